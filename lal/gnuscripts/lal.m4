@@ -1,6 +1,6 @@
 # lal.m4 - lal specific macros
 #
-# serial 25
+# serial 26
 
 AC_DEFUN([LAL_WITH_DEFAULT_DEBUG_LEVEL],[
   AC_ARG_WITH(
@@ -71,6 +71,17 @@ AC_DEFUN([LAL_ENABLE_PTHREAD_LOCK], [
   AC_SUBST([PTHREAD_LIBS])
 ])
 
+AC_DEFUN([LAL_ENABLE_INSTRUMENTATION],
+[AC_ARG_ENABLE(
+  [instrumentation],
+  AS_HELP_STRING([--enable-instrumentation],[compile in instrumentation counters and timers [default=no]]),
+  AS_CASE(["${enableval}"],
+    [yes],[AC_DEFINE([LAL_INSTRUMENTATION_ENABLED],[1],[Enable instrumentation counters and timers])],
+    [no],,
+    AC_MSG_ERROR([bad value for ${enableval} for --enable-instrumentation])
+  ),)
+])
+
 AC_DEFUN([LAL_INTEL_MKL_QTHREAD_WARNING],
 [echo "**************************************************************"
  echo "* LAL will be linked against the fake POSIX thread library!  *"
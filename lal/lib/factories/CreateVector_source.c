@@ -17,7 +17,7 @@
 VTYPE * XFUNC ( UINT4 length )
 {
   VTYPE * vector;
-  vector = LALMalloc( sizeof( *vector ) );
+  vector = XLALFactoryMalloc( sizeof( *vector ) );
   if ( ! vector )
     XLAL_ERROR_NULL( XLAL_ENOMEM );
   vector->length = length;
@@ -26,13 +26,13 @@ VTYPE * XFUNC ( UINT4 length )
   else /* non-zero length: allocate memory for data */
   {
 #ifdef USE_ALIGNED_MEMORY_ROUTINES
-    vector->data = XLALMallocAligned( length * sizeof( *vector->data ) );
+    vector->data = XLALFactoryMallocAligned( length * sizeof( *vector->data ) );
 #else
-    vector->data = LALMalloc( length * sizeof( *vector->data ) );
+    vector->data = XLALFactoryMalloc( length * sizeof( *vector->data ) );
 #endif
     if ( ! vector->data )
     {
-      LALFree( vector );
+      XLALFree( vector );
       XLAL_ERROR_NULL( XLAL_ENOMEM );
     }
   }
@@ -28,7 +28,7 @@ void XFUNC ( VTYPE *vector )
     XLALFree( vector->data );
 #endif
   vector->data = NULL; /* leave length non-zero to detect repeated frees */
-  LALFree( vector );
+  XLALFree( vector );
   return;
 }
 
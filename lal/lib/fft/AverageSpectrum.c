@@ -31,6 +31,10 @@
 #include <lal/Window.h>
 #include <lal/Date.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 static COMPLEX16 cabs2(COMPLEX16 z)
 {
 	double x = creal(z);
@@ -363,6 +367,280 @@ int XLALREAL8AverageSpectrumWelch(
   return 0;
 }
 
+/**
+ * Parallel variant of XLALREAL4AverageSpectrumWelch().
+ *
+ * The segments are divided between OpenMP threads (if LAL was built with
+ * OpenMP support); each thread computes the modified periodograms of its
+ * segments in its own workspace and accumulates them into its own partial
+ * sum, and the partial sums are added together at the end.  All threads
+ * execute the same FFT plan, which is safe as each transform uses its own
+ * input and output arrays.  Because the partial sums are added in a
+ * different order, the result may differ from that of
+ * XLALREAL4AverageSpectrumWelch() by rounding errors.
+ */
+int XLALREAL4AverageSpectrumWelchParallel(
+    REAL4FrequencySeries        *spectrum,
+    const REAL4TimeSeries       *tseries,
+    UINT4                        seglen,
+    UINT4                        stride,
+    const REAL4Window           *window,
+    const REAL4FFTPlan          *plan
+    )
+{
+  REAL4 *partial; /* partial sums, one per thread */
+  REAL4FrequencySeries meta; /* metadata of the spectrum, read by all threads */
+  REAL4FrequencySeries last; /* metadata of the periodogram of the last segment */
+  UINT4 nthreads = 1;
+  UINT4 numseg;
+  UINT4 nfailed = 0;
+  UINT4 thread;
+  UINT4 k;
+
+  if ( ! spectrum || ! tseries || ! plan )
+      XLAL_ERROR( XLAL_EFAULT );
+  if ( ! spectrum->data || ! tseries->data )
+      XLAL_ERROR( XLAL_EINVAL );
+  if ( tseries->deltaT <= 0.0 )
+      XLAL_ERROR( XLAL_EINVAL );
+
+  numseg = 1 + (tseries->data->length - seglen)/stride;
+
+  /* consistency check for lengths: make sure that the segments cover the
+   * data record completely */
+  if ( (numseg - 1)*stride + seglen != tseries->data->length )
+    XLAL_ERROR( XLAL_EBADLEN );
+  if ( spectrum->data->length != seglen/2 + 1 )
+    XLAL_ERROR( XLAL_EBADLEN );
+
+#ifdef _OPENMP
+  nthreads = omp_get_max_threads();
+  if ( nthreads > numseg )
+    nthreads = numseg;
+#endif
+
+  /* create partial sums */
+  partial = XLALCalloc( (size_t)nthreads * spectrum->data->length, sizeof( *partial ) );
+  if ( ! partial )
+    XLAL_ERROR( XLAL_ENOMEM );
+
+  /* the spectrum is not touched until all threads have finished */
+  meta = *spectrum;
+  last = meta;
+
+#pragma omp parallel num_threads(nthreads) private(k) reduction(+:nfailed)
+  {
+    REAL4FrequencySeries *work; /* workspace of this thread */
+    REAL4 *sum;                 /* partial sum of this thread */
+    INT4 seg;
+#ifdef _OPENMP
+    sum = partial + (size_t)omp_get_thread_num() * spectrum->data->length;
+#else
+    sum = partial;
+#endif
+
+    /* create frequency series data workspace */
+    work = XLALCreateREAL4FrequencySeries( meta.name, &meta.epoch, meta.f0, meta.deltaF, &meta.sampleUnits, meta.data->length );
+    if ( ! work )
+      ++nfailed;
+
+#pragma omp for schedule(static)
+    for ( seg = 0; seg < (INT4)numseg; ++seg )
+    {
+      REAL4Sequence sequence; /* working copy of input time series data */
+      REAL4TimeSeries tseriescopy; /* working copy of input time series */
+
+      if ( ! work )
+        continue;
+
+      /* construct local copy of this segment of the time series */
+      sequence.length = seglen;
+      sequence.data = tseries->data->data + seg * stride;
+      tseriescopy = *tseries;
+      tseriescopy.data = &sequence;
+
+      /* compute the modified periodogram */
+      if ( XLALREAL4ModifiedPeriodogram( work, &tseriescopy, window, plan ) == XLAL_FAILURE )
+      {
+        ++nfailed;
+        continue;
+      }
+
+      /* add the periodogram to the running sum */
+      for ( k = 0; k < spectrum->data->length; ++k )
+        sum[k] += work->data->data[k];
+
+      /* keep metadata from the last segment, as the serial version does */
+      if ( seg == (INT4)numseg - 1 )
+        last = *work;
+    }
+
+    XLALDestroyREAL4FrequencySeries( work );
+  }
+
+  if ( nfailed )
+  {
+    XLALFree( partial );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+
+  /* set metadata from the last segment */
+  spectrum->epoch       = last.epoch;
+  spectrum->f0          = last.f0;
+  spectrum->deltaF      = last.deltaF;
+  spectrum->sampleUnits = last.sampleUnits;
+
+  /* add partial sums and divide by the number of segments in average */
+  memcpy( spectrum->data->data, partial, spectrum->data->length * sizeof( *spectrum->data->data ) );
+  for ( thread = 1; thread < nthreads; ++thread )
+    for ( k = 0; k < spectrum->data->length; ++k )
+      spectrum->data->data[k] += partial[(size_t)thread * spectrum->data->length + k];
+  for ( k = 0; k < spectrum->data->length; ++k )
+    spectrum->data->data[k] /= numseg;
+
+  /* clean up */
+  XLALFree( partial );
+
+  return 0;
+}
+
+/**
+ * Parallel variant of XLALREAL8AverageSpectrumWelch().
+ *
+ * The segments are divided between OpenMP threads (if LAL was built with
+ * OpenMP support); each thread computes the modified periodograms of its
+ * segments in its own workspace and accumulates them into its own partial
+ * sum, and the partial sums are added together at the end.  All threads
+ * execute the same FFT plan, which is safe as each transform uses its own
+ * input and output arrays.  Because the partial sums are added in a
+ * different order, the result may differ from that of
+ * XLALREAL8AverageSpectrumWelch() by rounding errors.
+ */
+int XLALREAL8AverageSpectrumWelchParallel(
+    REAL8FrequencySeries        *spectrum,
+    const REAL8TimeSeries       *tseries,
+    UINT4                        seglen,
+    UINT4                        stride,
+    const REAL8Window           *window,
+    const REAL8FFTPlan          *plan
+    )
+{
+  REAL8 *partial; /* partial sums, one per thread */
+  REAL8FrequencySeries meta; /* metadata of the spectrum, read by all threads */
+  REAL8FrequencySeries last; /* metadata of the periodogram of the last segment */
+  UINT4 nthreads = 1;
+  UINT4 numseg;
+  UINT4 nfailed = 0;
+  UINT4 thread;
+  UINT4 k;
+
+  if ( ! spectrum || ! tseries || ! plan )
+      XLAL_ERROR( XLAL_EFAULT );
+  if ( ! spectrum->data || ! tseries->data )
+      XLAL_ERROR( XLAL_EINVAL );
+  if ( tseries->deltaT <= 0.0 )
+      XLAL_ERROR( XLAL_EINVAL );
+
+  numseg = 1 + (tseries->data->length - seglen)/stride;
+
+  /* consistency check for lengths: make sure that the segments cover the
+   * data record completely */
+  if ( (numseg - 1)*stride + seglen != tseries->data->length )
+    XLAL_ERROR( XLAL_EBADLEN );
+  if ( spectrum->data->length != seglen/2 + 1 )
+    XLAL_ERROR( XLAL_EBADLEN );
+
+#ifdef _OPENMP
+  nthreads = omp_get_max_threads();
+  if ( nthreads > numseg )
+    nthreads = numseg;
+#endif
+
+  /* create partial sums */
+  partial = XLALCalloc( (size_t)nthreads * spectrum->data->length, sizeof( *partial ) );
+  if ( ! partial )
+    XLAL_ERROR( XLAL_ENOMEM );
+
+  /* the spectrum is not touched until all threads have finished */
+  meta = *spectrum;
+  last = meta;
+
+#pragma omp parallel num_threads(nthreads) private(k) reduction(+:nfailed)
+  {
+    REAL8FrequencySeries *work; /* workspace of this thread */
+    REAL8 *sum;                 /* partial sum of this thread */
+    INT4 seg;
+#ifdef _OPENMP
+    sum = partial + (size_t)omp_get_thread_num() * spectrum->data->length;
+#else
+    sum = partial;
+#endif
+
+    /* create frequency series data workspace */
+    work = XLALCreateREAL8FrequencySeries( meta.name, &meta.epoch, meta.f0, meta.deltaF, &meta.sampleUnits, meta.data->length );
+    if ( ! work )
+      ++nfailed;
+
+#pragma omp for schedule(static)
+    for ( seg = 0; seg < (INT4)numseg; ++seg )
+    {
+      REAL8Sequence sequence; /* working copy of input time series data */
+      REAL8TimeSeries tseriescopy; /* working copy of input time series */
+
+      if ( ! work )
+        continue;
+
+      /* construct local copy of this segment of the time series */
+      sequence.length = seglen;
+      sequence.data = tseries->data->data + seg * stride;
+      tseriescopy = *tseries;
+      tseriescopy.data = &sequence;
+
+      /* compute the modified periodogram */
+      if ( XLALREAL8ModifiedPeriodogram( work, &tseriescopy, window, plan ) == XLAL_FAILURE )
+      {
+        ++nfailed;
+        continue;
+      }
+
+      /* add the periodogram to the running sum */
+      for ( k = 0; k < spectrum->data->length; ++k )
+        sum[k] += work->data->data[k];
+
+      /* keep metadata from the last segment, as the serial version does */
+      if ( seg == (INT4)numseg - 1 )
+        last = *work;
+    }
+
+    XLALDestroyREAL8FrequencySeries( work );
+  }
+
+  if ( nfailed )
+  {
+    XLALFree( partial );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+
+  /* set metadata from the last segment */
+  spectrum->epoch       = last.epoch;
+  spectrum->f0          = last.f0;
+  spectrum->deltaF      = last.deltaF;
+  spectrum->sampleUnits = last.sampleUnits;
+
+  /* add partial sums and divide by the number of segments in average */
+  memcpy( spectrum->data->data, partial, spectrum->data->length * sizeof( *spectrum->data->data ) );
+  for ( thread = 1; thread < nthreads; ++thread )
+    for ( k = 0; k < spectrum->data->length; ++k )
+      spectrum->data->data[k] += partial[(size_t)thread * spectrum->data->length + k];
+  for ( k = 0; k < spectrum->data->length; ++k )
+    spectrum->data->data[k] /= numseg;
+
+  /* clean up */
+  XLALFree( partial );
+
+  return 0;
+}
+
 
 /*
  *
@@ -406,6 +684,13 @@ static void median_cleanup_REAL4( REAL4FrequencySeries *work, UINT4 n )
   xlalErrno = saveErrno;
   return;
 }
+/* ...and release the memory arena of the workspace */
+static void median_cleanup_arena_REAL4( REAL4FrequencySeries *work, UINT4 n )
+{
+  median_cleanup_REAL4( work, n );
+  XLALPopMemoryArena();
+  return;
+}
 static void median_cleanup_REAL8( REAL8FrequencySeries *work, UINT4 n )
 {
   int saveErrno = xlalErrno;
@@ -417,6 +702,13 @@ static void median_cleanup_REAL8( REAL8FrequencySeries *work, UINT4 n )
   xlalErrno = saveErrno;
   return;
 }
+/* ...and release the memory arena of the workspace */
+static void median_cleanup_arena_REAL8( REAL8FrequencySeries *work, UINT4 n )
+{
+  median_cleanup_REAL8( work, n );
+  XLALPopMemoryArena();
+  return;
+}
 
 /* comparison for floating point numbers */
 static int compare_REAL4( const void *p1, const void *p2 )
@@ -476,16 +768,23 @@ int XLALREAL4AverageSpectrumMedian(
   if ( spectrum->data->length != seglen/2 + 1 )
     XLAL_ERROR( XLAL_EBADLEN );
 
-  /* create frequency series data workspaces */
+  /* create frequency series data workspaces, and the workspace of
+   * XLALREAL4ModifiedPeriodogram(), in a memory arena which holds them all
+   * and is released at once */
+  if ( XLALPushFactoryMemoryArena( numseg * ( spectrum->data->length * sizeof( REAL4 ) + 256 ) + seglen * sizeof( REAL4 ) + 256 ) < 0 )
+    XLAL_ERROR( XLAL_EFUNC );
   work = XLALCalloc( numseg, sizeof( *work ) );
   if ( ! work )
+  {
+    XLALPopMemoryArena();
     XLAL_ERROR( XLAL_ENOMEM );
+  }
   for ( seg = 0; seg < numseg; ++seg )
   {
     work[seg].data = XLALCreateREAL4Vector( spectrum->data->length );
     if ( ! work[seg].data )
     {
-      median_cleanup_REAL4( work, numseg ); /* cleanup */
+      median_cleanup_arena_REAL4( work, numseg ); /* cleanup */
       XLAL_ERROR( XLAL_EFUNC );
     }
   }
@@ -511,7 +810,7 @@ int XLALREAL4AverageSpectrumMedian(
     /* now check for failure of the XLAL routine */
     if ( code == XLAL_FAILURE )
     {
-      median_cleanup_REAL4( work, numseg ); /* cleanup */
+      median_cleanup_arena_REAL4( work, numseg ); /* cleanup */
       XLAL_ERROR( XLAL_EFUNC );
     }
   }
@@ -520,7 +819,7 @@ int XLALREAL4AverageSpectrumMedian(
   bin = XLALMalloc( numseg * sizeof( *bin ) );
   if ( ! bin )
   {
-    median_cleanup_REAL4( work, numseg ); /* cleanup */
+    median_cleanup_arena_REAL4( work, numseg ); /* cleanup */
     XLAL_ERROR( XLAL_ENOMEM );
   }
 
@@ -556,7 +855,7 @@ int XLALREAL4AverageSpectrumMedian(
 
   /* free the workspace data */
   XLALFree( bin );
-  median_cleanup_REAL4( work, numseg );
+  median_cleanup_arena_REAL4( work, numseg );
 
   return 0;
 }
@@ -604,16 +903,23 @@ int XLALREAL8AverageSpectrumMedian(
   if ( spectrum->data->length != seglen/2 + 1 )
     XLAL_ERROR( XLAL_EBADLEN );
 
-  /* create frequency series data workspaces */
+  /* create frequency series data workspaces, and the workspace of
+   * XLALREAL8ModifiedPeriodogram(), in a memory arena which holds them all
+   * and is released at once */
+  if ( XLALPushFactoryMemoryArena( numseg * ( spectrum->data->length * sizeof( REAL8 ) + 256 ) + seglen * sizeof( REAL8 ) + 256 ) < 0 )
+    XLAL_ERROR( XLAL_EFUNC );
   work = XLALCalloc( numseg, sizeof( *work ) );
   if ( ! work )
+  {
+    XLALPopMemoryArena();
     XLAL_ERROR( XLAL_ENOMEM );
+  }
   for ( seg = 0; seg < numseg; ++seg )
   {
     work[seg].data = XLALCreateREAL8Vector( spectrum->data->length );
     if ( ! work[seg].data )
     {
-      median_cleanup_REAL8( work, numseg ); /* cleanup */
+      median_cleanup_arena_REAL8( work, numseg ); /* cleanup */
       XLAL_ERROR( XLAL_EFUNC );
     }
   }
@@ -639,7 +945,7 @@ int XLALREAL8AverageSpectrumMedian(
     /* now check for failure of the XLAL routine */
     if ( code == XLAL_FAILURE )
     {
-      median_cleanup_REAL8( work, numseg ); /* cleanup */
+      median_cleanup_arena_REAL8( work, numseg ); /* cleanup */
       XLAL_ERROR( XLAL_EFUNC );
     }
   }
@@ -648,7 +954,7 @@ int XLALREAL8AverageSpectrumMedian(
   bin = XLALMalloc( numseg * sizeof( *bin ) );
   if ( ! bin )
   {
-    median_cleanup_REAL8( work, numseg ); /* cleanup */
+    median_cleanup_arena_REAL8( work, numseg ); /* cleanup */
     XLAL_ERROR( XLAL_ENOMEM );
   }
 
@@ -684,6 +990,278 @@ int XLALREAL8AverageSpectrumMedian(
 
   /* free the workspace data */
   XLALFree( bin );
+  median_cleanup_arena_REAL8( work, numseg );
+
+  return 0;
+}
+
+/**
+ * Parallel variant of XLALREAL4AverageSpectrumMedian().
+ *
+ * The modified periodograms of the segments, and then the medians of the
+ * frequency bins, are computed by OpenMP threads (if LAL was built with
+ * OpenMP support), each in its own workspace.  All threads execute the same
+ * FFT plan, which is safe as each transform uses its own input and output
+ * arrays.  The result is identical to that of
+ * XLALREAL4AverageSpectrumMedian().
+ */
+int XLALREAL4AverageSpectrumMedianParallel(
+    REAL4FrequencySeries        *spectrum,
+    const REAL4TimeSeries       *tseries,
+    UINT4                        seglen,
+    UINT4                        stride,
+    const REAL4Window           *window,
+    const REAL4FFTPlan          *plan
+    )
+{
+  REAL4FrequencySeries *work; /* array of frequency series */
+  REAL4 biasfac; /* median bias factor */
+  REAL4 normfac; /* normalization factor */
+  UINT4 reclen; /* length of entire data record */
+  UINT4 numseg;
+  UINT4 nfailed = 0;
+  INT4 seg;
+  INT4 k;
+
+  if ( ! spectrum || ! tseries || ! plan )
+      XLAL_ERROR( XLAL_EFAULT );
+  if ( ! spectrum->data || ! tseries->data )
+      XLAL_ERROR( XLAL_EINVAL );
+  if ( tseries->deltaT <= 0.0 )
+      XLAL_ERROR( XLAL_EINVAL );
+
+  reclen = tseries->data->length;
+  numseg = 1 + (reclen - seglen)/stride;
+
+  /* consistency check for lengths: make sure that the segments cover the
+   * data record completely */
+  if ( (numseg - 1)*stride + seglen != reclen )
+    XLAL_ERROR( XLAL_EBADLEN );
+  if ( spectrum->data->length != seglen/2 + 1 )
+    XLAL_ERROR( XLAL_EBADLEN );
+
+  /* create frequency series data workspaces */
+  work = XLALCalloc( numseg, sizeof( *work ) );
+  if ( ! work )
+    XLAL_ERROR( XLAL_ENOMEM );
+  for ( seg = 0; seg < (INT4)numseg; ++seg )
+  {
+    work[seg].data = XLALCreateREAL4Vector( spectrum->data->length );
+    if ( ! work[seg].data )
+    {
+      median_cleanup_REAL4( work, numseg ); /* cleanup */
+      XLAL_ERROR( XLAL_EFUNC );
+    }
+  }
+
+  /* compute the modified periodograms */
+#pragma omp parallel for schedule(static) reduction(+:nfailed)
+  for ( seg = 0; seg < (INT4)numseg; ++seg )
+  {
+    REAL4Sequence sequence; /* working copy of input time series data */
+    REAL4TimeSeries tseriescopy; /* working copy of input time series */
+
+    /* construct local copy of this segment of the time series */
+    sequence.length = seglen;
+    sequence.data = tseries->data->data + seg * stride;
+    tseriescopy = *tseries;
+    tseriescopy.data = &sequence;
+
+    if ( XLALREAL4ModifiedPeriodogram( work + seg, &tseriescopy, window, plan ) == XLAL_FAILURE )
+      ++nfailed;
+  }
+  if ( nfailed )
+  {
+    median_cleanup_REAL4( work, numseg ); /* cleanup */
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+
+  /* compute median bias factor */
+  biasfac = XLALMedianBias( numseg );
+
+  /* normaliztion takes into account bias */
+  normfac = 1.0 / biasfac;
+
+  /* now loop over frequency bins and compute the median */
+#pragma omp parallel private(seg) reduction(+:nfailed)
+  {
+    /* create array to hold a particular frequency bin data */
+    REAL4 *bin = XLALMalloc( numseg * sizeof( *bin ) );
+    if ( ! bin )
+      ++nfailed;
+
+#pragma omp for schedule(static)
+    for ( k = 0; k < (INT4)spectrum->data->length; ++k )
+    {
+      if ( ! bin )
+        continue;
+
+      /* assign array of segment values to bin array for this freq bin */
+      for ( seg = 0; seg < (INT4)numseg; ++seg )
+        bin[seg] = work[seg].data->data[k];
+
+      /* sort them and find median */
+      qsort( bin, numseg, sizeof( *bin ), compare_REAL4 );
+      if ( numseg % 2 ) /* odd number of evens */
+        spectrum->data->data[k] = bin[numseg/2];
+      else /* even number... take average */
+        spectrum->data->data[k] = 0.5*(bin[numseg/2-1] + bin[numseg/2]);
+
+      /* remove median bias */
+      spectrum->data->data[k] *= normfac;
+    }
+
+    XLALFree( bin );
+  }
+  if ( nfailed )
+  {
+    median_cleanup_REAL4( work, numseg ); /* cleanup */
+    XLAL_ERROR( XLAL_ENOMEM );
+  }
+
+  /* set metadata */
+  spectrum->epoch       = work->epoch;
+  spectrum->f0          = work->f0;
+  spectrum->deltaF      = work->deltaF;
+  spectrum->sampleUnits = work->sampleUnits;
+
+  /* free the workspace data */
+  median_cleanup_REAL4( work, numseg );
+
+  return 0;
+}
+
+/**
+ * Parallel variant of XLALREAL8AverageSpectrumMedian().
+ *
+ * The modified periodograms of the segments, and then the medians of the
+ * frequency bins, are computed by OpenMP threads (if LAL was built with
+ * OpenMP support), each in its own workspace.  All threads execute the same
+ * FFT plan, which is safe as each transform uses its own input and output
+ * arrays.  The result is identical to that of
+ * XLALREAL8AverageSpectrumMedian().
+ */
+int XLALREAL8AverageSpectrumMedianParallel(
+    REAL8FrequencySeries        *spectrum,
+    const REAL8TimeSeries       *tseries,
+    UINT4                        seglen,
+    UINT4                        stride,
+    const REAL8Window           *window,
+    const REAL8FFTPlan          *plan
+    )
+{
+  REAL8FrequencySeries *work; /* array of frequency series */
+  REAL8 biasfac; /* median bias factor */
+  REAL8 normfac; /* normalization factor */
+  UINT4 reclen; /* length of entire data record */
+  UINT4 numseg;
+  UINT4 nfailed = 0;
+  INT4 seg;
+  INT4 k;
+
+  if ( ! spectrum || ! tseries || ! plan )
+      XLAL_ERROR( XLAL_EFAULT );
+  if ( ! spectrum->data || ! tseries->data )
+      XLAL_ERROR( XLAL_EINVAL );
+  if ( tseries->deltaT <= 0.0 )
+      XLAL_ERROR( XLAL_EINVAL );
+
+  reclen = tseries->data->length;
+  numseg = 1 + (reclen - seglen)/stride;
+
+  /* consistency check for lengths: make sure that the segments cover the
+   * data record completely */
+  if ( (numseg - 1)*stride + seglen != reclen )
+    XLAL_ERROR( XLAL_EBADLEN );
+  if ( spectrum->data->length != seglen/2 + 1 )
+    XLAL_ERROR( XLAL_EBADLEN );
+
+  /* create frequency series data workspaces */
+  work = XLALCalloc( numseg, sizeof( *work ) );
+  if ( ! work )
+    XLAL_ERROR( XLAL_ENOMEM );
+  for ( seg = 0; seg < (INT4)numseg; ++seg )
+  {
+    work[seg].data = XLALCreateREAL8Vector( spectrum->data->length );
+    if ( ! work[seg].data )
+    {
+      median_cleanup_REAL8( work, numseg ); /* cleanup */
+      XLAL_ERROR( XLAL_EFUNC );
+    }
+  }
+
+  /* compute the modified periodograms */
+#pragma omp parallel for schedule(static) reduction(+:nfailed)
+  for ( seg = 0; seg < (INT4)numseg; ++seg )
+  {
+    REAL8Sequence sequence; /* working copy of input time series data */
+    REAL8TimeSeries tseriescopy; /* working copy of input time series */
+
+    /* construct local copy of this segment of the time series */
+    sequence.length = seglen;
+    sequence.data = tseries->data->data + seg * stride;
+    tseriescopy = *tseries;
+    tseriescopy.data = &sequence;
+
+    if ( XLALREAL8ModifiedPeriodogram( work + seg, &tseriescopy, window, plan ) == XLAL_FAILURE )
+      ++nfailed;
+  }
+  if ( nfailed )
+  {
+    median_cleanup_REAL8( work, numseg ); /* cleanup */
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+
+  /* compute median bias factor */
+  biasfac = XLALMedianBias( numseg );
+
+  /* normaliztion takes into account bias */
+  normfac = 1.0 / biasfac;
+
+  /* now loop over frequency bins and compute the median */
+#pragma omp parallel private(seg) reduction(+:nfailed)
+  {
+    /* create array to hold a particular frequency bin data */
+    REAL8 *bin = XLALMalloc( numseg * sizeof( *bin ) );
+    if ( ! bin )
+      ++nfailed;
+
+#pragma omp for schedule(static)
+    for ( k = 0; k < (INT4)spectrum->data->length; ++k )
+    {
+      if ( ! bin )
+        continue;
+
+      /* assign array of segment values to bin array for this freq bin */
+      for ( seg = 0; seg < (INT4)numseg; ++seg )
+        bin[seg] = work[seg].data->data[k];
+
+      /* sort them and find median */
+      qsort( bin, numseg, sizeof( *bin ), compare_REAL8 );
+      if ( numseg % 2 ) /* odd number of evens */
+        spectrum->data->data[k] = bin[numseg/2];
+      else /* even number... take average */
+        spectrum->data->data[k] = 0.5*(bin[numseg/2-1] + bin[numseg/2]);
+
+      /* remove median bias */
+      spectrum->data->data[k] *= normfac;
+    }
+
+    XLALFree( bin );
+  }
+  if ( nfailed )
+  {
+    median_cleanup_REAL8( work, numseg ); /* cleanup */
+    XLAL_ERROR( XLAL_ENOMEM );
+  }
+
+  /* set metadata */
+  spectrum->epoch       = work->epoch;
+  spectrum->f0          = work->f0;
+  spectrum->deltaF      = work->deltaF;
+  spectrum->sampleUnits = work->sampleUnits;
+
+  /* free the workspace data */
   median_cleanup_REAL8( work, numseg );
 
   return 0;
@@ -1898,6 +2476,424 @@ int XLALPSDRegressorSetPSD(LALPSDRegressor *r, const REAL8FrequencySeries *psd,
 }
 
 
+/*
+ *
+ * Sliding Median and Median-Mean PSD
+ *
+ */
+
+
+/*
+ * The sliding PSD keeps, for each frequency bin (and, for the median-mean
+ * method, separately for the segments with even and odd sequence numbers),
+ * the values of the bin in the current segments in a pair of heaps:  a
+ * max-heap "lo" holding the smaller half of the values and a min-heap "hi"
+ * holding the larger half, with lo holding one element more than hi if the
+ * number of values is odd.  The median is then found at the top(s) of the
+ * heaps.  The heaps store the ring-buffer slots of the segments, and the
+ * position of each slot in its heap is recorded so that the value of the
+ * oldest segment can be removed from anywhere in the heap.  Adding or
+ * removing a segment therefore costs O(log n) per bin, and retrieving the
+ * PSD O(1) per bin.
+ */
+
+struct tagLALSlidingPSD {
+  unsigned max_segments;	/* capacity of the ring buffer */
+  unsigned n_classes;		/* 1 for median, 2 for median-mean */
+  unsigned n_segments;		/* number of segments currently held */
+  unsigned long first;		/* sequence number of oldest segment */
+  unsigned length;		/* number of frequency bins */
+  REAL8 f0;
+  REAL8 deltaF;
+  LALUnit sampleUnits;
+  LIGOTimeGPS *epochs;		/* [max_segments] epoch of each slot */
+  REAL8 *values;		/* [length][max_segments] bin values */
+  INT4 *heap_pos;		/* [length][max_segments] >= 0: index in lo,
+				 * < 0: -1 - index in hi */
+  UINT4 *heaps;			/* [n_classes][length][2][heap_cap] slots */
+  UINT4 *heap_len;		/* [n_classes][length][2] heap sizes */
+  unsigned heap_cap;
+  REAL8FrequencySeries *periodogram;	/* workspace for segments */
+};
+
+/* helpers to address the heaps of class c and bin k */
+#define SLIDING_PSD_HEAP(s, c, k, h) ((s)->heaps + ((((size_t) (c) * (s)->length + (k)) * 2 + (h)) * (s)->heap_cap))
+#define SLIDING_PSD_HEAP_LEN(s, c, k, h) ((s)->heap_len[(((size_t) (c) * (s)->length + (k)) * 2 + (h))])
+#define SLIDING_PSD_LO 0
+#define SLIDING_PSD_HI 1
+
+/* is heap element a "before" (closer to the top than) b? */
+static int sliding_psd_before(const REAL8 *v, int h, UINT4 a, UINT4 b)
+{
+  return h == SLIDING_PSD_LO ? v[a] > v[b] : v[a] < v[b];
+}
+
+static void sliding_psd_set(UINT4 *heap, INT4 *pos, int h, UINT4 i, UINT4 slot)
+{
+  heap[i] = slot;
+  pos[slot] = h == SLIDING_PSD_LO ? (INT4) i : -1 - (INT4) i;
+}
+
+static void sliding_psd_sift_up(UINT4 *heap, INT4 *pos, const REAL8 *v, int h, UINT4 i)
+{
+  UINT4 slot = heap[i];
+  while (i > 0) {
+    UINT4 parent = (i - 1) / 2;
+    if (!sliding_psd_before(v, h, slot, heap[parent]))
+      break;
+    sliding_psd_set(heap, pos, h, i, heap[parent]);
+    i = parent;
+  }
+  sliding_psd_set(heap, pos, h, i, slot);
+}
+
+static void sliding_psd_sift_down(UINT4 *heap, INT4 *pos, const REAL8 *v, int h, UINT4 n, UINT4 i)
+{
+  UINT4 slot = heap[i];
+  for (;;) {
+    UINT4 child = 2 * i + 1;
+    if (child >= n)
+      break;
+    if (child + 1 < n && sliding_psd_before(v, h, heap[child + 1], heap[child]))
+      child++;
+    if (!sliding_psd_before(v, h, heap[child], slot))
+      break;
+    sliding_psd_set(heap, pos, h, i, heap[child]);
+    i = child;
+  }
+  sliding_psd_set(heap, pos, h, i, slot);
+}
+
+static void sliding_psd_heap_push(UINT4 *heap, UINT4 *n, INT4 *pos, const REAL8 *v, int h, UINT4 slot)
+{
+  sliding_psd_set(heap, pos, h, *n, slot);
+  sliding_psd_sift_up(heap, pos, v, h, (*n)++);
+}
+
+static UINT4 sliding_psd_heap_remove(UINT4 *heap, UINT4 *n, INT4 *pos, const REAL8 *v, int h, UINT4 i)
+{
+  UINT4 slot = heap[i];
+  if (i != --(*n)) {
+    sliding_psd_set(heap, pos, h, i, heap[*n]);
+    sliding_psd_sift_up(heap, pos, v, h, i);
+    sliding_psd_sift_down(heap, pos, v, h, *n, pos[heap[i]] >= 0 ? (UINT4) pos[heap[i]] : (UINT4) (-1 - pos[heap[i]]));
+  }
+  return slot;
+}
+
+/* restore |lo| == |hi| or |lo| == |hi| + 1 */
+static void sliding_psd_rebalance(UINT4 *lo, UINT4 *nlo, UINT4 *hi, UINT4 *nhi, INT4 *pos, const REAL8 *v)
+{
+  if (*nlo > *nhi + 1)
+    sliding_psd_heap_push(hi, nhi, pos, v, SLIDING_PSD_HI, sliding_psd_heap_remove(lo, nlo, pos, v, SLIDING_PSD_LO, 0));
+  else if (*nhi > *nlo)
+    sliding_psd_heap_push(lo, nlo, pos, v, SLIDING_PSD_LO, sliding_psd_heap_remove(hi, nhi, pos, v, SLIDING_PSD_HI, 0));
+}
+
+static void sliding_psd_insert(LALSlidingPSD *s, unsigned c, unsigned k, UINT4 slot)
+{
+  UINT4 *lo = SLIDING_PSD_HEAP(s, c, k, SLIDING_PSD_LO);
+  UINT4 *hi = SLIDING_PSD_HEAP(s, c, k, SLIDING_PSD_HI);
+  UINT4 *nlo = &SLIDING_PSD_HEAP_LEN(s, c, k, SLIDING_PSD_LO);
+  UINT4 *nhi = &SLIDING_PSD_HEAP_LEN(s, c, k, SLIDING_PSD_HI);
+  INT4 *pos = s->heap_pos + (size_t) k * s->max_segments;
+  const REAL8 *v = s->values + (size_t) k * s->max_segments;
+
+  if (*nlo == 0 || v[slot] <= v[lo[0]])
+    sliding_psd_heap_push(lo, nlo, pos, v, SLIDING_PSD_LO, slot);
+  else
+    sliding_psd_heap_push(hi, nhi, pos, v, SLIDING_PSD_HI, slot);
+  sliding_psd_rebalance(lo, nlo, hi, nhi, pos, v);
+}
+
+static void sliding_psd_delete(LALSlidingPSD *s, unsigned c, unsigned k, UINT4 slot)
+{
+  UINT4 *lo = SLIDING_PSD_HEAP(s, c, k, SLIDING_PSD_LO);
+  UINT4 *hi = SLIDING_PSD_HEAP(s, c, k, SLIDING_PSD_HI);
+  UINT4 *nlo = &SLIDING_PSD_HEAP_LEN(s, c, k, SLIDING_PSD_LO);
+  UINT4 *nhi = &SLIDING_PSD_HEAP_LEN(s, c, k, SLIDING_PSD_HI);
+  INT4 *pos = s->heap_pos + (size_t) k * s->max_segments;
+  const REAL8 *v = s->values + (size_t) k * s->max_segments;
+
+  if (pos[slot] >= 0)
+    sliding_psd_heap_remove(lo, nlo, pos, v, SLIDING_PSD_LO, pos[slot]);
+  else
+    sliding_psd_heap_remove(hi, nhi, pos, v, SLIDING_PSD_HI, -1 - pos[slot]);
+  sliding_psd_rebalance(lo, nlo, hi, nhi, pos, v);
+}
+
+static REAL8 sliding_psd_median(const LALSlidingPSD *s, unsigned c, unsigned k)
+{
+  const UINT4 *lo = SLIDING_PSD_HEAP(s, c, k, SLIDING_PSD_LO);
+  const UINT4 *hi = SLIDING_PSD_HEAP(s, c, k, SLIDING_PSD_HI);
+  const REAL8 *v = s->values + (size_t) k * s->max_segments;
+  /* same arithmetic as the sort-based median estimators */
+  if (SLIDING_PSD_HEAP_LEN(s, c, k, SLIDING_PSD_LO) > SLIDING_PSD_HEAP_LEN(s, c, k, SLIDING_PSD_HI))
+    return v[lo[0]];
+  return 0.5*(v[lo[0]] + v[hi[0]]);
+}
+
+/**
+ * Allocate and initialize a LALSlidingPSD object.
+ *
+ * The LALSlidingPSD object computes the median (if median_mean is zero)
+ * or median-mean (otherwise) average power spectrum of a sliding set of up
+ * to max_segments segments, with the same normalization as
+ * XLALREAL8AverageSpectrumMedian() and XLALREAL8AverageSpectrumMedianMean()
+ * respectively.  Segments are added with XLALSlidingPSDPush() or
+ * XLALSlidingPSDPushSegment(); once max_segments segments are held, adding
+ * a segment discards the oldest one.  The oldest segment can also be
+ * discarded explicitly with XLALSlidingPSDPop().  For the median-mean
+ * method successive segments are alternately counted as "even" and "odd"
+ * segments, so they should be spaced by the same stride.
+ *
+ * Instead of sorting the values of each frequency bin whenever the
+ * spectrum is needed, the values are kept ordered as segments come and go,
+ * so adding or removing a segment costs O(log max_segments) per frequency
+ * bin, and XLALSlidingPSDGetPSD() O(1) per frequency bin.
+ */
+LALSlidingPSD *XLALSlidingPSDNew(unsigned max_segments, int median_mean)
+{
+  LALSlidingPSD *new;
+
+  /* median-mean needs an even and an odd segment at least */
+  if(max_segments < 1 || (median_mean && max_segments < 2))
+    XLAL_ERROR_NULL(XLAL_EINVAL);
+
+  new = XLALCalloc(1, sizeof(*new));
+  if(!new)
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  new->max_segments = max_segments;
+  new->n_classes = median_mean ? 2 : 1;
+  new->heap_cap = median_mean ? (max_segments + 1) / 2 : max_segments;
+  new->epochs = XLALCalloc(max_segments, sizeof(*new->epochs));
+  if(!new->epochs)
+  {
+    XLALSlidingPSDFree(new);
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  }
+
+  return new;
+}
+
+/**
+ * Reset a LALSlidingPSD object to the newly-allocated state, discarding
+ * all segments and the frequency series parameters.
+ */
+void XLALSlidingPSDReset(LALSlidingPSD *s)
+{
+  XLALFree(s->values);
+  XLALFree(s->heap_pos);
+  XLALFree(s->heaps);
+  XLALFree(s->heap_len);
+  XLALDestroyREAL8FrequencySeries(s->periodogram);
+  s->values = NULL;
+  s->heap_pos = NULL;
+  s->heaps = NULL;
+  s->heap_len = NULL;
+  s->periodogram = NULL;
+  s->n_segments = 0;
+  s->first = 0;
+  s->length = 0;
+}
+
+/**
+ * Free all memory associated with a LALSlidingPSD object.
+ */
+void XLALSlidingPSDFree(LALSlidingPSD *s)
+{
+  if(s)
+  {
+    XLALSlidingPSDReset(s);
+    XLALFree(s->epochs);
+  }
+  XLALFree(s);
+}
+
+/**
+ * Return the number of segments currently held by a LALSlidingPSD object,
+ * or 0 with #XLAL_EFAULT set if s is NULL.
+ */
+unsigned XLALSlidingPSDGetNSegments(const LALSlidingPSD *s)
+{
+  if(!s)
+    XLAL_ERROR_VAL(0, XLAL_EFAULT);
+  return s->n_segments;
+}
+
+/**
+ * Discard the oldest segment held by a LALSlidingPSD object.
+ */
+int XLALSlidingPSDPop(LALSlidingPSD *s)
+{
+  unsigned c;
+  UINT4 slot;
+  unsigned k;
+
+  if(!s)
+    XLAL_ERROR(XLAL_EFAULT);
+  if(!s->n_segments)
+    XLAL_ERROR(XLAL_EDATA, "no segments to remove");
+
+  c = s->first % s->n_classes;
+  slot = s->first % s->max_segments;
+  for(k = 0; k < s->length; k++)
+    sliding_psd_delete(s, c, k, slot);
+
+  s->first++;
+  s->n_segments--;
+  return 0;
+}
+
+/**
+ * Add the modified periodogram of a segment, e.g.\ as computed by
+ * XLALREAL8ModifiedPeriodogram(), to a LALSlidingPSD object.  If the
+ * object already holds max_segments segments, the oldest one is discarded.
+ * The periodogram data is copied.
+ *
+ * The first periodogram added sets the frequency series parameters; all
+ * further periodograms must have the same f0, deltaF, length and sample
+ * units, until XLALSlidingPSDReset() is called.
+ */
+int XLALSlidingPSDPush(LALSlidingPSD *s, const REAL8FrequencySeries *periodogram)
+{
+  unsigned long seq;
+  unsigned c;
+  UINT4 slot;
+  unsigned k;
+
+  if(!s || !periodogram)
+    XLAL_ERROR(XLAL_EFAULT);
+  if(!periodogram->data || !periodogram->data->length)
+    XLAL_ERROR(XLAL_EINVAL);
+
+  if(!s->length)
+  {
+    /* first segment: allocate per-bin storage */
+    size_t n = (size_t) periodogram->data->length * s->max_segments;
+    size_t nheap = (size_t) s->n_classes * periodogram->data->length * 2;
+    s->values = XLALMalloc(n * sizeof(*s->values));
+    s->heap_pos = XLALMalloc(n * sizeof(*s->heap_pos));
+    s->heaps = XLALMalloc(nheap * s->heap_cap * sizeof(*s->heaps));
+    s->heap_len = XLALCalloc(nheap, sizeof(*s->heap_len));
+    if(!s->values || !s->heap_pos || !s->heaps || !s->heap_len)
+    {
+      XLALSlidingPSDReset(s);
+      XLAL_ERROR(XLAL_ENOMEM);
+    }
+    s->length = periodogram->data->length;
+    s->f0 = periodogram->f0;
+    s->deltaF = periodogram->deltaF;
+    s->sampleUnits = periodogram->sampleUnits;
+  }
+  else if((periodogram->f0 != s->f0) || (periodogram->deltaF != s->deltaF) || (periodogram->data->length != s->length) || XLALUnitCompare(&periodogram->sampleUnits, &s->sampleUnits))
+  {
+    XLALPrintError("%s(): input parameter mismatch", __func__);
+    XLAL_ERROR(XLAL_EDATA);
+  }
+
+  /* make room */
+  if(s->n_segments == s->max_segments)
+    if(XLALSlidingPSDPop(s) < 0)
+      XLAL_ERROR(XLAL_EFUNC);
+
+  seq = s->first + s->n_segments;
+  c = seq % s->n_classes;
+  slot = seq % s->max_segments;
+  s->epochs[slot] = periodogram->epoch;
+  for(k = 0; k < s->length; k++)
+  {
+    s->values[(size_t) k * s->max_segments + slot] = periodogram->data->data[k];
+    sliding_psd_insert(s, c, k, slot);
+  }
+
+  s->n_segments++;
+  return 0;
+}
+
+/**
+ * Compute the modified periodogram of a time series segment and add it to
+ * a LALSlidingPSD object with XLALSlidingPSDPush().
+ */
+int XLALSlidingPSDPushSegment(LALSlidingPSD *s, const REAL8TimeSeries *segment, const REAL8Window *window, const REAL8FFTPlan *plan)
+{
+  if(!s || !segment || !plan)
+    XLAL_ERROR(XLAL_EFAULT);
+  if(!segment->data)
+    XLAL_ERROR(XLAL_EINVAL);
+
+  if(!s->periodogram || s->periodogram->data->length != segment->data->length/2 + 1)
+  {
+    XLALDestroyREAL8FrequencySeries(s->periodogram);
+    s->periodogram = XLALCreateREAL8FrequencySeries(segment->name, &segment->epoch, segment->f0, 0.0, &lalDimensionlessUnit, segment->data->length/2 + 1);
+    if(!s->periodogram)
+      XLAL_ERROR(XLAL_EFUNC);
+  }
+
+  if(XLALREAL8ModifiedPeriodogram(s->periodogram, segment, window, plan) < 0)
+    XLAL_ERROR(XLAL_EFUNC);
+  if(XLALSlidingPSDPush(s, s->periodogram) < 0)
+    XLAL_ERROR(XLAL_EFUNC);
+
+  return 0;
+}
+
+/**
+ * Compute the median (or median-mean) average power spectrum of the
+ * segments currently held by a LALSlidingPSD object.  The spectrum must
+ * have the same length as the periodograms; its epoch is set to the epoch
+ * of the oldest segment.  For the median-mean method the number of
+ * segments must be even.
+ */
+int XLALSlidingPSDGetPSD(REAL8FrequencySeries *spectrum, const LALSlidingPSD *s)
+{
+  REAL8 normfac;
+  unsigned k;
+
+  if(!spectrum || !s)
+    XLAL_ERROR(XLAL_EFAULT);
+  if(!spectrum->data)
+    XLAL_ERROR(XLAL_EINVAL);
+  if(!s->n_segments)
+  {
+    XLALPrintError("%s: not initialized", __func__);
+    XLAL_ERROR(XLAL_EDATA);
+  }
+  if(spectrum->data->length != s->length)
+    XLAL_ERROR(XLAL_EBADLEN);
+
+  if(s->n_classes == 1)
+  {
+    /* normaliztion takes into account bias */
+    normfac = 1.0 / XLALMedianBias(s->n_segments);
+    for(k = 0; k < s->length; k++)
+    {
+      spectrum->data->data[k] = sliding_psd_median(s, 0, k);
+      spectrum->data->data[k] *= normfac;
+    }
+  }
+  else
+  {
+    /* for median-mean to work, the number of segments must be even */
+    if(s->n_segments % 2)
+      XLAL_ERROR(XLAL_EBADLEN);
+    /* normaliztion takes into account bias and a factor of two from
+     * averaging the even and the odd */
+    normfac = 1.0 / (2.0 * XLALMedianBias(s->n_segments / 2));
+    for(k = 0; k < s->length; k++)
+      spectrum->data->data[k] = normfac * (sliding_psd_median(s, 0, k) + sliding_psd_median(s, 1, k));
+  }
+
+  /* set metadata */
+  spectrum->epoch       = s->epochs[s->first % s->max_segments];
+  spectrum->f0          = s->f0;
+  spectrum->deltaF      = s->deltaF;
+  spectrum->sampleUnits = s->sampleUnits;
+
+  return 0;
+}
+
+
 /**
  * Compute the two-point spectral correlation function for a whitened
  * frequency series from the window applied to the original time series.
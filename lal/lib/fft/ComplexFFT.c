@@ -27,6 +27,7 @@
 #include <lal/ComplexFFT.h>
 #include <lal/FFTWMutex.h>
 #include <lal/LALConfig.h> /* Needed to know whether aligning memory */
+#include <lal/LALInstrument.h>
 #include <lal/LALMalloc.h>
 #include <lal/XLALError.h>
 
@@ -127,6 +128,9 @@ tagCOMPLEX8FFTPlan
   INT4       sign; /**< sign in transform exponential, -1 for forward, +1 for reverse */
   UINT4      size; /**< length of the complex data vector for this plan */
   fftwf_plan plan; /**< the FFTW plan */
+  int        measurelvl; /**< measurement level with which the plan was created */
+  UINT4      refcount; /**< number of owners of this plan, which is shared through the plan cache */
+  struct tagCOMPLEX8FFTPlan *next; /**< next plan in the plan cache */
 };
 
 /**
@@ -138,6 +142,9 @@ tagCOMPLEX16FFTPlan
   INT4       sign; /**< sign in transform exponential, -1 for forward, +1 for reverse */
   UINT4      size; /**< length of the complex data vector for this plan */
   fftw_plan  plan; /**< the FFTW plan */
+  int        measurelvl; /**< measurement level with which the plan was created */
+  UINT4      refcount; /**< number of owners of this plan, which is shared through the plan cache */
+  struct tagCOMPLEX16FFTPlan *next; /**< next plan in the plan cache */
 };
 
 /* single- and double-precision routines */
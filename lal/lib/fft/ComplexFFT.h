@@ -43,6 +43,11 @@ extern "C" {
  * Perform complex-to-complex fast Fourier transforms of vectors using the
  * package FFTW \cite fj_1998 .
  *
+ * As for real FFTs, plans with the same size, direction and measurement
+ * level are shared, and FFTW wisdom may be persisted between runs through the
+ * environment variables <tt>LAL_FFTWF_WISDOM_FILE</tt> and
+ * <tt>LAL_FFTW_WISDOM_FILE</tt>; see XLALFFTWImportWisdom().
+ *
  */
 /** @{ */
 
@@ -17,13 +17,30 @@
 *  MA  02110-1301  USA
 */
 
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
 #include <lal/FFTWMutex.h>
+#include <lal/XLALError.h>
+
+#ifdef LAL_FFTW3_ENABLED
+#include <unistd.h>
+#include <sys/stat.h>
+#include <fftw3.h>
+#endif
 
 #if defined(LAL_PTHREAD_LOCK) && defined(LAL_FFTW3_ENABLED)
 #include <pthread.h>
 static pthread_mutex_t lalFFTWMutex = PTHREAD_MUTEX_INITIALIZER;
 #endif
 
+#ifdef LAL_FFTW3_ENABLED
+/* set once wisdom has been imported, and the export at exit registered */
+static int lalFFTWWisdomImported = 0;
+#endif
+
 
 /**
  * Aquire LAL's FFTW wisdom lock.  This lock must be held when creating or
@@ -55,3 +72,129 @@ void XLALFFTWWisdomUnlock(void)
     pthread_mutex_unlock( &lalFFTWMutex );
 #endif
 }
+
+
+#ifdef LAL_FFTW3_ENABLED
+
+/* write wisdom to a temporary file, then rename it into place, so that
+ * concurrent processes sharing a wisdom file never see a partial file;
+ * the temporary file is given the permissions of the file it replaces, or
+ * those of a newly-created file if there is none, since mkstemp() creates
+ * it readable only by its owner */
+static int export_wisdom_to_filename(const char *filename, int single)
+{
+    char tmpname[FILENAME_MAX];
+    struct stat st;
+    mode_t mode;
+    if (snprintf(tmpname, sizeof(tmpname), "%s.XXXXXX", filename) >= (int) sizeof(tmpname))
+        XLAL_ERROR(XLAL_EINVAL, "Wisdom file name '%s' is too long", filename);
+    if (stat(filename, &st) == 0) {
+        mode = st.st_mode & 07777;
+    } else {
+        mode_t mask = umask(0);
+        umask(mask);
+        mode = 0666 & ~mask;
+    }
+    int fd = mkstemp(tmpname);
+    if (fd < 0) {
+        XLAL_ERROR(XLAL_EIO, "Could not create temporary wisdom file for '%s'", filename);
+    }
+    if (fchmod(fd, mode) != 0) {
+        close(fd);
+        unlink(tmpname);
+        XLAL_ERROR(XLAL_EIO, "Could not set permissions of temporary wisdom file for '%s'", filename);
+    }
+    FILE *fp = fdopen(fd, "w");
+    if (!fp) {
+        close(fd);
+        unlink(tmpname);
+        XLAL_ERROR(XLAL_EIO, "Could not open temporary wisdom file for '%s'", filename);
+    }
+    if (single)
+        fftwf_export_wisdom_to_file(fp);
+    else
+        fftw_export_wisdom_to_file(fp);
+    if (fclose(fp) != 0 || rename(tmpname, filename) != 0) {
+        unlink(tmpname);
+        XLAL_ERROR(XLAL_EIO, "Could not write wisdom file '%s'", filename);
+    }
+    return 0;
+}
+
+static void export_wisdom_at_exit(void)
+{
+    XLALFFTWExportWisdom();
+}
+
+#endif /* LAL_FFTW3_ENABLED */
+
+
+/**
+ * Import persistent FFTW wisdom, if requested through the environment.
+ *
+ * If the environment variable <tt>LAL_FFTW_WISDOM_FILE</tt> is set,
+ * double-precision wisdom is imported from the file it names; likewise
+ * <tt>LAL_FFTWF_WISDOM_FILE</tt> for single-precision wisdom.  A missing
+ * file is not an error, since it is created when wisdom is exported.  The
+ * accumulated wisdom is exported back to these files at program exit, so
+ * that later runs need not repeat lengthy measurements when creating plans
+ * with <tt>measurelvl > 0</tt>.
+ *
+ * Only the first call does anything.  This function is called by the FFT
+ * plan creation functions, so it rarely needs to be called directly.  It
+ * must not be called while holding the FFTW wisdom lock.  This function is
+ * a no-op if LAL has been compiled with an FFT backend other than FFTW.
+ *
+ * See also:  XLALFFTWExportWisdom()
+ */
+
+void XLALFFTWImportWisdom(void)
+{
+#ifdef LAL_FFTW3_ENABLED
+    LAL_FFTW_WISDOM_LOCK;
+    if (!lalFFTWWisdomImported) {
+        const char *filename;
+        lalFFTWWisdomImported = 1;
+        if ((filename = getenv("LAL_FFTW_WISDOM_FILE")) != NULL && *filename != '\0') {
+            if (access(filename, F_OK) == 0 && !fftw_import_wisdom_from_filename(filename))
+                XLALPrintWarning("%s: could not import wisdom from file '%s'\n", __func__, filename);
+        }
+        if ((filename = getenv("LAL_FFTWF_WISDOM_FILE")) != NULL && *filename != '\0') {
+            if (access(filename, F_OK) == 0 && !fftwf_import_wisdom_from_filename(filename))
+                XLALPrintWarning("%s: could not import wisdom from file '%s'\n", __func__, filename);
+        }
+        atexit(export_wisdom_at_exit);
+    }
+    LAL_FFTW_WISDOM_UNLOCK;
+#endif
+}
+
+
+/**
+ * Export the FFTW wisdom accumulated so far to the files named by the
+ * environment variables <tt>LAL_FFTW_WISDOM_FILE</tt> (double precision)
+ * and <tt>LAL_FFTWF_WISDOM_FILE</tt> (single precision), if set.  This is
+ * done automatically at program exit once XLALFFTWImportWisdom() has been
+ * called, but long-running programs may wish to save wisdom earlier.
+ * Returns 0 on success, or #XLAL_FAILURE with #XLAL_EFUNC set if the
+ * wisdom could not be written to either file.
+ *
+ * See also:  XLALFFTWImportWisdom()
+ */
+
+int XLALFFTWExportWisdom(void)
+{
+    int retn = 0;
+#ifdef LAL_FFTW3_ENABLED
+    const char *filename;
+    LAL_FFTW_WISDOM_LOCK;
+    if ((filename = getenv("LAL_FFTW_WISDOM_FILE")) != NULL && *filename != '\0')
+        retn |= export_wisdom_to_filename(filename, 0);
+    if ((filename = getenv("LAL_FFTWF_WISDOM_FILE")) != NULL && *filename != '\0')
+        retn |= export_wisdom_to_filename(filename, 1);
+    LAL_FFTW_WISDOM_UNLOCK;
+#endif
+    if (retn)
+        XLAL_ERROR(XLAL_EFUNC);
+    return 0;
+}
@@ -28,6 +28,8 @@ extern "C" {
 
 void XLALFFTWWisdomLock(void);
 void XLALFFTWWisdomUnlock(void);
+void XLALFFTWImportWisdom(void);
+int XLALFFTWExportWisdom(void);
 
 #if defined(LAL_PTHREAD_LOCK) && defined(LAL_FFTW3_ENABLED)
 # define LAL_FFTW_WISDOM_LOCK XLALFFTWWisdomLock()
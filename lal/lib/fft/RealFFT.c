@@ -26,6 +26,7 @@
 #include <lal/LALDatatypes.h>
 #include <lal/FFTWMutex.h>
 #include <lal/LALConfig.h> /* Needed to know whether aligning memory */
+#include <lal/LALInstrument.h>
 #include <lal/LALMalloc.h>
 #include <lal/RealFFT.h>
 #include <lal/SeqFactories.h>
@@ -155,6 +156,9 @@ tagREAL4FFTPlan
   INT4       sign; /**< sign in transform exponential, -1 for forward, +1 for reverse */
   UINT4      size; /**< length of the real data vector for this plan */
   fftwf_plan plan; /**< the FFTW plan */
+  int        measurelvl; /**< measurement level with which the plan was created */
+  UINT4      refcount; /**< number of owners of this plan, which is shared through the plan cache */
+  struct tagREAL4FFTPlan *next; /**< next plan in the plan cache */
 };
 
 /**
@@ -166,6 +170,9 @@ tagREAL8FFTPlan
   INT4       sign; /**< sign in transform exponential, -1 for forward, +1 for reverse */
   UINT4      size; /**< length of the real data vector for this plan */
   fftw_plan  plan; /**< the FFTW plan */
+  int        measurelvl; /**< measurement level with which the plan was created */
+  UINT4      refcount; /**< number of owners of this plan, which is shared through the plan cache */
+  struct tagREAL8FFTPlan *next; /**< next plan in the plan cache */
 };
 
 
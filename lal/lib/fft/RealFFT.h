@@ -91,6 +91,14 @@ extern "C" {
  * of any transform with this level but rather estimates which plan will
  * be the fastet) or 1 to measure a few likely plans to determine the fastest.
  *
+ * Plans are shared: if a plan with the same size, direction and measurement
+ * level already exists, it is returned again rather than re-planned, and it
+ * is only freed once every owner has called XLALDestroyREAL4FFTPlan().  If the
+ * environment variable <tt>LAL_FFTWF_WISDOM_FILE</tt> (<tt>LAL_FFTW_WISDOM_FILE</tt>
+ * for double precision) is set, FFTW wisdom is imported from that file before
+ * the first plan is created and saved back to it at exit; see
+ * XLALFFTWImportWisdom().
+ *
  * XLALCreateForwardREAL4FFTPlan() is equivalent to
  * XLALCreateREAL4FFTPlan() with \c fwdflg set to 1.
  * XLALCreateReverseREAL4FFTPlan() is equivalent to
@@ -22,6 +22,8 @@
 #define CREATE_FORWARD_PLAN_FUNCTION	CONCAT2(XLALCreateForward,PLAN_TYPE)
 #define CREATE_REVERSE_PLAN_FUNCTION	CONCAT2(XLALCreateReverse,PLAN_TYPE)
 #define DESTROY_PLAN_FUNCTION		CONCAT2(XLALDestroy,PLAN_TYPE)
+#define PLAN_CACHE			CONCAT2(PLAN_TYPE,Cache)
+#define PLAN_CACHE_LOOKUP		CONCAT2(PLAN_TYPE,CacheLookup)
 #define FORWARD_FFT_FUNCTION		CONCAT3(XLAL,REAL_TYPE,ForwardFFT)
 #define REVERSE_FFT_FUNCTION		CONCAT3(XLAL,REAL_TYPE,ReverseFFT)
 #define VECTOR_FFT_FUNCTION		CONCAT3(XLAL,REAL_VECTOR_TYPE,FFT)
@@ -34,6 +36,22 @@
 #define FFTWX_DESTROY_PLAN		CONCAT2(FFTWX,_destroy_plan)
 #define FFTWX_EXECUTE_R2R		CONCAT2(FFTWX,_execute_r2r)
 
+/* process-wide cache of live plans, protected by the FFTW wisdom lock */
+static PLAN_TYPE *PLAN_CACHE = NULL;
+
+/* find a cached plan with the given parameters and take a reference to it;
+ * must be called with the FFTW wisdom lock held */
+static PLAN_TYPE *PLAN_CACHE_LOOKUP(UINT4 size, int sign, int measurelvl)
+{
+    PLAN_TYPE *plan;
+    for (plan = PLAN_CACHE; plan; plan = plan->next)
+        if (plan->size == size && plan->sign == sign && plan->measurelvl == measurelvl) {
+            ++plan->refcount;
+            break;
+        }
+    return plan;
+}
+
 PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
 {
     PLAN_TYPE *plan;
@@ -45,6 +63,18 @@ PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
     if (!size)
         XLAL_ERROR_NULL(XLAL_EBADLEN);
 
+    /* import persistent wisdom, if requested, before any planning */
+
+    XLALFFTWImportWisdom();
+
+    /* return a shared plan if one with the same parameters already exists */
+
+    LAL_FFTW_WISDOM_LOCK;
+    plan = PLAN_CACHE_LOOKUP(size, fwdflg ? -1 : 1, measurelvl);
+    LAL_FFTW_WISDOM_UNLOCK;
+    if (plan)
+        return plan;
+
     nbytes = size * sizeof(REAL_TYPE);
 
     /* set fftw3 flags to perform requested degree of measurement */
@@ -124,6 +154,26 @@ PLAN_TYPE *CREATE_PLAN_FUNCTION(UINT4 size, int fwdflg, int measurelvl)
 
     plan->size = size;
     plan->sign = (fwdflg ? -1 : 1);
+    plan->measurelvl = measurelvl;
+    plan->refcount = 1;
+
+    /* add the plan to the cache, unless another thread has cached an
+     * identical plan while the lock was released, in which case share
+     * that one instead */
+
+    LAL_FFTW_WISDOM_LOCK;
+    {
+        PLAN_TYPE *cached = PLAN_CACHE_LOOKUP(size, plan->sign, measurelvl);
+        if (cached) {
+            FFTWX_DESTROY_PLAN(plan->plan);
+            LAL_FFTW_WISDOM_UNLOCK;
+            XLALFree(plan);
+            return cached;
+        }
+    }
+    plan->next = PLAN_CACHE;
+    PLAN_CACHE = plan;
+    LAL_FFTW_WISDOM_UNLOCK;
 
     return plan;
 }
@@ -149,11 +199,23 @@ PLAN_TYPE *CREATE_REVERSE_PLAN_FUNCTION(UINT4 size, int measurelvl)
 void DESTROY_PLAN_FUNCTION(PLAN_TYPE * plan)
 {
     if (plan) {
-        if (plan->plan) {
-            LAL_FFTW_WISDOM_LOCK;
-            FFTWX_DESTROY_PLAN(plan->plan);
+        PLAN_TYPE **prev;
+        LAL_FFTW_WISDOM_LOCK;
+        /* plan is still shared with other owners */
+        if (plan->refcount > 1) {
+            --plan->refcount;
             LAL_FFTW_WISDOM_UNLOCK;
+            return;
         }
+        /* remove the plan from the cache */
+        for (prev = &PLAN_CACHE; *prev; prev = &(*prev)->next)
+            if (*prev == plan) {
+                *prev = plan->next;
+                break;
+            }
+        if (plan->plan)
+            FFTWX_DESTROY_PLAN(plan->plan);
+        LAL_FFTW_WISDOM_UNLOCK;
         memset(plan, 0, sizeof(*plan));
         XLALFree(plan);
     }
@@ -204,7 +266,9 @@ int FORWARD_FFT_FUNCTION(COMPLEX_VECTOR_TYPE * output, const REAL_VECTOR_TYPE *
 
     /* perform the fft */
 
+    XLAL_INSTRUMENT_START(__func__);
     FFTWX_EXECUTE_R2R(plan->plan, input_data, tmp);
+    XLAL_INSTRUMENT_STOP(__func__);
 
     /* unpack the results into the output vector */
 
@@ -294,7 +358,9 @@ int REVERSE_FFT_FUNCTION(REAL_VECTOR_TYPE * output, const COMPLEX_VECTOR_TYPE *
 
     /* perform the fft */
 
+    XLAL_INSTRUMENT_START(__func__);
     FFTWX_EXECUTE_R2R(plan->plan, tmp, output_data);
+    XLAL_INSTRUMENT_STOP(__func__);
 
     /* if temporary space for output data was created, copy data into
      * the output vector and free the temporary space */
@@ -359,7 +425,9 @@ int VECTOR_FFT_FUNCTION(REAL_VECTOR_TYPE * _LAL_RESTRICT_ output, const REAL_VEC
 
     /* perform the fft */
 
+    XLAL_INSTRUMENT_START(__func__);
     FFTWX_EXECUTE_R2R(plan->plan, input_data, output_data);
+    XLAL_INSTRUMENT_STOP(__func__);
 
     /* cleanup aligned memory space if memory alignment is required;
      * copy data from temporary space to output vector */
@@ -421,7 +489,9 @@ int POWER_SPECTRUM_FUNCTION(REAL_VECTOR_TYPE * spec, const REAL_VECTOR_TYPE * da
 
     /* perform the fft */
 
+    XLAL_INSTRUMENT_START(__func__);
     FFTWX_EXECUTE_R2R(plan->plan, input_data, tmp);
+    XLAL_INSTRUMENT_STOP(__func__);
 
     /* compute spectrum from the fft of the data */
 
@@ -471,6 +541,8 @@ int POWER_SPECTRUM_FUNCTION(REAL_VECTOR_TYPE * spec, const REAL_VECTOR_TYPE * da
 #undef CREATE_FORWARD_PLAN_FUNCTION
 #undef CREATE_REVERSE_PLAN_FUNCTION
 #undef DESTROY_PLAN_FUNCTION
+#undef PLAN_CACHE
+#undef PLAN_CACHE_LOOKUP
 #undef FORWARD_FFT_FUNCTION
 #undef REVERSE_FFT_FUNCTION
 #undef VECTOR_FFT_FUNCTION
@@ -186,6 +186,12 @@ tagLALPSDRegressor
 }
 LALPSDRegressor;
 
+/**
+ * Opaque object computing median or median-mean average power spectra over
+ * a sliding set of segments; see XLALSlidingPSDNew().
+ */
+typedef struct tagLALSlidingPSD LALSlidingPSD;
+
 /*
  *
  * XLAL Functions
@@ -271,6 +277,24 @@ int XLALREAL8AverageSpectrumWelch(
     const REAL8FFTPlan          *plan
     );
 
+int XLALREAL4AverageSpectrumWelchParallel(
+    REAL4FrequencySeries        *spectrum,
+    const REAL4TimeSeries       *tseries,
+    UINT4                        seglen,
+    UINT4                        stride,
+    const REAL4Window           *window,
+    const REAL4FFTPlan          *plan
+    );
+
+int XLALREAL8AverageSpectrumWelchParallel(
+    REAL8FrequencySeries        *spectrum,
+    const REAL8TimeSeries       *tseries,
+    UINT4                        seglen,
+    UINT4                        stride,
+    const REAL8Window           *window,
+    const REAL8FFTPlan          *plan
+    );
+
 REAL8 XLALMedianBias( UINT4 nn );
 
 REAL8 XLALLogMedianBiasGeometric( UINT4 nn );
@@ -293,6 +317,24 @@ int XLALREAL8AverageSpectrumMedian(
     const REAL8FFTPlan          *plan
     );
 
+int XLALREAL4AverageSpectrumMedianParallel(
+    REAL4FrequencySeries        *spectrum,
+    const REAL4TimeSeries       *tseries,
+    UINT4                        seglen,
+    UINT4                        stride,
+    const REAL4Window           *window,
+    const REAL4FFTPlan          *plan
+    );
+
+int XLALREAL8AverageSpectrumMedianParallel(
+    REAL8FrequencySeries        *spectrum,
+    const REAL8TimeSeries       *tseries,
+    UINT4                        seglen,
+    UINT4                        stride,
+    const REAL8Window           *window,
+    const REAL8FFTPlan          *plan
+    );
+
 int XLALREAL4AverageSpectrumMedianMean(
     REAL4FrequencySeries        *spectrum,
     const REAL4TimeSeries       *tseries,
@@ -410,6 +452,51 @@ XLALPSDRegressorSetPSD(
     unsigned weight
 );
 
+LALSlidingPSD *
+XLALSlidingPSDNew(
+    unsigned max_segments,
+    int median_mean
+);
+
+void
+XLALSlidingPSDFree(
+    LALSlidingPSD *s
+);
+
+void
+XLALSlidingPSDReset(
+    LALSlidingPSD *s
+);
+
+unsigned XLALSlidingPSDGetNSegments(
+    const LALSlidingPSD *s
+);
+
+int
+XLALSlidingPSDPush(
+    LALSlidingPSD *s,
+    const REAL8FrequencySeries *periodogram
+);
+
+int
+XLALSlidingPSDPushSegment(
+    LALSlidingPSD *s,
+    const REAL8TimeSeries *segment,
+    const REAL8Window *window,
+    const REAL8FFTPlan *plan
+);
+
+int
+XLALSlidingPSDPop(
+    LALSlidingPSD *s
+);
+
+int
+XLALSlidingPSDGetPSD(
+    REAL8FrequencySeries *spectrum,
+    const LALSlidingPSD *s
+);
+
 
 /** @} */
 
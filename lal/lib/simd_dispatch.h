@@ -101,3 +101,9 @@
 #else
 #define DISPATCH_SELECT_AVX2(...)		DISPATCH_SELECT_NONE()
 #endif
+
+#if defined(HAVE_AVX512F_COMPILER)		/* set by config.h if compiler supports AVX512F */
+#define DISPATCH_SELECT_AVX512F(...)		if (LAL_HAVE_AVX512F_RUNTIME()) { (__VA_ARGS__); break; } do { } while(0)
+#else
+#define DISPATCH_SELECT_AVX512F(...)		DISPATCH_SELECT_NONE()
+#endif
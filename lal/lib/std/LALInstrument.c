@@ -0,0 +1,377 @@
+/*
+*  Copyright (C) 2026 agent
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/* - NOTE: API is doxygen-documented in header file LALInstrument.h - */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+
+#include <lal/LALInstrument.h>
+#include <lal/LALStdio.h>
+#include <lal/XLALError.h>
+
+/* Note: malloc and free are used here rather than LALMalloc and LALFree,
+ * since the allocation functions themselves report to this module and
+ * the probes should not show up as memory leaks. */
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_mutex_t lalInstrumentMutex = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK() pthread_mutex_lock(&lalInstrumentMutex)
+#define UNLOCK() pthread_mutex_unlock(&lalInstrumentMutex)
+#else
+#define LOCK()
+#define UNLOCK()
+#endif
+
+struct tagLALInstrumentProbe {
+    struct tagLALInstrumentProbe *next;
+    char *name;
+    UINT8 calls;        /* number of times the timer was stopped */
+    REAL8 total;        /* total elapsed time, in seconds */
+    REAL8 self;         /* elapsed time not spent in nested timers */
+    UINT8 bytes;        /* bytes allocated while the timer was running */
+    INT8 count;         /* sum of counter increments */
+};
+
+/* a running timer */
+typedef struct tagInstrumentFrame {
+    LALInstrumentProbe *probe;
+    REAL8 start;
+    REAL8 child;        /* time spent in nested timers */
+    UINT8 bytes;        /* allocation total of the thread at start */
+} InstrumentFrame;
+
+/* timers running in a thread, innermost last */
+typedef struct tagInstrumentThread {
+    InstrumentFrame *frames;
+    size_t depth;
+    size_t size;
+    UINT8 bytes;        /* bytes allocated by the thread so far */
+} InstrumentThread;
+
+/* all probes, newest first */
+static LALInstrumentProbe *lalInstrumentProbes = NULL;
+
+/* output requested through the LAL_INSTRUMENT environment variable */
+static int lalInstrumentInitialised = 0;
+static LALInstrumentFormat lalInstrumentExitFormat = LAL_INSTRUMENT_TEXT;
+static char *lalInstrumentExitFile = NULL;
+
+static REAL8 InstrumentClock(void)
+{
+#ifdef HAVE_CLOCK_GETTIME
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + 1e-6 * tv.tv_usec;
+#endif
+}
+
+#ifdef LAL_PTHREAD_LOCK
+
+static pthread_key_t lalInstrumentThreadKey;
+static pthread_once_t lalInstrumentThreadKeyOnce = PTHREAD_ONCE_INIT;
+
+static void InstrumentDestroyThread(void *p)
+{
+    InstrumentThread *thread = p;
+    free(thread->frames);
+    free(thread);
+}
+
+static void InstrumentCreateThreadKey(void)
+{
+    pthread_key_create(&lalInstrumentThreadKey, InstrumentDestroyThread);
+}
+
+static InstrumentThread *InstrumentGetThread(void)
+{
+    InstrumentThread *thread;
+    pthread_once(&lalInstrumentThreadKeyOnce, InstrumentCreateThreadKey);
+    thread = pthread_getspecific(lalInstrumentThreadKey);
+    if (!thread) {
+        thread = calloc(1, sizeof(*thread));
+        if (thread && pthread_setspecific(lalInstrumentThreadKey, thread)) {
+            free(thread);
+            thread = NULL;
+        }
+    }
+    return thread;
+}
+
+#else /* !LAL_PTHREAD_LOCK */
+
+static InstrumentThread lalInstrumentThread;
+#define InstrumentGetThread() (&lalInstrumentThread)
+
+#endif /* LAL_PTHREAD_LOCK */
+
+static void InstrumentAtExit(void)
+{
+    FILE *fp = stderr;
+    if (lalInstrumentExitFile && !(fp = fopen(lalInstrumentExitFile, "w"))) {
+        fprintf(stderr, "LAL_INSTRUMENT: could not open '%s'\n", lalInstrumentExitFile);
+        return;
+    }
+    XLALInstrumentDump(fp, lalInstrumentExitFormat);
+    if (fp != stderr)
+        fclose(fp);
+}
+
+/* parse LAL_INSTRUMENT=<format>[:<file>]; called with the lock held */
+static void InstrumentInitialise(void)
+{
+    const char *env = getenv("LAL_INSTRUMENT");
+    const char *file;
+    size_t n;
+    lalInstrumentInitialised = 1;
+    if (!env || !*env)
+        return;
+    file = strchr(env, ':');
+    n = file ? (size_t)(file - env) : strlen(env);
+    if (n == 4 && strncmp(env, "json", 4) == 0)
+        lalInstrumentExitFormat = LAL_INSTRUMENT_JSON;
+    else if (n == 4 && strncmp(env, "text", 4) == 0)
+        lalInstrumentExitFormat = LAL_INSTRUMENT_TEXT;
+    else {
+        fprintf(stderr, "LAL_INSTRUMENT: unknown format '%.*s'\n", (int)n, env);
+        return;
+    }
+    if (file && file[1])
+        lalInstrumentExitFile = strdup(file + 1);
+    atexit(InstrumentAtExit);
+}
+
+LALInstrumentProbe *XLALInstrumentGetProbe(const char *name)
+{
+    LALInstrumentProbe *probe;
+    XLAL_CHECK_NULL(name != NULL, XLAL_EFAULT);
+    LOCK();
+    if (!lalInstrumentInitialised)
+        InstrumentInitialise();
+    for (probe = lalInstrumentProbes; probe; probe = probe->next)
+        if (strcmp(probe->name, name) == 0)
+            break;
+    if (!probe && (probe = calloc(1, sizeof(*probe)))) {
+        if ((probe->name = strdup(name))) {
+            probe->next = lalInstrumentProbes;
+            lalInstrumentProbes = probe;
+        } else {
+            free(probe);
+            probe = NULL;
+        }
+    }
+    UNLOCK();
+    if (!probe)
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    return probe;
+}
+
+/* the cache is read and written atomically, so that it may be shared by
+ * threads; threads that find it empty look up the same probe and store
+ * the same value */
+LALInstrumentProbe *XLALInstrumentGetCachedProbe(LALInstrumentProbe **cache, const char *name)
+{
+    LALInstrumentProbe *probe;
+    XLAL_CHECK_NULL(cache != NULL, XLAL_EFAULT);
+#if defined(__ATOMIC_ACQUIRE)
+    __atomic_load(cache, &probe, __ATOMIC_ACQUIRE);
+#else
+    LOCK();
+    probe = *cache;
+    UNLOCK();
+#endif
+    if (probe)
+        return probe;
+    probe = XLALInstrumentGetProbe(name);
+    if (!probe)
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+#if defined(__ATOMIC_ACQUIRE)
+    __atomic_store(cache, &probe, __ATOMIC_RELEASE);
+#else
+    LOCK();
+    *cache = probe;
+    UNLOCK();
+#endif
+    return probe;
+}
+
+void XLALInstrumentCount(LALInstrumentProbe *probe, INT8 n)
+{
+    if (!probe)
+        return;
+    LOCK();
+    probe->count += n;
+    UNLOCK();
+}
+
+void XLALInstrumentStart(LALInstrumentProbe *probe)
+{
+    InstrumentThread *thread = InstrumentGetThread();
+    InstrumentFrame *frame;
+    if (!probe || !thread)
+        return;
+    if (thread->depth == thread->size) {
+        size_t size = thread->size ? 2 * thread->size : 16;
+        InstrumentFrame *frames = realloc(thread->frames, size * sizeof(*frames));
+        if (!frames)
+            return;
+        thread->frames = frames;
+        thread->size = size;
+    }
+    frame = &thread->frames[thread->depth++];
+    frame->probe = probe;
+    frame->child = 0.0;
+    frame->bytes = thread->bytes;
+    frame->start = InstrumentClock();
+}
+
+void XLALInstrumentStop(LALInstrumentProbe *probe)
+{
+    REAL8 now = InstrumentClock();
+    InstrumentThread *thread = InstrumentGetThread();
+    InstrumentFrame *frame;
+    REAL8 elapsed;
+    size_t depth;
+    if (!probe || !thread)
+        return;
+
+    /* find the innermost running timer of this probe; timers started
+     * after it and never stopped are discarded */
+    for (depth = thread->depth; depth > 0; --depth)
+        if (thread->frames[depth - 1].probe == probe)
+            break;
+    if (depth == 0)
+        return;
+    thread->depth = depth - 1;
+    frame = &thread->frames[depth - 1];
+    elapsed = now - frame->start;
+    if (thread->depth > 0)
+        thread->frames[thread->depth - 1].child += elapsed;
+
+    LOCK();
+    probe->calls += 1;
+    probe->total += elapsed;
+    probe->self += elapsed - frame->child;
+    probe->bytes += thread->bytes - frame->bytes;
+    UNLOCK();
+}
+
+void XLALInstrumentAllocation(size_t n)
+{
+    InstrumentThread *thread = InstrumentGetThread();
+    if (thread)
+        thread->bytes += n;
+}
+
+static int InstrumentCompare(const void *a, const void *b)
+{
+    const LALInstrumentProbe *pa = *(const LALInstrumentProbe * const *)a;
+    const LALInstrumentProbe *pb = *(const LALInstrumentProbe * const *)b;
+    if (pa->self != pb->self)
+        return pa->self < pb->self ? 1 : -1;
+    return strcmp(pa->name, pb->name);
+}
+
+/* write a JSON string, escaping quotes, backslashes and control characters */
+static void InstrumentPrintJSONString(FILE *fp, const char *s)
+{
+    fputc('"', fp);
+    for (; *s; ++s) {
+        if (*s == '"' || *s == '\\')
+            fprintf(fp, "\\%c", *s);
+        else if ((unsigned char)*s < 0x20)
+            fprintf(fp, "\\u%04x", (unsigned)(unsigned char)*s);
+        else
+            fputc(*s, fp);
+    }
+    fputc('"', fp);
+}
+
+int XLALInstrumentDump(FILE *fp, LALInstrumentFormat format)
+{
+    LALInstrumentProbe *probe;
+    LALInstrumentProbe **sorted;
+    size_t n = 0, i;
+
+    XLAL_CHECK(fp != NULL, XLAL_EFAULT);
+    XLAL_CHECK(format == LAL_INSTRUMENT_TEXT || format == LAL_INSTRUMENT_JSON, XLAL_EINVAL, "Unknown format %d", (int)format);
+
+    LOCK();
+    for (probe = lalInstrumentProbes; probe; probe = probe->next)
+        ++n;
+    sorted = malloc((n ? n : 1) * sizeof(*sorted));
+    if (!sorted) {
+        UNLOCK();
+        XLAL_ERROR(XLAL_ENOMEM);
+    }
+    for (probe = lalInstrumentProbes, i = 0; probe; probe = probe->next)
+        sorted[i++] = probe;
+    qsort(sorted, n, sizeof(*sorted), InstrumentCompare);
+
+    if (format == LAL_INSTRUMENT_JSON) {
+        fprintf(fp, "{\"probes\": [");
+        for (i = 0; i < n; ++i) {
+            probe = sorted[i];
+            fprintf(fp, "%s\n  {\"name\": ", i ? "," : "");
+            InstrumentPrintJSONString(fp, probe->name);
+            fprintf(fp, ", \"calls\": %" LAL_UINT8_FORMAT ", \"total_time\": %.9g, \"self_time\": %.9g, \"bytes\": %" LAL_UINT8_FORMAT ", \"count\": %" LAL_INT8_FORMAT "}",
+                probe->calls, probe->total, probe->self, probe->bytes, probe->count);
+        }
+        fprintf(fp, "\n]}\n");
+    } else {
+        fprintf(fp, "# %-38s %12s %14s %14s %16s %16s\n", "probe", "calls", "total/s", "self/s", "bytes", "count");
+        for (i = 0; i < n; ++i) {
+            probe = sorted[i];
+            fprintf(fp, "%-40s %12" LAL_UINT8_FORMAT " %14.6f %14.6f %16" LAL_UINT8_FORMAT " %16" LAL_INT8_FORMAT "\n",
+                probe->name, probe->calls, probe->total, probe->self, probe->bytes, probe->count);
+        }
+    }
+    UNLOCK();
+
+    free(sorted);
+    XLAL_CHECK(!ferror(fp), XLAL_EIO, "Error writing instrumentation output");
+    return 0;
+}
+
+void XLALInstrumentReset(void)
+{
+    LALInstrumentProbe *probe;
+    LOCK();
+    for (probe = lalInstrumentProbes; probe; probe = probe->next) {
+        probe->calls = 0;
+        probe->total = 0.0;
+        probe->self = 0.0;
+        probe->bytes = 0;
+        probe->count = 0;
+    }
+    UNLOCK();
+}
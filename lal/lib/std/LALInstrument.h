@@ -0,0 +1,131 @@
+/*
+*  Copyright (C) 2026 agent
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#ifndef _LALINSTRUMENT_H
+#define _LALINSTRUMENT_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <lal/LALAtomicDatatypes.h>
+
+#ifdef  __cplusplus
+extern "C" {
+#elif 0
+}       /* so that editors will match preceding brace */
+#endif
+
+/**
+ * \defgroup LALInstrument_h Header LALInstrument.h
+ * \ingroup lal_std
+ * \brief Lightweight named counters and timers for attributing time and
+ * memory allocations to parts of a program.
+ *
+ * ### Synopsis ###
+ *
+ * \code
+ * #include <lal/LALInstrument.h>
+ * \endcode
+ *
+ * A \e probe is a named accumulator, created on first use and shared by
+ * all threads.  Timer probes are started and stopped with
+ * XLAL_INSTRUMENT_START() and XLAL_INSTRUMENT_STOP(); each stop adds one
+ * call, the elapsed wall-clock time, the elapsed time not spent in nested
+ * timers, and the number of bytes requested from the XLAL memory
+ * allocation functions by the calling thread while the timer was running.
+ * Counter probes are incremented with XLAL_INSTRUMENT_COUNT().  Timers nest
+ * per thread; a timer left running when an enclosing timer is stopped (e.g.\
+ * by an early error return) is discarded.
+ *
+ * The macros expand to nothing unless LAL is configured with
+ * <tt>--enable-instrumentation</tt>, which defines
+ * \c LAL_INSTRUMENTATION_ENABLED in \ref LALConfig_h, so probes may be left
+ * in production code.  When enabled, setting the environment variable
+ * \c LAL_INSTRUMENT to \c text or \c json, optionally followed by
+ * <tt>:</tt><em>filename</em>, writes all probes in that format to the file
+ * (or to standard error) when the program exits; XLALInstrumentDump() writes
+ * them at any other time.
+ *
+ * \code
+ * XLAL_INSTRUMENT_START( "my analysis step" );
+ * ...
+ * XLAL_INSTRUMENT_COUNT( "templates", 1 );
+ * ...
+ * XLAL_INSTRUMENT_STOP( "my analysis step" );
+ * \endcode
+ */
+/** @{ */
+
+/** Opaque type of an instrumentation probe */
+typedef struct tagLALInstrumentProbe LALInstrumentProbe;
+
+/** Output formats of XLALInstrumentDump() */
+typedef enum tagLALInstrumentFormat {
+  LAL_INSTRUMENT_TEXT,  /**< human-readable table, sorted by exclusive time */
+  LAL_INSTRUMENT_JSON   /**< JSON object with an array of probes */
+} LALInstrumentFormat;
+
+LALInstrumentProbe *XLALInstrumentGetProbe( const char *name );
+LALInstrumentProbe *XLALInstrumentGetCachedProbe( LALInstrumentProbe **cache, const char *name );
+void XLALInstrumentCount( LALInstrumentProbe *probe, INT8 n );
+void XLALInstrumentStart( LALInstrumentProbe *probe );
+void XLALInstrumentStop( LALInstrumentProbe *probe );
+void XLALInstrumentAllocation( size_t n );
+int XLALInstrumentDump( FILE *fp, LALInstrumentFormat format );
+void XLALInstrumentReset( void );
+
+#ifndef SWIG    /* exclude from SWIG interface */
+
+#ifdef LAL_INSTRUMENTATION_ENABLED
+
+/* each expansion caches the probe it looks up; see XLALInstrumentGetCachedProbe() */
+#define XLAL_INSTRUMENT_PROBE_CALL_( name, call ) \
+  do { \
+    static LALInstrumentProbe *lal_instrument_probe_cache_ = NULL; \
+    LALInstrumentProbe *lal_instrument_probe_ = XLALInstrumentGetCachedProbe( &lal_instrument_probe_cache_, name ); \
+    call; \
+  } while ( 0 )
+
+/** Add \a n to the counter probe \a name */
+#define XLAL_INSTRUMENT_COUNT( name, n ) XLAL_INSTRUMENT_PROBE_CALL_( name, XLALInstrumentCount( lal_instrument_probe_, n ) )
+/** Start the timer probe \a name */
+#define XLAL_INSTRUMENT_START( name ) XLAL_INSTRUMENT_PROBE_CALL_( name, XLALInstrumentStart( lal_instrument_probe_ ) )
+/** Stop the timer probe \a name */
+#define XLAL_INSTRUMENT_STOP( name ) XLAL_INSTRUMENT_PROBE_CALL_( name, XLALInstrumentStop( lal_instrument_probe_ ) )
+/** Record an allocation of \a n bytes */
+#define XLAL_INSTRUMENT_ALLOCATION( n ) XLALInstrumentAllocation( n )
+
+#else /* !LAL_INSTRUMENTATION_ENABLED */
+
+#define XLAL_INSTRUMENT_COUNT( name, n ) do { } while ( 0 )
+#define XLAL_INSTRUMENT_START( name ) do { } while ( 0 )
+#define XLAL_INSTRUMENT_STOP( name ) do { } while ( 0 )
+#define XLAL_INSTRUMENT_ALLOCATION( n ) do { } while ( 0 )
+
+#endif /* LAL_INSTRUMENTATION_ENABLED */
+
+#endif /* SWIG */
+
+/** @} */
+
+#if 0
+{       /* so that editors will match succeeding brace */
+#elif defined(__cplusplus)
+}
+#endif
+#endif /* _LALINSTRUMENT_H */
@@ -21,12 +21,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include <signal.h>
 
 #include <config.h>
 #include <lal/LALMalloc.h>
 #include <lal/LALStdio.h>
 #include <lal/LALError.h>
+#include <lal/LALInstrument.h>
+
+#if defined(LAL_INSTRUMENTATION_ENABLED) && defined(HAVE_MALLOC_H) && defined(HAVE_MALLOC_USABLE_SIZE)
+#include <malloc.h>
+#endif
 
 #ifdef __GNUC__
 #define UNUSED __attribute__ ((unused))
@@ -38,6 +44,321 @@
 size_t lalMallocTotal = 0;	/**< current amount of memory allocated by process */
 size_t lalMallocTotalPeak = 0;	/**< peak amount of memory allocated so far */
 
+/*
+ *
+ * Memory arenas.
+ *
+ */
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
+
+/* default size of the blocks from which arena memory is carved */
+#define ARENA_DEFAULT_BLOCK_SIZE ( 1024 * 1024 )
+
+/* alignment of memory returned by XLALArenaMalloc() */
+#define ARENA_ALIGNMENT 16
+
+#define ARENA_ALIGN_UP( ptr, align ) \
+    ( (char *)( ( (uintptr_t)(ptr) + (align) - 1 ) & ~(uintptr_t)( (align) - 1 ) ) )
+
+/* arena memory is recognised by the tag stored in the word just before it,
+ * which is the address of the memory scrambled with a magic number; the
+ * tag of memory which is not at least a word into a page is never read, as
+ * the word before it may not be mapped, and arena memory is never placed
+ * there.  ARENA_PAGE_SIZE must not exceed the smallest page size in use */
+#define ARENA_MAGIC ( (uintptr_t)0x9e3779b97f4a7c15ULL )
+#define ARENA_TAG( ptr ) ( ARENA_MAGIC ^ (uintptr_t)(ptr) )
+#define ARENA_PAGE_SIZE 4096
+#define ARENA_TAG_READABLE( ptr ) ( (uintptr_t)(ptr) % ARENA_PAGE_SIZE >= sizeof(uintptr_t) )
+
+/* reading the tag of heap memory reads into the bookkeeping of the heap,
+ * which AddressSanitizer would report */
+#if defined(__GNUC__) || defined(__clang__)
+#define ARENA_NO_SANITIZE __attribute__ ((no_sanitize_address))
+#else
+#define ARENA_NO_SANITIZE
+#endif
+
+struct tagArena;
+
+typedef struct tagArenaBlock {
+    struct tagArenaBlock *next; /* next (older) block of the arena */
+    struct tagArena *arena;     /* arena owning the block */
+    struct tagArenaHeader *last;/* header of the last allocation of the block */
+    char *top;                  /* first unused byte of the block */
+    char *end;                  /* one past the last byte of the block */
+} ArenaBlock;
+
+typedef struct tagArenaHeader {
+    struct tagArenaHeader *prev;/* header of the previous allocation of the block */
+    ArenaBlock *block;          /* block holding the allocation */
+    size_t size;                /* size of the allocation */
+    uintptr_t tag;              /* ARENA_TAG() of the allocation; must be last */
+} ArenaHeader;
+
+typedef struct tagArena {
+    struct tagArena *outer;     /* enclosing arena of the same thread, or NULL */
+    ArenaBlock *blocks;         /* blocks of the arena, newest first */
+    size_t blockSize;           /* size of a standard block */
+    int factories;              /* nonzero if XLALFactoryMalloc() uses the arena */
+} Arena;
+
+static void ArenaRelease(Arena *arena)
+{
+    while (arena->blocks) {
+        ArenaBlock *next = arena->blocks->next;
+        ArenaHeader *hdr;
+        /* untag the memory, so that it is not mistaken for arena memory
+         * once the heap hands it out again */
+        for (hdr = arena->blocks->last; hdr; hdr = hdr->prev)
+            hdr->tag = 0;
+        LALFree(arena->blocks);
+        arena->blocks = next;
+    }
+    LALFree(arena);
+}
+
+/* number of arenas active in all threads; while it is zero, memory is
+ * freed without looking for a tag.  Arena memory handed to another thread
+ * is handed over after its arena was counted, so relaxed atomic operations
+ * suffice; without them, the count is protected by a mutex */
+#if defined(__ATOMIC_RELAXED)
+static size_t arenaCount = 0;
+#define ArenaCountAdd() __atomic_fetch_add(&arenaCount, 1, __ATOMIC_RELAXED)
+#define ArenaCountSub() __atomic_fetch_sub(&arenaCount, 1, __ATOMIC_RELAXED)
+#define ArenasActive() ( __atomic_load_n(&arenaCount, __ATOMIC_RELAXED) > 0 )
+#elif !defined(LAL_PTHREAD_LOCK)
+static size_t arenaCount = 0;
+#define ArenaCountAdd() ( ++arenaCount )
+#define ArenaCountSub() ( --arenaCount )
+#define ArenasActive() ( arenaCount > 0 )
+#else
+static size_t arenaCount = 0;
+static pthread_mutex_t arenaCountMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void ArenaCountAdd(void)
+{
+    pthread_mutex_lock(&arenaCountMutex);
+    ++arenaCount;
+    pthread_mutex_unlock(&arenaCountMutex);
+}
+
+static void ArenaCountSub(void)
+{
+    pthread_mutex_lock(&arenaCountMutex);
+    --arenaCount;
+    pthread_mutex_unlock(&arenaCountMutex);
+}
+
+static int ArenasActive(void)
+{
+    int active;
+    pthread_mutex_lock(&arenaCountMutex);
+    active = arenaCount > 0;
+    pthread_mutex_unlock(&arenaCountMutex);
+    return active;
+}
+#endif
+
+/* the innermost active arena is kept per thread */
+#ifdef LAL_PTHREAD_LOCK
+static pthread_key_t arenaKey;
+static pthread_once_t arenaKeyOnce = PTHREAD_ONCE_INIT;
+
+/* releases any arenas a thread forgot to pop when it exits */
+static void ArenaThreadExit(void *p)
+{
+    Arena *arena = p;
+    while (arena) {
+        Arena *outer = arena->outer;
+        ArenaRelease(arena);
+        ArenaCountSub();
+        arena = outer;
+    }
+}
+
+static void ArenaMakeKey(void)
+{
+    pthread_key_create(&arenaKey, ArenaThreadExit);
+}
+
+static Arena *ArenaGet(void)
+{
+    pthread_once(&arenaKeyOnce, ArenaMakeKey);
+    return pthread_getspecific(arenaKey);
+}
+
+static void ArenaSet(Arena *arena)
+{
+    pthread_once(&arenaKeyOnce, ArenaMakeKey);
+    pthread_setspecific(arenaKey, arena);
+}
+#else
+static Arena *currentArena = NULL;
+#define ArenaGet() ( currentArena )
+#define ArenaSet( arena ) ( currentArena = (arena) )
+#endif
+
+/* returns where an allocation of n bytes would be placed at the top of
+ * block, or NULL if it does not fit */
+static char *ArenaPlace(ArenaBlock *block, size_t n, size_t align)
+{
+    char *p = ARENA_ALIGN_UP(block->top + sizeof(ArenaHeader), align);
+    if (!ARENA_TAG_READABLE(p))
+        p += align;
+    if (p > block->end || (size_t)(block->end - p) < n)
+        return NULL;
+    return p;
+}
+
+/* allocates n bytes from an arena of the calling thread; each allocation
+ * is preceded by a header holding its size and tag */
+static void *ArenaAlloc(Arena *arena, size_t n, size_t align)
+{
+    ArenaBlock *block = arena->blocks;
+    ArenaHeader *hdr;
+    char *p = NULL;
+    if (block)
+        p = ArenaPlace(block, n, align);
+    if (!p) {
+        size_t size = n + sizeof(ArenaHeader) + 2 * align;
+        int large = size > arena->blockSize;
+        if (!large)
+            size = arena->blockSize;
+        block = LALMalloc(sizeof(*block) + size);
+        if (!block)
+            return NULL;
+        block->arena = arena;
+        block->last = NULL;
+        block->top = (char *)(block + 1);
+        block->end = block->top + size;
+        if (large && arena->blocks) {
+            /* keep allocating from the partly used standard block */
+            block->next = arena->blocks->next;
+            arena->blocks->next = block;
+        } else {
+            block->next = arena->blocks;
+            arena->blocks = block;
+        }
+        p = ArenaPlace(block, n, align);
+    }
+    hdr = (ArenaHeader *)p - 1;
+    hdr->prev = block->last;
+    hdr->block = block;
+    hdr->size = n;
+    hdr->tag = ARENA_TAG(p);
+    block->last = hdr;
+    block->top = p + n;
+    return p;
+}
+
+/* returns the arena of any thread holding p, or NULL; the header of p is
+ * stored in *hdrp, if given.  Only the word before p is read, so no lock
+ * is needed */
+ARENA_NO_SANITIZE static Arena *ArenaFind(const void *p, ArenaHeader **hdrp)
+{
+    ArenaHeader *hdr;
+    if (!p || !ArenasActive() || !ARENA_TAG_READABLE(p))
+        return NULL;
+    if (((const uintptr_t *)p)[-1] != ARENA_TAG(p))
+        return NULL;
+    hdr = (ArenaHeader *)p - 1;
+    if (hdrp)
+        *hdrp = hdr;
+    return hdr->block->arena;
+}
+
+/* returns nonzero if the arena is active in the calling thread */
+static int ArenaOwned(const Arena *arena)
+{
+    const Arena *own;
+    for (own = ArenaGet(); own; own = own->outer)
+        if (own == arena)
+            return 1;
+    return 0;
+}
+
+/* if p is arena memory, returns 1, and, if p is the last allocation of a
+ * block of an arena of the calling thread, returns its memory to the
+ * block, so that memory allocated and freed in turn is reused; otherwise
+ * returns 0 */
+static int ArenaFree(void *p)
+{
+    ArenaHeader *hdr = NULL;
+    Arena *arena = ArenaFind(p, &hdr);
+    if (!arena)
+        return 0;
+    if (ArenaOwned(arena) && hdr->block->last == hdr) {
+        hdr->block->last = hdr->prev;
+        hdr->block->top = (char *)hdr;
+        hdr->tag = 0;
+    }
+    return 1;
+}
+
+/* if p is memory of an arena of the calling thread, resizes it to n bytes
+ * in its own arena, stores the result in *q, and returns 1; if p is memory
+ * of an arena of another thread, which cannot be resized safely, returns
+ * -1; otherwise returns 0 */
+static int ArenaRealloc(void **q, void *p, size_t n, size_t align)
+{
+    ArenaHeader *hdr = NULL;
+    Arena *arena = ArenaFind(p, &hdr);
+    ArenaBlock *block;
+    size_t m;
+    if (!arena)
+        return 0;
+    if (!ArenaOwned(arena))
+        return -1;
+    block = hdr->block;
+    m = hdr->size;
+    if (n == 0)
+        *q = NULL;
+    else if ((uintptr_t)p % align == 0 && (n <= m || (block->last == hdr && (size_t)(block->end - (char *)p) >= n))) {
+        /* shrink in place, or grow in place if p is the last allocation
+         * of its block and there is room */
+        if (block->last == hdr)
+            block->top = (char *)p + n;
+        hdr->size = n;
+        *q = p;
+    } else {
+        *q = ArenaAlloc(arena, n, align);
+        if (*q)
+            memcpy(*q, p, m < n ? m : n);
+    }
+    return 1;
+}
+
+/* returns the size of the memory at p, if it can be found, so that
+ * reallocations report only their growth to LALInstrument.h; 'lalmem'
+ * is nonzero if p was allocated by the LALMalloc-family, which may pad it.
+ * malloc_usable_size() may exceed the size requested; if no size can be
+ * found, 0 is returned and the full new size is reported */
+static UNUSED size_t AllocationSize(void *p, int lalmem UNUSED)
+{
+#ifdef LAL_INSTRUMENTATION_ENABLED
+    ArenaHeader *hdr = NULL;
+    if (!p)
+        return 0;
+    if (ArenaFind(p, &hdr))
+        return hdr->size;
+#ifndef LAL_MEMORY_FUNCTIONS_DISABLED
+    /* PadAlloc() stores the size two words before the memory */
+    if (lalmem && (lalDebugLevel & LALMEMDBGBIT) && (lalDebugLevel & LALMEMPADBIT))
+        return ((size_t *)p)[-2];
+#endif
+#if defined(HAVE_MALLOC_H) && defined(HAVE_MALLOC_USABLE_SIZE)
+    return malloc_usable_size(p);
+#endif
+#endif
+    return 0;
+}
+
+/* growth of an allocation resized from m to n bytes */
+#define ALLOCATION_GROWTH( n, m ) ( (n) > (m) ? (n) - (m) : 0 )
+
 /*
  *
  * XLAL Routines.
@@ -71,6 +392,7 @@ void *(XLALMalloc) (size_t n) {
     void *p;
     p = LALMallocShort(n);
     XLAL_TEST_POINTER(p, n);
+    XLAL_INSTRUMENT_ALLOCATION(n);
     return p;
 }
 
@@ -79,6 +401,7 @@ void *XLALMallocLong(size_t n, const char *file, int line)
     void *p;
     p = LALMallocLong(n, file, line);
     XLAL_TEST_POINTER_LONG(p, n, file, line);
+    XLAL_INSTRUMENT_ALLOCATION(n);
     return p;
 }
 
@@ -86,6 +409,7 @@ void *(XLALCalloc) (size_t m, size_t n) {
     void *p;
     p = LALCallocShort(m, n);
     XLAL_TEST_POINTER(p, m && n);
+    XLAL_INSTRUMENT_ALLOCATION(m * n);
     return p;
 }
 
@@ -94,32 +418,57 @@ void *XLALCallocLong(size_t m, size_t n, const char *file, int line)
     void *p;
     p = LALCallocLong(m, n, file, line);
     XLAL_TEST_POINTER_LONG(p, m && n, file, line);
+    XLAL_INSTRUMENT_ALLOCATION(m * n);
     return p;
 }
 
 void *(XLALRealloc) (void *p, size_t n) {
-    p = LALReallocShort(p, n);
+    void *q;
+    size_t m UNUSED;
+    int arena;
+    m = AllocationSize(p, 1);
+    arena = ArenaRealloc(&q, p, n, ARENA_ALIGNMENT);
+    if (arena < 0)
+        XLAL_ERROR_NULL(XLAL_EINVAL, "Cannot reallocate memory of another thread's arena");
+    if (arena)
+        p = q;
+    else
+        p = LALReallocShort(p, n);
     XLAL_TEST_POINTER(p, n);
+    XLAL_INSTRUMENT_ALLOCATION(ALLOCATION_GROWTH(n, m));
     return p;
 }
 
 void *XLALReallocLong(void *p, size_t n, const char *file, int line)
 {
-    p = LALReallocLong(p, n, file, line);
+    void *q;
+    size_t m UNUSED;
+    int arena;
+    m = AllocationSize(p, 1);
+    arena = ArenaRealloc(&q, p, n, ARENA_ALIGNMENT);
+    if (arena < 0) {
+        XLALPrintError("XLALError - %s in %s:%d", __func__, file, line);
+        XLAL_ERROR_NULL(XLAL_EINVAL, "Cannot reallocate memory of another thread's arena");
+    }
+    if (arena)
+        p = q;
+    else
+        p = LALReallocLong(p, n, file, line);
     XLAL_TEST_POINTER_LONG(p, n, file, line);
+    XLAL_INSTRUMENT_ALLOCATION(ALLOCATION_GROWTH(n, m));
     return p;
 }
 
 void (XLALFree) (void *p)
 {
-    if (p)
+    if (p && !ArenaFree(p))
         LALFreeShort(p);
     return;
 }
 
 void XLALFreeLong(void *p, const char *file UNUSED, int line UNUSED)
 {
-    if (p)
+    if (p && !ArenaFree(p))
         LALFreeLong(p, file, line);
     return;
 }
@@ -145,6 +494,7 @@ void *XLALMallocAlignedLong(size_t size, const char *file, int line)
 	int retval;
 	retval = posix_memalign(&p, LAL_MEM_ALIGNMENT, size);
 	XLAL_TEST_POINTER_ALIGNED_LONG(p, size, retval, file, line);
+	XLAL_INSTRUMENT_ALLOCATION(size);
 	return p;
 }
 
@@ -154,6 +504,7 @@ void *(XLALMallocAligned)(size_t size)
 	int retval;
 	retval = posix_memalign(&p, LAL_MEM_ALIGNMENT, size);
 	XLAL_TEST_POINTER_ALIGNED(p, size, retval);
+	XLAL_INSTRUMENT_ALLOCATION(size);
 	return p;
 }
 
@@ -178,44 +529,222 @@ void *(XLALCallocAligned)(size_t nelem, size_t elsize)
 void *XLALReallocAlignedLong(void *ptr, size_t size, const char *file, int line)
 {
 	void *p;
+	size_t m UNUSED;
+	int retval;
+	int arena;
 	if (ptr == NULL)
 		return XLALMallocAlignedLong(size, file, line);
+	m = AllocationSize(ptr, 0);
+	arena = ArenaRealloc(&p, ptr, size, LAL_MEM_ALIGNMENT);
+	if (arena < 0) {
+		XLALPrintError("XLALError - %s in %s:%d", __func__, file, line);
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Cannot reallocate memory of another thread's arena");
+	}
+	if (arena) {
+		XLAL_TEST_POINTER_LONG(p, size, file, line);
+		XLAL_INSTRUMENT_ALLOCATION(ALLOCATION_GROWTH(size, m));
+		return p;
+	}
 	if (size == 0) {
 		XLALFreeAligned(ptr);
 		return NULL;
 	}
 	p = realloc(ptr, size); /* use ordinary realloc */
-	if (XLALIsMemoryAligned(p))
+	if (XLALIsMemoryAligned(p)) {
+		XLAL_INSTRUMENT_ALLOCATION(ALLOCATION_GROWTH(size, m));
 		return p;
+	}
 	/* need to do a new allocation and a memcpy, inefficient... */
-	ptr = XLALMallocAlignedLong(size, file, line);
+	retval = posix_memalign(&ptr, LAL_MEM_ALIGNMENT, size);
+	XLAL_TEST_POINTER_ALIGNED_LONG(ptr, size, retval, file, line);
 	memcpy(ptr, p, size);
 	free(p);
+	XLAL_INSTRUMENT_ALLOCATION(ALLOCATION_GROWTH(size, m));
 	return ptr;
 }
 
 void *(XLALReallocAligned)(void *ptr, size_t size)
 {
 	void *p;
+	size_t m UNUSED;
+	int retval;
+	int arena;
 	if (ptr == NULL)
-		return XLALMallocAligned(size);
+		return (XLALMallocAligned)(size);
+	m = AllocationSize(ptr, 0);
+	arena = ArenaRealloc(&p, ptr, size, LAL_MEM_ALIGNMENT);
+	if (arena < 0)
+		XLAL_ERROR_NULL(XLAL_EINVAL, "Cannot reallocate memory of another thread's arena");
+	if (arena) {
+		XLAL_TEST_POINTER(p, size);
+		XLAL_INSTRUMENT_ALLOCATION(ALLOCATION_GROWTH(size, m));
+		return p;
+	}
 	if (size == 0) {
 		XLALFreeAligned(ptr);
 		return NULL;
 	}
 	p = realloc(ptr, size); /* use ordinary realloc */
-	if (XLALIsMemoryAligned(p))
+	if (XLALIsMemoryAligned(p)) {
+		XLAL_INSTRUMENT_ALLOCATION(ALLOCATION_GROWTH(size, m));
 		return p;
+	}
 	/* need to do a new allocation and a memcpy, inefficient... */
-	ptr = XLALMallocAligned(size);
+	retval = posix_memalign(&ptr, LAL_MEM_ALIGNMENT, size);
+	XLAL_TEST_POINTER_ALIGNED(ptr, size, retval);
 	memcpy(ptr, p, size);
 	free(p);
+	XLAL_INSTRUMENT_ALLOCATION(ALLOCATION_GROWTH(size, m));
 	return ptr;
 }
 
 void XLALFreeAligned(void *ptr)
 {
-	free(ptr); /* use ordinary free */
+	if (!ArenaFree(ptr))
+		free(ptr); /* use ordinary free */
+}
+
+#endif /* LAL_FFTW3_MEMALIGN_ENABLED */
+
+/*
+ * Memory arena routines.
+ */
+
+static int ArenaPush(size_t blockSize, int factories)
+{
+    Arena *arena = LALMalloc(sizeof(*arena));
+    if (!arena)
+        return -1;
+    arena->outer = ArenaGet();
+    arena->blocks = NULL;
+    arena->blockSize = blockSize ? blockSize : ARENA_DEFAULT_BLOCK_SIZE;
+    arena->factories = factories;
+    ArenaSet(arena);
+    ArenaCountAdd();
+    return 0;
+}
+
+int XLALPushMemoryArena(size_t blockSize)
+{
+    if (ArenaPush(blockSize, 0) < 0)
+        XLAL_ERROR(XLAL_ENOMEM);
+    return 0;
+}
+
+int XLALPushFactoryMemoryArena(size_t blockSize)
+{
+    if (ArenaPush(blockSize, 1) < 0)
+        XLAL_ERROR(XLAL_ENOMEM);
+    return 0;
+}
+
+int XLALPopMemoryArena(void)
+{
+    Arena *arena = ArenaGet();
+    if (!arena)
+        XLAL_ERROR(XLAL_EFAILED, "No memory arena is active");
+    ArenaSet(arena->outer);
+    ArenaRelease(arena);
+    ArenaCountSub();
+    return 0;
+}
+
+void *(XLALArenaMalloc) (size_t n)
+{
+    Arena *arena = ArenaGet();
+    void *p;
+    if (!arena)
+        return (XLALMalloc)(n);
+    p = ArenaAlloc(arena, n, ARENA_ALIGNMENT);
+    XLAL_TEST_POINTER(p, n);
+    XLAL_INSTRUMENT_ALLOCATION(n);
+    return p;
+}
+
+void *XLALArenaMallocLong(size_t n, const char *file, int line)
+{
+    Arena *arena = ArenaGet();
+    void *p;
+    if (!arena)
+        return XLALMallocLong(n, file, line);
+    p = ArenaAlloc(arena, n, ARENA_ALIGNMENT);
+    XLAL_TEST_POINTER_LONG(p, n, file, line);
+    XLAL_INSTRUMENT_ALLOCATION(n);
+    return p;
+}
+
+void *(XLALFactoryMalloc) (size_t n)
+{
+    Arena *arena = ArenaGet();
+    void *p;
+    if (!arena || !arena->factories)
+        return (XLALMalloc)(n);
+    p = ArenaAlloc(arena, n, ARENA_ALIGNMENT);
+    XLAL_TEST_POINTER(p, n);
+    XLAL_INSTRUMENT_ALLOCATION(n);
+    return p;
+}
+
+void *XLALFactoryMallocLong(size_t n, const char *file, int line)
+{
+    Arena *arena = ArenaGet();
+    void *p;
+    if (!arena || !arena->factories)
+        return XLALMallocLong(n, file, line);
+    p = ArenaAlloc(arena, n, ARENA_ALIGNMENT);
+    XLAL_TEST_POINTER_LONG(p, n, file, line);
+    XLAL_INSTRUMENT_ALLOCATION(n);
+    return p;
+}
+
+#if LAL_FFTW3_MEMALIGN_ENABLED
+
+void *(XLALArenaMallocAligned) (size_t size)
+{
+	Arena *arena = ArenaGet();
+	void *p;
+	if (!arena)
+		return (XLALMallocAligned)(size);
+	p = ArenaAlloc(arena, size, LAL_MEM_ALIGNMENT);
+	XLAL_TEST_POINTER(p, size);
+	XLAL_INSTRUMENT_ALLOCATION(size);
+	return p;
+}
+
+void *XLALArenaMallocAlignedLong(size_t size, const char *file, int line)
+{
+	Arena *arena = ArenaGet();
+	void *p;
+	if (!arena)
+		return XLALMallocAlignedLong(size, file, line);
+	p = ArenaAlloc(arena, size, LAL_MEM_ALIGNMENT);
+	XLAL_TEST_POINTER_LONG(p, size, file, line);
+	XLAL_INSTRUMENT_ALLOCATION(size);
+	return p;
+}
+
+void *(XLALFactoryMallocAligned) (size_t size)
+{
+	Arena *arena = ArenaGet();
+	void *p;
+	if (!arena || !arena->factories)
+		return (XLALMallocAligned)(size);
+	p = ArenaAlloc(arena, size, LAL_MEM_ALIGNMENT);
+	XLAL_TEST_POINTER(p, size);
+	XLAL_INSTRUMENT_ALLOCATION(size);
+	return p;
+}
+
+void *XLALFactoryMallocAlignedLong(size_t size, const char *file, int line)
+{
+	Arena *arena = ArenaGet();
+	void *p;
+	if (!arena || !arena->factories)
+		return XLALMallocAlignedLong(size, file, line);
+	p = ArenaAlloc(arena, size, LAL_MEM_ALIGNMENT);
+	XLAL_TEST_POINTER_LONG(p, size, file, line);
+	XLAL_INSTRUMENT_ALLOCATION(size);
+	return p;
 }
 
 #endif /* LAL_FFTW3_MEMALIGN_ENABLED */
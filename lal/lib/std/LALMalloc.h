@@ -48,6 +48,20 @@ void XLALFreeLong(void *p, const char *file, const int line);
 #endif /* SWIG */
 /** @} */
 
+#ifndef SWIG    /* exclude from SWIG interface */
+/** \addtogroup LALMalloc_h */ /** @{ */
+int XLALPushMemoryArena(size_t blockSize);
+int XLALPushFactoryMemoryArena(size_t blockSize);
+int XLALPopMemoryArena(void);
+void *XLALArenaMalloc(size_t n);
+void *XLALArenaMallocLong(size_t n, const char *file, int line);
+void *XLALFactoryMalloc(size_t n);
+void *XLALFactoryMallocLong(size_t n, const char *file, int line);
+#define XLALArenaMalloc( n )   XLALArenaMallocLong( n, __FILE__, __LINE__ )
+#define XLALFactoryMalloc( n ) XLALFactoryMallocLong( n, __FILE__, __LINE__ )
+/** @} */
+#endif /* SWIG */
+
 /** \addtogroup LALMalloc_h */ /** @{ */
 /* presently these are only here if needed */
 #ifdef LAL_FFTW3_MEMALIGN_ENABLED
@@ -61,10 +75,16 @@ void *XLALReallocAlignedLong(void *ptr, size_t size, const char *file, int line)
 void *XLALReallocAligned(void *ptr, size_t size);
 void XLALFreeAligned(void *ptr);
 #ifndef SWIG    /* exclude from SWIG interface */
+void *XLALArenaMallocAlignedLong(size_t size, const char *file, int line);
+void *XLALArenaMallocAligned(size_t size);
+void *XLALFactoryMallocAlignedLong(size_t size, const char *file, int line);
+void *XLALFactoryMallocAligned(size_t size);
 #define LAL_IS_MEMORY_ALIGNED(ptr) (((size_t)(ptr) % LAL_MEM_ALIGNMENT) == 0)
 #define XLALMallocAligned(size) XLALMallocAlignedLong(size, __FILE__, __LINE__)
 #define XLALCallocAligned(nelem, elsize) XLALCallocAlignedLong(nelem, elsize, __FILE__, __LINE__)
 #define XLALReallocAligned(ptr, size) XLALReallocAlignedLong(ptr, size, __FILE__, __LINE__)
+#define XLALArenaMallocAligned(size) XLALArenaMallocAlignedLong(size, __FILE__, __LINE__)
+#define XLALFactoryMallocAligned(size) XLALFactoryMallocAlignedLong(size, __FILE__, __LINE__)
 #endif /* SWIG */
 #endif /* LAL_FFTW3_MEMALIGN_ENABLED */
 /** @} */
@@ -232,6 +232,110 @@ XLALParsePassBandParamStruc( PassBandParamStruc *params,
 #undef SINGLE_PRECISION
 #include "ButterworthTimeSeries_source.c"
 
+/**
+ * Creates the Butterworth filter described by \c params, for data sampled
+ * at intervals \c deltaT, as a cascade of second-order sections which
+ * filters \c numChannels channels at once; see \ref SOSFilter_c.  The
+ * sections are the same as those applied by XLALButterworthREAL8TimeSeries(),
+ * so that applying the filter forwards with
+ * XLALSOSFilterREAL8VectorSequence() and then backwards with
+ * XLALSOSFilterReverseREAL8VectorSequence() gives the same zero-phase
+ * response as that routine, up to edge effects; applying it forwards
+ * only gives a causal filter with the square root of the desired
+ * attenuation, suitable for filtering a data stream in chunks.
+ */
+REAL8SOSFilter *XLALCreateButterworthREAL8SOSFilter( PassBandParamStruc *params, REAL8 deltaT, UINT4 numChannels )
+{
+  REAL8SOSFilter *sosFilter=NULL;
+  REAL8IIRFilter **iirFilters=NULL;
+  INT4 numFilters=0; /* The number of sections created so far. */
+  INT4 n;    /* The filter order. */
+  INT4 type; /* The pass-band type: high, low, or undeterminable. */
+  INT4 i;    /* An index. */
+  INT4 j;    /* Another index. */
+  REAL8 wc;  /* The filter's transformed frequency. */
+
+  if ( ! params )
+    XLAL_ERROR_NULL( XLAL_EFAULT );
+  if ( deltaT <= 0.0 )
+    XLAL_ERROR_NULL( XLAL_EINVAL );
+
+  type=XLALParsePassBandParamStruc(params,&n,&wc,deltaT);
+  if(type<0)
+    XLAL_ERROR_NULL( XLAL_EINVAL );
+
+  iirFilters = LALCalloc( (n+1)/2, sizeof(*iirFilters) );
+  if ( ! iirFilters )
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+
+  /* Pair up poles into second-order sections, plus perhaps an
+     additional first-order section, exactly as in
+     XLALButterworthREAL8TimeSeries(). */
+  for(i=0,j=n-1;i<=j;i++,j--){
+    COMPLEX16ZPGFilter *zpgFilter=NULL;
+
+    if(i<j){
+      REAL8 theta=LAL_PI*(i+0.5)/n;
+      REAL8 ar=wc*cos(theta);
+      REAL8 ai=wc*sin(theta);
+      if(type==2){
+        zpgFilter = XLALCreateCOMPLEX16ZPGFilter(2,2);
+        if ( zpgFilter ) {
+          zpgFilter->zeros->data[0]=0.0;
+          zpgFilter->zeros->data[1]=0.0;
+          zpgFilter->gain=1.0;
+        }
+      }else{
+        zpgFilter = XLALCreateCOMPLEX16ZPGFilter(0,2);
+        if ( zpgFilter )
+          zpgFilter->gain=-wc*wc;
+      }
+      if ( zpgFilter ) {
+        zpgFilter->poles->data[0]=ar+ai*I;
+        zpgFilter->poles->data[1]=-ar+ai*I;
+      }
+    }else{
+      if(type==2){
+        zpgFilter=XLALCreateCOMPLEX16ZPGFilter(1,1);
+        if ( zpgFilter ) {
+          *zpgFilter->zeros->data=0.0;
+          zpgFilter->gain=1.0;
+        }
+      }else{
+        zpgFilter=XLALCreateCOMPLEX16ZPGFilter(0,1);
+        if ( zpgFilter )
+          zpgFilter->gain=-wc*I;
+      }
+      if ( zpgFilter )
+        *zpgFilter->poles->data=wc*I;
+    }
+
+    /* Transform to the z-plane and create the IIR filter. */
+    if ( ! zpgFilter || XLALWToZCOMPLEX16ZPGFilter(zpgFilter)<0
+        || ! (iirFilters[numFilters]=XLALCreateREAL8IIRFilter(zpgFilter)) )
+    {
+      XLALDestroyCOMPLEX16ZPGFilter(zpgFilter);
+      goto done;
+    }
+    XLALDestroyCOMPLEX16ZPGFilter(zpgFilter);
+    ++numFilters;
+  }
+
+  sosFilter = XLALCreateREAL8SOSFilterFromIIR( iirFilters, numFilters, numChannels );
+  if ( sosFilter ) {
+    sosFilter->name = params->name;
+    sosFilter->deltaT = deltaT;
+  }
+
+done:
+  for ( i = 0; i < numFilters; i++ )
+    XLALDestroyREAL8IIRFilter( iirFilters[i] );
+  LALFree( iirFilters );
+  if ( ! sosFilter )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  return sosFilter;
+}
+
 /**
  * Deprecated.
  * \deprecated Use XLALButterworthREAL4TimeSeries() instead.
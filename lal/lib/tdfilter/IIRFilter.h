@@ -123,6 +123,7 @@ extern "C" {
  * \defgroup IIRFilter_c 		Module IIRFilter.c
  * \defgroup IIRFilterVector_c 	Module IIRFilterVector.c
  * \defgroup IIRFilterVectorR_c 	Module IIRFilterVectorR.c
+ * \defgroup SOSFilter_c 		Module SOSFilter.c
  * @}
  */
 
@@ -189,6 +190,28 @@ typedef struct tagCOMPLEX16IIRFilter{
   COMPLEX16Vector *history;    /**< The previous values of w. */
 } COMPLEX16IIRFilter;
 
+/**
+ * This structure stores a REAL8 filter as a cascade of second-order
+ * sections (biquads), together with the state of each section for each of
+ * a number of independent data channels, so that the filter can be applied
+ * to all channels at once.  Section \f$s\f$ has the transfer function
+ * \f[
+ * T_s(z) = \frac{b_0 + b_1 z^{-1} + b_2 z^{-2}}{1 + a_1 z^{-1} + a_2 z^{-2}}
+ * \f]
+ * and is implemented in transposed direct form II.
+ */
+#ifdef SWIG /* SWIG interface directives */
+SWIGLAL(IMMUTABLE_MEMBERS(tagREAL8SOSFilter, name));
+#endif /* SWIG */
+typedef struct tagREAL8SOSFilter{
+  const CHAR *name;        /**< User assigned name. */
+  REAL8 deltaT;            /**< Sampling time interval of the filter; If \f$\leq0\f$, it will be ignored (ie it will be taken from the data stream). */
+  UINT4 numSections;       /**< The number of second-order sections. */
+  UINT4 numChannels;       /**< The number of data channels filtered together. */
+  REAL8Vector *coef;       /**< The coefficients \f$b_0,b_1,b_2,a_1,a_2\f$ of each section in turn. */
+  REAL8Vector *state;      /**< The state of the sections; element \f$(2s+k)C+c\f$ is state variable \f$k\f$ of section \f$s\f$ for channel \f$c\f$ of \f$C\f$. */
+} REAL8SOSFilter;
+
 /** @} */
 
 /* Function prototypes. */
@@ -208,6 +231,16 @@ int XLALIIRFilterReverseREAL8Vector( REAL8Vector *vector, REAL8IIRFilter *filter
 int XLALIIRFilterReverseCOMPLEX8Vector( COMPLEX8Vector *vector, COMPLEX16IIRFilter *filter );
 int XLALIIRFilterReverseCOMPLEX16Vector( COMPLEX16Vector *vector, COMPLEX16IIRFilter *filter );
 
+REAL8SOSFilter *XLALCreateREAL8SOSFilter( const REAL8Vector *coef, UINT4 numChannels );
+REAL8SOSFilter *XLALCreateREAL8SOSFilterFromIIR( REAL8IIRFilter **filters, UINT4 numFilters, UINT4 numChannels );
+void XLALDestroyREAL8SOSFilter( REAL8SOSFilter *filter );
+void XLALResetREAL8SOSFilter( REAL8SOSFilter *filter );
+int XLALGetREAL8SOSFilterState( REAL8Vector *state, const REAL8SOSFilter *filter );
+int XLALSetREAL8SOSFilterState( REAL8SOSFilter *filter, const REAL8Vector *state );
+int XLALSOSFilterREAL8Vector( REAL8Vector *vector, REAL8SOSFilter *filter );
+int XLALSOSFilterREAL8VectorSequence( REAL8VectorSequence *data, REAL8SOSFilter *filter );
+int XLALSOSFilterReverseREAL8VectorSequence( REAL8VectorSequence *data, const REAL8SOSFilter *filter );
+
 REAL4 XLALIIRFilterREAL4( REAL4 x, REAL8IIRFilter *filter );
 REAL8 XLALIIRFilterREAL8( REAL8 x, REAL8IIRFilter *filter );
 /* WARNING: THIS FUNCTION IS OBSOLETE */
@@ -0,0 +1,325 @@
+/*
+*  Copyright (C) 2026 agent
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/IIRFilter.h>
+
+/**
+ * \addtogroup SOSFilter_c
+ *
+ * \brief Creates and applies filters given as cascades of second-order sections.
+ *
+ * ### Description ###
+ *
+ * A \c REAL8SOSFilter stores a filter as a cascade of second-order
+ * sections, as described in \ref IIRFilter.h, together with the state
+ * of every section for each of \c numChannels independent data
+ * channels.  High-order filters built as a single \c REAL8IIRFilter
+ * lose precision; the cascade form does not, and it is what the
+ * Butterworth routines of \ref BandPassTimeSeries.h construct section by
+ * section.
+ *
+ * The routine XLALSOSFilterREAL8VectorSequence() filters all channels
+ * of a \c REAL8VectorSequence at once, where <tt>data->length</tt> is the
+ * number of time samples and <tt>data->vectorLength</tt> is the number of
+ * channels, i.e.\ the channels are interleaved.  The filter state is
+ * updated, so that a long data stream may be filtered in consecutive
+ * chunks with the same result as if it were filtered in one go; the state
+ * may also be saved with XLALGetREAL8SOSFilterState() and restored with
+ * XLALSetREAL8SOSFilterState(), e.g.\ to resume filtering of a stream
+ * later on.  XLALSOSFilterReverseREAL8VectorSequence() applies the filter
+ * in the time-reversed sense, starting from zero state and leaving the
+ * filter state untouched, as XLALIIRFilterReverseREAL8Vector() does.
+ *
+ * ### Algorithm ###
+ *
+ * Each section is implemented in transposed direct form II, which needs
+ * two state variables per section and channel.  When filtering several
+ * channels, each time sample of all channels is passed through the
+ * sections in turn, so that the innermost loop runs over contiguous
+ * channels and is vectorized by the compiler; a single channel is passed
+ * through each section in turn, keeping the state in registers.
+ *
+ */
+/** @{ */
+
+/**
+ * Creates a \c REAL8SOSFilter for \c numChannels channels from the
+ * coefficients \f$b_0,b_1,b_2,a_1,a_2\f$ of each section in turn, with zero
+ * initial state.  The length of \c coef must be a positive multiple of 5.
+ */
+REAL8SOSFilter *XLALCreateREAL8SOSFilter( const REAL8Vector *coef, UINT4 numChannels )
+{
+  REAL8SOSFilter *filter;
+
+  if ( ! coef || ! coef->data )
+    XLAL_ERROR_NULL( XLAL_EFAULT );
+  if ( coef->length == 0 || coef->length % 5 || numChannels == 0 )
+    XLAL_ERROR_NULL( XLAL_EINVAL );
+
+  filter = LALCalloc( 1, sizeof( *filter ) );
+  if ( ! filter )
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  filter->numSections = coef->length / 5;
+  filter->numChannels = numChannels;
+  filter->coef = XLALCreateREAL8Vector( coef->length );
+  filter->state = XLALCreateREAL8Vector( 2 * filter->numSections * numChannels );
+  if ( ! filter->coef || ! filter->state )
+  {
+    XLALDestroyREAL8SOSFilter( filter );
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  }
+  memcpy( filter->coef->data, coef->data, coef->length * sizeof( *coef->data ) );
+  XLALResetREAL8SOSFilter( filter );
+
+  return filter;
+}
+
+/**
+ * Creates a \c REAL8SOSFilter for \c numChannels channels from
+ * \c numFilters IIR filters of at most second order, which become the
+ * sections of the cascade in the given order.  The sampling interval is
+ * taken from the first filter.
+ */
+REAL8SOSFilter *XLALCreateREAL8SOSFilterFromIIR( REAL8IIRFilter **filters, UINT4 numFilters, UINT4 numChannels )
+{
+  REAL8SOSFilter *filter;
+  REAL8Vector *coef;
+  UINT4 i, j;
+
+  if ( ! filters )
+    XLAL_ERROR_NULL( XLAL_EFAULT );
+  if ( numFilters == 0 )
+    XLAL_ERROR_NULL( XLAL_EINVAL );
+
+  coef = XLALCreateREAL8Vector( 5 * numFilters );
+  if ( ! coef )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  memset( coef->data, 0, coef->length * sizeof( *coef->data ) );
+
+  for ( i = 0; i < numFilters; i++ )
+  {
+    REAL8IIRFilter *iir = filters[i];
+    REAL8 *sos = coef->data + 5 * i;
+    if ( ! iir || ! iir->directCoef || ! iir->recursCoef
+        || ! iir->directCoef->data || ! iir->recursCoef->data )
+    {
+      XLALDestroyREAL8Vector( coef );
+      XLAL_ERROR_NULL( XLAL_EFAULT );
+    }
+    if ( iir->directCoef->length > 3 || iir->recursCoef->length > 3 )
+    {
+      XLALDestroyREAL8Vector( coef );
+      XLAL_ERROR_NULL( XLAL_EINVAL, "IIR filter %u has order greater than 2", i );
+    }
+    for ( j = 0; j < iir->directCoef->length; j++ )
+      sos[j] = iir->directCoef->data[j];
+    /* the recursive coefficients d_l enter with the opposite sign; d_0 is
+       redundant */
+    for ( j = 1; j < iir->recursCoef->length; j++ )
+      sos[2 + j] = -iir->recursCoef->data[j];
+  }
+
+  filter = XLALCreateREAL8SOSFilter( coef, numChannels );
+  XLALDestroyREAL8Vector( coef );
+  if ( ! filter )
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  filter->deltaT = filters[0]->deltaT;
+
+  return filter;
+}
+
+/** Destroys a \c REAL8SOSFilter */
+void XLALDestroyREAL8SOSFilter( REAL8SOSFilter *filter )
+{
+  if ( filter )
+  {
+    XLALDestroyREAL8Vector( filter->coef );
+    XLALDestroyREAL8Vector( filter->state );
+    LALFree( filter );
+  }
+  return;
+}
+
+/** Sets the state of all sections of a \c REAL8SOSFilter to zero */
+void XLALResetREAL8SOSFilter( REAL8SOSFilter *filter )
+{
+  if ( filter && filter->state && filter->state->data )
+    memset( filter->state->data, 0, filter->state->length * sizeof( *filter->state->data ) );
+  return;
+}
+
+/**
+ * Copies the state of a \c REAL8SOSFilter into \c state, which must have
+ * length <tt>2 * numSections * numChannels</tt>.
+ */
+int XLALGetREAL8SOSFilterState( REAL8Vector *state, const REAL8SOSFilter *filter )
+{
+  if ( ! state || ! state->data || ! filter || ! filter->state || ! filter->state->data )
+    XLAL_ERROR( XLAL_EFAULT );
+  if ( state->length != filter->state->length )
+    XLAL_ERROR( XLAL_EBADLEN );
+  memcpy( state->data, filter->state->data, state->length * sizeof( *state->data ) );
+  return 0;
+}
+
+/**
+ * Restores the state of a \c REAL8SOSFilter from \c state, as saved by
+ * XLALGetREAL8SOSFilterState().
+ */
+int XLALSetREAL8SOSFilterState( REAL8SOSFilter *filter, const REAL8Vector *state )
+{
+  if ( ! state || ! state->data || ! filter || ! filter->state || ! filter->state->data )
+    XLAL_ERROR( XLAL_EFAULT );
+  if ( state->length != filter->state->length )
+    XLAL_ERROR( XLAL_EBADLEN );
+  memcpy( filter->state->data, state->data, state->length * sizeof( *state->data ) );
+  return 0;
+}
+
+/* filter length samples of numChannels interleaved channels, starting at
+   data and advancing by step (+/- numChannels) samples, updating state */
+static void
+SOSFilterREAL8Samples( REAL8 *data, UINT4 length, INT4 step, UINT4 numChannels,
+                       UINT4 numSections, const REAL8 *coef, REAL8 *state )
+{
+  UINT4 i, s, c;
+
+  if ( numChannels == 1 )
+  {
+    /* one section at a time, keeping its state in registers */
+    for ( s = 0; s < numSections; s++ )
+    {
+      const REAL8 b0 = coef[5*s], b1 = coef[5*s+1], b2 = coef[5*s+2];
+      const REAL8 a1 = coef[5*s+3], a2 = coef[5*s+4];
+      REAL8 z1 = state[2*s], z2 = state[2*s+1];
+      REAL8 *x = data;
+      for ( i = 0; i < length; i++, x += step )
+      {
+        const REAL8 xi = *x;
+        const REAL8 y = b0 * xi + z1;
+        z1 = b1 * xi - a1 * y + z2;
+        z2 = b2 * xi - a2 * y;
+        *x = y;
+      }
+      state[2*s] = z1;
+      state[2*s+1] = z2;
+    }
+    return;
+  }
+
+  /* one time sample of all channels at a time */
+  for ( i = 0; i < length; i++, data += step )
+  {
+    for ( s = 0; s < numSections; s++ )
+    {
+      const REAL8 b0 = coef[5*s], b1 = coef[5*s+1], b2 = coef[5*s+2];
+      const REAL8 a1 = coef[5*s+3], a2 = coef[5*s+4];
+      REAL8 * restrict x = data;
+      REAL8 * restrict z1 = state + 2 * s * numChannels;
+      REAL8 * restrict z2 = z1 + numChannels;
+      for ( c = 0; c < numChannels; c++ )
+      {
+        const REAL8 xi = x[c];
+        const REAL8 y = b0 * xi + z1[c];
+        z1[c] = b1 * xi - a1 * y + z2[c];
+        z2[c] = b2 * xi - a2 * y;
+        x[c] = y;
+      }
+    }
+  }
+  return;
+}
+
+/**
+ * Applies a single-channel \c REAL8SOSFilter to a vector in place,
+ * updating the filter state.
+ */
+int XLALSOSFilterREAL8Vector( REAL8Vector *vector, REAL8SOSFilter *filter )
+{
+  if ( ! vector || ! filter )
+    XLAL_ERROR( XLAL_EFAULT );
+  if ( ! vector->data || ! filter->coef || ! filter->state
+      || ! filter->coef->data || ! filter->state->data )
+    XLAL_ERROR( XLAL_EINVAL );
+  if ( filter->numChannels != 1 )
+    XLAL_ERROR( XLAL_EBADLEN, "Filter has %u channels, not 1", filter->numChannels );
+
+  SOSFilterREAL8Samples( vector->data, vector->length, 1, 1,
+                         filter->numSections, filter->coef->data, filter->state->data );
+
+  return 0;
+}
+
+/**
+ * Applies a \c REAL8SOSFilter in place to a sequence of time samples of
+ * <tt>data->vectorLength</tt> interleaved channels, which must equal the
+ * number of channels of the filter, updating the filter state.
+ */
+int XLALSOSFilterREAL8VectorSequence( REAL8VectorSequence *data, REAL8SOSFilter *filter )
+{
+  if ( ! data || ! filter )
+    XLAL_ERROR( XLAL_EFAULT );
+  if ( ! data->data || ! filter->coef || ! filter->state
+      || ! filter->coef->data || ! filter->state->data )
+    XLAL_ERROR( XLAL_EINVAL );
+  if ( data->vectorLength != filter->numChannels )
+    XLAL_ERROR( XLAL_EBADLEN, "Data has %u channels, filter has %u", data->vectorLength, filter->numChannels );
+
+  SOSFilterREAL8Samples( data->data, data->length, data->vectorLength, data->vectorLength,
+                         filter->numSections, filter->coef->data, filter->state->data );
+
+  return 0;
+}
+
+/**
+ * Applies a \c REAL8SOSFilter in place to a sequence of time samples of
+ * <tt>data->vectorLength</tt> interleaved channels in the time-reversed
+ * sense, starting from zero state.  The filter state is not changed.
+ */
+int XLALSOSFilterReverseREAL8VectorSequence( REAL8VectorSequence *data, const REAL8SOSFilter *filter )
+{
+  REAL8 *state;
+
+  if ( ! data || ! filter )
+    XLAL_ERROR( XLAL_EFAULT );
+  if ( ! data->data || ! filter->coef || ! filter->coef->data )
+    XLAL_ERROR( XLAL_EINVAL );
+  if ( data->vectorLength != filter->numChannels )
+    XLAL_ERROR( XLAL_EBADLEN, "Data has %u channels, filter has %u", data->vectorLength, filter->numChannels );
+
+  if ( data->length == 0 )
+    return 0;
+
+  state = LALCalloc( 2 * filter->numSections * filter->numChannels, sizeof( *state ) );
+  if ( ! state )
+    XLAL_ERROR( XLAL_ENOMEM );
+
+  SOSFilterREAL8Samples( data->data + (size_t) ( data->length - 1 ) * data->vectorLength,
+                         data->length, -(INT4) data->vectorLength, data->vectorLength,
+                         filter->numSections, filter->coef->data, state );
+
+  LALFree( state );
+
+  return 0;
+}
+
+/** @} */
@@ -18,9 +18,21 @@
 */
 
 /*
- * Dictionary is implemented as a hash search with algorithm adopted
- * from "The C Programming Language" by Kernighan and Ritchie, 2nd ed.
- * section 6.6.
+ * Dictionary is implemented as an open-addressing hash table with linear
+ * probing.  Each slot stores the full hash of its key inline alongside a
+ * pointer to the entry, so that probing only touches the key string of an
+ * entry when the hashes match, and a lookup of a missing key usually stops
+ * at the first empty slot.  The number of slots is a power of two and is
+ * doubled whenever the table becomes more than 3/4 full; entries are removed
+ * by shifting later members of the probe sequence backwards, so no
+ * tombstones are needed.
+ *
+ * Keys are not interned: each entry owns its own copy of its key, as the
+ * key strings passed in by callers are transient (often built on the fly)
+ * and may be freed or reused as soon as the call returns.  A process-wide
+ * table of interned strings would need its own locking and could never
+ * release its memory; comparing the inline hashes before calling strcmp()
+ * already means a successful lookup compares the key string only once.
  */
 
 #include <stdio.h>
@@ -35,37 +47,83 @@
 #include "LALValue_private.h"
 #include "config.h"
 
-#define LAL_DICT_HASHSIZE 101
+#define LAL_DICT_MINSIZE 16 /* initial number of slots: must be a power of two */
 
 struct tagLALDictEntry {
-        struct tagLALDictEntry *next;
+        struct tagLALDictEntry *next; /* always NULL for entries in a dict */
         char *key;
 	LALValue value;
 };
 
+struct tagLALDictSlot {
+	size_t hash; /* hash of the entry key */
+	struct tagLALDictEntry *entry; /* NULL if slot is empty */
+};
+
 struct tagLALDict {
-	size_t size;
-	struct tagLALDictEntry *hashes[];
+	size_t size; /* number of slots: a power of two */
+	size_t count; /* number of occupied slots */
+	struct tagLALDictSlot *slots;
 };
 
+/* FNV-1a string hash */
 static size_t hash(const char *s)
 {
-	size_t hashval;
-	for (hashval = 0; *s != '\0'; ++s)
-		hashval = *s + 31 * hashval;
-	return hashval;
+	UINT8 hashval = 14695981039346656037ULL;
+	for (; *s != '\0'; ++s) {
+		hashval ^= (unsigned char)(*s);
+		hashval *= 1099511628211ULL;
+	}
+	return (size_t)hashval;
+}
+
+/* return slot holding key, or the empty slot at which it would be inserted */
+static size_t find_slot(const LALDict *dict, const char *key, size_t hashval)
+{
+	const size_t mask = dict->size - 1;
+	size_t i = hashval & mask;
+	while (dict->slots[i].entry) {
+		const struct tagLALDictSlot *slot = &dict->slots[i];
+		if (slot->hash == hashval && strcmp(slot->entry->key, key) == 0)
+			break;
+		i = (i + 1) & mask;
+	}
+	return i;
+}
+
+/* resize slot array to newsize slots, re-inserting all entries */
+static int resize(LALDict *dict, size_t newsize)
+{
+	struct tagLALDictSlot *oldslots = dict->slots;
+	size_t oldsize = dict->size;
+	size_t i;
+	dict->slots = XLALCalloc(newsize, sizeof(*dict->slots));
+	if (!dict->slots) {
+		dict->slots = oldslots;
+		XLAL_ERROR(XLAL_ENOMEM);
+	}
+	dict->size = newsize;
+	for (i = 0; i < oldsize; ++i)
+		if (oldslots[i].entry) {
+			size_t j = oldslots[i].hash & (newsize - 1);
+			while (dict->slots[j].entry)
+				j = (j + 1) & (newsize - 1);
+			dict->slots[j] = oldslots[i];
+		}
+	LALFree(oldslots);
+	return 0;
 }
 
 /* DICT ENTRY ROUTINES */
 
-void XLALDictEntryFree(LALDictEntry *list)
+void XLALDictEntryFree(LALDictEntry *entry)
 {
-	while (list) {
-		LALDictEntry *next = list->next;
-		if (list->key)
-			LALFree(list->key);
-		LALFree(list);
-		list = next;
+	while (entry) {
+		LALDictEntry *next = entry->next;
+		if (entry->key)
+			LALFree(entry->key);
+		LALFree(entry);
+		entry = next;
 	}
 	return;
 }
@@ -76,6 +134,7 @@ LALDictEntry * XLALDictEntryAlloc(size_t size)
 	entry = XLALMalloc(sizeof(*entry) + size);
 	if (!entry)
 		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	entry->next = NULL;
 	entry->key = NULL;
 	entry->value.size = size;
 	return entry;
@@ -129,7 +188,8 @@ void XLALDestroyDict(LALDict *dict)
 	if (dict) {
 		size_t i;
 		for (i = 0; i < dict->size; ++i)
-			XLALDictEntryFree(dict->hashes[i]);
+			XLALDictEntryFree(dict->slots[i].entry);
+		LALFree(dict->slots);
 		LALFree(dict);
 	}
 	return;
@@ -138,10 +198,16 @@ void XLALDestroyDict(LALDict *dict)
 LALDict * XLALCreateDict(void)
 {
 	LALDict *dict;
-	dict = XLALCalloc(1, sizeof(dict) + LAL_DICT_HASHSIZE * sizeof(*dict->hashes));
+	dict = XLALMalloc(sizeof(*dict));
 	if (!dict)
 		XLAL_ERROR_NULL(XLAL_ENOMEM);
-	dict->size = LAL_DICT_HASHSIZE;
+	dict->slots = XLALCalloc(LAL_DICT_MINSIZE, sizeof(*dict->slots));
+	if (!dict->slots) {
+		LALFree(dict);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+	dict->size = LAL_DICT_MINSIZE;
+	dict->count = 0;
 	return dict;
 }
 
@@ -149,8 +215,8 @@ void XLALDictForeach(LALDict *dict, void (*func)(char *, LALValue *, void *), vo
 {
 	size_t i;
 	for (i = 0; i < dict->size; ++i) {
-		LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next)
+		LALDictEntry *entry = dict->slots[i].entry;
+		if (entry)
 			func(entry->key, &entry->value, thunk);
 	}
 	return;
@@ -160,10 +226,9 @@ LALDictEntry * XLALDictFind(LALDict *dict, int (*func)(const char *, const LALVa
 {
 	size_t i;
 	for (i = 0; i < dict->size; ++i) {
-		LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next)
-			if (func(entry->key, &entry->value, thunk))
-				return entry;
+		LALDictEntry *entry = dict->slots[i].entry;
+		if (entry && func(entry->key, &entry->value, thunk))
+			return entry;
 	}
 	return NULL;
 }
@@ -172,25 +237,15 @@ void XLALDictIterInit(LALDictIter *iter, LALDict *dict)
 {
 	iter->dict = dict;
 	iter->pos = 0;
-	iter->next = NULL;
 	return;
 }
 
 LALDictEntry * XLALDictIterNext(LALDictIter *iter)
 {
-	while (1) {
-
-		if (iter->next) {
-			LALDictEntry *entry = iter->next;
-			iter->next = entry->next;
+	while (iter->pos < iter->dict->size) {
+		LALDictEntry *entry = iter->dict->slots[iter->pos++].entry;
+		if (entry)
 			return entry;
-		}
-
-		/* check end of iteration */
-		if (iter->pos >= iter->dict->size)
-			return NULL;
-
-		iter->next = iter->dict->hashes[iter->pos++];
 	}
 	return NULL;
 }
@@ -204,8 +259,8 @@ LALDict * XLALDictDuplicate(LALDict *old)
     if (!new)
         XLAL_ERROR_NULL(XLAL_ENOMEM);
     for (i = 0; i < old->size; ++i) {
-        const LALDictEntry *entry;
-        for (entry = old->hashes[i]; entry != NULL; entry = entry->next) {
+        const LALDictEntry *entry = old->slots[i].entry;
+        if (entry) {
             const char *key = XLALDictEntryGetKey(entry);
             XLAL_TRY(XLALDictInsertValue(new, key, XLALDictEntryGetValue(entry)), retcode);
             if(retcode!=XLAL_SUCCESS)
@@ -226,8 +281,8 @@ LALList * XLALDictKeys(const LALDict *dict)
 	if (!list)
 		XLAL_ERROR_NULL(XLAL_EFUNC);
 	for (i = 0; i < dict->size; ++i) {
-		const LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next) {
+		const LALDictEntry *entry = dict->slots[i].entry;
+		if (entry) {
 			const char *key = XLALDictEntryGetKey(entry);
 			if (XLALListAddStringValue(list, key) < 0) {
 				XLALDestroyList(list);
@@ -246,8 +301,8 @@ LALList * XLALDictValues(const LALDict *dict)
 	if (!list)
 		XLAL_ERROR_NULL(XLAL_EFUNC);
 	for (i = 0; i < dict->size; ++i) {
-		const LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next) {
+		const LALDictEntry *entry = dict->slots[i].entry;
+		if (entry) {
 			const LALValue *value = XLALDictEntryGetValue(entry);
 			if (XLALListAddValue(list, value) < 0) {
 				XLALDestroyList(list);
@@ -260,84 +315,58 @@ LALList * XLALDictValues(const LALDict *dict)
 
 int XLALDictContains(const LALDict *dict, const char *key)
 {
-	const LALDictEntry *entry;
-	for (entry = dict->hashes[hash(key) % dict->size]; entry != NULL; entry = entry->next)
-		if (strcmp(key, entry->key) == 0)
-			return 1;
-	return 0;
+	return dict->slots[find_slot(dict, key, hash(key))].entry != NULL;
 }
 
 size_t XLALDictSize(const LALDict *dict)
 {
-	size_t size = 0;
-	size_t i;
-	for (i = 0; i < dict->size; ++i) {
-		const LALDictEntry *entry;
-		for (entry = dict->hashes[i]; entry != NULL; entry = entry->next)
-			++size;
-	}
-	return size;
+	return dict->count;
 }
 
 LALDictEntry *XLALDictLookup(LALDict *dict, const char *key)
 {
-	LALDictEntry *entry;
-	for (entry = dict->hashes[hash(key) % dict->size]; entry != NULL; entry = entry->next)
-		if (strcmp(key, entry->key) == 0)
-			return entry;
-	return NULL;
+	return dict->slots[find_slot(dict, key, hash(key))].entry;
 }
 
 int XLALDictRemove(LALDict *dict, const char *key)
 {
-	size_t hashidx = hash(key) % dict->size;
-	LALDictEntry *this = dict->hashes[hashidx];
-	LALDictEntry *prev = this;
-	while (this) {
-		if (strcmp(this->key, key) == 0) { /* found it! */
-			if (prev == this) /* head is removed */
-				dict->hashes[hashidx] = this->next;
-			else
-				prev->next = this->next;
-			if (this->key)
-				LALFree(this->key);
-			LALFree(this);
-			return 0;
+	const size_t mask = dict->size - 1;
+	size_t i = find_slot(dict, key, hash(key));
+	size_t j;
+	if (dict->slots[i].entry == NULL)
+		return -1; /* not found */
+	XLALDictEntryFree(dict->slots[i].entry);
+	dict->slots[i].entry = NULL;
+	--dict->count;
+	/* shift back later entries in this probe sequence that may no longer
+	 * be reachable from their home slot across the new gap at i */
+	for (j = (i + 1) & mask; dict->slots[j].entry; j = (j + 1) & mask) {
+		size_t home = dict->slots[j].hash & mask;
+		if (((j - home) & mask) >= ((j - i) & mask)) {
+			dict->slots[i] = dict->slots[j];
+			dict->slots[j].entry = NULL;
+			i = j;
 		}
-		prev = this;
-		this = this->next;
 	}
-	return -1; /* not found */
+	return 0;
 }
 
 int XLALDictInsert(LALDict *dict, const char *key, const void *data, size_t size, LALTYPECODE type)
 {
-	size_t hashidx = hash(key) % dict->size;
-	LALDictEntry *this = dict->hashes[hashidx];
-	LALDictEntry *prev = NULL;
+	size_t hashval = hash(key);
+	size_t i = find_slot(dict, key, hashval);
 	LALDictEntry *entry;
 
 	/* see if entry already exists */
-	while (this) {
-		if (strcmp(this->key, key) == 0) { /* found it! */
-			entry = XLALDictEntryRealloc(this, size);
-			if (entry == NULL)
-				XLAL_ERROR(XLAL_EFUNC);
-			if (entry != this) { /* relink */
-				if (prev == NULL) /* head is moved */
-					dict->hashes[hashidx] = entry;
-				else
-					prev->next = entry;
-			}
-			entry = XLALDictEntrySetValue(entry, data, size, type);
-
-			if (entry == NULL)
-				XLAL_ERROR(XLAL_EFUNC);
-
-			return 0;
-		}
-		prev = this;
-		this = this->next;
+	if (dict->slots[i].entry) {
+		entry = XLALDictEntryRealloc(dict->slots[i].entry, size);
+		if (entry == NULL)
+			XLAL_ERROR(XLAL_EFUNC);
+		dict->slots[i].entry = entry;
+		entry = XLALDictEntrySetValue(entry, data, size, type);
+		if (entry == NULL)
+			XLAL_ERROR(XLAL_EFUNC);
+		return 0;
 	}
 
 	/* not found: create new entry */
@@ -345,20 +374,28 @@ int XLALDictInsert(LALDict *dict, const char *key, const void *data, size_t size
 	if (entry == NULL)
 		XLAL_ERROR(XLAL_EFUNC);
 
-	entry = XLALDictEntrySetKey(entry, key);
-	if (entry == NULL) {
+	if (XLALDictEntrySetKey(entry, key) == NULL) {
 		LALFree(entry);
 		XLAL_ERROR(XLAL_EFUNC);
 	}
 
-	entry = XLALDictEntrySetValue(entry, data, size, type);
-	if (entry == NULL) {
-		LALFree(entry);
+	if (XLALDictEntrySetValue(entry, data, size, type) == NULL) {
+		XLALDictEntryFree(entry);
 		XLAL_ERROR(XLAL_EFUNC);
 	}
 
-	entry->next = dict->hashes[hashidx];
-	dict->hashes[hashidx] = entry;
+	/* grow table if it would become more than 3/4 full */
+	if (4 * (dict->count + 1) > 3 * dict->size) {
+		if (resize(dict, 2 * dict->size) < 0) {
+			XLALDictEntryFree(entry);
+			XLAL_ERROR(XLAL_EFUNC);
+		}
+		i = find_slot(dict, key, hashval);
+	}
+
+	dict->slots[i].hash = hashval;
+	dict->slots[i].entry = entry;
+	++dict->count;
 	return 0;
 }
 
@@ -41,12 +41,11 @@ typedef struct tagLALDict LALDict;
 struct tagLALDictIter {
 	/* private data */
 	struct tagLALDict *dict;
-	struct tagLALDictEntry *next;
 	size_t pos;
 };
 typedef struct tagLALDictIter LALDictIter;
 
-void XLALDictEntryFree(LALDictEntry *list);
+void XLALDictEntryFree(LALDictEntry *entry);
 LALDictEntry * XLALDictEntryAlloc(size_t size);
 LALDictEntry * XLALDictEntryRealloc(LALDictEntry *entry, size_t size);
 LALDictEntry * XLALDictEntrySetKey(LALDictEntry *entry, const char *key);
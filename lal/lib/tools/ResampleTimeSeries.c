@@ -18,6 +18,8 @@
 */
 
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALStdio.h>
 #include <lal/AVFactories.h>
@@ -25,6 +27,9 @@
 #include <lal/IIRFilter.h>
 #include <lal/BandPassTimeSeries.h>
 #include <lal/ResampleTimeSeries.h>
+#include <lal/RealFFT.h>
+#include <lal/Sequence.h>
+#include <lal/Window.h>
 
 #if __GNUC__
 #define UNUSED __attribute__ ((unused))
@@ -218,6 +223,433 @@ int XLALResampleREAL8TimeSeries( REAL8TimeSeries *series, REAL8 dt )
 }
 
 
+/*
+ * Polyphase FIR resampler
+ */
+
+/** Structure holding the polyphase filter bank and the stream state of a #LALREAL8Resampler */
+struct tagLALREAL8Resampler {
+  UINT4 up;		/* upsampling factor L */
+  UINT4 down;		/* downsampling factor M */
+  UINT4 halfTaps;	/* each output sample depends on input samples n0 - halfTaps .. n0 + halfTaps */
+  UINT4 taps;		/* number of taps in each polyphase branch (2 * halfTaps + 1) */
+  REAL8 *coef;		/* polyphase filter bank: branch p occupies coef[p * taps .. (p + 1) * taps - 1] */
+  REAL8 *buffer;	/* input samples that are still needed to compute future output */
+  UINT4 bufferLength;	/* number of samples in buffer */
+  UINT4 bufferSize;	/* allocated size of buffer */
+  INT8 bufferStart;	/* index in the input stream of buffer[0] */
+  INT8 outputCount;	/* index in the output stream of the next output sample */
+};
+
+/**
+ * Creates a polyphase FIR resampler which changes the sample rate of a
+ * stream of \c REAL8 data by the rational factor \c upFactor / \c downFactor.
+ *
+ * The anti-aliasing (and anti-imaging) filter is a sinc function with its
+ * cutoff at the lower of the input and output Nyquist frequencies, tapered
+ * by a Kaiser window with shape parameter \c beta, which extends over
+ * \c halfLength samples at the lower of the two sample rates on either
+ * side of each output sample. Each polyphase branch is normalized to unit
+ * gain at DC. <tt>halfLength = 10, beta = 5</tt> are reasonable defaults;
+ * increase \c halfLength for a sharper transition band and \c beta for
+ * stronger stopband attenuation.
+ *
+ * Output sample \f$k\f$ is aligned with input sample \f$k\,\mathrm{downFactor}
+ * / \mathrm{upFactor}\f$, i.e.\ there is no time shift, and samples before the
+ * start of the stream are taken to be zero. The factors are reduced to lowest
+ * terms.
+ */
+LALREAL8Resampler *XLALREAL8ResamplerCreate( UINT4 upFactor, UINT4 downFactor, UINT4 halfLength, REAL8 beta )
+{
+  LALREAL8Resampler *resampler;
+  REAL8Window *window;
+  UINT4 a, b, maxFactor, halfWidth;
+  UINT4 p, t;
+
+  XLAL_CHECK_NULL( upFactor > 0 && downFactor > 0, XLAL_EINVAL, "Resampling factors must be positive" );
+  XLAL_CHECK_NULL( halfLength > 0, XLAL_EINVAL, "Filter half-length must be positive" );
+  XLAL_CHECK_NULL( beta >= 0, XLAL_EINVAL, "Kaiser window parameter must be non-negative" );
+
+  /* reduce the resampling ratio to lowest terms */
+  a = upFactor;
+  b = downFactor;
+  while ( b )
+  {
+    UINT4 r = a % b;
+    a = b;
+    b = r;
+  }
+  upFactor /= a;
+  downFactor /= a;
+
+  /* half width of the prototype filter, in samples at the upsampled rate */
+  maxFactor = upFactor > downFactor ? upFactor : downFactor;
+  XLAL_CHECK_NULL( (UINT8) halfLength * maxFactor < (UINT8) 1 << 28, XLAL_EINVAL, "Filter is too long" );
+  halfWidth = halfLength * maxFactor;
+
+  resampler = LALCalloc( 1, sizeof( *resampler ) );
+  XLAL_CHECK_NULL( resampler, XLAL_ENOMEM );
+  resampler->up = upFactor;
+  resampler->down = downFactor;
+  resampler->halfTaps = ( halfWidth + upFactor - 1 ) / upFactor;
+  resampler->taps = 2 * resampler->halfTaps + 1;
+  resampler->coef = LALCalloc( (size_t) upFactor * resampler->taps, sizeof( *resampler->coef ) );
+  resampler->bufferSize = resampler->taps;
+  resampler->buffer = LALMalloc( resampler->bufferSize * sizeof( *resampler->buffer ) );
+  window = XLALCreateKaiserREAL8Window( 2 * halfWidth + 1, beta );
+  if ( ! resampler->coef || ! resampler->buffer || ! window )
+  {
+    XLALDestroyREAL8Window( window );
+    XLALREAL8ResamplerDestroy( resampler );
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  }
+
+  /*
+   * Output sample k sits at index u = k M of the upsampled stream. With
+   * n0 = floor( u / L ) and phase p = u - n0 L, input sample n0 - Q + t
+   * (Q = halfTaps) sits at a distance j = p + ( Q - t ) L from it, which
+   * selects tap t of branch p from the windowed sinc prototype.
+   */
+  for ( p = 0; p < upFactor; ++p )
+  {
+    REAL8 *coef = resampler->coef + (size_t) p * resampler->taps;
+    REAL8 sum = 0;
+    for ( t = 0; t < resampler->taps; ++t )
+    {
+      INT8 j = (INT8) p + ( (INT8) resampler->halfTaps - t ) * upFactor;
+      if ( llabs( j ) > halfWidth )
+        continue;
+      if ( j == 0 )
+        coef[t] = 1.0;
+      else
+        coef[t] = sin( LAL_PI * j / maxFactor ) / ( LAL_PI * j / maxFactor );
+      coef[t] *= window->data->data[j + halfWidth];
+      sum += coef[t];
+    }
+    for ( t = 0; t < resampler->taps; ++t )
+      coef[t] /= sum;
+  }
+  XLALDestroyREAL8Window( window );
+
+  XLALREAL8ResamplerReset( resampler );
+
+  return resampler;
+}
+
+/** Destroys a #LALREAL8Resampler created by XLALREAL8ResamplerCreate() */
+void XLALREAL8ResamplerDestroy( LALREAL8Resampler *resampler )
+{
+  if ( ! resampler )
+    return;
+  LALFree( resampler->coef );
+  LALFree( resampler->buffer );
+  LALFree( resampler );
+  return;
+}
+
+/**
+ * Resets the stream state of a #LALREAL8Resampler, so that it can be
+ * reused for a new, unrelated stream; the filter bank is kept.
+ */
+void XLALREAL8ResamplerReset( LALREAL8Resampler *resampler )
+{
+  if ( ! resampler )
+    return;
+  /* the samples before the start of the stream are zero */
+  resampler->bufferLength = resampler->halfTaps;
+  memset( resampler->buffer, 0, resampler->bufferLength * sizeof( *resampler->buffer ) );
+  resampler->bufferStart = -(INT8) resampler->bufferLength;
+  resampler->outputCount = 0;
+  return;
+}
+
+/**
+ * Returns the number of input samples which a #LALREAL8Resampler must see
+ * beyond the input sample aligned with an output sample before it can
+ * produce that output sample. Feeding this many zeros after the end of the
+ * input stream flushes out the final output samples.
+ */
+UINT4 XLALREAL8ResamplerLatency( const LALREAL8Resampler *resampler )
+{
+  XLAL_CHECK_VAL( 0, resampler, XLAL_EFAULT );
+  return resampler->halfTaps;
+}
+
+/**
+ * Returns the number of output samples that the next call to
+ * XLALREAL8ResamplerApply() will produce from \c inLength input samples.
+ */
+UINT4 XLALREAL8ResamplerOutputLength( const LALREAL8Resampler *resampler, UINT4 inLength )
+{
+  INT8 available, last;
+  XLAL_CHECK_VAL( 0, resampler, XLAL_EFAULT );
+  /* index of the last input sample that will be available */
+  available = resampler->bufferStart + resampler->bufferLength + inLength;
+  /* output sample k is ready once floor( k M / L ) + Q < available */
+  last = available - resampler->halfTaps - 1;
+  if ( last < 0 )
+    return 0;
+  last = ( ( last + 1 ) * resampler->up - 1 ) / resampler->down;
+  return last < resampler->outputCount ? 0 : (UINT4) ( last - resampler->outputCount + 1 );
+}
+
+/**
+ * Feeds the next \c inLength samples of the input stream to a
+ * #LALREAL8Resampler, and writes all output samples that can be computed so
+ * far to \c out, which must have room for
+ * XLALREAL8ResamplerOutputLength() samples. Returns the number of output
+ * samples written, or #XLAL_FAILURE on error.
+ *
+ * The output does not depend on how the input stream is split into chunks.
+ */
+int XLALREAL8ResamplerApply( LALREAL8Resampler *resampler, REAL8 *out, const REAL8 *in, UINT4 inLength )
+{
+  const UINT4 L = resampler ? resampler->up : 1;
+  const UINT4 M = resampler ? resampler->down : 1;
+  UINT4 outLength, k;
+  INT8 n0;
+
+  XLAL_CHECK( resampler, XLAL_EFAULT );
+  XLAL_CHECK( in || inLength == 0, XLAL_EFAULT );
+
+  outLength = XLALREAL8ResamplerOutputLength( resampler, inLength );
+  XLAL_CHECK( out || outLength == 0, XLAL_EFAULT );
+
+  /* append the input to the buffer */
+  if ( resampler->bufferLength + inLength > resampler->bufferSize )
+  {
+    UINT4 size = resampler->bufferLength + inLength;
+    REAL8 *buffer = LALRealloc( resampler->buffer, size * sizeof( *buffer ) );
+    XLAL_CHECK( buffer, XLAL_ENOMEM );
+    resampler->buffer = buffer;
+    resampler->bufferSize = size;
+  }
+  if ( inLength )
+    memcpy( resampler->buffer + resampler->bufferLength, in, inLength * sizeof( *in ) );
+  resampler->bufferLength += inLength;
+
+  /* compute the output samples */
+  for ( k = 0; k < outLength; ++k )
+  {
+    const INT8 u = ( resampler->outputCount + k ) * M;
+    const REAL8 *coef = resampler->coef + (size_t) ( u % L ) * resampler->taps;
+    const REAL8 *x;
+    REAL8 sum = 0;
+    UINT4 t;
+    n0 = u / L;
+    x = resampler->buffer + ( n0 - resampler->halfTaps - resampler->bufferStart );
+    for ( t = 0; t < resampler->taps; ++t )
+      sum += coef[t] * x[t];
+    out[k] = sum;
+  }
+  resampler->outputCount += outLength;
+
+  /* discard input samples which are no longer needed */
+  n0 = resampler->outputCount * M / L - resampler->halfTaps;
+  if ( n0 > resampler->bufferStart )
+  {
+    UINT4 discard = n0 - resampler->bufferStart;
+    if ( discard > resampler->bufferLength )
+      discard = resampler->bufferLength;
+    memmove( resampler->buffer, resampler->buffer + discard, ( resampler->bufferLength - discard ) * sizeof( *resampler->buffer ) );
+    resampler->bufferLength -= discard;
+    resampler->bufferStart += discard;
+  }
+
+  return outLength;
+}
+
+/* find the rational approximation M / L to dt / deltaT */
+static int rational_resample_factors( UINT4 *up, UINT4 *down, REAL8 deltaT, REAL8 dt )
+{
+  const UINT4 maxFactor = 1024;
+  const REAL8 ratio = dt / deltaT;
+  /* continued fraction convergents h / k of ratio */
+  REAL8 x = ratio;
+  UINT8 h0 = 0, h1 = 1, k0 = 1, k1 = 0;
+  XLAL_CHECK( deltaT > 0 && dt > 0, XLAL_EINVAL, "Sample intervals must be positive" );
+  XLAL_CHECK( ratio <= maxFactor && ratio * maxFactor >= 1, XLAL_EDOM,
+      "Resampling ratio %g is outside [1/%u, %u]", ratio, maxFactor, maxFactor );
+  while ( 1 )
+  {
+    const REAL8 a = floor( x );
+    /* the next convergent would exceed the maximum factor; checked before
+     * converting to an integer, as a may be arbitrarily large */
+    if ( a > maxFactor )
+      break;
+    const UINT8 h = a * h1 + h0;
+    const UINT8 k = a * k1 + k0;
+    if ( h > maxFactor || k > maxFactor )
+      break;
+    h0 = h1;
+    h1 = h;
+    k0 = k1;
+    k1 = k;
+    if ( fabs( (REAL8) h / k - ratio ) <= 1e-9 * ratio || x == a )
+      break;
+    x = 1.0 / ( x - a );
+  }
+  XLAL_CHECK( h1 > 0 && k1 > 0 && fabs( (REAL8) h1 / k1 - ratio ) <= 1e-9 * ratio, XLAL_EINVAL,
+      "Resampling ratio %g is not a ratio of integers <= %u", ratio, maxFactor );
+  *down = h1;
+  *up = k1;
+  return 0;
+}
+
+/**
+ * Resamples a time series to the sample interval \c dt with a polyphase FIR
+ * filter. The ratio <tt>dt / series->deltaT</tt> must be a ratio of integers
+ * no larger than 1024; a ratio outside <tt>[1/1024, 1024]</tt> fails with
+ * #XLAL_EDOM. The filter is a Kaiser-windowed sinc with
+ * <tt>halfLength = 10, beta = 5</tt>, see XLALREAL8ResamplerCreate(). There
+ * is no time shift in the output time series; the series is padded with
+ * zeros beyond its ends, so the data within \c halfLength output samples of
+ * either end are corrupted. The length of the time series is scaled by
+ * the resampling ratio and rounded down.
+ *
+ * Since the filter is applied only at the output samples, this is much
+ * faster than XLALResampleREAL8TimeSeries() when downsampling.
+ */
+int XLALResampleREAL8TimeSeriesFIR( REAL8TimeSeries *series, REAL8 dt )
+{
+  LALREAL8Resampler *resampler;
+  REAL8Sequence *data;
+  REAL8 *zeros;
+  UINT4 up, down, latency, length, n;
+  int nin, nflush;
+
+  XLAL_CHECK( series && series->data && series->data->data, XLAL_EFAULT );
+  XLAL_CHECK( rational_resample_factors( &up, &down, series->deltaT, dt ) == 0, XLAL_EFUNC );
+
+  /* just return if no resampling is required */
+  if ( up == down )
+  {
+    XLALPrintInfo( "XLAL Info - %s: No resampling required", __func__ );
+    return 0;
+  }
+
+  resampler = XLALREAL8ResamplerCreate( up, down, 10, 5.0 );
+  XLAL_CHECK( resampler, XLAL_EFUNC );
+  latency = XLALREAL8ResamplerLatency( resampler );
+  length = ( (UINT8) series->data->length * up ) / down;
+
+  /* the output of the full input stream, followed by enough zeros to flush it */
+  n = XLALREAL8ResamplerOutputLength( resampler, series->data->length + latency );
+  data = XLALCreateREAL8Sequence( n > length ? n : length );
+  zeros = LALCalloc( latency, sizeof( *zeros ) );
+  if ( ! data || ! zeros )
+  {
+    XLALDestroyREAL8Sequence( data );
+    LALFree( zeros );
+    XLALREAL8ResamplerDestroy( resampler );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+  nin = XLALREAL8ResamplerApply( resampler, data->data, series->data->data, series->data->length );
+  nflush = nin < 0 ? XLAL_FAILURE : XLALREAL8ResamplerApply( resampler, data->data + nin, zeros, latency );
+  LALFree( zeros );
+  XLALREAL8ResamplerDestroy( resampler );
+  if ( nin < 0 || nflush < 0 || (UINT4) nin + (UINT4) nflush < length )
+  {
+    XLALDestroyREAL8Sequence( data );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+
+  data->length = length;
+  XLALDestroyREAL8Sequence( series->data );
+  series->data = data;
+  series->deltaT = dt;
+
+  return 0;
+}
+
+/**
+ * Resamples a whole time series to the sample interval \c dt in the
+ * frequency domain: the Fourier transform of the series is truncated at
+ * (or zero-padded to) the new Nyquist frequency and transformed back.
+ * The duration of the series must be an integer multiple of \c dt.
+ * This is an ideal low-pass filter for a periodic signal, so unlike
+ * the time-domain filters there is no corruption at the ends of the
+ * series except for the effect of the implicit periodic wrap-around; it is
+ * most efficient when the lengths of the input and output series have
+ * only small prime factors.
+ */
+int XLALResampleREAL8TimeSeriesFFT( REAL8TimeSeries *series, REAL8 dt )
+{
+  REAL8FFTPlan *fwdplan = NULL;
+  REAL8FFTPlan *revplan = NULL;
+  COMPLEX16Vector *fin = NULL;
+  COMPLEX16Vector *fout = NULL;
+  REAL8Vector *out = NULL;
+  UINT4 length, newLength, nbins, k;
+  REAL8 duration;
+
+  XLAL_CHECK( series && series->data && series->data->data, XLAL_EFAULT );
+  XLAL_CHECK( series->deltaT > 0 && dt > 0, XLAL_EINVAL, "Sample intervals must be positive" );
+  length = series->data->length;
+  duration = length * series->deltaT;
+  newLength = floor( duration / dt + 0.5 );
+  XLAL_CHECK( newLength > 0 && fabs( newLength * dt - duration ) <= 1e-3 * dt, XLAL_EINVAL,
+      "Duration %g s is not an integer multiple of dt = %g s", duration, dt );
+
+  /* just return if no resampling is required */
+  if ( newLength == length )
+  {
+    XLALPrintInfo( "XLAL Info - %s: No resampling required", __func__ );
+    return 0;
+  }
+
+  fwdplan = XLALCreateForwardREAL8FFTPlan( length, 0 );
+  revplan = XLALCreateReverseREAL8FFTPlan( newLength, 0 );
+  fin = XLALCreateCOMPLEX16Vector( length / 2 + 1 );
+  fout = XLALCreateCOMPLEX16Vector( newLength / 2 + 1 );
+  out = XLALCreateREAL8Vector( newLength );
+  if ( ! fwdplan || ! revplan || ! fin || ! fout || ! out )
+    goto error;
+
+  if ( XLALREAL8ForwardFFT( fin, series->data, fwdplan ) < 0 )
+    goto error;
+
+  /* copy the frequency bins common to both series, and normalize */
+  nbins = ( length < newLength ? length : newLength ) / 2 + 1;
+  for ( k = 0; k < nbins; ++k )
+    fout->data[k] = fin->data[k] / length;
+  for ( ; k < fout->length; ++k )
+    fout->data[k] = 0;
+
+  /*
+   * The Nyquist bin of an even-length series stands for both the positive
+   * and negative frequency; split it when upsampling, and fold both halves
+   * into it when downsampling.
+   */
+  if ( length < newLength && length % 2 == 0 )
+    fout->data[length / 2] *= 0.5;
+  else if ( newLength < length && newLength % 2 == 0 )
+    fout->data[newLength / 2] = 2.0 * creal( fout->data[newLength / 2] );
+
+  if ( XLALREAL8ReverseFFT( out, fout, revplan ) < 0 )
+    goto error;
+
+  XLALDestroyREAL8FFTPlan( fwdplan );
+  XLALDestroyREAL8FFTPlan( revplan );
+  XLALDestroyCOMPLEX16Vector( fin );
+  XLALDestroyCOMPLEX16Vector( fout );
+
+  XLALDestroyREAL8Sequence( series->data );
+  series->data = out;
+  series->deltaT = dt;
+
+  return 0;
+
+error:
+  XLALDestroyREAL8FFTPlan( fwdplan );
+  XLALDestroyREAL8FFTPlan( revplan );
+  XLALDestroyCOMPLEX16Vector( fin );
+  XLALDestroyCOMPLEX16Vector( fout );
+  XLALDestroyREAL8Vector( out );
+  XLAL_ERROR( XLAL_EFUNC );
+}
+
+
 /**
  * \deprecated Use XLALResampleREAL4TimeSeries() instead.
  */
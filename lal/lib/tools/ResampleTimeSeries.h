@@ -36,7 +36,11 @@ extern "C" {
  *
  * \brief Provides routines to resample a time series.
  *
- * At present only integer downsampling of \c REAL4TimeSeries by a power of two is supported.
+ * The routines XLALResampleREAL4TimeSeries() and XLALResampleREAL8TimeSeries()
+ * downsample a time series by a power of two. Resampling by rational ratios is
+ * provided by a reusable polyphase FIR resampler, see #LALREAL8Resampler, which
+ * can also be fed with consecutive chunks of a data stream, and by an
+ * FFT-domain resampler for whole time series.
  *
  * ### Synopsis ###
  *
@@ -129,12 +133,27 @@ tagResampleTSParams
 }
 ResampleTSParams;
 
+/**
+ * Opaque polyphase FIR resampler for \c REAL8 data, which changes the
+ * sample rate by a rational factor \c upFactor / \c downFactor.
+ */
+typedef struct tagLALREAL8Resampler LALREAL8Resampler;
+
 /** @} */
 
 /* ---------- Function prototypes ---------- */
 
 int XLALResampleREAL4TimeSeries( REAL4TimeSeries *series, REAL8 dt );
 int XLALResampleREAL8TimeSeries( REAL8TimeSeries *series, REAL8 dt );
+int XLALResampleREAL8TimeSeriesFIR( REAL8TimeSeries *series, REAL8 dt );
+int XLALResampleREAL8TimeSeriesFFT( REAL8TimeSeries *series, REAL8 dt );
+
+LALREAL8Resampler *XLALREAL8ResamplerCreate( UINT4 upFactor, UINT4 downFactor, UINT4 halfLength, REAL8 beta );
+void XLALREAL8ResamplerDestroy( LALREAL8Resampler *resampler );
+void XLALREAL8ResamplerReset( LALREAL8Resampler *resampler );
+UINT4 XLALREAL8ResamplerLatency( const LALREAL8Resampler *resampler );
+UINT4 XLALREAL8ResamplerOutputLength( const LALREAL8Resampler *resampler, UINT4 inLength );
+int XLALREAL8ResamplerApply( LALREAL8Resampler *resampler, REAL8 *out, const REAL8 *in, UINT4 inLength );
 
 void
 LALResampleREAL4TimeSeries(
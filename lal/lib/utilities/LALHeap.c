@@ -17,8 +17,13 @@
  *  MA  02110-1301  USA
  */
 
+#include <math.h>
 #include <lal/LALHeap.h>
 
+#if !defined(__ATOMIC_ACQUIRE) && defined(LAL_PTHREAD_LOCK)
+#include <pthread.h>
+#endif
+
 #define LEFT(i)     (2*(i) + 1)         /* Left child of binary heap element 'i' */
 #define RIGHT(i)    (2*(i) + 2)         /* Right child of binary heap element 'i' */
 #define PARENT(i)   (((i) - 1)/2)       /* Parent of binary heap element 'i' */
@@ -482,3 +487,212 @@ const void **XLALHeapElements(
   return elems;
 
 }
+
+struct tagLALConcurrentHeap {
+  LALHeap **heaps;              /* Heap of each thread */
+  int nthreads;                 /* Number of threads */
+  LALHeapDtorFcn dtor;          /* Function to free memory of elements of heap, if required */
+  int max_size;                 /* Maximum size of each thread heap; if zero, heaps have unlimited size */
+  LALHeapRankParamFcn rank;     /* Parameterised heap element rank function */
+  void *param;                  /* Parameter to pass to comparison and rank functions */
+  REAL8 threshold;              /* Elements ranked below this are rejected; only accessed atomically */
+#if !defined(__ATOMIC_ACQUIRE) && defined(LAL_PTHREAD_LOCK)
+  pthread_mutex_t lock;         /* Lock on threshold, if atomic operations are not available */
+#endif
+};
+
+/* Atomically read the threshold of a concurrent heap */
+static REAL8 concurrent_heap_threshold( const LALConcurrentHeap *ch )
+{
+  REAL8 t;
+#if defined(__ATOMIC_ACQUIRE)
+  __atomic_load( &ch->threshold, &t, __ATOMIC_ACQUIRE );
+#elif defined(LAL_PTHREAD_LOCK)
+  pthread_mutex_lock( ( pthread_mutex_t * ) &ch->lock );
+  t = ch->threshold;
+  pthread_mutex_unlock( ( pthread_mutex_t * ) &ch->lock );
+#else
+  t = ch->threshold;
+#endif
+  return t;
+}
+
+/* Atomically raise the threshold of a concurrent heap to 't', if it is lower */
+static void concurrent_heap_raise_threshold( LALConcurrentHeap *ch, REAL8 t )
+{
+#if defined(__ATOMIC_ACQUIRE)
+  REAL8 old = concurrent_heap_threshold( ch );
+  while ( old < t && !__atomic_compare_exchange( &ch->threshold, &old, &t, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) ) {
+    /* 'old' now holds the value set by another thread; try again */
+  }
+#elif defined(LAL_PTHREAD_LOCK)
+  pthread_mutex_lock( &ch->lock );
+  if ( ch->threshold < t ) {
+    ch->threshold = t;
+  }
+  pthread_mutex_unlock( &ch->lock );
+#else
+  if ( ch->threshold < t ) {
+    ch->threshold = t;
+  }
+#endif
+}
+
+LALConcurrentHeap *XLALConcurrentHeapCreate(
+  LALHeapDtorFcn dtor,
+  int max_size,
+  int min_or_max_heap,
+  LALHeapCmpParamFcn cmp,
+  LALHeapRankParamFcn rank,
+  void *param,
+  int nthreads
+  )
+{
+
+  /* Check input */
+  XLAL_CHECK_NULL( max_size >= 0, XLAL_EINVAL );
+  XLAL_CHECK_NULL( abs( min_or_max_heap ) == 1, XLAL_EINVAL );
+  XLAL_CHECK_NULL( cmp != NULL, XLAL_EFAULT );
+  XLAL_CHECK_NULL( rank != NULL, XLAL_EFAULT );
+  XLAL_CHECK_NULL( nthreads > 0, XLAL_EINVAL );
+
+  /* Allocate memory for concurrent heap struct */
+  LALConcurrentHeap *ch = XLALCalloc( 1, sizeof( *ch ) );
+  XLAL_CHECK_NULL( ch != NULL, XLAL_ENOMEM );
+
+  /* Set concurrent heap struct parameters */
+  ch->nthreads = nthreads;
+  ch->dtor = dtor;
+  ch->max_size = max_size;
+  ch->rank = rank;
+  ch->param = param;
+  ch->threshold = -INFINITY;
+#if !defined(__ATOMIC_ACQUIRE) && defined(LAL_PTHREAD_LOCK)
+  pthread_mutex_init( &ch->lock, NULL );
+#endif
+
+  /* Create heap of each thread; destroy what was created on failure */
+  ch->heaps = XLALCalloc( nthreads, sizeof( ch->heaps[0] ) );
+  if ( ch->heaps == NULL ) {
+    XLALConcurrentHeapDestroy( ch );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+  for ( int i = 0; i < nthreads; ++i ) {
+    ch->heaps[i] = XLALHeapCreate2( dtor, max_size, min_or_max_heap, cmp, param );
+    if ( ch->heaps[i] == NULL ) {
+      XLALConcurrentHeapDestroy( ch );
+      XLAL_ERROR_NULL( XLAL_EFUNC );
+    }
+  }
+
+  return ch;
+
+}
+
+void XLALConcurrentHeapDestroy(
+  LALConcurrentHeap *ch
+  )
+{
+  if ( ch != NULL ) {
+    if ( ch->heaps != NULL ) {
+      for ( int i = 0; i < ch->nthreads; ++i ) {
+        XLALHeapDestroy( ch->heaps[i] );
+      }
+      XLALFree( ch->heaps );
+    }
+#if !defined(__ATOMIC_ACQUIRE) && defined(LAL_PTHREAD_LOCK)
+    pthread_mutex_destroy( &ch->lock );
+#endif
+    XLALFree( ch );
+  }
+}
+
+int XLALConcurrentHeapNumThreads(
+  const LALConcurrentHeap *ch
+  )
+{
+  XLAL_CHECK( ch != NULL, XLAL_EFAULT );
+  return ch->nthreads;
+}
+
+LALHeap *XLALConcurrentHeapThreadHeap(
+  LALConcurrentHeap *ch,
+  int thread
+  )
+{
+  XLAL_CHECK_NULL( ch != NULL, XLAL_EFAULT );
+  XLAL_CHECK_NULL( 0 <= thread && thread < ch->nthreads, XLAL_EINVAL );
+  return ch->heaps[thread];
+}
+
+REAL8 XLALConcurrentHeapThreshold(
+  const LALConcurrentHeap *ch
+  )
+{
+  XLAL_CHECK_REAL8( ch != NULL, XLAL_EFAULT );
+  return concurrent_heap_threshold( ch );
+}
+
+int XLALConcurrentHeapAdd(
+  LALConcurrentHeap *ch,
+  int thread,
+  void **x
+  )
+{
+
+  /* Check input */
+  XLAL_CHECK( ch != NULL, XLAL_EFAULT );
+  XLAL_CHECK( 0 <= thread && thread < ch->nthreads, XLAL_EINVAL );
+  XLAL_CHECK( x != NULL, XLAL_EFAULT );
+  XLAL_CHECK( *x != NULL, XLAL_EINVAL );
+
+  /* Reject element if it is ranked below the threshold */
+  if ( ch->max_size > 0 && ch->rank( ch->param, *x ) < concurrent_heap_threshold( ch ) ) {
+    return XLAL_SUCCESS;
+  }
+
+  /* Add element to heap of thread */
+  LALHeap *h = ch->heaps[thread];
+  const void *y = *x;
+  XLAL_CHECK( XLALHeapAdd( h, x ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  /* If element was added and heap is full, the rank of its root is a lower bound on the
+     ranks of the best 'max_size' elements of all threads, so raise threshold to it */
+  if ( *x != y && XLALHeapIsFull( h ) ) {
+    concurrent_heap_raise_threshold( ch, ch->rank( ch->param, h->data[0] ) );
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
+int XLALConcurrentHeapMerge(
+  LALConcurrentHeap *ch
+  )
+{
+
+  /* Check input */
+  XLAL_CHECK( ch != NULL, XLAL_EFAULT );
+
+  /* Move elements of each thread heap, in thread order, into heap of thread 0 */
+  LALHeap *h0 = ch->heaps[0];
+  for ( int i = 1; i < ch->nthreads; ++i ) {
+    LALHeap *h = ch->heaps[i];
+    while ( h->n > 0 ) {
+      void *x = XLALHeapExtractRoot( h );
+      XLAL_CHECK( x != NULL, XLAL_EFUNC );
+      XLAL_CHECK( XLALHeapAdd( h0, &x ) == XLAL_SUCCESS, XLAL_EFUNC );
+      if ( x != NULL && ch->dtor != NULL ) {
+        ch->dtor( x );
+      }
+    }
+  }
+
+  /* Update threshold */
+  if ( XLALHeapIsFull( h0 ) ) {
+    concurrent_heap_raise_threshold( ch, ch->rank( ch->param, h0->data[0] ) );
+  }
+
+  return XLAL_SUCCESS;
+
+}
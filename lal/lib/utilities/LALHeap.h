@@ -193,6 +193,96 @@ const void **XLALHeapElements(
   const LALHeap *h              /**< [in] Pointer to heap */
   );
 
+/**
+ * Concurrent limited-size heap, made up of one heap per thread
+ *
+ * Each thread adds elements only to its own heap, so no locking is needed.
+ * The threads share a <em>threshold</em>: the largest rank of the root
+ * element of any full thread heap. An element whose rank is below the
+ * threshold cannot be among the \c max_size best elements of all threads,
+ * and is rejected without touching any heap; callers may also test the
+ * threshold themselves before constructing an element. The threshold is
+ * read and raised atomically.
+ *
+ * Once all threads have finished, XLALConcurrentHeapMerge() moves all
+ * elements into the heap of thread 0. If the comparison function defines a
+ * total order, the merged heap is exactly the heap that adding all elements
+ * from a single thread would give, regardless of how elements were
+ * distributed between threads; otherwise, elements which compare equal are
+ * resolved in thread order.
+ */
+typedef struct tagLALConcurrentHeap LALConcurrentHeap;
+
+/**
+ * Function which returns the rank of heap element <tt>x</tt>, with a parameter \c param.
+ * Must be consistent with the heap comparison function: the root of a full
+ * heap, which is the first element to be removed, must have the lowest rank.
+ */
+typedef REAL8 ( *LALHeapRankParamFcn )( void *param, const void *x );
+
+/**
+ * Create a concurrent heap
+ */
+LALConcurrentHeap *XLALConcurrentHeapCreate(
+  LALHeapDtorFcn dtor,          /**< [in] Heap element destructor function, if required */
+  int max_size,                 /**< [in] Maximum size of each thread heap; if zero, heaps have unlimited size
+                                   and no elements are rejected */
+  int min_or_max_heap,          /**< [in] -1|+1 if root of heap is minimum|maximum element */
+  LALHeapCmpParamFcn cmp,       /**< [in] Parameterised heap element comparison function */
+  LALHeapRankParamFcn rank,     /**< [in] Parameterised heap element rank function */
+  void *param,                  /**< [in] Parameter to pass to comparison and rank functions */
+  int nthreads                  /**< [in] Number of threads */
+  );
+
+/**
+ * Destroy a concurrent heap and its elements
+ */
+void XLALConcurrentHeapDestroy(
+  LALConcurrentHeap *ch         /**< [in] Pointer to concurrent heap */
+  );
+
+/**
+ * Return the number of threads of a concurrent heap
+ */
+int XLALConcurrentHeapNumThreads(
+  const LALConcurrentHeap *ch   /**< [in] Pointer to concurrent heap */
+  );
+
+/**
+ * Return the heap of a thread. Elements should only be added to it through
+ * XLALConcurrentHeapAdd(), which keeps the threshold up to date.
+ */
+LALHeap *XLALConcurrentHeapThreadHeap(
+  LALConcurrentHeap *ch,        /**< [in] Pointer to concurrent heap */
+  int thread                    /**< [in] Thread index, from 0 to one less than the number of threads */
+  );
+
+/**
+ * Return the rank below which new elements are rejected, or \c -INFINITY if no thread heap is full yet
+ */
+REAL8 XLALConcurrentHeapThreshold(
+  const LALConcurrentHeap *ch   /**< [in] Pointer to concurrent heap */
+  );
+
+/**
+ * Add a new element to the heap of a thread, as for XLALHeapAdd(); elements ranked below the threshold are
+ * returned immediately in <tt>*x</tt>. May be called concurrently with different thread indexes.
+ */
+int XLALConcurrentHeapAdd(
+  LALConcurrentHeap *ch,        /**< [in] Pointer to concurrent heap */
+  int thread,                   /**< [in] Thread index */
+  void **x                      /**< [in/out] Pointer to new element. If an element is removed or rejected, it
+                                   is returned in <tt>*x</tt>; otherwise <tt>*x</tt> is set to \c NULL */
+  );
+
+/**
+ * Move all elements into the heap of thread 0, which then holds the best elements added by any thread.
+ * Must not be called concurrently with XLALConcurrentHeapAdd().
+ */
+int XLALConcurrentHeapMerge(
+  LALConcurrentHeap *ch         /**< [in] Pointer to concurrent heap */
+  );
+
 /** @} */
 
 #ifdef __cplusplus
@@ -933,36 +933,65 @@ void LALSRunningMedian( LALStatus *status,
 
 
 
-void LALDRunningMedian2( LALStatus *status,
-			 REAL8Sequence *medians,
-			 const REAL8Sequence *input,
-			 LALRunningMedianPar param)
-
-{
-  /* a single "node"
+/* a single "node" of the RunningMedian2 REAL8 algorithm
    lesser  points to the next node with less or equal value
    greater points to the next node with greater or equal value
    an index == blocksize is an end marker
-  */
-  struct node{
-    REAL8 value;
-    UINT4 lesser;
-    UINT4 greater;
-  };
+*/
+struct rngmed2_node8 {
+  REAL8 value;
+  UINT4 lesser;
+  UINT4 greater;
+};
 
-  /* a node of the quicksort array */
-  struct qsnode{
-    REAL8 value;
-    UINT4 index;
-  };
+/* a node of the quicksort array of the RunningMedian2 REAL8 algorithm */
+struct rngmed2_qsnode8 {
+  REAL8 value;
+  UINT4 index;
+};
 
-  const UINT4 bsize = param.blocksize; /* just an abbrevation */
+/* number of checkpoints needed by the RunningMedian2 algorithm for a given
+   blocksize; also returns their spacing, the index of the middle node in
+   sorting order and the checkpoint "nearest" to the median */
+static UINT4 rngmed2_checkpoints(UINT4 bsize, UINT4 *stepchkpts,
+				 UINT4 *midpoint, UINT4 *mdnnearest)
+{
+  UINT4 ncheckpts;
+
+  /* determine checkpoint positions */
+  *stepchkpts = sqrt(bsize);
+  /* the old form
+     ncheckpts = bsize/stepchkpts;
+     caused too less checkpoints at the end, leading to break the
+     cost calculation */
+  ncheckpts = ceil((REAL4)bsize/(REAL4)*stepchkpts);
+
+  /* set checkpoint nearest to the median and offset of the median to it */
+  *midpoint = (bsize+(bsize&1)) / 2 - 1;
+  /* this becomes the median checkpoint */
+  *mdnnearest = ceil((REAL4)*midpoint / (REAL4)*stepchkpts);
+
+  /* add a checkpoint for the median if necessary */
+  if (ceil((REAL4)*midpoint / (REAL4)*stepchkpts) != (REAL4)*midpoint / (REAL4)*stepchkpts)
+    ncheckpts++;
+
+  return ncheckpts;
+}
+
+/* the RunningMedian2 REAL8 algorithm proper; computes nmedians medians of
+   blocks of bsize elements of input, using caller-provided workspace
+   nodes[bsize], qsnodes[bsize] and checkpts[ncheckpts] */
+static void rngmed2_compute8(REAL8 *medians,
+			     UINT4 nmedians,
+			     const REAL8 *input,
+			     UINT4 bsize,
+			     struct rngmed2_node8 *nodes,
+			     struct rngmed2_qsnode8 *qsnodes,
+			     UINT4 *checkpts)
+{
   const UINT4 nil = bsize;       /* invalid index used as end marker */
   const BOOLEAN isodd = bsize&1; /* bsize is odd = median is a single element */
 
-  struct node* nodes;           /* array of nodes, will be of size blocksize */
-  struct qsnode* qsnodes;       /* array of indices for initial qsort */
-  UINT4* checkpts;              /* array of checkpoints */
   UINT4  ncheckpts,stepchkpts;  /* checkpoints: number and distance between */
   UINT4  oldestnode;            /* index of "oldest" node */
   UINT4  i;                     /* loop counter (up to input length) */
@@ -977,64 +1006,22 @@ void LALDRunningMedian2( LALStatus *status,
   REAL8 oldvalue,newvalue;      /* old + new value of the node being replaced */
   UINT4 oldlesser,oldgreater;   /* remember the pointers of the replaced node */
 
-  INITSTATUS(status);
-
-  /* check input parameters */
-  /* input must not be NULL */
-  ASSERT(input,status,LALRUNNINGMEDIANH_ENULL,LALRUNNINGMEDIANH_MSGENULL);
-  /* param.blocksize must be >2 */
-  ASSERT(param.blocksize>2,
-	 status,LALRUNNINGMEDIANH_EZERO,LALRUNNINGMEDIANH_MSGEZERO);
-  /* blocksize must not be larger than input size */
-  ASSERT(param.blocksize <= input->length,
-	 status,LALRUNNINGMEDIANH_ELARGE,LALRUNNINGMEDIANH_MSGELARGE);
-  /* medians must point to a valid sequence of correct size */
-  ASSERT(medians,status,LALRUNNINGMEDIANH_EIMED,LALRUNNINGMEDIANH_MSGEIMED);
-  ASSERT(medians->length == (input->length - param.blocksize + 1),
-	 status,LALRUNNINGMEDIANH_EIMED,LALRUNNINGMEDIANH_MSGEIMED);
-
-  ATTATCHSTATUSPTR( status );
-
-  /* create nodes array */
-  nodes = (struct node*)LALCalloc(bsize, sizeof(struct node));
-
-  /* determine checkpoint positions */
-  stepchkpts = sqrt(bsize);
-  /* the old form
-     ncheckpts = bsize/stepchkpts;
-     caused too less checkpoints at the end, leading to break the
-     cost calculation */
-  ncheckpts = ceil((REAL4)bsize/(REAL4)stepchkpts);
-
-  /* set checkpoint nearest to the median and offset of the median to it */
-  midpoint = (bsize+(bsize&1)) / 2 - 1;
-  /* this becomes the median checkpoint */
-  mdnnearest = ceil((REAL4)midpoint / (REAL4)stepchkpts);
-
-  /* add a checkpoint for the median if necessary */
-  if (ceil((REAL4)midpoint / (REAL4)stepchkpts) != (REAL4)midpoint / (REAL4)stepchkpts)
-    ncheckpts++;
-
-  /* create checkpoints array */
-  checkpts = (UINT4*)LALCalloc(ncheckpts,sizeof(UINT4));
-
-  /* create array for qsort */
-  qsnodes = (struct qsnode*)LALCalloc(bsize, sizeof(struct qsnode));
+  ncheckpts = rngmed2_checkpoints(bsize, &stepchkpts, &midpoint, &mdnnearest);
 
   /* init qsort array
    the nodes get their values from the input,
    the indices are only identities qi[0]=0,qi[1]=1,... */
   for(i=0;i<bsize;i++) {
-    qsnodes[i].value = input->data[i];
+    qsnodes[i].value = input[i];
     qsnodes[i].index = i;
   }
 
   /* sort qsnodes by value and index(!) */
-  qsort(qsnodes, bsize, sizeof(struct qsnode),rngmed_qsortindex8);
+  qsort(qsnodes, bsize, sizeof(struct rngmed2_qsnode8),rngmed_qsortindex8);
 
   /* init nodes array */
   for(i=0;i<bsize;i++)
-    nodes[i].value = input->data[i];
+    nodes[i].value = input[i];
   for(i=1;i<bsize-1;i++) {
     nodes[qsnodes[i-1].index].greater = qsnodes[i].index;
     nodes[qsnodes[i+1].index].lesser  = qsnodes[i].index;
@@ -1057,28 +1044,25 @@ void LALDRunningMedian2( LALStatus *status,
     checkpts[j] = qsnodes[i*stepchkpts].index;
   }
 
-  /* don't need the qsnodes anymore */
-  LALFree(qsnodes);
-
   /* find first median */
   nextnode = checkpts[mdnnearest];
   if(isodd)
-    medians->data[0] = nodes[nextnode].value;
+    medians[0] = nodes[nextnode].value;
   else
-    medians->data[0] = (nodes[nextnode].value
+    medians[0] = (nodes[nextnode].value
 			+ nodes[nodes[nextnode].greater].value) / 2.0;
 
   /* the "oldest" node (first in sequence) is the one with index 0 */
   oldestnode = 0;
 
   /* outer loop: find a median with each iteration */
-  for(nmedian=1; nmedian < medians->length; nmedian++) {
+  for(nmedian=1; nmedian < nmedians; nmedian++) {
 
     /* remember value of sample to be deleted */
     oldvalue = nodes[oldestnode].value;
 
     /* get next value to be inserted from input */
-    newvalue = input->data[nmedian+bsize-1];
+    newvalue = input[nmedian+bsize-1];
 
     /** find point of insertion: **/
 
@@ -1193,13 +1177,13 @@ void LALDRunningMedian2( LALStatus *status,
 
     /* find median */
     if (newvalue == oldvalue)
-      medians->data[nmedian] = medians->data[nmedian-1];
+      medians[nmedian] = medians[nmedian-1];
     else {
       nextnode = checkpts[mdnnearest];
       if(isodd)
-	medians->data[nmedian] = nodes[nextnode].value;
+	medians[nmedian] = nodes[nextnode].value;
       else
-	medians->data[nmedian] = (nodes[nextnode].value
+	medians[nmedian] = (nodes[nextnode].value
 				  + nodes[nodes[nextnode].greater].value) / 2.0;
     }
 
@@ -1207,8 +1191,57 @@ void LALDRunningMedian2( LALStatus *status,
     oldestnode = (oldestnode + 1) % bsize; /* wrap around */
 
   } /* for (nmedian...) */
+}
+
+
+void LALDRunningMedian2( LALStatus *status,
+			 REAL8Sequence *medians,
+			 const REAL8Sequence *input,
+			 LALRunningMedianPar param)
+
+{
+  const UINT4 bsize = param.blocksize; /* just an abbrevation */
+
+  struct rngmed2_node8* nodes;     /* array of nodes, will be of size blocksize */
+  struct rngmed2_qsnode8* qsnodes; /* array of indices for initial qsort */
+  UINT4* checkpts;                 /* array of checkpoints */
+  UINT4  ncheckpts,stepchkpts;     /* checkpoints: number and distance between */
+  UINT4  midpoint;                 /* index of middle node in sorting order */
+  UINT4  mdnnearest;               /* checkpoint "nearest" to the median */
+
+  INITSTATUS(status);
+
+  /* check input parameters */
+  /* input must not be NULL */
+  ASSERT(input,status,LALRUNNINGMEDIANH_ENULL,LALRUNNINGMEDIANH_MSGENULL);
+  /* param.blocksize must be >2 */
+  ASSERT(param.blocksize>2,
+	 status,LALRUNNINGMEDIANH_EZERO,LALRUNNINGMEDIANH_MSGEZERO);
+  /* blocksize must not be larger than input size */
+  ASSERT(param.blocksize <= input->length,
+	 status,LALRUNNINGMEDIANH_ELARGE,LALRUNNINGMEDIANH_MSGELARGE);
+  /* medians must point to a valid sequence of correct size */
+  ASSERT(medians,status,LALRUNNINGMEDIANH_EIMED,LALRUNNINGMEDIANH_MSGEIMED);
+  ASSERT(medians->length == (input->length - param.blocksize + 1),
+	 status,LALRUNNINGMEDIANH_EIMED,LALRUNNINGMEDIANH_MSGEIMED);
+
+  ATTATCHSTATUSPTR( status );
+
+  /* create nodes array */
+  nodes = (struct rngmed2_node8*)LALCalloc(bsize, sizeof(struct rngmed2_node8));
+
+  /* create checkpoints array */
+  ncheckpts = rngmed2_checkpoints(bsize, &stepchkpts, &midpoint, &mdnnearest);
+  checkpts = (UINT4*)LALCalloc(ncheckpts,sizeof(UINT4));
+
+  /* create array for qsort */
+  qsnodes = (struct rngmed2_qsnode8*)LALCalloc(bsize, sizeof(struct rngmed2_qsnode8));
+
+  rngmed2_compute8(medians->data, medians->length, input->data, bsize,
+		   nodes, qsnodes, checkpts);
 
   /* cleanup */
+  LALFree(qsnodes);
   LALFree(checkpts);
   LALFree(nodes);
 
@@ -1499,3 +1532,72 @@ void LALSRunningMedian2( LALStatus *status,
   DETATCHSTATUSPTR( status );
   RETURN( status );
 }
+
+
+struct tagLALRunningMedianContext {
+  UINT4 blocksize;                 /* the number of elements a single median is calculated from */
+  struct rngmed2_node8 *nodes;     /* array of nodes, of size blocksize */
+  struct rngmed2_qsnode8 *qsnodes; /* array of indices for initial qsort, of size blocksize */
+  UINT4 *checkpts;                 /* array of checkpoints */
+};
+
+
+LALRunningMedianContext *XLALCreateRunningMedianContext(UINT4 blocksize)
+{
+  LALRunningMedianContext *ctx;
+  UINT4 ncheckpts, stepchkpts, midpoint, mdnnearest;
+
+  XLAL_CHECK_NULL(blocksize > 2, XLAL_EDOM, "Block length must be >2 (got %u)", blocksize);
+
+  ctx = XLALCalloc(1, sizeof(*ctx));
+  XLAL_CHECK_NULL(ctx, XLAL_ENOMEM);
+  ctx->blocksize = blocksize;
+
+  ncheckpts = rngmed2_checkpoints(blocksize, &stepchkpts, &midpoint, &mdnnearest);
+  ctx->nodes = XLALMalloc(blocksize * sizeof(*ctx->nodes));
+  ctx->qsnodes = XLALMalloc(blocksize * sizeof(*ctx->qsnodes));
+  ctx->checkpts = XLALMalloc(ncheckpts * sizeof(*ctx->checkpts));
+  if (!ctx->nodes || !ctx->qsnodes || !ctx->checkpts) {
+    XLALDestroyRunningMedianContext(ctx);
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  }
+
+  return ctx;
+}
+
+
+void XLALDestroyRunningMedianContext(LALRunningMedianContext *ctx)
+{
+  if (!ctx)
+    return;
+  XLALFree(ctx->nodes);
+  XLALFree(ctx->qsnodes);
+  XLALFree(ctx->checkpts);
+  XLALFree(ctx);
+}
+
+
+UINT4 XLALRunningMedianContextBlocksize(const LALRunningMedianContext *ctx)
+{
+  XLAL_CHECK_VAL(0, ctx, XLAL_EFAULT);
+  return ctx->blocksize;
+}
+
+
+int XLALDRunningMedianWithContext(LALRunningMedianContext *ctx,
+				  REAL8Sequence *medians,
+				  const REAL8Sequence *input)
+{
+  XLAL_CHECK(ctx, XLAL_EFAULT);
+  XLAL_CHECK(input && input->data, XLAL_EFAULT);
+  XLAL_CHECK(medians && medians->data, XLAL_EFAULT);
+  XLAL_CHECK(ctx->blocksize <= input->length, XLAL_EBADLEN,
+	     "Block length %u larger than input length %u", ctx->blocksize, input->length);
+  XLAL_CHECK(medians->length == input->length - ctx->blocksize + 1, XLAL_EBADLEN,
+	     "Median array must have length %u (got %u)", input->length - ctx->blocksize + 1, medians->length);
+
+  rngmed2_compute8(medians->data, medians->length, input->data,
+		   ctx->blocksize, ctx->nodes, ctx->qsnodes, ctx->checkpts);
+
+  return XLAL_SUCCESS;
+}
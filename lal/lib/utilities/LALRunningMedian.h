@@ -54,6 +54,12 @@ extern "C" {
  * <tt>LALDRunningMedian()</tt>, but has proven to be a
  * little faster and more stable. Check if it works for you.
  *
+ * When running medians with the same blocksize are computed over many
+ * sequences, e.g.\ over the periodograms of a set of SFTs, the workspace of
+ * <tt>LALDRunningMedian2()</tt> can instead be allocated once with
+ * <tt>XLALCreateRunningMedianContext()</tt> and reused by
+ * <tt>XLALDRunningMedianWithContext()</tt>, which gives identical results.
+ *
  * ### Algorithm ###
  *
  * For a detailed description of the algorithm see the
@@ -106,6 +112,12 @@ typedef struct tagLALRunningMedianPar
 }
 LALRunningMedianPar;
 
+/**
+ * Opaque workspace for computing running medians of a fixed blocksize
+ * over several sequences without reallocating memory.
+ */
+typedef struct tagLALRunningMedianContext LALRunningMedianContext;
+
 
 /* Function prototypes. */
 
@@ -137,6 +149,13 @@ LALSRunningMedian2( LALStatus *status,
 		    const REAL4Sequence *input,
 		    LALRunningMedianPar param);
 
+LALRunningMedianContext *XLALCreateRunningMedianContext( UINT4 blocksize );
+void XLALDestroyRunningMedianContext( LALRunningMedianContext *ctx );
+UINT4 XLALRunningMedianContextBlocksize( const LALRunningMedianContext *ctx );
+int XLALDRunningMedianWithContext( LALRunningMedianContext *ctx,
+				   REAL8Sequence *medians,
+				   const REAL8Sequence *input );
+
 /** @} */
 
 #ifdef  __cplusplus
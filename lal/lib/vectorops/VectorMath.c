@@ -206,5 +206,47 @@ EXPORT_VECTORMATH_cC2C(Shift, AVX2, AVX, SSE2, NONE)
 #define EXPORT_VECTORMATH_D2D(NAME, ...)                                     \
   EXPORT_VECTORMATH_ANY( NAME ## REAL8, (REAL8 *out, const REAL8 *in, const UINT4 len), (out, in, len), __VA_ARGS__ )
 
+EXPORT_VECTORMATH_D2D(Sin, AVX2, AVX, SSE2, NONE)
+EXPORT_VECTORMATH_D2D(Cos, AVX2, AVX, SSE2, NONE)
+EXPORT_VECTORMATH_D2D(Exp, AVX2, AVX, NONE, NONE)
+EXPORT_VECTORMATH_D2D(Log, AVX2, AVX, NONE, NONE)
 EXPORT_VECTORMATH_D2D(Round, AVX2, AVX, NONE, NONE)
 
+// ---------- define exported vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define EXPORT_VECTORMATH_D2DD(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## REAL8, (REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len), (out1, out2, in, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_D2DD(SinCos, AVX2, AVX, SSE2, NONE)
+EXPORT_VECTORMATH_D2DD(SinCos2Pi, AVX2, AVX, SSE2, NONE)
+
+// ---------- define exported vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+#define EXPORT_VECTORMATH_ZZ2Z(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX16, (COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len), (out, in1, in2, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_ZZ2Z(Multiply, AVX512F, AVX2, AVX, NONE)
+EXPORT_VECTORMATH_ZZ2Z(Add, AVX512F, AVX2, AVX, NONE)
+
+// ---------- define exported vector math functions with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+#define EXPORT_VECTORMATH_zZ2Z(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX16, (COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len), (out, scalar, in, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_zZ2Z(Scale, AVX512F, AVX2, AVX, NONE)
+EXPORT_VECTORMATH_zZ2Z(Shift, AVX512F, AVX2, AVX, NONE)
+
+// ---------- define exported vector math functions with 1 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZD2Z) ----------
+#define EXPORT_VECTORMATH_ZD2Z(NAME, ...)                                    \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX16, (COMPLEX16 *out, const COMPLEX16 *in, const REAL8 *weight, const UINT4 len), (out, in, weight, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_ZD2Z(Weight, AVX512F, AVX2, AVX, NONE)
+
+// ---------- define exported vector math functions with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZZD2Z) ----------
+#define EXPORT_VECTORMATH_ZZD2Z(NAME, ...)                                   \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX16, (COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len), (out, in1, in2, weight, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_ZZD2Z(ConjMultiplyAccumulate, AVX512F, AVX2, AVX, NONE)
+
+// ---------- define exported vector math functions with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 scalar output (ZZD2z) ----------
+#define EXPORT_VECTORMATH_ZZD2z(NAME, ...)                                   \
+  EXPORT_VECTORMATH_ANY( NAME ## COMPLEX16, (COMPLEX16 *result, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len), (result, in1, in2, weight, len), __VA_ARGS__ )
+
+EXPORT_VECTORMATH_ZZD2z(WeightedInnerProduct, AVX512F, AVX2, AVX, NONE)
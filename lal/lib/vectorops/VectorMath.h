@@ -153,6 +153,18 @@ int XLALVectorLogREAL4 ( REAL4 *out, const REAL4 *in, const UINT4 len );
 /** Compute \f$\text{out} = round ( \text{in} )\f$ over REAL4 vectors \c out, \c in with \c len elements */
 int XLALVectorRoundREAL4 ( REAL4 *out, const REAL4 *in, const UINT4 len);
 
+/** Compute \f$\text{out} = \sin(\text{in})\f$ over REAL8 vectors \c out, \c in with \c len elements */
+int XLALVectorSinREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len );
+
+/** Compute \f$\text{out} = \cos(\text{in})\f$ over REAL8 vectors \c out, \c in with \c len elements */
+int XLALVectorCosREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len );
+
+/** Compute \f$\text{out} = \exp(\text{in})\f$ over REAL8 vectors \c out, \c in with \c len elements */
+int XLALVectorExpREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len );
+
+/** Compute \f$\text{out} = \log(\text{in})\f$ over REAL8 vectors \c out, \c in with \c len elements */
+int XLALVectorLogREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len );
+
 /** Compute \f$\text{out} = round ( \text{in} )\f$ over REAL8 vectors \c out, \c in with \c len elements */
 int XLALVectorRoundREAL8 ( REAL8 *out, const REAL8 *in, const UINT4 len);
 
@@ -162,6 +174,14 @@ int XLALVectorSinCosREAL4 ( REAL4 *out1, REAL4 *out2, const REAL4 *in, const UIN
 /** Compute \f$\text{out1} = \sin(2\pi \text{in}), \text{out2} = \cos(2\pi \text{in})\f$ over REAL4 vectors \c out1, \c out2, \c in with \c len elements */
 int XLALVectorSinCos2PiREAL4 ( REAL4 *out1, REAL4 *out2, const REAL4 *in, const UINT4 len );
 
+/** Compute \f$\text{out1} = \sin(\text{in}), \text{out2} = \cos(\text{in})\f$ over REAL8 vectors \c out1, \c out2, \c in with \c len elements */
+int XLALVectorSinCosREAL8 ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len );
+
+/** Compute \f$\text{out1} = \sin(2\pi \text{in}), \text{out2} = \cos(2\pi \text{in})\f$ over REAL8 vectors \c out1, \c out2, \c in with \c len elements.
+ * The integer part of \c in is removed before multiplying by \f$2\pi\f$, so full precision is retained for large \c in.
+ */
+int XLALVectorSinCos2PiREAL8 ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len );
+
 /** @} */
 
 /** \name Vector by Vector Operations */
@@ -197,6 +217,15 @@ int XLALVectorMultiplyCOMPLEX8 (  COMPLEX8 *out, const COMPLEX8 *in1, const COMP
 /** Compute \f$\text{out} = \text{in1} + \text{in2}\f$ over COMPLEX8 vectors \c in1 and \c in2 with \c len elements */
 int XLALVectorAddCOMPLEX8 ( COMPLEX8 *out, const COMPLEX8 *in1, const COMPLEX8 *in2, const UINT4 len);
 
+/** Compute \f$\text{out} = \text{in1} \times \text{in2}\f$ over COMPLEX16 vectors \c in1 and \c in2 with \c len elements */
+int XLALVectorMultiplyCOMPLEX16 ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len );
+
+/** Compute \f$\text{out} = \text{in1} + \text{in2}\f$ over COMPLEX16 vectors \c in1 and \c in2 with \c len elements */
+int XLALVectorAddCOMPLEX16 ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len );
+
+/** Compute \f$\text{out} = \text{in} \times \text{weight}\f$ over COMPLEX16 vector \c in and REAL8 vector \c weight with \c len elements */
+int XLALVectorWeightCOMPLEX16 ( COMPLEX16 *out, const COMPLEX16 *in, const REAL8 *weight, const UINT4 len );
+
 /** @} */
 
 /** \name Vector by Scalar Operations */
@@ -220,6 +249,25 @@ int XLALVectorScaleCOMPLEX8 ( COMPLEX8 *out, COMPLEX8 scalar, const COMPLEX8 *in
 /** Compute \f$\text{out} = \text{scalar} + \text{in}\f$ over COMPLEX8 vector \c in with \c len elements */
 int XLALVectorShiftCOMPLEX8 ( COMPLEX8 *out, COMPLEX8 scalar, const COMPLEX8 *in, const UINT4 len);
 
+/** Compute \f$\text{out} = \text{scalar} \times \text{in}\f$ over COMPLEX16 vector \c in with \c len elements */
+int XLALVectorScaleCOMPLEX16 ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len );
+
+/** Compute \f$\text{out} = \text{scalar} + \text{in}\f$ over COMPLEX16 vector \c in with \c len elements */
+int XLALVectorShiftCOMPLEX16 ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len );
+
+/** @} */
+
+/** \name Fused Vector Operations */
+/** @{ */
+
+/** Compute \f$\text{out} \mathrel{+}= \text{in1} \times \text{in2}^* \times \text{weight}\f$ over COMPLEX16 vectors \c in1, \c in2 and REAL8 vector \c weight with \c len elements */
+int XLALVectorConjMultiplyAccumulateCOMPLEX16 ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len );
+
+/** Compute the weighted inner product \f$\text{result} = \sum_i \text{in1}_i \times \text{in2}_i^* \times \text{weight}_i\f$ over COMPLEX16 vectors \c in1, \c in2 and REAL8 vector \c weight with \c len elements.
+ * \note The summation order differs between instruction sets, so results may differ by rounding errors.
+ */
+int XLALVectorWeightedInnerProductCOMPLEX16 ( COMPLEX16 *result, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len );
+
 /** @} */
 
 /** \name Vector Element Finding Operations */
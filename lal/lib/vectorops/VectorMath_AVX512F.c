@@ -0,0 +1,340 @@
+//
+// Copyright (C) 2026 agent
+// Copyright (C) 2015 Reinhard Prix, Karl Wette
+// Copyright (C) 2015 Evan Goetz
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+// ---------- INCLUDES ----------
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <config.h>
+
+#include <lal/LALConstants.h>
+#include <lal/VectorMath.h>
+
+#include "VectorMath_internal.h"
+
+#ifndef __AVX512F__
+#error "VectorMath_AVX512F.c requires SIMD instruction set AVX512F"
+#endif
+
+#include <immintrin.h>
+
+typedef union {
+  double f[8];
+  __m512d v;
+} __attribute__ ((aligned(64))) V8SD;
+
+// ---------- local operators and operator-wrappers ----------
+UNUSED static inline __m512d
+local_add_pd ( __m512d in1, __m512d in2 )
+{
+  return _mm512_add_pd ( in1, in2 );
+}
+
+// in1: a0,b0,...,a3,b3 in2: c0,d0,...,c3,d3
+UNUSED static inline __m512d
+local_cmul_pd ( __m512d in1, __m512d in2 )
+{
+  // a0,a0,...,a3,a3 and b0,b0,...,b3,b3
+  __m512d re1 = _mm512_movedup_pd ( in1 );
+  __m512d im1 = _mm512_permute_pd ( in1, 0xff );
+
+  // Switch the real and imaginary elements of in2
+  // d0,c0,...,d3,c3
+  __m512d sw2 = _mm512_permute_pd ( in2, 0x55 );
+
+  // a0c0-b0d0, a0d0+b0c0, ...
+  return _mm512_fmaddsub_pd ( re1, in2, _mm512_mul_pd ( im1, sw2 ) );
+}
+
+// in1: a0,b0,...,a3,b3 in2: c0,d0,...,c3,d3; returns in1 * conj(in2)
+UNUSED static inline __m512d
+local_cmulconj_pd ( __m512d in1, __m512d in2 )
+{
+  // c0,c0,...,c3,c3 and d0,d0,...,d3,d3
+  __m512d re2 = _mm512_movedup_pd ( in2 );
+  __m512d im2 = _mm512_permute_pd ( in2, 0xff );
+
+  // Switch the real and imaginary elements of in1
+  // b0,a0,...,b3,a3
+  __m512d sw1 = _mm512_permute_pd ( in1, 0x55 );
+
+  // a0c0+b0d0, b0c0-a0d0, ...
+  return _mm512_fmsubadd_pd ( re2, in1, _mm512_mul_pd ( im2, sw1 ) );
+}
+
+// in: a0,b0,...,a3,b3 weight: w0,w0,...,w3,w3
+UNUSED static inline __m512d
+local_cweight_pd ( __m512d in, __m512d weight )
+{
+  return _mm512_mul_pd ( in, weight );
+}
+
+// accum + in1 * conj(in2) * weight
+UNUSED static inline __m512d
+local_cmulconjacc_pd ( __m512d accum, __m512d in1, __m512d in2, __m512d weight )
+{
+  return _mm512_fmadd_pd ( local_cmulconj_pd ( in1, in2 ), weight, accum );
+}
+
+// load 4 REAL8 weights w0,...,w3 and expand them to w0,w0,...,w3,w3
+static inline __m512d
+local_load_cweight_pd ( const REAL8 *weight )
+{
+  const __m512i idx = _mm512_set_epi64 ( 3, 3, 2, 2, 1, 1, 0, 0 );
+  return _mm512_permutexvar_pd ( idx, _mm512_castpd256_pd512 ( _mm256_loadu_pd ( weight ) ) );
+}
+
+// ========== internal generic AVX512F functions ==========
+
+// ---------- generic AVX512F operator with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+static inline int
+XLALVectorMath_ZZ2Z_AVX512F ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len, __m512d (*op)(__m512d, __m512d) )
+{
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      __m512d in8p_1 = _mm512_loadu_pd( (const REAL8*)&in1[i4] );
+      __m512d in8p_2 = _mm512_loadu_pd( (const REAL8*)&in2[i4] );
+      __m512d out8p = (*op) ( in8p_1, in8p_2 );
+      _mm512_storeu_pd( (REAL8*)&out[i4], out8p );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  V8SD in8_1 = {.f={0,0,0,0,0,0,0,0}};
+  V8SD in8_2 = {.f={0,0,0,0,0,0,0,0}};
+  V8SD out8;
+  for ( UINT4 i = i4Max, j = 0; i < len; i++, j+=2 )
+    {
+      in8_1.f[j]   = creal ( in1[i] );
+      in8_1.f[j+1] = cimag ( in1[i] );
+      in8_2.f[j]   = creal ( in2[i] );
+      in8_2.f[j+1] = cimag ( in2[i] );
+    }
+
+  out8.v = (*op) ( in8_1.v, in8_2.v );
+  for ( UINT4 i = i4Max, j = 0; i < len; i++, j+=2 )
+    {
+      out[i] = crect( out8.f[j], out8.f[j+1] );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZ2Z_AVX512F()
+
+// ---------- generic AVX512F operator with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+static inline int
+XLALVectorMath_zZ2Z_AVX512F ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len, __m512d (*op)(__m512d, __m512d) )
+{
+  const V8SD scalar8 = {.f={creal(scalar),cimag(scalar),creal(scalar),cimag(scalar),creal(scalar),cimag(scalar),creal(scalar),cimag(scalar)}};
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      __m512d in8p = _mm512_loadu_pd( (const REAL8*)&in[i4] );
+      __m512d out8p = (*op) ( scalar8.v, in8p );
+      _mm512_storeu_pd( (REAL8*)&out[i4], out8p );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  V8SD in8 = {.f={0,0,0,0,0,0,0,0}};
+  V8SD out8;
+  for ( UINT4 i = i4Max, j = 0; i < len; i++, j+=2 )
+    {
+      in8.f[j]   = creal ( in[i] );
+      in8.f[j+1] = cimag ( in[i] );
+    }
+
+  out8.v = (*op) ( scalar8.v, in8.v );
+  for ( UINT4 i = i4Max, j = 0; i < len; i++, j+=2 )
+    {
+      out[i] = crect( out8.f[j], out8.f[j+1] );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_zZ2Z_AVX512F()
+
+// ---------- generic AVX512F operator with 1 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZD2Z) ----------
+static inline int
+XLALVectorMath_ZD2Z_AVX512F ( COMPLEX16 *out, const COMPLEX16 *in, const REAL8 *weight, const UINT4 len, __m512d (*op)(__m512d, __m512d) )
+{
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      __m512d in8p = _mm512_loadu_pd( (const REAL8*)&in[i4] );
+      __m512d w8p = local_load_cweight_pd ( &weight[i4] );
+      __m512d out8p = (*op) ( in8p, w8p );
+      _mm512_storeu_pd( (REAL8*)&out[i4], out8p );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  V8SD in8 = {.f={0,0,0,0,0,0,0,0}};
+  V8SD w8 = {.f={0,0,0,0,0,0,0,0}};
+  V8SD out8;
+  for ( UINT4 i = i4Max, j = 0; i < len; i++, j+=2 )
+    {
+      in8.f[j]   = creal ( in[i] );
+      in8.f[j+1] = cimag ( in[i] );
+      w8.f[j]    = weight[i];
+      w8.f[j+1]  = weight[i];
+    }
+
+  out8.v = (*op) ( in8.v, w8.v );
+  for ( UINT4 i = i4Max, j = 0; i < len; i++, j+=2 )
+    {
+      out[i] = crect( out8.f[j], out8.f[j+1] );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZD2Z_AVX512F()
+
+// ---------- generic AVX512F operator with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZZD2Z) ----------
+static inline int
+XLALVectorMath_ZZD2Z_AVX512F ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len, __m512d (*op)(__m512d, __m512d, __m512d, __m512d) )
+{
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      __m512d out8p = _mm512_loadu_pd( (const REAL8*)&out[i4] );
+      __m512d in8p_1 = _mm512_loadu_pd( (const REAL8*)&in1[i4] );
+      __m512d in8p_2 = _mm512_loadu_pd( (const REAL8*)&in2[i4] );
+      __m512d w8p = local_load_cweight_pd ( &weight[i4] );
+      out8p = (*op) ( out8p, in8p_1, in8p_2, w8p );
+      _mm512_storeu_pd( (REAL8*)&out[i4], out8p );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  V8SD out8 = {.f={0,0,0,0,0,0,0,0}};
+  V8SD in8_1 = {.f={0,0,0,0,0,0,0,0}};
+  V8SD in8_2 = {.f={0,0,0,0,0,0,0,0}};
+  V8SD w8 = {.f={0,0,0,0,0,0,0,0}};
+  for ( UINT4 i = i4Max, j = 0; i < len; i++, j+=2 )
+    {
+      out8.f[j]    = creal ( out[i] );
+      out8.f[j+1]  = cimag ( out[i] );
+      in8_1.f[j]   = creal ( in1[i] );
+      in8_1.f[j+1] = cimag ( in1[i] );
+      in8_2.f[j]   = creal ( in2[i] );
+      in8_2.f[j+1] = cimag ( in2[i] );
+      w8.f[j]      = weight[i];
+      w8.f[j+1]    = weight[i];
+    }
+
+  out8.v = (*op) ( out8.v, in8_1.v, in8_2.v, w8.v );
+  for ( UINT4 i = i4Max, j = 0; i < len; i++, j+=2 )
+    {
+      out[i] = crect( out8.f[j], out8.f[j+1] );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZD2Z_AVX512F()
+
+// ---------- generic AVX512F operator with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 scalar output (ZZD2z) ----------
+static inline int
+XLALVectorMath_ZZD2z_AVX512F ( COMPLEX16 *result, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len, __m512d (*op)(__m512d, __m512d, __m512d, __m512d) )
+{
+
+  // accumulate in 2 independent partial sums, to hide the latency of the additions
+  __m512d sum8p_a = _mm512_setzero_pd();
+  __m512d sum8p_b = _mm512_setzero_pd();
+
+  // walk through vector in blocks of 8
+  UINT4 i8Max = len - ( len % 8 );
+  for ( UINT4 i8 = 0; i8 < i8Max; i8 += 8 )
+    {
+      sum8p_a = (*op) ( sum8p_a, _mm512_loadu_pd( (const REAL8*)&in1[i8] ), _mm512_loadu_pd( (const REAL8*)&in2[i8] ), local_load_cweight_pd ( &weight[i8] ) );
+      sum8p_b = (*op) ( sum8p_b, _mm512_loadu_pd( (const REAL8*)&in1[i8+4] ), _mm512_loadu_pd( (const REAL8*)&in2[i8+4] ), local_load_cweight_pd ( &weight[i8+4] ) );
+    }
+
+  // deal with the remaining (<=7) terms separately: first a full block of 4, if there is one
+  UINT4 i4Max = i8Max;
+  if ( len - i8Max >= 4 )
+    {
+      sum8p_b = (*op) ( sum8p_b, _mm512_loadu_pd( (const REAL8*)&in1[i8Max] ), _mm512_loadu_pd( (const REAL8*)&in2[i8Max] ), local_load_cweight_pd ( &weight[i8Max] ) );
+      i4Max += 4;
+    }
+
+  // then the remaining (<=3) terms
+  V8SD in8_1 = {.f={0,0,0,0,0,0,0,0}};
+  V8SD in8_2 = {.f={0,0,0,0,0,0,0,0}};
+  V8SD w8 = {.f={0,0,0,0,0,0,0,0}};
+  for ( UINT4 i = i4Max, j = 0; i < len; i++, j+=2 )
+    {
+      in8_1.f[j]   = creal ( in1[i] );
+      in8_1.f[j+1] = cimag ( in1[i] );
+      in8_2.f[j]   = creal ( in2[i] );
+      in8_2.f[j+1] = cimag ( in2[i] );
+      w8.f[j]      = weight[i];
+      w8.f[j+1]    = weight[i];
+    }
+  sum8p_a = (*op) ( sum8p_a, in8_1.v, in8_2.v, w8.v );
+
+  // add up the partial sums
+  V8SD sum8;
+  sum8.v = _mm512_add_pd ( sum8p_a, sum8p_b );
+  *result = crect( ( sum8.f[0] + sum8.f[2] ) + ( sum8.f[4] + sum8.f[6] ), ( sum8.f[1] + sum8.f[3] ) + ( sum8.f[5] + sum8.f[7] ) );
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZD2z_AVX512F()
+
+// ========== internal AVX512F vector math functions ==========
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+#define DEFINE_VECTORMATH_ZZ2Z(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZ2Z_AVX512F, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_ZZ2Z(Multiply, local_cmul_pd)
+DEFINE_VECTORMATH_ZZ2Z(Add, local_add_pd)
+
+// ---------- define vector math functions with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+#define DEFINE_VECTORMATH_zZ2Z(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_zZ2Z_AVX512F, NAME ## COMPLEX16, ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, scalar, in, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_zZ2Z(Scale, local_cmul_pd)
+DEFINE_VECTORMATH_zZ2Z(Shift, local_add_pd)
+
+// ---------- define vector math functions with 1 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZD2Z) ----------
+#define DEFINE_VECTORMATH_ZD2Z(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZD2Z_AVX512F, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in, const REAL8 *weight, const UINT4 len ), ( (out != NULL) && (in != NULL) && (weight != NULL) ), ( out, in, weight, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_ZD2Z(Weight, local_cweight_pd)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZZD2Z) ----------
+#define DEFINE_VECTORMATH_ZZD2Z(NAME, AVX_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZD2Z_AVX512F, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( out, in1, in2, weight, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_ZZD2Z(ConjMultiplyAccumulate, local_cmulconjacc_pd)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 scalar output (ZZD2z) ----------
+#define DEFINE_VECTORMATH_ZZD2z(NAME, AVX_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZD2z_AVX512F, NAME ## COMPLEX16, ( COMPLEX16 *result, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), ( (result != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( result, in1, in2, weight, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_ZZD2z(WeightedInnerProduct, local_cmulconjacc_pd)
@@ -184,6 +184,68 @@ local_cmul_ps ( __m256 in1, __m256 in2 )
   return _mm256_permute_ps(in2, 0xd8);
 }
 
+// in1: a0,b0,a1,b1 in2: c0,d0,c1,d1
+UNUSED static inline __m256d
+local_cmul_pd ( __m256d in1, __m256d in2 )
+{
+  // a0,a0,a1,a1 and b0,b0,b1,b1
+  __m256d re1 = _mm256_movedup_pd ( in1 );
+  __m256d im1 = _mm256_permute_pd ( in1, 0xf );
+
+  // Switch the real and imaginary elements of in2
+  // d0,c0,d1,c1
+  __m256d sw2 = _mm256_permute_pd ( in2, 0x5 );
+
+  // a0c0, a0d0, a1c1, a1d1 and b0d0, b0c0, b1d1, b1c1
+  __m256d temp1 = _mm256_mul_pd ( re1, in2 );
+  __m256d temp2 = _mm256_mul_pd ( im1, sw2 );
+
+  // a0c0-b0d0, a0d0+b0c0, a1c1-b1d1, a1d1+b1c1
+  return _mm256_addsub_pd ( temp1, temp2 );
+}
+
+// in1: a0,b0,a1,b1 in2: c0,d0,c1,d1; returns in1 * conj(in2)
+UNUSED static inline __m256d
+local_cmulconj_pd ( __m256d in1, __m256d in2 )
+{
+  // c0,c0,c1,c1 and -d0,-d0,-d1,-d1
+  __m256d re2 = _mm256_movedup_pd ( in2 );
+  __m256d im2 = _mm256_xor_pd ( _mm256_permute_pd ( in2, 0xf ), _mm256_set1_pd ( -0.0 ) );
+
+  // Switch the real and imaginary elements of in1
+  // b0,a0,b1,a1
+  __m256d sw1 = _mm256_permute_pd ( in1, 0x5 );
+
+  // a0c0, b0c0, a1c1, b1c1 and -b0d0, -a0d0, -b1d1, -a1d1
+  __m256d temp1 = _mm256_mul_pd ( re2, in1 );
+  __m256d temp2 = _mm256_mul_pd ( im2, sw1 );
+
+  // a0c0+b0d0, b0c0-a0d0, a1c1+b1d1, b1c1-a1d1
+  return _mm256_addsub_pd ( temp1, temp2 );
+}
+
+// in: a0,b0,a1,b1 weight: w0,w0,w1,w1
+UNUSED static inline __m256d
+local_cweight_pd ( __m256d in, __m256d weight )
+{
+  return _mm256_mul_pd ( in, weight );
+}
+
+// accum + in1 * conj(in2) * weight
+UNUSED static inline __m256d
+local_cmulconjacc_pd ( __m256d accum, __m256d in1, __m256d in2, __m256d weight )
+{
+  return _mm256_add_pd ( accum, _mm256_mul_pd ( local_cmulconj_pd ( in1, in2 ), weight ) );
+}
+
+// load 2 REAL8 weights w0,w1 and expand them to w0,w0,w1,w1
+static inline __m256d
+local_load_cweight_pd ( const REAL8 *weight )
+{
+  __m128d w2 = _mm_loadu_pd ( weight );
+  return _mm256_permute_pd ( _mm256_insertf128_pd ( _mm256_castpd128_pd256 ( w2 ), w2, 1 ), 0xc );
+}
+
 // ========== internal generic AVXx functions ==========
 
 // ---------- generic AVXx operator with 1 REAL4 vector input to 1 REAL4 vector output (S2S) ----------
@@ -468,6 +530,190 @@ XLALVectorMath_D2D_AVXx ( REAL8 *out, const REAL8 *in, const UINT4 len, __m256d
 
 } // XLALVectorMath_D2D_AVXx()
 
+// ---------- generic AVXx operator with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+static inline int
+XLALVectorMath_D2DD_AVXx ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len, void (*f)(__m256d, __m256d*, __m256d*) )
+{
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      __m256d in4p = _mm256_loadu_pd(&in[i4]);
+      __m256d out4p_1, out4p_2;
+      (*f) ( in4p, &out4p_1, &out4p_2 );
+      _mm256_storeu_pd(&out1[i4], out4p_1);
+      _mm256_storeu_pd(&out2[i4], out4p_2);
+    }
+
+  // deal with the remaining (<=3) terms separately
+  V4SD in4 = {.f={0,0,0,0}}, out4_1, out4_2;
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    in4.f[j] = in[i];
+  }
+  (*f) ( in4.v, &out4_1.v, &out4_2.v );
+  for ( UINT4 i = i4Max,j=0; i < len; i ++, j++ ) {
+    out1[i] = out4_1.f[j];
+    out2[i] = out4_2.f[j];
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_D2DD_AVXx()
+
+// ---------- generic AVXx operator with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+static inline int
+XLALVectorMath_ZZ2Z_AVXx ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len, __m256d (*op)(__m256d, __m256d) )
+{
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      __m256d in4p_1 = _mm256_loadu_pd( (const REAL8*)&in1[i2] );
+      __m256d in4p_2 = _mm256_loadu_pd( (const REAL8*)&in2[i2] );
+      __m256d out4p = (*op) ( in4p_1, in4p_2 );
+      _mm256_storeu_pd( (REAL8*)&out[i2], out4p );
+    }
+
+  // deal with the remaining (<=1) term separately
+  if ( i2Max < len )
+    {
+      V4SD in4_1 = {.f={creal(in1[i2Max]),cimag(in1[i2Max]),0,0}};
+      V4SD in4_2 = {.f={creal(in2[i2Max]),cimag(in2[i2Max]),0,0}};
+      V4SD out4;
+      out4.v = (*op) ( in4_1.v, in4_2.v );
+      out[i2Max] = crect( out4.f[0], out4.f[1] );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZ2Z_AVXx()
+
+// ---------- generic AVXx operator with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+static inline int
+XLALVectorMath_zZ2Z_AVXx ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len, __m256d (*op)(__m256d, __m256d) )
+{
+  const V4SD scalar4 = {.f={creal(scalar),cimag(scalar),creal(scalar),cimag(scalar)}};
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      __m256d in4p = _mm256_loadu_pd( (const REAL8*)&in[i2] );
+      __m256d out4p = (*op) ( scalar4.v, in4p );
+      _mm256_storeu_pd( (REAL8*)&out[i2], out4p );
+    }
+
+  // deal with the remaining (<=1) term separately
+  if ( i2Max < len )
+    {
+      V4SD in4 = {.f={creal(in[i2Max]),cimag(in[i2Max]),0,0}};
+      V4SD out4;
+      out4.v = (*op) ( scalar4.v, in4.v );
+      out[i2Max] = crect( out4.f[0], out4.f[1] );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_zZ2Z_AVXx()
+
+// ---------- generic AVXx operator with 1 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZD2Z) ----------
+static inline int
+XLALVectorMath_ZD2Z_AVXx ( COMPLEX16 *out, const COMPLEX16 *in, const REAL8 *weight, const UINT4 len, __m256d (*op)(__m256d, __m256d) )
+{
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      __m256d in4p = _mm256_loadu_pd( (const REAL8*)&in[i2] );
+      __m256d w4p = local_load_cweight_pd ( &weight[i2] );
+      __m256d out4p = (*op) ( in4p, w4p );
+      _mm256_storeu_pd( (REAL8*)&out[i2], out4p );
+    }
+
+  // deal with the remaining (<=1) term separately
+  if ( i2Max < len )
+    {
+      V4SD in4 = {.f={creal(in[i2Max]),cimag(in[i2Max]),0,0}};
+      V4SD w4 = {.f={weight[i2Max],weight[i2Max],0,0}};
+      V4SD out4;
+      out4.v = (*op) ( in4.v, w4.v );
+      out[i2Max] = crect( out4.f[0], out4.f[1] );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZD2Z_AVXx()
+
+// ---------- generic AVXx operator with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZZD2Z) ----------
+static inline int
+XLALVectorMath_ZZD2Z_AVXx ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len, __m256d (*op)(__m256d, __m256d, __m256d, __m256d) )
+{
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      __m256d out4p = _mm256_loadu_pd( (const REAL8*)&out[i2] );
+      __m256d in4p_1 = _mm256_loadu_pd( (const REAL8*)&in1[i2] );
+      __m256d in4p_2 = _mm256_loadu_pd( (const REAL8*)&in2[i2] );
+      __m256d w4p = local_load_cweight_pd ( &weight[i2] );
+      out4p = (*op) ( out4p, in4p_1, in4p_2, w4p );
+      _mm256_storeu_pd( (REAL8*)&out[i2], out4p );
+    }
+
+  // deal with the remaining (<=1) term separately
+  if ( i2Max < len )
+    {
+      V4SD out4 = {.f={creal(out[i2Max]),cimag(out[i2Max]),0,0}};
+      V4SD in4_1 = {.f={creal(in1[i2Max]),cimag(in1[i2Max]),0,0}};
+      V4SD in4_2 = {.f={creal(in2[i2Max]),cimag(in2[i2Max]),0,0}};
+      V4SD w4 = {.f={weight[i2Max],weight[i2Max],0,0}};
+      out4.v = (*op) ( out4.v, in4_1.v, in4_2.v, w4.v );
+      out[i2Max] = crect( out4.f[0], out4.f[1] );
+    }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZD2Z_AVXx()
+
+// ---------- generic AVXx operator with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 scalar output (ZZD2z) ----------
+static inline int
+XLALVectorMath_ZZD2z_AVXx ( COMPLEX16 *result, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len, __m256d (*op)(__m256d, __m256d, __m256d, __m256d) )
+{
+
+  // accumulate in 2 independent partial sums, to hide the latency of the additions
+  __m256d sum4p_a = _mm256_setzero_pd();
+  __m256d sum4p_b = _mm256_setzero_pd();
+
+  // walk through vector in blocks of 4
+  UINT4 i4Max = len - ( len % 4 );
+  for ( UINT4 i4 = 0; i4 < i4Max; i4 += 4 )
+    {
+      sum4p_a = (*op) ( sum4p_a, _mm256_loadu_pd( (const REAL8*)&in1[i4] ), _mm256_loadu_pd( (const REAL8*)&in2[i4] ), local_load_cweight_pd ( &weight[i4] ) );
+      sum4p_b = (*op) ( sum4p_b, _mm256_loadu_pd( (const REAL8*)&in1[i4+2] ), _mm256_loadu_pd( (const REAL8*)&in2[i4+2] ), local_load_cweight_pd ( &weight[i4+2] ) );
+    }
+
+  // deal with the remaining (<=3) terms separately
+  for ( UINT4 i = i4Max; i < len; i ++ )
+    {
+      V4SD in4_1 = {.f={creal(in1[i]),cimag(in1[i]),0,0}};
+      V4SD in4_2 = {.f={creal(in2[i]),cimag(in2[i]),0,0}};
+      V4SD w4 = {.f={weight[i],weight[i],0,0}};
+      sum4p_a = (*op) ( sum4p_a, in4_1.v, in4_2.v, w4.v );
+    }
+
+  // add up the partial sums
+  V4SD sum4;
+  sum4.v = _mm256_add_pd ( sum4p_a, sum4p_b );
+  *result = crect( sum4.f[0] + sum4.f[2], sum4.f[1] + sum4.f[3] );
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_ZZD2z_AVXx()
+
 // ========== internal AVXx vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 REAL4 vector output (S2S) ----------
@@ -537,4 +783,47 @@ DEFINE_VECTORMATH_cC2C(Shift, local_add_ps)
 #define DEFINE_VECTORMATH_D2D(NAME, AVX_OP)                             \
   DEFINE_VECTORMATH_ANY( XLALVectorMath_D2D_AVXx, NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, AVX_OP ) )
 
+DEFINE_VECTORMATH_D2D(Sin, sin256_pd)
+DEFINE_VECTORMATH_D2D(Cos, cos256_pd)
+DEFINE_VECTORMATH_D2D(Exp, exp256_pd)
+DEFINE_VECTORMATH_D2D(Log, log256_pd)
 DEFINE_VECTORMATH_D2D(Round, local_round_pd)
+
+// ---------- define vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define DEFINE_VECTORMATH_D2DD(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2DD_AVXx, NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), ( (out1 != NULL) && (out2 != NULL) && (in != NULL) ), ( out1, out2, in, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_D2DD(SinCos, sincos256_pd)
+DEFINE_VECTORMATH_D2DD(SinCos2Pi, sincos256_pd_2pi)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+#define DEFINE_VECTORMATH_ZZ2Z(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZ2Z_AVXx, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_ZZ2Z(Multiply, local_cmul_pd)
+DEFINE_VECTORMATH_ZZ2Z(Add, local_add_pd)
+
+// ---------- define vector math functions with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+#define DEFINE_VECTORMATH_zZ2Z(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_zZ2Z_AVXx, NAME ## COMPLEX16, ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, scalar, in, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_zZ2Z(Scale, local_cmul_pd)
+DEFINE_VECTORMATH_zZ2Z(Shift, local_add_pd)
+
+// ---------- define vector math functions with 1 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZD2Z) ----------
+#define DEFINE_VECTORMATH_ZD2Z(NAME, AVX_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZD2Z_AVXx, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in, const REAL8 *weight, const UINT4 len ), ( (out != NULL) && (in != NULL) && (weight != NULL) ), ( out, in, weight, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_ZD2Z(Weight, local_cweight_pd)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZZD2Z) ----------
+#define DEFINE_VECTORMATH_ZZD2Z(NAME, AVX_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZD2Z_AVXx, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( out, in1, in2, weight, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_ZZD2Z(ConjMultiplyAccumulate, local_cmulconjacc_pd)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 scalar output (ZZD2z) ----------
+#define DEFINE_VECTORMATH_ZZD2z(NAME, AVX_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZD2z_AVXx, NAME ## COMPLEX16, ( COMPLEX16 *result, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), ( (result != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( result, in1, in2, weight, len, AVX_OP ) )
+
+DEFINE_VECTORMATH_ZZD2z(WeightedInnerProduct, local_cmulconjacc_pd)
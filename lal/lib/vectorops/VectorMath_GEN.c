@@ -46,6 +46,18 @@ static inline void local_sincosf_2pi(REAL4 in, REAL4 *out1, REAL4 *out2) {
   *out2 = cosf ( (REAL4)LAL_TWOPI * in );
 }
 
+static inline void local_sincos(REAL8 in, REAL8 *out1, REAL8 *out2) {
+  *out1 = sin ( in );
+  *out2 = cos ( in );
+}
+
+static inline void local_sincos_2pi(REAL8 in, REAL8 *out1, REAL8 *out2) {
+  // remove the integer part of 'in' first, to retain full precision for large arguments
+  const REAL8 x = LAL_TWOPI * ( in - round ( in ) );
+  *out1 = sin ( x );
+  *out2 = cos ( x );
+}
+
 static inline REAL4 local_addf ( REAL4 x, REAL4 y ) {
   return x + y;
 }
@@ -80,6 +92,26 @@ static inline COMPLEX8 local_caddf ( COMPLEX8 x, COMPLEX8 y )
   return x + y;
 }
 
+static inline COMPLEX16 local_cmul ( COMPLEX16 x, COMPLEX16 y )
+{
+  return crect ( creal(x) * creal(y) - cimag(x) * cimag(y), creal(x) * cimag(y) + cimag(x) * creal(y) );
+}
+
+static inline COMPLEX16 local_cadd ( COMPLEX16 x, COMPLEX16 y )
+{
+  return x + y;
+}
+
+static inline COMPLEX16 local_cweight ( COMPLEX16 x, REAL8 w )
+{
+  return crect ( creal(x) * w, cimag(x) * w );
+}
+
+static inline COMPLEX16 local_cmulconjacc ( COMPLEX16 acc, COMPLEX16 x, COMPLEX16 y, REAL8 w )
+{
+  return crect ( creal(acc) + ( creal(x) * creal(y) + cimag(x) * cimag(y) ) * w, cimag(acc) + ( cimag(x) * creal(y) - creal(x) * cimag(y) ) * w );
+}
+
 static inline REAL4 local_fmaxf ( REAL4 x, REAL4 y ) {
   return (x > y) ? x : y;
 }
@@ -196,6 +228,74 @@ XLALVectorMath_D2D_GEN ( REAL8 *out, const REAL8 *in, const UINT4 len, REAL8 (*o
   return XLAL_SUCCESS;
 }
 
+// ---------- generic operator with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+static inline int
+XLALVectorMath_D2DD_GEN ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len, void (*op)(REAL8, REAL8*, REAL8*) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      (*op) ( in[i], &(out1[i]), &(out2[i]) );
+    }
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+static inline int
+XLALVectorMath_ZZ2Z_GEN ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len, COMPLEX16 (*op)(COMPLEX16, COMPLEX16) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      out[i] = (*op) ( in1[i], in2[i] );
+    }
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+static inline int
+XLALVectorMath_zZ2Z_GEN ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len, COMPLEX16 (*op)(COMPLEX16, COMPLEX16) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      out[i] = (*op) ( scalar, in[i] );
+    }
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 1 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZD2Z) ----------
+static inline int
+XLALVectorMath_ZD2Z_GEN ( COMPLEX16 *out, const COMPLEX16 *in, const REAL8 *weight, const UINT4 len, COMPLEX16 (*op)(COMPLEX16, REAL8) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      out[i] = (*op) ( in[i], weight[i] );
+    }
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZZD2Z) ----------
+static inline int
+XLALVectorMath_ZZD2Z_GEN ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len, COMPLEX16 (*op)(COMPLEX16, COMPLEX16, COMPLEX16, REAL8) )
+{
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      out[i] = (*op) ( out[i], in1[i], in2[i], weight[i] );
+    }
+  return XLAL_SUCCESS;
+}
+
+// ---------- generic operator with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 scalar output (ZZD2z) ----------
+static inline int
+XLALVectorMath_ZZD2z_GEN ( COMPLEX16 *result, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len, COMPLEX16 (*op)(COMPLEX16, COMPLEX16, COMPLEX16, REAL8) )
+{
+  COMPLEX16 sum = 0;
+  for ( UINT4 i = 0; i < len; i ++ )
+    {
+      sum = (*op) ( sum, in1[i], in2[i], weight[i] );
+    }
+  *result = sum;
+  return XLAL_SUCCESS;
+}
+
 // ========== internal vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 INT4 vector output (S2I) ----------
@@ -271,4 +371,47 @@ DEFINE_VECTORMATH_cC2C(Shift, local_caddf)
 #define DEFINE_VECTORMATH_D2D(NAME, GEN_OP)                             \
   DEFINE_VECTORMATH_ANY( XLALVectorMath_D2D_GEN, NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, GEN_OP ) )
 
+DEFINE_VECTORMATH_D2D(Sin, sin)
+DEFINE_VECTORMATH_D2D(Cos, cos)
+DEFINE_VECTORMATH_D2D(Exp, exp)
+DEFINE_VECTORMATH_D2D(Log, log)
 DEFINE_VECTORMATH_D2D(Round, round)
+
+// ---------- define vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define DEFINE_VECTORMATH_D2DD(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2DD_GEN, NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), ( (out1 != NULL) && (out2 != NULL) && (in != NULL) ), ( out1, out2, in, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_D2DD(SinCos, local_sincos)
+DEFINE_VECTORMATH_D2DD(SinCos2Pi, local_sincos_2pi)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) ----------
+#define DEFINE_VECTORMATH_ZZ2Z(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZ2Z_GEN, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) ), ( out, in1, in2, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_ZZ2Z(Multiply, local_cmul)
+DEFINE_VECTORMATH_ZZ2Z(Add, local_cadd)
+
+// ---------- define vector math functions with 1 COMPLEX16 scalar and 1 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (zZ2Z) ----------
+#define DEFINE_VECTORMATH_zZ2Z(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_zZ2Z_GEN, NAME ## COMPLEX16, ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, scalar, in, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_zZ2Z(Scale, local_cmul)
+DEFINE_VECTORMATH_zZ2Z(Shift, local_cadd)
+
+// ---------- define vector math functions with 1 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZD2Z) ----------
+#define DEFINE_VECTORMATH_ZD2Z(NAME, GEN_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZD2Z_GEN, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in, const REAL8 *weight, const UINT4 len ), ( (out != NULL) && (in != NULL) && (weight != NULL) ), ( out, in, weight, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_ZD2Z(Weight, local_cweight)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZZD2Z) ----------
+#define DEFINE_VECTORMATH_ZZD2Z(NAME, GEN_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZD2Z_GEN, NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), ( (out != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( out, in1, in2, weight, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_ZZD2Z(ConjMultiplyAccumulate, local_cmulconjacc)
+
+// ---------- define vector math functions with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 scalar output (ZZD2z) ----------
+#define DEFINE_VECTORMATH_ZZD2z(NAME, GEN_OP)                           \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_ZZD2z_GEN, NAME ## COMPLEX16, ( COMPLEX16 *result, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), ( (result != NULL) && (in1 != NULL) && (in2 != NULL) && (weight != NULL) ), ( result, in1, in2, weight, len, GEN_OP ) )
+
+DEFINE_VECTORMATH_ZZD2z(WeightedInnerProduct, local_cmulconjacc)
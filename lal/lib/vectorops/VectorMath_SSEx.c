@@ -401,6 +401,65 @@ XLALVectorMath_cC2C_SSEx ( COMPLEX8 *out, COMPLEX8 scalar, const COMPLEX8 *in, c
 
 } // XLALVectorMath_cC2C_SSEx()
 
+// ---------- generic SSEx operator with 1 REAL8 vector input to 1 REAL8 vector output (D2D) ----------
+static inline int
+XLALVectorMath_D2D_SSEx ( REAL8 *out, const REAL8 *in, const UINT4 len, __m128d (*f)(__m128d) )
+{
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      __m128d in2p = _mm_loadu_pd(&in[i2]);
+      __m128d out2p = (*f)( in2p );
+      _mm_storeu_pd(&out[i2], out2p);
+    }
+
+  // deal with the remaining (<=1) terms separately
+  V2SF in2 = {.f={0,0}}, out2;
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    in2.f[j] = in[i];
+  }
+  out2.v = (*f)( in2.v );
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    out[i] = out2.f[j];
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_D2D_SSEx()
+
+// ---------- generic SSEx operator with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+static inline int
+XLALVectorMath_D2DD_SSEx ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len, void (*f)(__m128d, __m128d*, __m128d*) )
+{
+
+  // walk through vector in blocks of 2
+  UINT4 i2Max = len - ( len % 2 );
+  for ( UINT4 i2 = 0; i2 < i2Max; i2 += 2 )
+    {
+      __m128d in2p = _mm_loadu_pd(&in[i2]);
+      __m128d out2p_1, out2p_2;
+      (*f) ( in2p, &out2p_1, &out2p_2 );
+      _mm_storeu_pd(&out1[i2], out2p_1);
+      _mm_storeu_pd(&out2[i2], out2p_2);
+    }
+
+  // deal with the remaining (<=1) terms separately
+  V2SF in2 = {.f={0,0}}, out2_1, out2_2;
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    in2.f[j] = in[i];
+  }
+  (*f) ( in2.v, &out2_1.v, &out2_2.v );
+  for ( UINT4 i = i2Max,j=0; i < len; i ++, j++ ) {
+    out1[i] = out2_1.f[j];
+    out2[i] = out2_2.f[j];
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALVectorMath_D2DD_SSEx()
+
 // ========== internal SSEx vector math functions ==========
 
 // ---------- define vector math functions with 1 REAL4 vector input to 1 INT4 vector output (S2I) ----------
@@ -469,3 +528,17 @@ DEFINE_VECTORMATH_CC2C(Add, local_add_ps)
 
 DEFINE_VECTORMATH_cC2C(Scale, local_cmul_ps)
 DEFINE_VECTORMATH_cC2C(Shift, local_add_ps)
+
+// ---------- define vector math functions with 1 REAL8 vector input to 1 REAL8 vector output (D2D) ----------
+#define DEFINE_VECTORMATH_D2D(NAME, SSE_OP)                             \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2D_SSEx, NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), ( (out != NULL) && (in != NULL) ), ( out, in, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_D2D(Sin, sin_pd)
+DEFINE_VECTORMATH_D2D(Cos, cos_pd)
+
+// ---------- define vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) ----------
+#define DEFINE_VECTORMATH_D2DD(NAME, SSE_OP)                            \
+  DEFINE_VECTORMATH_ANY( XLALVectorMath_D2DD_SSEx, NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), ( (out1 != NULL) && (out2 != NULL) && (in != NULL) ), ( out1, out2, in, len, SSE_OP ) )
+
+DEFINE_VECTORMATH_D2DD(SinCos, sincos_pd)
+DEFINE_VECTORMATH_D2DD(SinCos2Pi, sincos_pd_2pi)
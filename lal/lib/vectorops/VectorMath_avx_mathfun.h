@@ -128,6 +128,8 @@ _PS256_CONST(cephes_log_q2, 0.693359375);
 
 #define _mathfun_mm256_slli_epi32 _mm256_slli_epi32
 #define _mathfun_mm256_srli_epi32 _mm256_srli_epi32
+#define _mathfun_mm256_slli_epi64 _mm256_slli_epi64
+#define _mathfun_mm256_srli_epi64 _mm256_srli_epi64
 
 #define _mathfun_mm256_and_si128 _mm256_and_si128
 #define _mathfun_mm256_andnot_si128 _mm256_andnot_si128
@@ -171,6 +173,8 @@ static inline v8si _mathfun_mm256_##fn(v8si x, int a) \
 
 AVX2_BITOP_USING_SSE2(slli_epi32)
 AVX2_BITOP_USING_SSE2(srli_epi32)
+AVX2_BITOP_USING_SSE2(slli_epi64)
+AVX2_BITOP_USING_SSE2(srli_epi64)
 
 #define AVX2_INTOP_USING_SSE2(fn) \
 static inline v8si _mathfun_mm256_##fn(v8si x, v8si y) \
@@ -771,3 +775,315 @@ sincos256_ps_2pi(v8sf xx, v8sf *s, v8sf *c)
 
   return;
 } // sincos256_ps_2pi
+/* ========== double-precision versions of the above, added for LAL ==========
+ *
+ * These follow the double-precision cephes algorithms for sin, cos, exp and log.
+ * All integer bookkeeping (octants, exponents) is done in floating point, so the
+ * only integer instructions needed are the 64-bit shifts used to move exponents
+ * in and out of the IEEE bit pattern. Special values (0, denormals, inf, NaN) are
+ * treated like the C library does. For sin/cos, arguments with |x| > 2^30 (where
+ * cephes' three-part reduction of pi/4 loses accuracy) fall back to libm.
+ */
+#include <math.h>
+
+// ---------- Prototypes ----------
+static v4sd sin256_pd(v4sd x);
+static v4sd cos256_pd(v4sd x);
+static v4sd exp256_pd(v4sd x);
+static v4sd log256_pd(v4sd x);
+static void sincos256_pd(v4sd x, v4sd *s, v4sd *c);
+static void sincos256_pd_2pi(v4sd xx, v4sd *s, v4sd *c);
+// --------------------------------
+
+#define _PD256_CONST(Name, Val)                                    \
+  static const V4SD _pd256_##Name = { .f={Val, Val, Val, Val} }
+
+_PD256_CONST(0, 0.0);
+_PD256_CONST(1, 1.0);
+_PD256_CONST(2, 2.0);
+_PD256_CONST(4, 4.0);
+_PD256_CONST(6, 6.0);
+_PD256_CONST(8, 8.0);
+_PD256_CONST(0p5, 0.5);
+_PD256_CONST(0p125, 0.125);
+_PD256_CONST(sign_mask, -0.0);			// only the sign bit set
+_PD256_CONST(inf, INFINITY);			// all exponent bits set
+_PD256_CONST(nan, NAN);
+_PD256_CONST(ninf, -INFINITY);
+_PD256_CONST(2p52, 4503599627370496.0);		// 2^52
+_PD256_CONST(min_norm_pos, 2.2250738585072014e-308);	// DBL_MIN
+_PD256_CONST(2p54, 18014398509481984.0);		// 2^54
+_PD256_CONST(54, 54.0);
+_PD256_CONST(1022, 1022.0);
+_PD256_CONST(1023, 1023.0);
+
+/* round to nearest integer */
+static inline v4sd round256_pd(v4sd x) {
+  return _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+
+/* round down to integer, for x >= 0 */
+static inline v4sd floor_pos256_pd(v4sd x) {
+  return _mm256_round_pd(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+}
+
+/* select a where mask is set, b otherwise */
+static inline v4sd select256_pd(v4sd mask, v4sd a, v4sd b) {
+  return _mm256_blendv_pd(b, a, mask);
+}
+
+/* 2^n for integer-valued n in [-1022, 1023] */
+static inline v4sd pow2_256_pd(v4sd n) {
+  /* put the biased exponent into the low mantissa bits of 2^52, then shift it into place */
+  v4sd e = _mm256_add_pd(_mm256_add_pd(n, _pd256_1023.v), _pd256_2p52.v);
+  return _mm256_castsi256_pd(_mathfun_mm256_slli_epi64(_mm256_castpd_si256(e), 52));
+}
+
+_PD256_CONST(cephes_SQRTH, 0.70710678118654752440);
+_PD256_CONST(cephes_log_p0, 1.01875663804580931796E-4);
+_PD256_CONST(cephes_log_p1, 4.97494994976747001425E-1);
+_PD256_CONST(cephes_log_p2, 4.70579119878881725854E0);
+_PD256_CONST(cephes_log_p3, 1.44989225341610930846E1);
+_PD256_CONST(cephes_log_p4, 1.79368678507819816313E1);
+_PD256_CONST(cephes_log_p5, 7.70838733755885391666E0);
+_PD256_CONST(cephes_log_q0, 1.12873587189167450590E1);
+_PD256_CONST(cephes_log_q1, 4.52279145837532221105E1);
+_PD256_CONST(cephes_log_q2, 8.29875266912776603211E1);
+_PD256_CONST(cephes_log_q3, 7.11544750618563894466E1);
+_PD256_CONST(cephes_log_q4, 2.31251620126765340583E1);
+_PD256_CONST(cephes_log_C1, 0.693359375);
+_PD256_CONST(cephes_log_C2, -2.121944400546905827679e-4);
+
+/* natural logarithm computed for 4 simultaneous doubles
+   return NaN for x < 0, -inf for x == 0
+*/
+v4sd log256_pd(v4sd x) {
+  v4sd one = _pd256_1.v;
+
+  v4sd invalid_mask = _mm256_cmp_pd(x, _pd256_0.v, _CMP_NGT_UQ);	/* x <= 0 or NaN */
+  v4sd zero_mask = _mm256_cmp_pd(x, _pd256_0.v, _CMP_EQ_OQ);
+  v4sd inf_mask = _mm256_cmp_pd(x, _pd256_inf.v, _CMP_EQ_OQ);
+
+  /* scale denormals into the normal range */
+  v4sd denorm_mask = _mm256_cmp_pd(x, _pd256_min_norm_pos.v, _CMP_LT_OQ);
+  x = select256_pd(denorm_mask, _mm256_mul_pd(x, _pd256_2p54.v), x);
+
+  /* extract the exponent as a double, via the low mantissa bits of 2^52 */
+  v8si imm0 = _mathfun_mm256_srli_epi64(_mm256_castpd_si256(x), 52);
+  v4sd e = _mm256_sub_pd(_mm256_or_pd(_mm256_castsi256_pd(imm0), _pd256_2p52.v), _pd256_2p52.v);
+  e = _mm256_sub_pd(e, _pd256_1022.v);
+  e = _mm256_sub_pd(e, _mm256_and_pd(denorm_mask, _pd256_54.v));
+
+  /* keep only the fractional part, in [0.5, 1) */
+  x = _mm256_andnot_pd(_pd256_inf.v, x);
+  x = _mm256_or_pd(x, _pd256_0p5.v);
+
+  /* if( x < SQRTH ) { e -= 1; x = x + x - 1.0; } else { x = x - 1.0; } */
+  v4sd mask = _mm256_cmp_pd(x, _pd256_cephes_SQRTH.v, _CMP_LT_OQ);
+  v4sd tmp = _mm256_and_pd(x, mask);
+  x = _mm256_sub_pd(x, one);
+  e = _mm256_sub_pd(e, _mm256_and_pd(one, mask));
+  x = _mm256_add_pd(x, tmp);
+
+  v4sd z = _mm256_mul_pd(x, x);
+
+  /* y = x * ( z * P(x) / Q(x) ) */
+  v4sd p = _pd256_cephes_log_p0.v;
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), _pd256_cephes_log_p1.v);
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), _pd256_cephes_log_p2.v);
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), _pd256_cephes_log_p3.v);
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), _pd256_cephes_log_p4.v);
+  p = _mm256_add_pd(_mm256_mul_pd(p, x), _pd256_cephes_log_p5.v);
+  v4sd q = _mm256_add_pd(x, _pd256_cephes_log_q0.v);
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), _pd256_cephes_log_q1.v);
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), _pd256_cephes_log_q2.v);
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), _pd256_cephes_log_q3.v);
+  q = _mm256_add_pd(_mm256_mul_pd(q, x), _pd256_cephes_log_q4.v);
+  v4sd y = _mm256_mul_pd(x, _mm256_div_pd(_mm256_mul_pd(z, p), q));
+
+  y = _mm256_add_pd(y, _mm256_mul_pd(e, _pd256_cephes_log_C2.v));
+  y = _mm256_sub_pd(y, _mm256_mul_pd(z, _pd256_0p5.v));
+  x = _mm256_add_pd(x, y);
+  x = _mm256_add_pd(x, _mm256_mul_pd(e, _pd256_cephes_log_C1.v));
+
+  /* special values */
+  x = select256_pd(inf_mask, _pd256_inf.v, x);
+  x = select256_pd(invalid_mask, _pd256_nan.v, x);
+  x = select256_pd(zero_mask, _pd256_ninf.v, x);
+  return x;
+}
+
+_PD256_CONST(exp_hi, 7.09782712893383996843E2);	// log(DBL_MAX)
+_PD256_CONST(exp_lo, -7.45133219101941108420E2);	// log(smallest denormal / 2)
+
+_PD256_CONST(cephes_LOG2E, 1.4426950408889634073599);
+_PD256_CONST(cephes_exp_C1, 6.93145751953125E-1);
+_PD256_CONST(cephes_exp_C2, 1.42860682030941723212E-6);
+
+_PD256_CONST(cephes_exp_p0, 1.26177193074810590878E-4);
+_PD256_CONST(cephes_exp_p1, 3.02994407707441961300E-2);
+_PD256_CONST(cephes_exp_p2, 9.99999999999999999910E-1);
+_PD256_CONST(cephes_exp_q0, 3.00198505138664455042E-6);
+_PD256_CONST(cephes_exp_q1, 2.52448340349684104192E-3);
+_PD256_CONST(cephes_exp_q2, 2.27265548208155028766E-1);
+_PD256_CONST(cephes_exp_q3, 2.00000000000000000009E0);
+
+/* exponential computed for 4 simultaneous doubles */
+v4sd exp256_pd(v4sd x) {
+  v4sd in = x;
+
+  v4sd nan_mask = _mm256_cmp_pd(x, x, _CMP_UNORD_Q);
+  v4sd hi_mask = _mm256_cmp_pd(x, _pd256_exp_hi.v, _CMP_GT_OQ);
+  v4sd lo_mask = _mm256_cmp_pd(x, _pd256_exp_lo.v, _CMP_LT_OQ);
+  x = _mm256_min_pd(x, _pd256_exp_hi.v);
+  x = _mm256_max_pd(x, _pd256_exp_lo.v);
+
+  /* express exp(x) as exp(g + n*log(2)) */
+  v4sd fx = round256_pd(_mm256_mul_pd(x, _pd256_cephes_LOG2E.v));
+  x = _mm256_sub_pd(x, _mm256_mul_pd(fx, _pd256_cephes_exp_C1.v));
+  x = _mm256_sub_pd(x, _mm256_mul_pd(fx, _pd256_cephes_exp_C2.v));
+
+  /* rational approximation for exponential of the fractional part:
+     e**x = 1 + 2x P(x**2) / ( Q(x**2) - P(x**2) ) */
+  v4sd xx = _mm256_mul_pd(x, x);
+  v4sd p = _pd256_cephes_exp_p0.v;
+  p = _mm256_add_pd(_mm256_mul_pd(p, xx), _pd256_cephes_exp_p1.v);
+  p = _mm256_add_pd(_mm256_mul_pd(p, xx), _pd256_cephes_exp_p2.v);
+  p = _mm256_mul_pd(p, x);
+  v4sd q = _pd256_cephes_exp_q0.v;
+  q = _mm256_add_pd(_mm256_mul_pd(q, xx), _pd256_cephes_exp_q1.v);
+  q = _mm256_add_pd(_mm256_mul_pd(q, xx), _pd256_cephes_exp_q2.v);
+  q = _mm256_add_pd(_mm256_mul_pd(q, xx), _pd256_cephes_exp_q3.v);
+  x = _mm256_div_pd(p, _mm256_sub_pd(q, p));
+  x = _mm256_add_pd(_pd256_1.v, _mm256_add_pd(x, x));
+
+  /* multiply by 2^n in two steps, so that n over the full range
+     [-1075, 1024] (incl. denormal results) never leaves the normal range */
+  v4sd n1 = round256_pd(_mm256_mul_pd(fx, _pd256_0p5.v));
+  v4sd n2 = _mm256_sub_pd(fx, n1);
+  x = _mm256_mul_pd(_mm256_mul_pd(x, pow2_256_pd(n1)), pow2_256_pd(n2));
+
+  /* special values */
+  x = select256_pd(hi_mask, _pd256_inf.v, x);
+  x = _mm256_andnot_pd(lo_mask, x);
+  x = select256_pd(nan_mask, in, x);
+  return x;
+}
+
+_PD256_CONST(minus_cephes_DP1, -7.85398125648498535156E-1);
+_PD256_CONST(minus_cephes_DP2, -3.77489470793079817668E-8);
+_PD256_CONST(minus_cephes_DP3, -2.69515142907905952645E-15);
+_PD256_CONST(sincof_p0, 1.58962301576546568060E-10);
+_PD256_CONST(sincof_p1, -2.50507477628578072866E-8);
+_PD256_CONST(sincof_p2, 2.75573136213857245213E-6);
+_PD256_CONST(sincof_p3, -1.98412698295895385996E-4);
+_PD256_CONST(sincof_p4, 8.33333333332211858878E-3);
+_PD256_CONST(sincof_p5, -1.66666666666666307295E-1);
+_PD256_CONST(coscof_p0, -1.13585365213876817300E-11);
+_PD256_CONST(coscof_p1, 2.08757008419747316778E-9);
+_PD256_CONST(coscof_p2, -2.75573141792967388112E-7);
+_PD256_CONST(coscof_p3, 2.48015872888517045348E-5);
+_PD256_CONST(coscof_p4, -1.38888888888730564116E-3);
+_PD256_CONST(coscof_p5, 4.16666666666665929218E-2);
+_PD256_CONST(cephes_FOPI, 1.27323954473516268615);	// 4 / M_PI
+_PD256_CONST(cephes_lossth, 1.073741824e9);		// 2^30
+
+/* since sin256_pd and cos256_pd are almost identical, sincos256_pd could replace both of them..
+   it is almost as fast, and gives you a free cosine with your sine */
+void sincos256_pd(v4sd x, v4sd *s, v4sd *c) {
+  v4sd sign_bit_sin = _mm256_and_pd(x, _pd256_sign_mask.v);
+  v4sd xa = _mm256_andnot_pd(_pd256_sign_mask.v, x);
+
+  /* j = (int)(|x| * 4/Pi), rounded up to the next even number */
+  v4sd y = floor_pos256_pd(_mm256_mul_pd(xa, _pd256_cephes_FOPI.v));
+  y = _mm256_mul_pd(floor_pos256_pd(_mm256_mul_pd(_mm256_add_pd(y, _pd256_1.v), _pd256_0p5.v)), _pd256_2.v);
+
+  /* j mod 8, which is one of 0, 2, 4, 6 */
+  v4sd j8 = _mm256_sub_pd(y, _mm256_mul_pd(floor_pos256_pd(_mm256_mul_pd(y, _pd256_0p125.v)), _pd256_8.v));
+
+  /* extended precision modular arithmetic: z = ((xa - y * DP1) - y * DP2) - y * DP3 */
+  v4sd z = xa;
+  z = _mm256_add_pd(z, _mm256_mul_pd(y, _pd256_minus_cephes_DP1.v));
+  z = _mm256_add_pd(z, _mm256_mul_pd(y, _pd256_minus_cephes_DP2.v));
+  z = _mm256_add_pd(z, _mm256_mul_pd(y, _pd256_minus_cephes_DP3.v));
+  v4sd zz = _mm256_mul_pd(z, z);
+
+  /* sine polynom, valid for |z| <= Pi/4 */
+  v4sd ys = _pd256_sincof_p0.v;
+  ys = _mm256_add_pd(_mm256_mul_pd(ys, zz), _pd256_sincof_p1.v);
+  ys = _mm256_add_pd(_mm256_mul_pd(ys, zz), _pd256_sincof_p2.v);
+  ys = _mm256_add_pd(_mm256_mul_pd(ys, zz), _pd256_sincof_p3.v);
+  ys = _mm256_add_pd(_mm256_mul_pd(ys, zz), _pd256_sincof_p4.v);
+  ys = _mm256_add_pd(_mm256_mul_pd(ys, zz), _pd256_sincof_p5.v);
+  ys = _mm256_add_pd(z, _mm256_mul_pd(_mm256_mul_pd(ys, zz), z));
+
+  /* cosine polynom, valid for |z| <= Pi/4 */
+  v4sd yc = _pd256_coscof_p0.v;
+  yc = _mm256_add_pd(_mm256_mul_pd(yc, zz), _pd256_coscof_p1.v);
+  yc = _mm256_add_pd(_mm256_mul_pd(yc, zz), _pd256_coscof_p2.v);
+  yc = _mm256_add_pd(_mm256_mul_pd(yc, zz), _pd256_coscof_p3.v);
+  yc = _mm256_add_pd(_mm256_mul_pd(yc, zz), _pd256_coscof_p4.v);
+  yc = _mm256_add_pd(_mm256_mul_pd(yc, zz), _pd256_coscof_p5.v);
+  yc = _mm256_mul_pd(_mm256_mul_pd(yc, zz), zz);
+  yc = _mm256_add_pd(_mm256_sub_pd(_pd256_1.v, _mm256_mul_pd(zz, _pd256_0p5.v)), yc);
+
+  /* select the polynoms: j8 == 2, 6 swaps sine and cosine */
+  v4sd j8eq2 = _mm256_cmp_pd(j8, _pd256_2.v, _CMP_EQ_OQ);
+  v4sd j8eq4 = _mm256_cmp_pd(j8, _pd256_4.v, _CMP_EQ_OQ);
+  v4sd j8eq6 = _mm256_cmp_pd(j8, _pd256_6.v, _CMP_EQ_OQ);
+  v4sd poly_mask = _mm256_or_pd(j8eq2, j8eq6);
+  v4sd ysin = select256_pd(poly_mask, yc, ys);
+  v4sd ycos = select256_pd(poly_mask, ys, yc);
+
+  /* update the signs: sine is negative for j8 == 4, 6, cosine for j8 == 2, 4 */
+  sign_bit_sin = _mm256_xor_pd(sign_bit_sin, _mm256_and_pd(_mm256_or_pd(j8eq4, j8eq6), _pd256_sign_mask.v));
+  v4sd sign_bit_cos = _mm256_and_pd(_mm256_or_pd(j8eq2, j8eq4), _pd256_sign_mask.v);
+  ysin = _mm256_xor_pd(ysin, sign_bit_sin);
+  ycos = _mm256_xor_pd(ycos, sign_bit_cos);
+
+  /* hand large arguments (incl. +-inf) over to libm */
+  if ( _mm256_movemask_pd(_mm256_cmp_pd(xa, _pd256_cephes_lossth.v, _CMP_GT_OQ)) ) {
+    V4SD xin = { .v = x }, sout = { .v = ysin }, cout = { .v = ycos };
+    for ( int i = 0; i < 4; ++i ) {
+      if ( fabs(xin.f[i]) > _pd256_cephes_lossth.f[0] ) {
+        sout.f[i] = sin(xin.f[i]);
+        cout.f[i] = cos(xin.f[i]);
+      }
+    }
+    ysin = sout.v;
+    ycos = cout.v;
+  }
+
+  *s = ysin;
+  *c = ycos;
+} // sincos256_pd()
+
+v4sd sin256_pd(v4sd x) {
+  v4sd s, c;
+  sincos256_pd(x, &s, &c);
+  return s;
+}
+
+v4sd cos256_pd(v4sd x) {
+  v4sd s, c;
+  sincos256_pd(x, &s, &c);
+  return c;
+}
+
+/* sincos2pi() variant of sincos256_pd() above, computing sin(2pi*x) and cos(2pi*x).
+ * Unlike sincos256_ps_2pi(), the integer part of 'xx' is removed before multiplying
+ * by 2pi, so the result stays accurate for arbitrarily large 'xx'
+ */
+_PD256_CONST(2pi, 6.283185307179586476925286766559);	// LAL_TWOPI
+void
+sincos256_pd_2pi(v4sd xx, v4sd *s, v4sd *c)
+{
+  // reduce 'xx' to [-0.5, 0.5], then convert to actual angle '2pi * xx'
+  v4sd x = _mm256_sub_pd ( xx, round256_pd ( xx ) );
+  x = _mm256_mul_pd ( x, _pd256_2pi.v );
+
+  sincos256_pd ( x, s, c );
+
+  return;
+} // sincos256_pd_2pi
+
@@ -135,4 +135,47 @@ DECLARE_VECTORMATH_cC2C(Shift, AVX2, AVX, SSE2, NONE)
 #define DECLARE_VECTORMATH_D2D(NAME, ...)                                    \
   DECLARE_VECTORMATH_ANY( NAME ## REAL8, ( REAL8 *out, const REAL8 *in, const UINT4 len ), __VA_ARGS__ )
 
+DECLARE_VECTORMATH_D2D(Sin, AVX2, AVX, SSE2, NONE)
+DECLARE_VECTORMATH_D2D(Cos, AVX2, AVX, SSE2, NONE)
+DECLARE_VECTORMATH_D2D(Exp, AVX2, AVX, NONE, NONE)
+DECLARE_VECTORMATH_D2D(Log, AVX2, AVX, NONE, NONE)
 DECLARE_VECTORMATH_D2D(Round, AVX2, AVX, NONE, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 1 REAL8 vector input to 2 REAL8 vector outputs (D2DD) */
+#define DECLARE_VECTORMATH_D2DD(NAME, ...)                                   \
+  DECLARE_VECTORMATH_ANY( NAME ## REAL8, ( REAL8 *out1, REAL8 *out2, const REAL8 *in, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_D2DD(SinCos, AVX2, AVX, SSE2, NONE)
+DECLARE_VECTORMATH_D2DD(SinCos2Pi, AVX2, AVX, SSE2, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 2 COMPLEX16 vector inputs to 1 COMPLEX16 vector output (ZZ2Z) */
+#define DECLARE_VECTORMATH_ZZ2Z(NAME, ...)                                   \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_ZZ2Z(Multiply, AVX512F, AVX2, AVX, NONE)
+DECLARE_VECTORMATH_ZZ2Z(Add, AVX512F, AVX2, AVX, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 1 COMPLEX16 scalar and 1 COMPLEX16 vector input to 1 COMPLEX16 vector output (zZ2Z) */
+#define DECLARE_VECTORMATH_zZ2Z(NAME, ...) \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX16, ( COMPLEX16 *out, COMPLEX16 scalar, const COMPLEX16 *in, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_zZ2Z(Scale, AVX512F, AVX2, AVX, NONE)
+DECLARE_VECTORMATH_zZ2Z(Shift, AVX512F, AVX2, AVX, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 1 COMPLEX16 vector and 1 REAL8 vector input to 1 COMPLEX16 vector output (ZD2Z) */
+#define DECLARE_VECTORMATH_ZD2Z(NAME, ...)                                   \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in, const REAL8 *weight, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_ZD2Z(Weight, AVX512F, AVX2, AVX, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 vector output (ZZD2Z) */
+#define DECLARE_VECTORMATH_ZZD2Z(NAME, ...)                                  \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX16, ( COMPLEX16 *out, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_ZZD2Z(ConjMultiplyAccumulate, AVX512F, AVX2, AVX, NONE)
+
+/* declare internal prototypes of SIMD-specific vector math functions with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 scalar output (ZZD2z) */
+#define DECLARE_VECTORMATH_ZZD2z(NAME, ...)                                  \
+  DECLARE_VECTORMATH_ANY( NAME ## COMPLEX16, ( COMPLEX16 *result, const COMPLEX16 *in1, const COMPLEX16 *in2, const REAL8 *weight, const UINT4 len ), __VA_ARGS__ )
+
+DECLARE_VECTORMATH_ZZD2z(WeightedInnerProduct, AVX512F, AVX2, AVX, NONE)
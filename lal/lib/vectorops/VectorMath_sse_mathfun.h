@@ -757,3 +757,174 @@ sincos_ps_2pi(v4sf xx, v4sf *s, v4sf *c)
 
   return;
 } // sincos_ps_2pi
+
+/* ========== double-precision versions of sin and cos, added for LAL ==========
+ *
+ * These follow the double-precision cephes algorithm. The octant bookkeeping is
+ * done in floating point, so no integer instructions are needed. Arguments with
+ * |x| > 2^30 (where cephes' three-part reduction of pi/4 loses accuracy) fall
+ * back to libm. There are no SSE2 versions of exp and log: with only 2 lanes
+ * they are not faster than a modern libm.
+ */
+#ifdef USE_SSE2
+
+#include <math.h>
+
+// ---------- Prototypes ----------
+static v2sf sin_pd(v2sf x);
+static v2sf cos_pd(v2sf x);
+static void sincos_pd(v2sf x, v2sf *s, v2sf *c);
+static void sincos_pd_2pi(v2sf xx, v2sf *s, v2sf *c);
+// --------------------------------
+
+#define _PD_CONST(Name, Val)                                    \
+  static const V2SF _pd_##Name = { .f={Val, Val} }
+
+_PD_CONST(1, 1.0);
+_PD_CONST(2, 2.0);
+_PD_CONST(4, 4.0);
+_PD_CONST(6, 6.0);
+_PD_CONST(8, 8.0);
+_PD_CONST(0p5, 0.5);
+_PD_CONST(0p125, 0.125);
+_PD_CONST(sign_mask, -0.0);			// only the sign bit set
+_PD_CONST(round_magic, 6755399441055744.0);	// 1.5 * 2^52
+
+/* round to nearest integer, for any finite x */
+static inline v2sf round_pd_sse2(v2sf x) {
+  v2sf sign = _mm_and_pd(x, _pd_sign_mask.v);
+  v2sf a = _mm_andnot_pd(_pd_sign_mask.v, x);
+  /* adding 1.5*2^52 pushes all fractional bits out of the mantissa */
+  a = _mm_sub_pd(_mm_add_pd(a, _pd_round_magic.v), _pd_round_magic.v);
+  return _mm_or_pd(a, sign);
+}
+
+/* round down to integer, for x >= 0 */
+static inline v2sf floor_pos_pd_sse2(v2sf x) {
+  v2sf r = round_pd_sse2(x);
+  return _mm_sub_pd(r, _mm_and_pd(_mm_cmpgt_pd(r, x), _pd_1.v));
+}
+
+/* select a where mask is set, b otherwise */
+static inline v2sf select_pd_sse2(v2sf mask, v2sf a, v2sf b) {
+  return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+
+_PD_CONST(minus_cephes_DP1, -7.85398125648498535156E-1);
+_PD_CONST(minus_cephes_DP2, -3.77489470793079817668E-8);
+_PD_CONST(minus_cephes_DP3, -2.69515142907905952645E-15);
+_PD_CONST(sincof_p0, 1.58962301576546568060E-10);
+_PD_CONST(sincof_p1, -2.50507477628578072866E-8);
+_PD_CONST(sincof_p2, 2.75573136213857245213E-6);
+_PD_CONST(sincof_p3, -1.98412698295895385996E-4);
+_PD_CONST(sincof_p4, 8.33333333332211858878E-3);
+_PD_CONST(sincof_p5, -1.66666666666666307295E-1);
+_PD_CONST(coscof_p0, -1.13585365213876817300E-11);
+_PD_CONST(coscof_p1, 2.08757008419747316778E-9);
+_PD_CONST(coscof_p2, -2.75573141792967388112E-7);
+_PD_CONST(coscof_p3, 2.48015872888517045348E-5);
+_PD_CONST(coscof_p4, -1.38888888888730564116E-3);
+_PD_CONST(coscof_p5, 4.16666666666665929218E-2);
+_PD_CONST(cephes_FOPI, 1.27323954473516268615);	// 4 / M_PI
+_PD_CONST(cephes_lossth, 1.073741824e9);		// 2^30
+
+/* since sin_pd and cos_pd are almost identical, sincos_pd could replace both of them..
+   it is almost as fast, and gives you a free cosine with your sine */
+void sincos_pd(v2sf x, v2sf *s, v2sf *c) {
+  v2sf sign_bit_sin = _mm_and_pd(x, _pd_sign_mask.v);
+  v2sf xa = _mm_andnot_pd(_pd_sign_mask.v, x);
+
+  /* j = (int)(|x| * 4/Pi), rounded up to the next even number */
+  v2sf y = floor_pos_pd_sse2(_mm_mul_pd(xa, _pd_cephes_FOPI.v));
+  y = _mm_mul_pd(floor_pos_pd_sse2(_mm_mul_pd(_mm_add_pd(y, _pd_1.v), _pd_0p5.v)), _pd_2.v);
+
+  /* j mod 8, which is one of 0, 2, 4, 6 */
+  v2sf j8 = _mm_sub_pd(y, _mm_mul_pd(floor_pos_pd_sse2(_mm_mul_pd(y, _pd_0p125.v)), _pd_8.v));
+
+  /* extended precision modular arithmetic: z = ((xa - y * DP1) - y * DP2) - y * DP3 */
+  v2sf z = xa;
+  z = _mm_add_pd(z, _mm_mul_pd(y, _pd_minus_cephes_DP1.v));
+  z = _mm_add_pd(z, _mm_mul_pd(y, _pd_minus_cephes_DP2.v));
+  z = _mm_add_pd(z, _mm_mul_pd(y, _pd_minus_cephes_DP3.v));
+  v2sf zz = _mm_mul_pd(z, z);
+
+  /* sine polynom, valid for |z| <= Pi/4 */
+  v2sf ys = _pd_sincof_p0.v;
+  ys = _mm_add_pd(_mm_mul_pd(ys, zz), _pd_sincof_p1.v);
+  ys = _mm_add_pd(_mm_mul_pd(ys, zz), _pd_sincof_p2.v);
+  ys = _mm_add_pd(_mm_mul_pd(ys, zz), _pd_sincof_p3.v);
+  ys = _mm_add_pd(_mm_mul_pd(ys, zz), _pd_sincof_p4.v);
+  ys = _mm_add_pd(_mm_mul_pd(ys, zz), _pd_sincof_p5.v);
+  ys = _mm_add_pd(z, _mm_mul_pd(_mm_mul_pd(ys, zz), z));
+
+  /* cosine polynom, valid for |z| <= Pi/4 */
+  v2sf yc = _pd_coscof_p0.v;
+  yc = _mm_add_pd(_mm_mul_pd(yc, zz), _pd_coscof_p1.v);
+  yc = _mm_add_pd(_mm_mul_pd(yc, zz), _pd_coscof_p2.v);
+  yc = _mm_add_pd(_mm_mul_pd(yc, zz), _pd_coscof_p3.v);
+  yc = _mm_add_pd(_mm_mul_pd(yc, zz), _pd_coscof_p4.v);
+  yc = _mm_add_pd(_mm_mul_pd(yc, zz), _pd_coscof_p5.v);
+  yc = _mm_mul_pd(_mm_mul_pd(yc, zz), zz);
+  yc = _mm_add_pd(_mm_sub_pd(_pd_1.v, _mm_mul_pd(zz, _pd_0p5.v)), yc);
+
+  /* select the polynoms: j8 == 2, 6 swaps sine and cosine */
+  v2sf j8eq2 = _mm_cmpeq_pd(j8, _pd_2.v);
+  v2sf j8eq4 = _mm_cmpeq_pd(j8, _pd_4.v);
+  v2sf j8eq6 = _mm_cmpeq_pd(j8, _pd_6.v);
+  v2sf poly_mask = _mm_or_pd(j8eq2, j8eq6);
+  v2sf ysin = select_pd_sse2(poly_mask, yc, ys);
+  v2sf ycos = select_pd_sse2(poly_mask, ys, yc);
+
+  /* update the signs: sine is negative for j8 == 4, 6, cosine for j8 == 2, 4 */
+  sign_bit_sin = _mm_xor_pd(sign_bit_sin, _mm_and_pd(_mm_or_pd(j8eq4, j8eq6), _pd_sign_mask.v));
+  v2sf sign_bit_cos = _mm_and_pd(_mm_or_pd(j8eq2, j8eq4), _pd_sign_mask.v);
+  ysin = _mm_xor_pd(ysin, sign_bit_sin);
+  ycos = _mm_xor_pd(ycos, sign_bit_cos);
+
+  /* hand large arguments (incl. +-inf) over to libm */
+  if ( _mm_movemask_pd(_mm_cmpgt_pd(xa, _pd_cephes_lossth.v)) ) {
+    V2SF xin = { .v = x }, sout = { .v = ysin }, cout = { .v = ycos };
+    for ( int i = 0; i < 2; ++i ) {
+      if ( fabs(xin.f[i]) > _pd_cephes_lossth.f[0] ) {
+        sout.f[i] = sin(xin.f[i]);
+        cout.f[i] = cos(xin.f[i]);
+      }
+    }
+    ysin = sout.v;
+    ycos = cout.v;
+  }
+
+  *s = ysin;
+  *c = ycos;
+} // sincos_pd()
+
+v2sf sin_pd(v2sf x) {
+  v2sf s, c;
+  sincos_pd(x, &s, &c);
+  return s;
+}
+
+v2sf cos_pd(v2sf x) {
+  v2sf s, c;
+  sincos_pd(x, &s, &c);
+  return c;
+}
+
+/* sincos2pi() variant of sincos_pd() above, computing sin(2pi*x) and cos(2pi*x).
+ * Unlike sincos_ps_2pi(), the integer part of 'xx' is removed before multiplying
+ * by 2pi, so the result stays accurate for arbitrarily large 'xx'
+ */
+_PD_CONST(2pi, 6.283185307179586476925286766559);	// LAL_TWOPI
+void
+sincos_pd_2pi(v2sf xx, v2sf *s, v2sf *c)
+{
+  // reduce 'xx' to [-0.5, 0.5], then convert to actual angle '2pi * xx'
+  v2sf x = _mm_sub_pd ( xx, round_pd_sse2 ( xx ) );
+  x = _mm_mul_pd ( x, _pd_2pi.v );
+
+  sincos_pd ( x, s, c );
+
+  return;
+} // sincos_pd_2pi
+
+#endif // USE_SSE2
@@ -29,6 +29,7 @@
 
 
 #include <math.h>
+#include <stdlib.h>
 #include <string.h>
 #include <gsl/gsl_sf_bessel.h>
 #include <lal/LALConstants.h>
@@ -937,3 +938,181 @@ XLALCreateNamedREAL4Window ( const char *windowName, REAL8 beta, UINT4 length )
 {
   return XLALREAL4Window_from_REAL8Window ( XLALCreateNamedREAL8Window ( windowName, beta, length ) );
 }
+
+
+/*
+ * ============================================================================
+ *
+ *                               Cached Windows
+ *
+ * ============================================================================
+ */
+
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_mutex_t window_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define WINDOW_CACHE_LOCK pthread_mutex_lock(&window_cache_mutex)
+#define WINDOW_CACHE_UNLOCK pthread_mutex_unlock(&window_cache_mutex)
+#else
+#define WINDOW_CACHE_LOCK
+#define WINDOW_CACHE_UNLOCK
+#endif
+
+/** maximum total size in bytes of released windows kept in the cache for
+ * reuse; a released window larger than this is freed at once */
+#define WINDOW_CACHE_MAX_UNUSED_BYTES (16 * 1024 * 1024)
+
+/**
+ * An entry in the window cache.  The window, its sequence and its samples
+ * are stored in a single block, which is allocated with the system
+ * malloc() rather than LALMalloc(), since the cache lives for the lifetime
+ * of the process and would otherwise be reported by LALCheckMemoryLeaks().
+ */
+struct window_cache_entry {
+	int type;	/**< window type */
+	REAL8 beta;	/**< window parameter */
+	UINT4 refcount;	/**< number of users of the window */
+	REAL8Window window;	/**< the window */
+	REAL8Sequence sequence;	/**< the window samples */
+	struct window_cache_entry *next;	/**< next entry, in order of most recent use */
+	REAL8 data[];	/**< storage for the window samples */
+};
+
+static struct window_cache_entry *window_cache = NULL;
+
+
+/* find a window in the cache and move it to the front; the cache must be
+ * locked */
+static struct window_cache_entry *window_cache_find(int type, REAL8 beta, UINT4 length)
+{
+	struct window_cache_entry **prev;
+
+	for(prev = &window_cache; *prev; prev = &(*prev)->next) {
+		struct window_cache_entry *entry = *prev;
+		if(entry->type == type && entry->beta == beta && entry->sequence.length == length) {
+			*prev = entry->next;
+			entry->next = window_cache;
+			window_cache = entry;
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+
+/* free the least recently used windows which are no longer in use, keeping
+ * at most max_unused_bytes of them; the cache must be locked */
+static void window_cache_trim(size_t max_unused_bytes)
+{
+	struct window_cache_entry **prev = &window_cache;
+	size_t unused_bytes = 0;
+
+	while(*prev) {
+		struct window_cache_entry *entry = *prev;
+		if(entry->refcount == 0 && (unused_bytes += sizeof(*entry) + entry->sequence.length * sizeof(*entry->data)) > max_unused_bytes) {
+			*prev = entry->next;
+			free(entry);
+		} else
+			prev = &entry->next;
+	}
+}
+
+
+/**
+ * Returns a shared, immutable window from the window cache, computing it
+ * with XLALCreateNamedREAL8Window() if it is not already there.  The window
+ * must be released with XLALDestroyCachedREAL8Window().
+ */
+const REAL8Window *XLALCreateCachedREAL8Window(const char *windowName, REAL8 beta, UINT4 length)
+{
+	struct window_cache_entry *entry, *found;
+	REAL8Window *window;
+	int wintype;
+
+	XLAL_CHECK_NULL(length > 0, XLAL_EINVAL);
+	XLAL_CHECK_NULL((wintype = XLALParseWindowNameAndCheckBeta(windowName, beta)) >= 0, XLAL_EFUNC);
+
+	WINDOW_CACHE_LOCK;
+	found = window_cache_find(wintype, beta, length);
+	if(found)
+		found->refcount++;
+	WINDOW_CACHE_UNLOCK;
+	if(found)
+		return &found->window;
+
+	/* compute the window without holding the lock */
+	window = XLALCreateNamedREAL8Window(windowName, beta, length);
+	XLAL_CHECK_NULL(window != NULL, XLAL_EFUNC);
+	entry = malloc(sizeof(*entry) + length * sizeof(*entry->data));
+	if(!entry) {
+		XLALDestroyREAL8Window(window);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+	entry->type = wintype;
+	entry->beta = beta;
+	entry->refcount = 1;
+	entry->sequence.length = length;
+	entry->sequence.data = entry->data;
+	memcpy(entry->data, window->data->data, length * sizeof(*entry->data));
+	entry->window.data = &entry->sequence;
+	entry->window.sumofsquares = window->sumofsquares;
+	entry->window.sum = window->sum;
+	XLALDestroyREAL8Window(window);
+
+	WINDOW_CACHE_LOCK;
+	/* another thread may have added the same window in the meantime */
+	found = window_cache_find(wintype, beta, length);
+	if(found)
+		found->refcount++;
+	else {
+		entry->next = window_cache;
+		window_cache = entry;
+		window_cache_trim(WINDOW_CACHE_MAX_UNUSED_BYTES);
+	}
+	WINDOW_CACHE_UNLOCK;
+	if(found) {
+		free(entry);
+		return &found->window;
+	}
+
+	return &entry->window;
+}
+
+
+/**
+ * Releases a window obtained from XLALCreateCachedREAL8Window().  The
+ * window stays in the cache for reuse.
+ */
+void XLALDestroyCachedREAL8Window(const REAL8Window *window)
+{
+	struct window_cache_entry *entry;
+
+	if(!window)
+		return;
+
+	WINDOW_CACHE_LOCK;
+	for(entry = window_cache; entry; entry = entry->next)
+		if(&entry->window == window)
+			break;
+	if(entry && entry->refcount > 0) {
+		entry->refcount--;
+		window_cache_trim(WINDOW_CACHE_MAX_UNUSED_BYTES);
+	}
+	WINDOW_CACHE_UNLOCK;
+
+	if(!entry)
+		XLAL_ERROR_VOID(XLAL_EINVAL, "Window %p was not obtained from XLALCreateCachedREAL8Window()", (const void *) window);
+}
+
+
+/**
+ * Frees all windows in the window cache which are no longer in use.
+ */
+void XLALClearREAL8WindowCache(void)
+{
+	WINDOW_CACHE_LOCK;
+	window_cache_trim(0);
+	WINDOW_CACHE_UNLOCK;
+}
@@ -232,6 +232,20 @@ extern "C" {
  * or to measure a broad spectrum with a large dynamical range (a Creighton or
  * a Papoulis window).
  *
+ * ### Cached windows ###
+ *
+ * Programs that repeatedly need the same window, such as the spectrum
+ * estimation and SFT generation codes, can obtain it from a process-wide
+ * cache with XLALCreateCachedREAL8Window(), which takes the same arguments
+ * as XLALCreateNamedREAL8Window().  Windows with the same type, parameter
+ * \f$\beta\f$ and length are computed only once and then shared; they are
+ * returned as <tt>const</tt> and must not be modified.  Each window
+ * obtained in this way must be released with
+ * XLALDestroyCachedREAL8Window(), and not with XLALDestroyREAL8Window().
+ * Released windows are kept for reuse, up to a fixed total size of 16 MiB,
+ * and the least recently used are freed first; they can also be freed with
+ * XLALClearREAL8WindowCache().  The cache is thread-safe.
+ *
  */
 /** @{ */
 
@@ -308,6 +322,10 @@ int XLALCheckNamedWindow ( const char *windowName, const BOOLEAN haveBeta );
 REAL8Window *XLALCreateNamedREAL8Window ( const char *windowName, REAL8 beta, UINT4 length );
 REAL4Window *XLALCreateNamedREAL4Window ( const char *windowName, REAL8 beta, UINT4 length );
 
+const REAL8Window *XLALCreateCachedREAL8Window ( const char *windowName, REAL8 beta, UINT4 length );
+void XLALDestroyCachedREAL8Window ( const REAL8Window *window );
+void XLALClearREAL8WindowCache ( void );
+
 /** @} */
 
 #ifdef  __cplusplus
@@ -26,6 +26,10 @@
 #include <lal/RealFFT.h>
 #include <lal/Window.h>
 #include <lal/Random.h>
+#include <lal/TimeSeries.h>
+#include <lal/FrequencySeries.h>
+#include <lal/Units.h>
+#include <lal/Date.h>
 
 #define TESTSTATUS( s ) \
   if ( (s)->statusCode ) { REPORTSTATUS( s ); exit( 1 ); } else \
@@ -94,6 +98,98 @@ int main( void )
   fprintf( stdout, "mean:\t%e\terror:\t%f%%\n", ave, fabs( ave - 2.0 ) / 0.02 );
 
 
+  /* check that the sliding PSD agrees with the median and median-mean
+   * methods when sliding over a longer REAL8 time series */
+  {
+    const UINT4 seglen = 1024;
+    const UINT4 stride = seglen / 2;
+    const UINT4 numseg = 8;
+    const UINT4 numslide = 5;
+    REAL8TimeSeries *tseries8;
+    REAL8FrequencySeries *fseries8;
+    REAL8FrequencySeries *sliding8;
+    REAL8FFTPlan *plan8;
+    REAL8Window *window8;
+    LIGOTimeGPS epoch = LIGOTIMEGPSZERO;
+    int median_mean;
+
+    tseries8 = XLALCreateREAL8TimeSeries( "x", &epoch, 0.0, 1.0 / 1024, &lalDimensionlessUnit, (numseg + numslide - 1) * stride + seglen );
+    fseries8 = XLALCreateREAL8FrequencySeries( "X", &epoch, 0.0, 0.0, &lalDimensionlessUnit, seglen / 2 + 1 );
+    sliding8 = XLALCreateREAL8FrequencySeries( "X", &epoch, 0.0, 0.0, &lalDimensionlessUnit, seglen / 2 + 1 );
+    plan8 = XLALCreateForwardREAL8FFTPlan( seglen, 0 );
+    window8 = XLALCreateHannREAL8Window( seglen );
+    if ( ! tseries8 || ! fseries8 || ! sliding8 || ! plan8 || ! window8 )
+      return 1;
+    randpar = XLALCreateRandomParams( 2 );
+    for ( i = 0; i < tseries8->data->length; ++i )
+      tseries8->data->data[i] = XLALNormalDeviate( randpar );
+    XLALDestroyRandomParams( randpar );
+
+    for ( median_mean = 0; median_mean < 2; ++median_mean )
+    {
+      LALSlidingPSD *slide = XLALSlidingPSDNew( numseg, median_mean );
+      REAL8Vector savevec = *tseries8->data;
+      UINT4 seg;
+      if ( ! slide )
+        return 1;
+      for ( seg = 0; seg < numseg + numslide; ++seg )
+      {
+        /* push the next segment */
+        tseries8->data->length = seglen;
+        tseries8->data->data   = savevec.data + seg * stride;
+        if ( XLALSlidingPSDPushSegment( slide, tseries8, window8, plan8 ) )
+          return 1;
+        if ( seg + 1 < numseg )
+          continue;
+
+        /* compare with the spectrum of the last numseg segments */
+        tseries8->data->length = (numseg - 1) * stride + seglen;
+        tseries8->data->data   = savevec.data + (seg + 1 - numseg) * stride;
+        if ( median_mean )
+          XLALREAL8AverageSpectrumMedianMean( fseries8, tseries8, seglen, stride, window8, plan8 );
+        else
+          XLALREAL8AverageSpectrumMedian( fseries8, tseries8, seglen, stride, window8, plan8 );
+        if ( XLALSlidingPSDGetPSD( sliding8, slide ) )
+          return 1;
+        if ( XLALGPSCmp( &sliding8->epoch, &fseries8->epoch ) )
+          return 1;
+        for ( i = 0; i < fseries8->data->length; ++i )
+          if ( fabs( sliding8->data->data[i] - fseries8->data->data[i] ) > 1e-12 * fseries8->data->data[i] )
+          {
+            fprintf( stderr, "sliding PSD mismatch at bin %u: %e != %e\n", i, sliding8->data->data[i], fseries8->data->data[i] );
+            return 1;
+          }
+      }
+      *tseries8->data = savevec;
+      fprintf( stdout, "sliding %s:\tpassed\n", median_mean ? "median-mean" : "median" );
+      XLALSlidingPSDFree( slide );
+    }
+
+    /* check that the parallel variants agree with the serial methods */
+    XLALREAL8AverageSpectrumWelch( fseries8, tseries8, seglen, stride, window8, plan8 );
+    if ( XLALREAL8AverageSpectrumWelchParallel( sliding8, tseries8, seglen, stride, window8, plan8 ) )
+      return 1;
+    for ( i = 0; i < fseries8->data->length; ++i )
+      if ( fabs( sliding8->data->data[i] - fseries8->data->data[i] ) > 1e-12 * fseries8->data->data[i] )
+        return 1;
+    if ( XLALGPSCmp( &sliding8->epoch, &fseries8->epoch ) )
+      return 1;
+    XLALREAL8AverageSpectrumMedian( fseries8, tseries8, seglen, stride, window8, plan8 );
+    if ( XLALREAL8AverageSpectrumMedianParallel( sliding8, tseries8, seglen, stride, window8, plan8 ) )
+      return 1;
+    for ( i = 0; i < fseries8->data->length; ++i )
+      if ( sliding8->data->data[i] != fseries8->data->data[i] )
+        return 1;
+    fprintf( stdout, "parallel welch and median:\tpassed\n" );
+
+    XLALDestroyREAL8Window( window8 );
+    XLALDestroyREAL8FFTPlan( plan8 );
+    XLALDestroyREAL8FrequencySeries( sliding8 );
+    XLALDestroyREAL8FrequencySeries( fseries8 );
+    XLALDestroyREAL8TimeSeries( tseries8 );
+  }
+
+
   /* cleanup */
   XLALDestroyREAL4Window( window );
   XLALDestroyREAL4FFTPlan( plan );
@@ -311,6 +311,40 @@ int main( int argc, char *argv[] )
     TestStatus( &status, CODES( 0 ), 1 );
   }
 
+#ifdef LAL_FFTW3_ENABLED
+  /* plans with identical parameters are shared, and only freed by their last owner */
+  {
+    REAL4FFTPlan *fwd1 = XLALCreateForwardREAL4FFTPlan( 64, 0 );
+    REAL4FFTPlan *fwd2 = XLALCreateForwardREAL4FFTPlan( 64, 0 );
+    REAL4FFTPlan *rev1 = XLALCreateReverseREAL4FFTPlan( 64, 0 );
+    if ( !fwd1 || !rev1 || fwd1 != fwd2 || fwd1 == rev1 )
+    {
+      fprintf( stderr, "FFT plan cache returned unexpected plans\n" );
+      return 1;
+    }
+    XLALDestroyREAL4FFTPlan( fwd1 );
+    LALSCreateVector( &status, &dat, 64 );
+    TestStatus( &status, CODES( 0 ), 1 );
+    LALCCreateVector( &status, &fft, 33 );
+    TestStatus( &status, CODES( 0 ), 1 );
+    for ( j = 0; j < 64; ++j )
+    {
+      dat->data[j] = j % 5;
+    }
+    if ( XLALREAL4ForwardFFT( fft, dat, fwd2 ) != 0 )
+    {
+      fprintf( stderr, "Shared FFT plan unusable after destroying one owner\n" );
+      return 1;
+    }
+    XLALDestroyREAL4FFTPlan( fwd2 );
+    XLALDestroyREAL4FFTPlan( rev1 );
+    LALSDestroyVector( &status, &dat );
+    TestStatus( &status, CODES( 0 ), 1 );
+    LALCDestroyVector( &status, &fft );
+    TestStatus( &status, CODES( 0 ), 1 );
+  }
+#endif
+
   LALCheckMemoryLeaks();
   return 0;
 }
@@ -0,0 +1,168 @@
+/*
+*  Copyright (C) 2026 agent
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALStdio.h>
+#include <lal/LALInstrument.h>
+
+/*
+ * Tests the counters and timers of LALInstrument.h: probe lookup, nesting
+ * of timers, attribution of allocations, discarding of timers that are
+ * never stopped, and the text and JSON output.  The probe functions are
+ * called directly, so the test does not depend on whether the probe macros
+ * are compiled in.
+ */
+
+typedef struct {
+  UINT8 calls;
+  REAL8 total;
+  REAL8 self;
+  UINT8 bytes;
+  INT8 count;
+} ProbeStats;
+
+/* read back the statistics of one probe from the text output */
+static int get_stats( const char *name, ProbeStats *stats )
+{
+  char line[1024];
+  FILE *fp = tmpfile();
+  int found = 0;
+  XLAL_CHECK( fp != NULL, XLAL_EIO );
+  XLAL_CHECK( XLALInstrumentDump( fp, LAL_INSTRUMENT_TEXT ) == 0, XLAL_EFUNC );
+  rewind( fp );
+  while ( !found && fgets( line, sizeof( line ), fp ) ) {
+    char probe[256];
+    if ( line[0] == '#' )
+      continue;
+    XLAL_CHECK( sscanf( line, "%255s %" LAL_UINT8_FORMAT " %lf %lf %" LAL_UINT8_FORMAT " %" LAL_INT8_FORMAT,
+                        probe, &stats->calls, &stats->total, &stats->self, &stats->bytes, &stats->count ) == 6,
+                XLAL_EFAILED, "Could not parse '%s'", line );
+    found = strcmp( probe, name ) == 0;
+  }
+  fclose( fp );
+  XLAL_CHECK( found, XLAL_EFAILED, "Probe '%s' not in output", name );
+  return XLAL_SUCCESS;
+}
+
+static void spin( void )
+{
+  volatile REAL8 x = 0;
+  for ( int i = 0; i < 1000000; ++i )
+    x += 1e-6 * i;
+}
+
+int main( void )
+{
+  LALInstrumentProbe *outer, *inner, *counter, *lost;
+  ProbeStats stats;
+  char buf[4096];
+  FILE *fp;
+  size_t n;
+
+  outer = XLALInstrumentGetProbe( "outer" );
+  inner = XLALInstrumentGetProbe( "inner" );
+  counter = XLALInstrumentGetProbe( "counter" );
+  lost = XLALInstrumentGetProbe( "lost" );
+  XLAL_CHECK_MAIN( outer && inner && counter && lost, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( XLALInstrumentGetProbe( "outer" ) == outer, XLAL_EFAILED, "Looking up a probe twice gave different probes" );
+  XLAL_CHECK_MAIN( inner != outer, XLAL_EFAILED, "Different names gave the same probe" );
+
+  /* cached lookup, as done by the probe macros */
+  LALInstrumentProbe *cache = NULL;
+  XLAL_CHECK_MAIN( XLALInstrumentGetCachedProbe( &cache, "outer" ) == outer && cache == outer, XLAL_EFAILED, "Cached lookup gave a different probe" );
+  XLAL_CHECK_MAIN( XLALInstrumentGetCachedProbe( &cache, "inner" ) == outer, XLAL_EFAILED, "Cached probe was looked up again" );
+
+  /* counters */
+  XLALInstrumentCount( counter, 3 );
+  XLALInstrumentCount( counter, 4 );
+  XLAL_CHECK_MAIN( get_stats( "counter", &stats ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( stats.count == 7 && stats.calls == 0, XLAL_EFAILED );
+
+  /* nested timers: the outer timer's own time excludes the inner timer */
+  XLALInstrumentStart( outer );
+  XLALInstrumentAllocation( 100 );
+  spin();
+  for ( int i = 0; i < 2; ++i ) {
+    XLALInstrumentStart( inner );
+    XLALInstrumentAllocation( 10 );
+    spin();
+    XLALInstrumentStop( inner );
+  }
+  XLALInstrumentStop( outer );
+  XLAL_CHECK_MAIN( get_stats( "inner", &stats ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( stats.calls == 2 && stats.bytes == 20, XLAL_EFAILED, "inner: %" LAL_UINT8_FORMAT " calls, %" LAL_UINT8_FORMAT " bytes", stats.calls, stats.bytes );
+  XLAL_CHECK_MAIN( stats.total > 0 && stats.self == stats.total, XLAL_EFAILED );
+  REAL8 inner_total = stats.total;
+  XLAL_CHECK_MAIN( get_stats( "outer", &stats ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( stats.calls == 1 && stats.bytes == 120, XLAL_EFAILED, "outer: %" LAL_UINT8_FORMAT " calls, %" LAL_UINT8_FORMAT " bytes", stats.calls, stats.bytes );
+  /* times are read back from text output rounded to 1e-6 s */
+  XLAL_CHECK_MAIN( stats.total >= inner_total && fabs( stats.self - ( stats.total - inner_total ) ) < 2e-6, XLAL_EFAILED );
+
+  /* a timer left running is discarded when an enclosing timer stops */
+  XLALInstrumentStart( outer );
+  XLALInstrumentStart( lost );
+  XLALInstrumentStop( outer );
+  XLALInstrumentStop( lost );
+  XLAL_CHECK_MAIN( get_stats( "lost", &stats ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( stats.calls == 0, XLAL_EFAILED );
+  XLAL_CHECK_MAIN( get_stats( "outer", &stats ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( stats.calls == 2, XLAL_EFAILED );
+
+#ifdef LAL_INSTRUMENTATION_ENABLED
+  /* reallocations report only their growth; arena memory records its size exactly */
+  LALInstrumentProbe *resize = XLALInstrumentGetProbe( "resize" );
+  XLAL_CHECK_MAIN( resize != NULL, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( XLALPushMemoryArena( 0 ) == 0, XLAL_EFUNC );
+  XLALInstrumentStart( resize );
+  void *p = XLALArenaMalloc( 1000 );
+  XLAL_CHECK_MAIN( p != NULL, XLAL_EFUNC );
+  p = XLALRealloc( p, 3000 );
+  XLAL_CHECK_MAIN( p != NULL, XLAL_EFUNC );
+  p = XLALRealloc( p, 2000 );
+  XLAL_CHECK_MAIN( p != NULL, XLAL_EFUNC );
+  XLALInstrumentStop( resize );
+  XLAL_CHECK_MAIN( XLALPopMemoryArena() == 0, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( get_stats( "resize", &stats ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( stats.bytes == 3000, XLAL_EFAILED, "resize: %" LAL_UINT8_FORMAT " bytes", stats.bytes );
+#endif
+
+  /* JSON output */
+  fp = tmpfile();
+  XLAL_CHECK_MAIN( fp != NULL, XLAL_EIO );
+  XLAL_CHECK_MAIN( XLALInstrumentDump( fp, LAL_INSTRUMENT_JSON ) == 0, XLAL_EFUNC );
+  rewind( fp );
+  n = fread( buf, 1, sizeof( buf ) - 1, fp );
+  buf[n] = '\0';
+  fclose( fp );
+  XLAL_CHECK_MAIN( strncmp( buf, "{\"probes\": [", 12 ) == 0, XLAL_EFAILED );
+  XLAL_CHECK_MAIN( strstr( buf, "{\"name\": \"counter\", \"calls\": 0," ) != NULL, XLAL_EFAILED, "Unexpected JSON output:\n%s", buf );
+  XLAL_CHECK_MAIN( strstr( buf, "\"count\": 7}" ) != NULL, XLAL_EFAILED, "Unexpected JSON output:\n%s", buf );
+
+  /* reset */
+  XLALInstrumentReset();
+  XLAL_CHECK_MAIN( get_stats( "outer", &stats ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( stats.calls == 0 && stats.total == 0 && stats.bytes == 0, XLAL_EFAILED );
+
+  LALCheckMemoryLeaks();
+  return EXIT_SUCCESS;
+}
@@ -54,6 +54,13 @@
 #include <signal.h>
 #include <lal/LALStdio.h>
 #include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/TimeSeries.h>
+#include <lal/Units.h>
+
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
 
 /* never use this... never! */
 void XLALClobberDebugLevel(int);
@@ -326,6 +333,131 @@ static int stressTestRealloc( void )
 }
 
 
+#ifdef LAL_PTHREAD_LOCK
+/* frees and resizes arena memory of the main thread */
+static void *otherThreadArena( void *arg )
+{
+  void *r;
+  XLALFree( arg );
+  r = XLALRealloc( arg, 1000 );
+  if ( r || xlalErrno != XLAL_EINVAL )
+    return r;
+  XLALClearErrno();
+  return arg;
+}
+#endif
+
+/* test scoped memory arenas */
+static int testArena( void )
+{
+  int keep = lalDebugLevel;
+  REAL8Vector *vec;
+  REAL8TimeSeries *series, *again;
+  LIGOTimeGPS epoch = { 0, 0 };
+  size_t *big;
+
+  XLALClobberDebugLevel(lalDebugLevel | LALMEMDBGBIT | LALMEMPADBIT | LALMEMTRKBIT);
+
+  /* popping when no arena is active is an error */
+  if ( XLALPopMemoryArena() == 0 ) die( popped nonexistent arena );
+  XLALClearErrno();
+
+  if ( XLALPushMemoryArena( 256 ) < 0 ) die( failed to push arena );
+
+  /* small allocations, and one larger than a block */
+  p = XLALArenaMalloc( 10 * sizeof( *p ) );
+  big = XLALArenaMalloc( 1000 * sizeof( *big ) );
+  if ( ! p || ! big ) die( arena allocation failed );
+  for ( i = 0; i < 10; ++i ) p[i] = i;
+  for ( i = 0; i < 1000; ++i ) big[i] = i;
+
+  /* freeing arena memory does nothing */
+  XLALFree( big );
+  for ( i = 0; i < 1000; ++i )
+    if ( big[i] != i ) die( wrong contents );
+
+  /* heap memory is still freed as usual */
+  q = XLALMalloc( 10 * sizeof( *q ) );
+  if ( ! q ) die( heap allocation failed );
+  XLALFree( q );
+
+  /* reallocating NULL allocates from the heap */
+  q = XLALRealloc( NULL, 10 * sizeof( *q ) );
+  if ( ! q ) die( heap reallocation failed );
+
+#ifdef LAL_PTHREAD_LOCK
+  /* another thread may free arena memory, but not resize it */
+  {
+    pthread_t thread;
+    void *ret = NULL;
+    if ( pthread_create( &thread, NULL, otherThreadArena, p ) != 0 ) die( failed to create thread );
+    if ( pthread_join( thread, &ret ) != 0 ) die( failed to join thread );
+    if ( ret != p ) die( another thread resized arena memory );
+  }
+#endif
+
+  /* resizing keeps the contents, and memory of an outer arena stays there */
+  if ( XLALPushMemoryArena( 0 ) < 0 ) die( failed to push arena );
+  r = XLALArenaMalloc( 100 * sizeof( *r ) );
+  if ( ! r ) die( arena allocation failed );
+  p = XLALRealloc( p, 500 * sizeof( *p ) );
+  if ( ! p ) die( arena reallocation failed );
+  for ( i = 10; i < 500; ++i ) p[i] = i;
+  if ( XLALPopMemoryArena() < 0 ) die( failed to pop arena );
+  for ( i = 0; i < 500; ++i )
+    if ( p[i] != i ) die( wrong contents );
+  p = XLALRealloc( p, 5 * sizeof( *p ) );
+  for ( i = 0; i < 5; ++i )
+    if ( p[i] != i ) die( wrong contents );
+
+  /* vectors are created on the heap, and outlive the arena */
+  vec = XLALCreateREAL8Vector( 100 );
+  if ( ! vec ) die( vector creation failed );
+  for ( i = 0; i < 100; ++i ) vec->data[i] = i;
+
+  if ( XLALPopMemoryArena() < 0 ) die( failed to pop arena );
+
+  vec = XLALResizeREAL8Vector( vec, 200 );
+  if ( ! vec ) die( vector resize failed );
+  for ( i = 0; i < 100; ++i )
+    if ( vec->data[i] != i ) die( wrong contents );
+  XLALDestroyREAL8Vector( vec );
+  XLALFree( q );
+
+  /* series are created in a factory arena, and memory freed in turn is
+   * reused; an ordinary arena inside it makes the factories use the heap */
+  if ( XLALPushFactoryMemoryArena( 0 ) < 0 ) die( failed to push arena );
+  series = XLALCreateREAL8TimeSeries( "arena", &epoch, 0.0, 1.0, &lalDimensionlessUnit, 100 );
+  if ( ! series ) die( series creation failed );
+  for ( i = 0; i < 100; ++i ) series->data->data[i] = i;
+  series = XLALResizeREAL8TimeSeries( series, 0, 200 );
+  if ( ! series ) die( series resize failed );
+  for ( i = 0; i < 100; ++i )
+    if ( series->data->data[i] != i ) die( wrong contents );
+  XLALDestroyREAL8TimeSeries( series );
+  again = XLALCreateREAL8TimeSeries( "arena", &epoch, 0.0, 1.0, &lalDimensionlessUnit, 200 );
+  if ( again != series ) die( arena memory not reused );
+  if ( XLALPushMemoryArena( 0 ) < 0 ) die( failed to push arena );
+  vec = XLALCreateREAL8Vector( 100 );
+  if ( ! vec ) die( vector creation failed );
+  if ( XLALPopMemoryArena() < 0 ) die( failed to pop arena );
+  XLALDestroyREAL8TimeSeries( again );
+  if ( XLALPopMemoryArena() < 0 ) die( failed to pop arena );
+  for ( i = 0; i < 100; ++i ) vec->data[i] = i;
+  XLALDestroyREAL8Vector( vec );
+  trial( LALCheckMemoryLeaks(), 0, "" );
+
+  /* without an arena the arena allocator is the ordinary one */
+  p = XLALArenaMalloc( 10 * sizeof( *p ) );
+  trial( LALCheckMemoryLeaks(), SIGSEGV, "LALCheckMemoryLeaks: memory leak\n" );
+  XLALFree( p );
+
+  trial( LALCheckMemoryLeaks(), 0, "" );
+  XLALClobberDebugLevel(keep);
+  return 0;
+}
+
+
 int main( void )
 {
   XLALGetDebugLevel();
@@ -342,6 +474,7 @@ int main( void )
   if ( testPadding() ) return 1;
   if ( testAllocList() ) return 1;
   if ( stressTestRealloc() ) return 1;
+  if ( testArena() ) return 1;
 
   trial( LALCheckMemoryLeaks(), 0, "" );
 
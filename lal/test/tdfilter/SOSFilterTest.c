@@ -0,0 +1,139 @@
+/*
+*  Copyright (C) 2026 agent
+*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/SeqFactories.h>
+#include <lal/TimeSeries.h>
+#include <lal/Units.h>
+#include <lal/BandPassTimeSeries.h>
+
+/*
+ * Tests the second-order-section filters of SOSFilter.c: multi-channel
+ * filtering against single-channel filtering, chunked filtering with saved
+ * and restored state against filtering in one go, and the zero-phase
+ * Butterworth response against XLALButterworthREAL8TimeSeries().
+ */
+
+#define NUM_CHANNELS 5
+#define NUM_SAMPLES 4096
+#define DELTA_T (1.0 / 1024)
+
+int main( void )
+{
+  LIGOTimeGPS epoch = LIGOTIMEGPSZERO;
+  PassBandParamStruc params;
+  REAL8SOSFilter *multi, *single;
+  REAL8VectorSequence *data, *chunked;
+  REAL8TimeSeries *series[NUM_CHANNELS];
+  REAL8Vector *state;
+  REAL8Vector channel;
+  REAL8 maxerr;
+  UINT4 i, c;
+
+  /* a 10th-order low-pass filter at 100 Hz */
+  params.name = NULL;
+  params.nMax = 10;
+  params.f1 = -1.0;
+  params.a1 = -1.0;
+  params.f2 = 100.0;
+  params.a2 = 0.5;
+  multi = XLALCreateButterworthREAL8SOSFilter( &params, DELTA_T, NUM_CHANNELS );
+  single = XLALCreateButterworthREAL8SOSFilter( &params, DELTA_T, 1 );
+  XLAL_CHECK_MAIN( multi && single, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( multi->numSections == 5, XLAL_EFAILED, "expected 5 sections, got %u", multi->numSections );
+
+  /* random data */
+  data = XLALCreateREAL8VectorSequence( NUM_SAMPLES, NUM_CHANNELS );
+  chunked = XLALCreateREAL8VectorSequence( NUM_SAMPLES, NUM_CHANNELS );
+  XLAL_CHECK_MAIN( data && chunked, XLAL_EFUNC );
+  srand( 1 );
+  for ( i = 0; i < NUM_SAMPLES * NUM_CHANNELS; i++ )
+    data->data[i] = rand() / (REAL8) RAND_MAX - 0.5;
+  for ( c = 0; c < NUM_CHANNELS; c++ )
+  {
+    series[c] = XLALCreateREAL8TimeSeries( "test", &epoch, 0.0, DELTA_T, &lalDimensionlessUnit, NUM_SAMPLES );
+    XLAL_CHECK_MAIN( series[c], XLAL_EFUNC );
+    for ( i = 0; i < NUM_SAMPLES; i++ )
+      series[c]->data->data[i] = data->data[i * NUM_CHANNELS + c];
+  }
+  memcpy( chunked->data, data->data, NUM_SAMPLES * NUM_CHANNELS * sizeof( *data->data ) );
+
+  /* filter in one go */
+  XLAL_CHECK_MAIN( XLALSOSFilterREAL8VectorSequence( data, multi ) == 0, XLAL_EFUNC );
+
+  /* filter in two chunks, saving and restoring the state in between */
+  state = XLALCreateREAL8Vector( multi->state->length );
+  XLAL_CHECK_MAIN( state, XLAL_EFUNC );
+  XLALResetREAL8SOSFilter( multi );
+  chunked->length = 1000;
+  XLAL_CHECK_MAIN( XLALSOSFilterREAL8VectorSequence( chunked, multi ) == 0, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( XLALGetREAL8SOSFilterState( state, multi ) == 0, XLAL_EFUNC );
+  XLALResetREAL8SOSFilter( multi );
+  XLAL_CHECK_MAIN( XLALSetREAL8SOSFilterState( multi, state ) == 0, XLAL_EFUNC );
+  chunked->data += 1000 * NUM_CHANNELS;
+  chunked->length = NUM_SAMPLES - 1000;
+  XLAL_CHECK_MAIN( XLALSOSFilterREAL8VectorSequence( chunked, multi ) == 0, XLAL_EFUNC );
+  chunked->data -= 1000 * NUM_CHANNELS;
+  chunked->length = NUM_SAMPLES;
+  for ( i = 0; i < NUM_SAMPLES * NUM_CHANNELS; i++ )
+    XLAL_CHECK_MAIN( chunked->data[i] == data->data[i], XLAL_EFAILED, "chunked filtering differs at sample %u", i );
+
+  /* each channel filtered on its own */
+  channel.length = NUM_SAMPLES;
+  channel.data = XLALMalloc( NUM_SAMPLES * sizeof( *channel.data ) );
+  XLAL_CHECK_MAIN( channel.data, XLAL_ENOMEM );
+  maxerr = 0;
+  for ( c = 0; c < NUM_CHANNELS; c++ )
+  {
+    for ( i = 0; i < NUM_SAMPLES; i++ )
+      channel.data[i] = series[c]->data->data[i];
+    XLALResetREAL8SOSFilter( single );
+    XLAL_CHECK_MAIN( XLALSOSFilterREAL8Vector( &channel, single ) == 0, XLAL_EFUNC );
+    for ( i = 0; i < NUM_SAMPLES; i++ )
+      maxerr = fmax( maxerr, fabs( channel.data[i] - data->data[i * NUM_CHANNELS + c] ) );
+  }
+  XLAL_CHECK_MAIN( maxerr < 1e-12, XLAL_EFAILED, "multi-channel filtering differs by %g", maxerr );
+  XLALFree( channel.data );
+
+  /* forwards and backwards gives the Butterworth response away from the
+     ends of the data */
+  XLAL_CHECK_MAIN( XLALSOSFilterReverseREAL8VectorSequence( data, multi ) == 0, XLAL_EFUNC );
+  maxerr = 0;
+  for ( c = 0; c < NUM_CHANNELS; c++ )
+  {
+    XLAL_CHECK_MAIN( XLALButterworthREAL8TimeSeries( series[c], &params ) == 0, XLAL_EFUNC );
+    for ( i = 512; i < NUM_SAMPLES - 512; i++ )
+      maxerr = fmax( maxerr, fabs( series[c]->data->data[i] - data->data[i * NUM_CHANNELS + c] ) );
+    XLALDestroyREAL8TimeSeries( series[c] );
+  }
+  XLAL_CHECK_MAIN( maxerr < 1e-10, XLAL_EFAILED, "zero-phase filtering differs from XLALButterworthREAL8TimeSeries() by %g", maxerr );
+
+  XLALDestroyREAL8Vector( state );
+  XLALDestroyREAL8VectorSequence( data );
+  XLALDestroyREAL8VectorSequence( chunked );
+  XLALDestroyREAL8SOSFilter( multi );
+  XLALDestroyREAL8SOSFilter( single );
+
+  LALCheckMemoryLeaks();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with with program; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+#include <lal/LALConstants.h>
+#include <lal/LALDatatypes.h>
+#include <lal/LALStdlib.h>
+#include <lal/ResampleTimeSeries.h>
+#include <lal/TimeSeries.h>
+#include <lal/Units.h>
+
+
+static LIGOTimeGPS gps_zero = LIGOTIMEGPSZERO;
+
+
+static REAL8TimeSeries *new_sine(double deltaT, unsigned length, double freq, double phase)
+{
+	REAL8TimeSeries *new = XLALCreateREAL8TimeSeries("blah", &gps_zero, 0.0, deltaT, &lalDimensionlessUnit, length);
+	unsigned i;
+	for(i = 0; i < new->data->length; i++)
+		new->data->data[i] = sin(LAL_TWOPI * freq * i * deltaT + phase);
+	return new;
+}
+
+
+/* maximum error with respect to the sine function, ignoring "edge" samples
+ * at either end */
+static void check_sine(const REAL8TimeSeries *s, double freq, double phase, unsigned length, unsigned edge, double bound)
+{
+	double max = 0.;
+	unsigned i;
+
+	if(s->data->length != length) {
+		fprintf(stderr, "error:  expected %u samples got %u\n", length, s->data->length);
+		exit(1);
+	}
+	for(i = edge; i + edge < s->data->length; i++) {
+		double err = fabs(s->data->data[i] - sin(LAL_TWOPI * freq * i * s->deltaT + phase));
+		if(err > max)
+			max = err;
+	}
+
+	fprintf(stderr, "maximum error:  %g\n", max);
+	if(max > bound) {
+		fprintf(stderr, "error larger than allowed\n");
+		exit(1);
+	}
+}
+
+
+int main(void)
+{
+	REAL8TimeSeries *series;
+	LALREAL8Resampler *resampler;
+	REAL8 *oneshot, *streamed, *zeros;
+	unsigned n, latency, i, j;
+	int k;
+
+	/*
+	 * integer downsampling:  64 Hz sine from 4096 Hz to 1024 Hz
+	 */
+
+	fprintf(stderr, "FIR downsampling 4096 Hz to 1024 Hz ...\n");
+	series = new_sine(1.0 / 4096, 16384, 64.0, 0.3);
+	if(XLALResampleREAL8TimeSeriesFIR(series, 1.0 / 1024) < 0)
+		exit(1);
+	check_sine(series, 64.0, 0.3, 4096, 64, 5e-3);
+	XLALDestroyREAL8TimeSeries(series);
+
+	/*
+	 * rational resampling:  3000 Hz to 2000 Hz
+	 */
+
+	fprintf(stderr, "FIR resampling 3000 Hz to 2000 Hz ...\n");
+	series = new_sine(1.0 / 3000, 6000, 150.0, 1.1);
+	if(XLALResampleREAL8TimeSeriesFIR(series, 1.0 / 2000) < 0)
+		exit(1);
+	check_sine(series, 150.0, 1.1, 4000, 64, 5e-3);
+	XLALDestroyREAL8TimeSeries(series);
+
+	/*
+	 * upsampling:  1024 Hz to 2048 Hz
+	 */
+
+	fprintf(stderr, "FIR upsampling 1024 Hz to 2048 Hz ...\n");
+	series = new_sine(1.0 / 1024, 4096, 100.0, 0.0);
+	if(XLALResampleREAL8TimeSeriesFIR(series, 1.0 / 2048) < 0)
+		exit(1);
+	check_sine(series, 100.0, 0.0, 8192, 64, 5e-3);
+	XLALDestroyREAL8TimeSeries(series);
+
+	/*
+	 * streaming:  feeding the input in chunks of random size must
+	 * reproduce the one-shot output exactly
+	 */
+
+	fprintf(stderr, "checking FIR resampler streaming ...\n");
+	series = new_sine(1.0 / 4096, 10000, 300.0, 0.0);
+	resampler = XLALREAL8ResamplerCreate(2, 5, 10, 5.0);
+	if(!resampler)
+		exit(1);
+	latency = XLALREAL8ResamplerLatency(resampler);
+	zeros = calloc(latency, sizeof(*zeros));
+	n = XLALREAL8ResamplerOutputLength(resampler, series->data->length + latency);
+	oneshot = calloc(n, sizeof(*oneshot));
+	streamed = calloc(n, sizeof(*streamed));
+	k = XLALREAL8ResamplerApply(resampler, oneshot, series->data->data, series->data->length);
+	k += XLALREAL8ResamplerApply(resampler, oneshot + k, zeros, latency);
+	if(k != (int) n) {
+		fprintf(stderr, "error:  expected %u samples got %d\n", n, k);
+		exit(1);
+	}
+	XLALREAL8ResamplerReset(resampler);
+	srand(1);
+	for(i = 0, j = 0; i < series->data->length; ) {
+		unsigned chunk = rand() % 97;
+		if(chunk > series->data->length - i)
+			chunk = series->data->length - i;
+		if(XLALREAL8ResamplerOutputLength(resampler, chunk) > n - j) {
+			fprintf(stderr, "error:  resampler output overflow\n");
+			exit(1);
+		}
+		k = XLALREAL8ResamplerApply(resampler, streamed + j, series->data->data + i, chunk);
+		if(k < 0)
+			exit(1);
+		i += chunk;
+		j += k;
+	}
+	j += XLALREAL8ResamplerApply(resampler, streamed + j, zeros, latency);
+	if(j != n) {
+		fprintf(stderr, "error:  expected %u samples got %u\n", n, j);
+		exit(1);
+	}
+	for(j = 0; j < n; j++)
+		if(streamed[j] != oneshot[j]) {
+			fprintf(stderr, "error:  streamed output differs from one-shot output in sample %u\n", j);
+			exit(1);
+		}
+	fprintf(stderr, "... passed\n");
+	free(zeros);
+	free(oneshot);
+	free(streamed);
+	XLALREAL8ResamplerDestroy(resampler);
+	XLALDestroyREAL8TimeSeries(series);
+
+	/*
+	 * a resampling ratio beyond the largest factor is rejected
+	 */
+
+	fprintf(stderr, "checking FIR resampling ratio range ...\n");
+	series = new_sine(1.0 / 1024, 4096, 100.0, 0.0);
+	if(XLALResampleREAL8TimeSeriesFIR(series, 1e30) == 0 || XLALGetBaseErrno() != XLAL_EDOM) {
+		fprintf(stderr, "error:  resampling ratio 1.024e33 was not rejected\n");
+		exit(1);
+	}
+	XLALClearErrno();
+	fprintf(stderr, "... passed\n");
+	XLALDestroyREAL8TimeSeries(series);
+
+	/*
+	 * frequency domain:  a sine with an integer number of cycles is
+	 * resampled exactly
+	 */
+
+	fprintf(stderr, "FFT downsampling 4096 Hz to 1000 Hz ...\n");
+	series = new_sine(1.0 / 4096, 4096, 37.0, 0.7);
+	if(XLALResampleREAL8TimeSeriesFFT(series, 1.0 / 1000) < 0)
+		exit(1);
+	check_sine(series, 37.0, 0.7, 1000, 0, 1e-10);
+	XLALDestroyREAL8TimeSeries(series);
+
+	fprintf(stderr, "FFT upsampling 1000 Hz to 4096 Hz ...\n");
+	series = new_sine(1.0 / 1000, 1000, 37.0, 0.7);
+	if(XLALResampleREAL8TimeSeriesFFT(series, 1.0 / 4096) < 0)
+		exit(1);
+	check_sine(series, 37.0, 0.7, 4096, 0, 1e-10);
+	XLALDestroyREAL8TimeSeries(series);
+
+	/*
+	 * success
+	 */
+
+	LALCheckMemoryLeaks();
+	exit(0);
+}
@@ -166,6 +166,33 @@ int main(void)
     if (XLALDictSize(dict) != 0)
         return 1;
 
+    /* grow the dict well beyond its initial size, then remove every
+     * other key and make sure the remaining keys can still be found */
+    fprintf(stderr, "Testing many keys...");
+    for (INT4 i = 0; i < 1000; ++i) {
+        char key[32];
+        snprintf(key, sizeof(key), "key%d", i);
+        if (XLALDictInsertINT4Value(dict, key, i) < 0)
+            return 1;
+    }
+    for (INT4 i = 0; i < 1000; i += 2) {
+        char key[32];
+        snprintf(key, sizeof(key), "key%d", i);
+        if (XLALDictRemove(dict, key) < 0)
+            return 1;
+    }
+    if (XLALDictSize(dict) != 500)
+        return 1;
+    for (INT4 i = 0; i < 1000; ++i) {
+        char key[32];
+        snprintf(key, sizeof(key), "key%d", i);
+        if (XLALDictContains(dict, key) != i % 2)
+            return 1;
+        if (i % 2 && XLALDictLookupINT4Value(dict, key) != i)
+            return 1;
+    }
+    fprintf(stderr, " passed\n");
+
     XLALDestroyDict(dict);
     XLALDestroyList(keys);
     XLALDestroyList(list);
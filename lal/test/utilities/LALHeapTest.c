@@ -18,9 +18,14 @@
  */
 
 #include <stdlib.h>
+#include <math.h>
 #include <gsl/gsl_rng.h>
 #include <lal/LALHeap.h>
 
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
+
 #ifdef __GNUC__
 #define UNUSED __attribute__ ((unused))
 #else
@@ -60,6 +65,46 @@ static int reverse_ptr_int( void *param, void *x )
   return XLAL_SUCCESS;
 }
 
+static int cmp_param_ptr_int( UNUSED void *param, const void *x, const void *y )
+{
+  return cmp_ptr_int( x, y );
+}
+
+static REAL8 rank_ptr_int( UNUSED void *param, const void *x )
+{
+  return *( ( const int * ) x );
+}
+
+#define CONCURRENT_NTHREADS 4
+#define CONCURRENT_NINPUT 10000
+
+typedef struct {
+  LALConcurrentHeap *ch;
+  const int *input;
+  int thread;
+  int nrejected;
+  int errnum;
+} ConcurrentThreadParam;
+
+/* Add every CONCURRENT_NTHREADS-th input to the heap of a thread, counting rejected elements */
+static void *concurrent_add( void *param )
+{
+  ConcurrentThreadParam *p = ( ConcurrentThreadParam * ) param;
+  for ( int i = p->thread; i < CONCURRENT_NINPUT; i += CONCURRENT_NTHREADS ) {
+    void *x = new_int( p->input[i] );
+    const void *y = x;
+    if ( x == NULL || XLALConcurrentHeapAdd( p->ch, p->thread, &x ) != XLAL_SUCCESS ) {
+      p->errnum = XLAL_EFUNC;
+      break;
+    }
+    if ( x == y ) {
+      ++p->nrejected;
+    }
+    XLALFree( x );
+  }
+  return NULL;
+}
+
 int main( void )
 {
 
@@ -321,6 +366,68 @@ int main( void )
   XLAL_CHECK_MAIN( XLALHeapClear( minh ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK_MAIN( XLALHeapSize( minh ) == 0, XLAL_EFAILED );
 
+  /* Fill a concurrent heap from several threads, and check that the merged heap holds the largest elements */
+  {
+    printf( "\n----- XLALConcurrentHeap() -----\n" );
+    static int cinput[CONCURRENT_NINPUT];
+    static int *cref[CONCURRENT_NINPUT];
+    gsl_rng *r = gsl_rng_alloc( gsl_rng_mt19937 );
+    XLAL_CHECK_MAIN( r != NULL, XLAL_ESYS );
+    for ( int i = 0; i < CONCURRENT_NINPUT; ++i ) {
+      cinput[i] = gsl_rng_uniform_int( r, 1000000 );
+      cref[i] = &cinput[i];
+    }
+    gsl_rng_free( r );
+    qsort( cref, CONCURRENT_NINPUT, sizeof( cref[0] ), cmp_ptr_ptr_int );
+    LALConcurrentHeap *ch = XLALConcurrentHeapCreate( XLALFree, 10, -1, cmp_param_ptr_int, rank_ptr_int, NULL, CONCURRENT_NTHREADS );
+    XLAL_CHECK_MAIN( ch != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( XLALConcurrentHeapNumThreads( ch ) == CONCURRENT_NTHREADS, XLAL_EFAILED );
+    XLAL_CHECK_MAIN( XLALConcurrentHeapThreshold( ch ) == -INFINITY, XLAL_EFAILED );
+    ConcurrentThreadParam param[CONCURRENT_NTHREADS];
+    for ( int t = 0; t < CONCURRENT_NTHREADS; ++t ) {
+      param[t].ch = ch;
+      param[t].input = cinput;
+      param[t].thread = t;
+      param[t].nrejected = 0;
+      param[t].errnum = 0;
+    }
+#ifdef LAL_PTHREAD_LOCK
+    pthread_t threads[CONCURRENT_NTHREADS];
+    for ( int t = 0; t < CONCURRENT_NTHREADS; ++t ) {
+      XLAL_CHECK_MAIN( pthread_create( &threads[t], NULL, concurrent_add, &param[t] ) == 0, XLAL_ESYS );
+    }
+    for ( int t = 0; t < CONCURRENT_NTHREADS; ++t ) {
+      XLAL_CHECK_MAIN( pthread_join( threads[t], NULL ) == 0, XLAL_ESYS );
+    }
+#else
+    for ( int t = 0; t < CONCURRENT_NTHREADS; ++t ) {
+      concurrent_add( &param[t] );
+    }
+#endif
+    int nrejected = 0;
+    for ( int t = 0; t < CONCURRENT_NTHREADS; ++t ) {
+      XLAL_CHECK_MAIN( param[t].errnum == 0, param[t].errnum );
+      XLAL_CHECK_MAIN( XLALHeapSize( XLALConcurrentHeapThreadHeap( ch, t ) ) <= 10, XLAL_EFAILED );
+      nrejected += param[t].nrejected;
+    }
+    printf( "rejected %i of %i elements\n", nrejected, CONCURRENT_NINPUT );
+    XLAL_CHECK_MAIN( XLALConcurrentHeapThreshold( ch ) <= *cref[CONCURRENT_NINPUT - 10], XLAL_EFAILED );
+    XLAL_CHECK_MAIN( XLALConcurrentHeapMerge( ch ) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( int t = 1; t < CONCURRENT_NTHREADS; ++t ) {
+      XLAL_CHECK_MAIN( XLALHeapSize( XLALConcurrentHeapThreadHeap( ch, t ) ) == 0, XLAL_EFAILED );
+    }
+    LALHeap *h0 = XLALConcurrentHeapThreadHeap( ch, 0 );
+    XLAL_CHECK_MAIN( h0 != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( XLALHeapSize( h0 ) == 10, XLAL_EFAILED );
+    printf( "merged={" );
+    XLAL_CHECK_MAIN( XLALHeapVisit( h0, print_ptr_int, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
+    printf( " }\n" );
+    int **ref0 = &cref[CONCURRENT_NINPUT - 10];
+    XLAL_CHECK_MAIN( XLALHeapVisit( h0, check_ptr_int, &ref0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( XLALConcurrentHeapThreshold( ch ) == *cref[CONCURRENT_NINPUT - 10], XLAL_EFAILED );
+    XLALConcurrentHeapDestroy( ch );
+  }
+
   /* Cleanup */
   {
     printf( "\n----- cleanup -----\n" );
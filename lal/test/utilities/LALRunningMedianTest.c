@@ -670,6 +670,60 @@ int main( int argc, char **argv )
     printf("  PASS: LALSRunningMedian2(%d,%d)\n",length,param.blocksize);
   }
 
+  /* the context version must give the same results as LALDRunningMedian2,
+     also when the context is reused */
+  {
+    const UINT4 ctxblocksizes[] = { param.blocksize, param.blocksize + 1, 50, 51, 101 };
+    for (i = 0; i < sizeof(ctxblocksizes)/sizeof(ctxblocksizes[0]); i++) {
+      LALRunningMedianContext *ctx;
+      REAL8Sequence *ctxmedians = NULL;
+      UINT4 k;
+      int rep;
+      if (ctxblocksizes[i] < 3 || ctxblocksizes[i] > length)
+	continue;
+      param.blocksize = ctxblocksizes[i];
+      LALDCreateVector( &stat, &medians8, length - param.blocksize + 1 );
+      LALDCreateVector( &stat, &ctxmedians, length - param.blocksize + 1 );
+      if( stat.statusCode ) {
+	EXIT( LALRUNNINGMEDIANTESTC_EALOC, argv0, LALRUNNINGMEDIANTESTC_MSGEALOC );
+      }
+      LALDRunningMedian2( &stat, medians8, input8, param );
+      if( stat.statusCode ) {
+	EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+      }
+      ctx = XLALCreateRunningMedianContext( param.blocksize );
+      if( !ctx ) {
+	EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+      }
+      for (rep = 0; rep < 2; rep++) {
+	if( XLALDRunningMedianWithContext( ctx, ctxmedians, input8 ) != XLAL_SUCCESS ) {
+	  EXIT( LALRUNNINGMEDIANTESTC_ESUB, argv0, LALRUNNINGMEDIANTESTC_MSGESUB );
+	}
+	for (k = 0; k < medians8->length; k++)
+	  if (ctxmedians->data[k] != medians8->data[k]) {
+	    printf("ERROR: index:%d median:% 22.15e context median:% 22.15e\n",
+		   k, medians8->data[k], ctxmedians->data[k]);
+	    EXIT( LALRUNNINGMEDIANTESTC_EFALSE, argv0, LALRUNNINGMEDIANTESTC_MSGEFALSE );
+	  }
+      }
+      XLALDestroyRunningMedianContext( ctx );
+      LALDDestroyVector( &stat, &ctxmedians );
+      LALDDestroyVector( &stat, &medians8 );
+      printf("  PASS: XLALDRunningMedianWithContext(%d,%d)\n",length,param.blocksize);
+    }
+  }
+
+  /* context creation with blocksize <= 2 must fail */
+  {
+    int errnum;
+    LALRunningMedianContext *ctx;
+    XLAL_TRY( ctx = XLALCreateRunningMedianContext( 2 ), errnum );
+    if( ctx || errnum != XLAL_EDOM ) {
+      EXIT( LALRUNNINGMEDIANTESTC_EERR, argv0, LALRUNNINGMEDIANTESTC_MSGEERR );
+    }
+    printf("  PASS: XLALCreateRunningMedianContext blocksize =2 results in error\n");
+  }
+
 
   /* free dummy input memory */
   LALDDestroyVector(&stat,&input8);
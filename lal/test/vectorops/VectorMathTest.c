@@ -38,6 +38,7 @@
 #define Relerr(dx,x) (fabsf(x)>0 ? fabsf((dx)/(x)) : fabsf(dx) )
 #define Relerrd(dx,x) (fabs(x)>0 ? fabs((dx)/(x)) : fabs(dx) )
 #define cRelerr(dx,x) (cabsf(x)>0 ? cabsf((dx)/(x)) : fabsf(dx) )
+#define cRelerrd(dx,x) (cabs(x)>0 ? cabs((dx)/(x)) : fabs(dx) )
 
 // ----- test and benchmark operators with 1 REAL4 vector input and 1 INT4 vector output (S2I) ----------
 #define TESTBENCH_VECTORMATH_S2I(name,in)                               \
@@ -188,6 +189,75 @@
     XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "COMPLEX8", maxRelerr, reltol ); \
   }
 
+// ----- test and benchmark operators with 2 COMPLEX16 vector inputs and 1 COMPLEX16 vector output (ZZ2Z) ----------
+#define TESTBENCH_VECTORMATH_ZZ2Z(name,in1,in2)                         \
+  {                                                                     \
+    XLAL_CHECK ( XLALVector##name##COMPLEX16_GEN( xOutRefZ, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##COMPLEX16( xOutZ, in1, in2, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    maxErr = maxRelerr = 0;                                             \
+    for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
+    {                                                                   \
+      REAL8 err = cabs ( xOutZ[i] - xOutRefZ[i] );                      \
+      REAL8 relerr = cRelerrd ( err, xOutRefZ[i] );                     \
+      maxErr    = fmax ( err, maxErr );                                 \
+      maxRelerr = fmax ( relerr, maxRelerr );                           \
+    }                                                                   \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##COMPLEX16_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxRelerr, reltol ); \
+  }
+
+// ----- test and benchmark operators with 2 COMPLEX16 vector and 1 REAL8 vector inputs accumulated into 1 COMPLEX16 vector output (ZZD2Z) ----------
+#define TESTBENCH_VECTORMATH_ZZD2Z(name,in1,in2,w)                      \
+  {                                                                     \
+    for ( UINT4 i = 0; i < Ntrials; i ++ ) {                            \
+      xOutZ[i] = xOutRefZ[i] = 0;                                       \
+    }                                                                   \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##COMPLEX16_GEN( xOutRefZ, in1, in2, w, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##COMPLEX16( xOutZ, in1, in2, w, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    maxErr = maxRelerr = 0;                                             \
+    for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
+    {                                                                   \
+      REAL8 err = cabs ( xOutZ[i] - xOutRefZ[i] );                      \
+      REAL8 relerr = cRelerrd ( err, xOutRefZ[i] );                     \
+      maxErr    = fmax ( err, maxErr );                                 \
+      maxRelerr = fmax ( relerr, maxRelerr );                           \
+    }                                                                   \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##COMPLEX16_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxRelerr, reltol ); \
+  }
+
+// ----- test and benchmark operators with 2 COMPLEX16 vector and 1 REAL8 vector inputs to 1 COMPLEX16 scalar output (ZZD2z) ----------
+#define TESTBENCH_VECTORMATH_ZZD2z(name,in1,in2,w)                      \
+  {                                                                     \
+    COMPLEX16 xResultZ = 0, xResultRefZ = 0;                            \
+    XLAL_CHECK ( XLALVector##name##COMPLEX16_GEN( &xResultRefZ, in1, in2, w, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                             \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##COMPLEX16( &xResultZ, in1, in2, w, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                             \
+    maxErr = cabs ( xResultZ - xResultRefZ );                           \
+    maxRelerr = cRelerrd ( maxErr, xResultRefZ );                       \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##COMPLEX16_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, (reltol) ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "COMPLEX16", maxRelerr, reltol ); \
+  }
+
 // ----- test and benchmark operators with 1 REAL8 vector input and 1 REAL8 vector output (D2D) ----------
 #define TESTBENCH_VECTORMATH_D2D(name,in)                               \
   {                                                                     \
@@ -200,8 +270,8 @@
     maxErr = maxRelerr = 0;                                             \
     for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
     {                                                                   \
-      REAL8 err = fabs ( xOut[i] - xOutRef[i] );                      \
-      REAL8 relerr = Relerrd ( err, xOutRef[i] );                       \
+      REAL8 err = fabs ( xOutD[i] - xOutRefD[i] );                      \
+      REAL8 relerr = Relerrd ( err, xOutRefD[i] );                       \
       maxErr    = fmax ( err, maxErr );                                \
       maxRelerr = fmax ( relerr, maxRelerr );                          \
     }                                                                   \
@@ -211,6 +281,33 @@
     XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxRelerr, reltol ); \
   }
 
+// ----- test and benchmark operators with 1 REAL8 vector input and 2 REAL8 vector outputs (D2DD) ----------
+#define TESTBENCH_VECTORMATH_D2DD(name,in)                              \
+  {                                                                     \
+    XLAL_CHECK ( XLALVector##name##REAL8_GEN( xOutRefD, xOutRef2D, in, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    tic = XLALGetCPUTime();                                           \
+    for (UINT4 l=0; l < Nruns; l ++ ) {                                 \
+      XLAL_CHECK ( XLALVector##name##REAL8( xOutD, xOut2D, in, Ntrials ) == XLAL_SUCCESS, XLAL_EFUNC ); \
+    }                                                                   \
+    toc = XLALGetCPUTime();                                           \
+    maxErr = maxRelerr = 0;                                             \
+    for ( UINT4 i = 0; i < Ntrials; i ++ )                              \
+    {                                                                   \
+      REAL8 err1 = fabs ( xOutD[i] - xOutRefD[i] );                     \
+      REAL8 err2 = fabs ( xOut2D[i] - xOutRef2D[i] );                   \
+      REAL8 relerr1 = Relerrd ( err1, xOutRefD[i] );                    \
+      REAL8 relerr2 = Relerrd ( err2, xOutRef2D[i] );                   \
+      maxErr    = fmax ( err1, maxErr );                                \
+      maxErr    = fmax ( err2, maxErr );                                \
+      maxRelerr = fmax ( relerr1, maxRelerr );                          \
+      maxRelerr = fmax ( relerr2, maxRelerr );                          \
+    }                                                                   \
+    XLALPrintInfo ( "%-32s: %4.0f Mops/sec [maxErr = %7.2g (tol=%7.2g), maxRelerr = %7.2g (tol=%7.2g)]\n", \
+                    XLALVector##name##REAL8_name, (REAL8)Ntrials * Nruns / (toc - tic)/1e6, maxErr, (abstol), maxRelerr, reltol ); \
+    XLAL_CHECK ( (maxErr <= (abstol)), XLAL_ETOL, "%s: absolute error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxErr, abstol ); \
+    XLAL_CHECK ( (maxRelerr <= (reltol)), XLAL_ETOL, "%s: relative error (%g) exceeds tolerance (%g)\n", #name "REAL8", maxRelerr, reltol ); \
+  }
+
 // local types
 typedef struct
 {
@@ -276,17 +373,21 @@ main ( int argc, char *argv[] )
   REAL4 *xOutRef  = xOutRef_a->data;
   REAL4 *xOutRef2 = xOutRef2_a->data;
 
-  REAL8VectorAligned *xInD_a, *xIn2D_a, *xOutD_a, *xOutRefD_a;
+  REAL8VectorAligned *xInD_a, *xIn2D_a, *xOutD_a, *xOut2D_a, *xOutRefD_a, *xOutRef2D_a;
   XLAL_CHECK ( ( xInD_a   = XLALCreateREAL8VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
   XLAL_CHECK ( ( xIn2D_a  = XLALCreateREAL8VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
   XLAL_CHECK ( ( xOutD_a  = XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( ( xOut2D_a = XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
   XLAL_CHECK ( (xOutRefD_a= XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( (xOutRef2D_a= XLALCreateREAL8VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
 
   // extract aligned REAL8 vectors from these
   REAL8 *xInD      = xInD_a->data;
   REAL8 *xIn2D     = xIn2D_a->data;
   REAL8 *xOutD     = xOutD_a->data;
+  REAL8 *xOut2D    = xOut2D_a->data;
   REAL8 *xOutRefD  = xOutRefD_a->data;
+  REAL8 *xOutRef2D = xOutRef2D_a->data;
 
   COMPLEX8VectorAligned *xInC_a, *xIn2C_a, *xOutC_a, *xOutRefC_a;
   XLAL_CHECK ( ( xInC_a   = XLALCreateCOMPLEX8VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
@@ -300,6 +401,18 @@ main ( int argc, char *argv[] )
   COMPLEX8 *xOutC     = xOutC_a->data;
   COMPLEX8 *xOutRefC  = xOutRefC_a->data;
 
+  COMPLEX16VectorAligned *xInZ_a, *xIn2Z_a, *xOutZ_a, *xOutRefZ_a;
+  XLAL_CHECK ( ( xInZ_a   = XLALCreateCOMPLEX16VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( ( xIn2Z_a  = XLALCreateCOMPLEX16VectorAligned ( Ntrials, uvar->inAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( ( xOutZ_a  = XLALCreateCOMPLEX16VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+  XLAL_CHECK ( (xOutRefZ_a  = XLALCreateCOMPLEX16VectorAligned ( Ntrials, uvar->outAlign )) != NULL, XLAL_EFUNC );
+
+  // extract aligned COMPLEX16 vectors from these
+  COMPLEX16 *xInZ     = xInZ_a->data;
+  COMPLEX16 *xIn2Z    = xIn2Z_a->data;
+  COMPLEX16 *xOutZ    = xOutZ_a->data;
+  COMPLEX16 *xOutRefZ = xOutRefZ_a->data;
+
   REAL8 tic, toc;
   REAL4 maxErr = 0, maxRelerr = 0;
   REAL4 abstol, reltol;
@@ -327,6 +440,17 @@ main ( int argc, char *argv[] )
   // ==================== SINCOS(2PI*x) ====================
   TESTBENCH_VECTORMATH_S2SS(SinCos2Pi,xIn);
 
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i] = 2000 * ( frand() - 0.5 );
+  }
+  abstol = 1e-15, reltol = 4e-15;
+
+  XLALPrintInfo ("\nTesting REAL8 sin(x), cos(x) for x in [-1000, 1000]\n");
+  TESTBENCH_VECTORMATH_D2D(Sin,xInD);
+  TESTBENCH_VECTORMATH_D2D(Cos,xInD);
+  TESTBENCH_VECTORMATH_D2DD(SinCos,xInD);
+  TESTBENCH_VECTORMATH_D2DD(SinCos2Pi,xInD);
+
   // ==================== EXP() ====================
   XLALPrintInfo ("\nTesting exp(x) for x in [-10, 10]\n");
   for ( UINT4 i = 0; i < Ntrials; i ++ ) {
@@ -336,6 +460,12 @@ main ( int argc, char *argv[] )
   abstol = 4e-3, reltol = 3e-7;
   TESTBENCH_VECTORMATH_S2S(Exp,xIn);
 
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i] = 20 * ( frand() - 0.5 );
+  }
+  abstol = 1e-11, reltol = 1e-15;
+  TESTBENCH_VECTORMATH_D2D(Exp,xInD);
+
   // ==================== LOG() ====================
   XLALPrintInfo ("\nTesting log(x) for x in (0, 10000]\n");
   for ( UINT4 i = 0; i < Ntrials; i ++ ) {
@@ -345,6 +475,12 @@ main ( int argc, char *argv[] )
 
   TESTBENCH_VECTORMATH_S2S(Log,xIn);
 
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInD[i] = 10000.0 * frand() + 1e-6;
+  }
+  abstol = 1e-14, reltol = 1e-15;
+  TESTBENCH_VECTORMATH_D2D(Log,xInD);
+
   // ==================== ADD,MUL,ROUND ====================
   for ( UINT4 i = 0; i < Ntrials; i ++ ) {
     xIn[i]  = -10000.0f + 20000.0f * frand() + 1e-6;
@@ -383,6 +519,30 @@ main ( int argc, char *argv[] )
   TESTBENCH_VECTORMATH_CC2C(Scale,xInC[0],xIn2C);
   TESTBENCH_VECTORMATH_CC2C(Shift,xInC[0],xIn2C);
 
+  // ==================== COMPLEX16 ====================
+  for ( UINT4 i = 0; i < Ntrials; i ++ ) {
+    xInZ[i]  = 2.0 * ( frand() - 0.5 ) + 2.0 * ( frand() - 0.5 ) * _Complex_I;
+    xIn2Z[i] = 2.0 * ( frand() - 0.5 ) + 2.0 * ( frand() - 0.5 ) * _Complex_I;
+    xInD[i]  = frand() + 1e-6;
+  } // for i < Ntrials
+  abstol = 1e-15, reltol = 1e-15;
+
+  XLALPrintInfo ("\nTesting COMPLEX16 add,multiply,shift,scale,weight(x,y,w) for x,y in (-1, 1], w in (0, 1]\n");
+  TESTBENCH_VECTORMATH_ZZ2Z(Multiply,xInZ,xIn2Z);
+  TESTBENCH_VECTORMATH_ZZ2Z(Add,xInZ,xIn2Z);
+
+  TESTBENCH_VECTORMATH_ZZ2Z(Scale,xInZ[0],xIn2Z);
+  TESTBENCH_VECTORMATH_ZZ2Z(Shift,xInZ[0],xIn2Z);
+
+  TESTBENCH_VECTORMATH_ZZ2Z(Weight,xInZ,xInD);
+
+  XLALPrintInfo ("\nTesting COMPLEX16 conj-multiply-accumulate, weighted inner product(x,y,w) for x,y in (-1, 1], w in (0, 1]\n");
+  abstol = 1e-14, reltol = 1e-13;
+  TESTBENCH_VECTORMATH_ZZD2Z(ConjMultiplyAccumulate,xInZ,xIn2Z,xInD);
+
+  abstol = 1e-10, reltol = 1e-12;
+  TESTBENCH_VECTORMATH_ZZD2z(WeightedInnerProduct,xInZ,xIn2Z,xInD);
+
   // ==================== FIND ====================
   for ( UINT4 i = 0; i < Ntrials; i ++ ) {
     xIn[i]  = -10000.0f + 20000.0f * frand() + 1e-6;
@@ -414,13 +574,20 @@ main ( int argc, char *argv[] )
   XLALDestroyREAL8VectorAligned ( xInD_a );
   XLALDestroyREAL8VectorAligned ( xIn2D_a );
   XLALDestroyREAL8VectorAligned ( xOutD_a );
+  XLALDestroyREAL8VectorAligned ( xOut2D_a );
   XLALDestroyREAL8VectorAligned ( xOutRefD_a );
+  XLALDestroyREAL8VectorAligned ( xOutRef2D_a );
 
   XLALDestroyCOMPLEX8VectorAligned ( xInC_a );
   XLALDestroyCOMPLEX8VectorAligned ( xIn2C_a );
   XLALDestroyCOMPLEX8VectorAligned ( xOutC_a );
   XLALDestroyCOMPLEX8VectorAligned ( xOutRefC_a );
 
+  XLALDestroyCOMPLEX16VectorAligned ( xInZ_a );
+  XLALDestroyCOMPLEX16VectorAligned ( xIn2Z_a );
+  XLALDestroyCOMPLEX16VectorAligned ( xOutZ_a );
+  XLALDestroyCOMPLEX16VectorAligned ( xOutRefZ_a );
+
   XLALDestroyUserVars();
 
   LALCheckMemoryLeaks();
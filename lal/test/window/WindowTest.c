@@ -412,6 +412,61 @@ static int test_parameter_safety(void)
 }
 
 
+/*
+ * Window cache
+ */
+
+
+static int test_cache(void)
+{
+	const REAL8Window *cached1, *cached2, *cached3;
+	REAL8Window *window;
+	int fail = 0;
+
+	cached1 = XLALCreateCachedREAL8Window("Tukey", 0.5, 1024);
+	cached2 = XLALCreateCachedREAL8Window("tukey", 0.5, 1024);
+	cached3 = XLALCreateCachedREAL8Window("tukey", 0.25, 1024);
+	window = XLALCreateTukeyREAL8Window(1024, 0.5);
+	if(!cached1 || !cached2 || !cached3 || !window) {
+		fprintf(stderr, "error: failure creating cached windows\n");
+		return 1;
+	}
+
+	if(cached1 != cached2) {
+		fprintf(stderr, "error: identical cached windows are not shared\n");
+		fail = 1;
+	}
+	if(cached1 == cached3) {
+		fprintf(stderr, "error: cached windows with different parameters are shared\n");
+		fail = 1;
+	}
+	if(memcmp(cached1->data->data, window->data->data, 1024 * sizeof(*window->data->data)) || cached1->sumofsquares != window->sumofsquares || cached1->sum != window->sum) {
+		fprintf(stderr, "error: cached window differs from XLALCreateTukeyREAL8Window()\n");
+		fail = 1;
+	}
+
+	/* a released window is reused */
+	XLALDestroyCachedREAL8Window(cached1);
+	XLALDestroyCachedREAL8Window(cached2);
+	cached2 = XLALCreateCachedREAL8Window("tukey", 0.5, 1024);
+	if(cached2 != cached1) {
+		fprintf(stderr, "error: released cached window is not reused\n");
+		fail = 1;
+	}
+	if(memcmp(cached2->data->data, window->data->data, 1024 * sizeof(*window->data->data))) {
+		fprintf(stderr, "error: reused cached window was modified\n");
+		fail = 1;
+	}
+
+	XLALDestroyCachedREAL8Window(cached2);
+	XLALDestroyCachedREAL8Window(cached3);
+	XLALDestroyREAL8Window(window);
+	XLALClearREAL8WindowCache();
+
+	return fail;
+}
+
+
 /*
  * Display sample windows.
  */
@@ -525,6 +580,11 @@ int main(void)
 	if(test_parameter_safety())
 		fail = 1;
 
+	/* Test window cache */
+
+	if(test_cache())
+		fail = 1;
+
 	/* Verbosity */
 
 	display();
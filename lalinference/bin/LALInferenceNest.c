@@ -158,6 +158,8 @@ int main(int argc, char *argv[]){
   /* Call nested sampling algorithm */
   state->algorithm(state);
 
+  LALInferenceDestroyRelativeBinning(state);
+
   /* end */
   return(0);
 }
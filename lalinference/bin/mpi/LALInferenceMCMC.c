@@ -731,6 +731,8 @@ int main(int argc, char *argv[]){
     if (mpirank == 0) printf("sampling...\n");
     runState->algorithm(runState);
 
+    LALInferenceDestroyRelativeBinning(runState);
+
     if (mpirank == 0) printf(" ========== main(): finished. ==========\n");
     MPI_Finalize();
 
@@ -463,6 +463,8 @@ typedef struct tagLALInferenceModel
   struct tagLALInferenceROQModel *roq; /** ROQ data */
   int roq_flag;               /** Is ROQ enabled */
   LALSimNeutronStarFamily     *eos_fam; /** Neutron Star equation of state family */
+  struct tagLALInferenceRelBinModel *relbin; /** Relative binning data */
+  int relbin_flag;            /** Is relative binning enabled */
 
 } LALInferenceModel;
 
@@ -655,6 +657,7 @@ tagLALInferenceIFOData
   UINT4                     likeli_counter; /** counts how many time the likelihood has been calculated */
   UINT4                     templa_counter; /** counts how many time the template has been calculated */
   struct tagLALInferenceROQData *roq; /** ROQ data */
+  struct tagLALInferenceRelBinData *relbin; /** Relative binning summary data */
 
   struct tagLALInferenceIFOData      *next;     /** A pointer to the next set of data for linked list */
 } LALInferenceIFOData;
@@ -682,6 +685,39 @@ tagLALInferenceROQData
 
 } LALInferenceROQData;
 
+/**
+ * Structure to contain the per-detector summary data of the relative binning
+ * (heterodyned) likelihood. For each frequency bin \f$ b \f$ with lower edge
+ * \f$ f_b \f$, the sums run over the data frequencies \f$ f \f$ in the bin:
+ * - \f$ A_{0,b} = \sum 4\Delta f\, d(f) h_0^*(f) / S(f) \f$
+ * - \f$ A_{1,b} = \sum 4\Delta f\, d(f) h_0^*(f) (f - f_b) / S(f) \f$
+ * - \f$ B_{0,b} = \sum 4\Delta f\, |h_0(f)|^2 / S(f) \f$
+ * - \f$ B_{1,b} = \sum 4\Delta f\, |h_0(f)|^2 (f - f_b) / S(f) \f$
+ *
+ * where \f$ h_0 \f$ is the fiducial waveform projected onto the detector.
+ */
+typedef struct
+tagLALInferenceRelBinData
+{
+  COMPLEX16Sequence *A0;        /** summary data for <d|h>, zeroth order */
+  COMPLEX16Sequence *A1;        /** summary data for <d|h>, first order */
+  REAL8Sequence *B0;            /** summary data for <h|h>, zeroth order */
+  REAL8Sequence *B1;            /** summary data for <h|h>, first order */
+  COMPLEX16Sequence *h0;        /** fiducial waveform projected onto the detector, at the bin edges */
+} LALInferenceRelBinData;
+
+/**
+ * Structure to contain model-related relative binning quantities
+ */
+typedef struct
+tagLALInferenceRelBinModel
+{
+  REAL8Sequence *frequencyBinEdges;     /** bin edges [Hz], shared by all detectors */
+  COMPLEX16FrequencySeries *hptilde;    /** plus polarisation at the bin edges */
+  COMPLEX16FrequencySeries *hctilde;    /** cross polarisation at the bin edges */
+  COMPLEX16Sequence *calFactor;         /** spline calibration factor at the bin edges */
+} LALInferenceRelBinModel;
+
 /**
  *  *  * Structure to contain spline of ROQ weights as a function of tc
  *   *   */
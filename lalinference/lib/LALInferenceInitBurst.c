@@ -239,6 +239,8 @@ LALInferenceModel * LALInferenceInitBurstModel(LALInferenceRunState *state)
   LALInferenceModel *model = XLALMalloc(sizeof(LALInferenceModel));
   model->params = XLALCalloc(1, sizeof(LALInferenceVariables));
   memset(model->params, 0, sizeof(LALInferenceVariables));
+  model->relbin = NULL;
+  model->relbin_flag = 0;
   LALInferenceVariables *currentParams=model->params;
 
   UINT4 signal_flag=1;
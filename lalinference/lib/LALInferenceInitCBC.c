@@ -244,6 +244,12 @@ void LALInferenceInitCBCThreads(LALInferenceRunState *run_state, INT4 nthreads)
       thread->model->roq_flag=0;
     }
 
+    /* Setup relative binning; the bins and summary data are filled in by LALInferenceInitLikelihood() */
+    if (LALInferenceGetProcParamVal(commandLine, "--relative-binning")){
+      thread->model->relbin = XLALCalloc(1, sizeof(LALInferenceRelBinModel));
+      thread->model->relbin_flag = 1;
+    }
+
     LALInferenceCopyVariables(thread->model->params, thread->currentParams);
     LALInferenceCopyVariables(run_state->proposalArgs, thread->proposalArgs);
 
@@ -302,6 +308,10 @@ LALInferenceTemplateFunction LALInferenceInitCBCTemplate(LALInferenceRunState *r
   templt=&LALInferenceROQWrapperForXLALSimInspiralChooseFDWaveformSequence;
         fprintf(stderr, "template is \"LALInferenceROQWrapperForXLALSimInspiralChooseFDWaveformSequence\"\n");
   }
+  else if(LALInferenceGetProcParamVal(commandLine,"--relative-binning")){
+    templt=&LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence;
+    fprintf(stderr, "template is \"LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence\"\n");
+  }
   else {
     fprintf(stdout,"Template function called is \"LALInferenceTemplateXLALSimInspiralChooseWaveform\"\n");
   }
@@ -951,6 +961,8 @@ LALInferenceModel *LALInferenceInitCBCModel(LALInferenceRunState *state) {
   model->params = XLALCalloc(1, sizeof(LALInferenceVariables));
   memset(model->params, 0, sizeof(LALInferenceVariables));
   model->eos_fam = NULL;
+  model->relbin = NULL;
+  model->relbin_flag = 0;
 
   UINT4 signal_flag=1;
   ppt = LALInferenceGetProcParamVal(commandLine, "--noiseonly");
@@ -33,6 +33,10 @@
 #include <lal/FrequencySeries.h>
 #include <lal/TimeFreqFFT.h>
 #include <lal/LALInferenceDistanceMarg.h>
+#include <lal/LALInstrument.h>
+#include <lal/LALInferenceReadData.h>
+#include <lal/LIGOLwXMLRead.h>
+#include <lal/LIGOMetadataUtils.h>
 
 #include <gsl/gsl_sf_bessel.h>
 #include <gsl/gsl_sf_dawson.h>
@@ -73,6 +77,9 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
 static double integrate_interpolated_log(double h, REAL8 *log_ys, size_t n, double *imean, size_t *imax);
 
 static int get_calib_spline(LALInferenceVariables *vars, const char *ifoname, REAL8Vector **logfreqs, REAL8Vector **amps, REAL8Vector **phases);
+static REAL8 relbin_phase_bound(REAL8 f, REAL8 fmin, REAL8 fmax);
+static void relbin_inner_products(LALInferenceModel *model, LALInferenceIFOData *dataPtr, UINT4 spcal_active, COMPLEX16 *d_inner_h, REAL8 *h_inner_h);
+static int relbin_set_fiducial(LALInferenceVariables *fiducial, LALInferenceVariables *given, const char *list);
 static int get_calib_spline(LALInferenceVariables *vars, const char *ifoname, REAL8Vector **logfreqs, REAL8Vector **amps, REAL8Vector **phases)
 {
   UINT4 npts = LALInferenceGetUINT4Variable(vars, "spcal_npts");
@@ -116,6 +123,10 @@ void LALInferenceInitLikelihood(LALInferenceRunState *runState)
     (--margtimephi)                  Using marginalised in time and phase likelihood\n\
     (--margdist)                     Using marginalisation in distance with d^2 prior (compatible with --margphi and --margtimephi)\n\
     (--margdist-comoving)            Using marginalisation in distance with uniform-in-comoving-volume prior (compatible with --margphi and --margtimephi)\n\
+    (--relative-binning)             Use the relative binning (heterodyned) likelihood; every varying parameter of the fiducial\n\
+                                     waveform must be given by --inj, --relative-binning-fiducial or its initial value (--NAME)\n\
+    (--relative-binning-epsilon EPS) Maximum phase variation across a relative binning bin (default 0.5)\n\
+    (--relative-binning-fiducial name=value[,name=value...]) Fiducial values of the given parameters, instead of the initial ones\n\
     \n";
 
     /* Print command line arguments if help requested */
@@ -176,6 +187,10 @@ void LALInferenceInitLikelihood(LALInferenceRunState *runState)
      else if (LALInferenceGetProcParamVal(commandLine, "--roqtime_steps")) {
      fprintf(stderr, "Using ROQ in likelihood.\n");
      runState->likelihood=&LALInferenceUndecomposedFreqDomainLogLikelihood;
+    }
+     else if (LALInferenceGetProcParamVal(commandLine, "--relative-binning")) {
+     fprintf(stderr, "Using relative binning in likelihood.\n");
+     runState->likelihood=&LALInferenceUndecomposedFreqDomainLogLikelihood;
     }
      else if (LALInferenceGetProcParamVal(commandLine, "--fastSineGaussianLikelihood")){
       fprintf(stderr, "WARNING: Using Fast SineGaussian likelihood and WF for LIB.\n");
@@ -184,6 +199,12 @@ void LALInferenceInitLikelihood(LALInferenceRunState *runState)
       runState->likelihood=&LALInferenceUndecomposedFreqDomainLogLikelihood;
    }
 
+   /* Set up the bins and summary data around the fiducial waveform */
+   if (thread->model->relbin_flag && LALInferenceSetupRelativeBinning(runState) != XLAL_SUCCESS) {
+     fprintf(stderr, "Failed to set up relative binning.\n");
+     exit(1);
+   }
+
    /* Try to determine a model-less likelihood, if such a thing makes sense */
    if (runState->likelihood==&LALInferenceUndecomposedFreqDomainLogLikelihood || runState->likelihood==&LALInferenceMarginalisedPhaseLogLikelihood ){
 
@@ -314,10 +335,11 @@ REAL8 LALInferenceUndecomposedFreqDomainLogLikelihood(LALInferenceVariables *cur
                                                       LALInferenceIFOData *data,
                                                       LALInferenceModel *model)
 {
-  return LALInferenceFusedFreqDomainLogLikelihood(currentParams,
-                                                 data,
-                                                 model,
-                                                  GAUSSIAN);
+  REAL8 loglikelihood;
+  XLAL_INSTRUMENT_START(__func__);
+  loglikelihood = LALInferenceFusedFreqDomainLogLikelihood(currentParams, data, model, GAUSSIAN);
+  XLAL_INSTRUMENT_STOP(__func__);
+  return loglikelihood;
 }
 
 
@@ -401,6 +423,10 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
     fprintf(stderr,"ERROR: cannot use ROQ likelihood and constant calibration error marginalization together. Exiting...\n");
     exit(1);
   }
+  if (model->relbin_flag && constantcal_active){
+    fprintf(stderr,"ERROR: cannot use relative binning likelihood and constant calibration error marginalization together. Exiting...\n");
+    exit(1);
+  }
 
   REAL8 degreesOfFreedom=2.0;
   REAL8 chisq=0.0;
@@ -417,6 +443,7 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
     margtime=1;
 
   if(model->roq_flag && margtime) XLAL_ERROR_REAL8(XLAL_EINVAL,"ROQ does not support time marginalisation");
+  if(model->relbin_flag && margtime) XLAL_ERROR_REAL8(XLAL_EINVAL,"Relative binning does not support time marginalisation");
 
   
   LALStatus status;
@@ -659,6 +686,12 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
                 if ( model->roq->hptildeQuadratic ) XLALDestroyCOMPLEX16FrequencySeries(model->roq->hptildeQuadratic);
                 if ( model->roq->hctildeQuadratic ) XLALDestroyCOMPLEX16FrequencySeries(model->roq->hctildeQuadratic);
               }
+              if(model->relbin_flag)
+              {
+                if ( model->relbin->hptilde ) XLALDestroyCOMPLEX16FrequencySeries(model->relbin->hptilde);
+                if ( model->relbin->hctilde ) XLALDestroyCOMPLEX16FrequencySeries(model->relbin->hctilde);
+                model->relbin->hptilde = model->relbin->hctilde = NULL;
+              }
               return (-INFINITY);
               break;
             default: /* Panic! */
@@ -694,6 +727,13 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
 						model->roq->frequencyNodesQuadratic,
 						&(model->roq->calFactorQuadratic));
 	  }
+	  else if (model->relbin_flag) {
+             LALInferenceSplineCalibrationFactorROQ(logfreqs, amps, phases,
+						model->relbin->frequencyBinEdges,
+						&(model->relbin->calFactor),
+						model->relbin->frequencyBinEdges,
+						&(model->relbin->calFactor));
+	  }
 
 	  else{
 	    if (calFactor == NULL) {
@@ -796,11 +836,16 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
       }
     }
 
-    if (model->roq_flag) {
+    if (model->roq_flag || model->relbin_flag) {
 
 	double complex weight_iii;
 
-	if (spcal_active){
+	if (model->relbin_flag){
+
+		relbin_inner_products(model, dataPtr, spcal_active, &this_ifo_d_inner_h, &this_ifo_s);
+	}
+
+	else if (spcal_active){
 
 	    for(unsigned int iii=0; iii < model->roq->frequencyNodesLinear->length; iii++){
 
@@ -1097,7 +1142,7 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
   } /* end loop over detectors */
 
   }
-  if (model->roq_flag){
+  if (model->roq_flag || model->relbin_flag){
 
 
 
@@ -1109,12 +1154,19 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
 
 	model->SNR = OptimalSNR;
 
+	if (model->relbin_flag) {
+	  if ( model->relbin->hptilde ) XLALDestroyCOMPLEX16FrequencySeries(model->relbin->hptilde);
+	  if ( model->relbin->hctilde ) XLALDestroyCOMPLEX16FrequencySeries(model->relbin->hctilde);
+	  model->relbin->hptilde = model->relbin->hctilde = NULL;
+	}
+	else {
 	if ( model->roq->hptildeLinear ) XLALDestroyCOMPLEX16FrequencySeries(model->roq->hptildeLinear);
   	if ( model->roq->hctildeLinear ) XLALDestroyCOMPLEX16FrequencySeries(model->roq->hctildeLinear);
   	if ( model->roq->hptildeQuadratic ) XLALDestroyCOMPLEX16FrequencySeries(model->roq->hptildeQuadratic);
   	if ( model->roq->hctildeQuadratic ) XLALDestroyCOMPLEX16FrequencySeries(model->roq->hctildeQuadratic);
+	}
 
- 	if(LALInferenceCheckVariable(model->params, "tilt_spin1")){
+ 	if(model->roq_flag && LALInferenceCheckVariable(model->params, "tilt_spin1")){
 		mc  = *(REAL8*) LALInferenceGetVariable(model->params, "chirpmass");
         	REAL8 eta=0;
         	REAL8 m1=0;
@@ -1575,7 +1627,11 @@ REAL8 LALInferenceMarginalisedPhaseLogLikelihood(LALInferenceVariables *currentP
 /*   - "time"            (REAL8, GPS sec.)                     */
 /***************************************************************/
 {
-  return LALInferenceFusedFreqDomainLogLikelihood(currentParams, data, model, MARGPHI);
+  REAL8 loglikelihood;
+  XLAL_INSTRUMENT_START(__func__);
+  loglikelihood = LALInferenceFusedFreqDomainLogLikelihood(currentParams, data, model, MARGPHI);
+  XLAL_INSTRUMENT_STOP(__func__);
+  return loglikelihood;
 }
 
 /** Integrate interpolated log, returns the mean index in *imax if it
@@ -1634,20 +1690,22 @@ REAL8 LALInferenceMarginalisedTimeLogLikelihood(LALInferenceVariables *currentPa
                                                 LALInferenceIFOData *data,
                                                 LALInferenceModel *model)
 {
-
-  return ( LALInferenceFusedFreqDomainLogLikelihood(currentParams,data,model,MARGTIME));
-
-
+  REAL8 loglikelihood;
+  XLAL_INSTRUMENT_START(__func__);
+  loglikelihood = LALInferenceFusedFreqDomainLogLikelihood(currentParams, data, model, MARGTIME);
+  XLAL_INSTRUMENT_STOP(__func__);
+  return loglikelihood;
 }
 
 REAL8 LALInferenceMarginalisedTimePhaseLogLikelihood(LALInferenceVariables *currentParams,
                                                 LALInferenceIFOData *data,
                                                 LALInferenceModel *model)
 {
-
-  return ( LALInferenceFusedFreqDomainLogLikelihood(currentParams,data,model,MARGTIMEPHI));
-
-
+  REAL8 loglikelihood;
+  XLAL_INSTRUMENT_START(__func__);
+  loglikelihood = LALInferenceFusedFreqDomainLogLikelihood(currentParams, data, model, MARGTIMEPHI);
+  XLAL_INSTRUMENT_STOP(__func__);
+  return loglikelihood;
 }
 
 REAL8 LALInferenceFastSineGaussianLogLikelihood(LALInferenceVariables *currentParams,
@@ -2062,3 +2120,350 @@ void LALInferenceNetworkSNR(LALInferenceVariables *currentParams,
 
   model->SNR = sqrt(model->SNR);
 }
+
+/* Bound on the phase variation of the waveform relative to the fiducial    */
+/* one, Eq. (10) of Zackay, Dai & Venumadhav, arXiv:1806.08792.             */
+static REAL8 relbin_phase_bound(REAL8 f, REAL8 fmin, REAL8 fmax)
+{
+  const REAL8 gammas[] = {-5.0/3.0, -2.0/3.0, 1.0, 5.0/3.0, 7.0/3.0};
+  REAL8 psi = 0.0;
+  for (UINT4 i = 0; i < sizeof(gammas)/sizeof(gammas[0]); i++) {
+    if (gammas[i] < 0.0)
+      psi -= pow(f / fmin, gammas[i]);
+    else
+      psi += pow(f / fmax, gammas[i]);
+  }
+  return LAL_TWOPI * psi;
+}
+
+/* Relative binning approximation to <d|h> and <h|h> for one detector, from */
+/* the waveform at the bin edges (already in model->relbin) and the summary */
+/* data. The ratio h/h0 is interpolated linearly across each bin.           */
+static void relbin_inner_products(LALInferenceModel *model, LALInferenceIFOData *dataPtr, UINT4 spcal_active, COMPLEX16 *d_inner_h, REAL8 *h_inner_h)
+{
+  const REAL8Sequence *edges = model->relbin->frequencyBinEdges;
+  const LALInferenceRelBinData *summary = dataPtr->relbin;
+  const UINT4 nedges = edges->length;
+  COMPLEX16 ratio[nedges];
+
+  for (UINT4 e = 0; e < nedges; e++) {
+    COMPLEX16 h0 = summary->h0->data[e];
+    COMPLEX16 h = (dataPtr->fPlus*model->relbin->hptilde->data->data[e] + dataPtr->fCross*model->relbin->hctilde->data->data[e])
+                  * cexp(-I*LAL_TWOPI*edges->data[e]*dataPtr->timeshift);
+    if (spcal_active)
+      h *= model->relbin->calFactor->data[e];
+    ratio[e] = (h0 != 0.0) ? h / h0 : 0.0;
+  }
+
+  COMPLEX16 dh = 0.0;
+  REAL8 hh = 0.0;
+  for (UINT4 b = 0; b + 1 < nedges; b++) {
+    COMPLEX16 r0 = ratio[b];
+    COMPLEX16 r1 = (ratio[b+1] - ratio[b]) / (edges->data[b+1] - edges->data[b]);
+    dh += summary->A0->data[b]*conj(r0) + summary->A1->data[b]*conj(r1);
+    hh += summary->B0->data[b]*creal(r0*conj(r0)) + 2.0*summary->B1->data[b]*creal(r0*conj(r1));
+  }
+
+  *d_inner_h = dh;
+  *h_inner_h = hh;
+}
+
+/* Override the fiducial parameters with the name=value pairs given in */
+/* --relative-binning-fiducial, and record their names in 'given'      */
+static int relbin_set_fiducial(LALInferenceVariables *fiducial, LALInferenceVariables *given, const char *list)
+{
+  char *tmp = XLALStringDuplicate(list);
+  XLAL_CHECK(tmp != NULL, XLAL_ENOMEM);
+  char *end_str = NULL;
+  for (char *item = strtok_r(tmp, ",", &end_str); item; item = strtok_r(NULL, ",", &end_str)) {
+    char *eq = strchr(item, '=');
+    if (eq == NULL || eq == item) {
+      XLALFree(tmp);
+      XLAL_ERROR(XLAL_EINVAL, "Invalid --relative-binning-fiducial entry '%s', expected name=value", item);
+    }
+    *eq = '\0';
+    if (!LALInferenceCheckVariable(fiducial, item) || LALInferenceGetVariableType(fiducial, item) != LALINFERENCE_REAL8_t) {
+      XLALFree(tmp);
+      XLAL_ERROR(XLAL_EINVAL, "--relative-binning-fiducial: '%s' is not a REAL8 parameter of the model", item);
+    }
+    char *end_val = NULL;
+    REAL8 value = strtod(eq + 1, &end_val);
+    if (end_val == eq + 1 || *end_val != '\0') {
+      XLALFree(tmp);
+      XLAL_ERROR(XLAL_EINVAL, "--relative-binning-fiducial: invalid value '%s' for '%s'", eq + 1, item);
+    }
+    LALInferenceSetVariable(fiducial, item, &value);
+    LALInferenceAddINT4Variable(given, item, 1, LALINFERENCE_PARAM_OUTPUT);
+  }
+  XLALFree(tmp);
+  return XLAL_SUCCESS;
+}
+
+/* Set the fiducial parameters to the values of the injection given by */
+/* --inj and --event, and record their names in 'given'                */
+static int relbin_set_fiducial_injection(LALInferenceVariables *fiducial, LALInferenceVariables *given, ProcessParamsTable *commandLine)
+{
+  ProcessParamsTable *ppt = LALInferenceGetProcParamVal(commandLine, "--inj");
+  SimInspiralTable *injTable = NULL, *injEvent = NULL;
+  LALInferenceVariables injParams;
+  int event = 0;
+
+  if (ppt == NULL)
+    return XLAL_SUCCESS;
+  injTable = XLALSimInspiralTableFromLIGOLw(ppt->value);
+  XLAL_CHECK(injTable != NULL, XLAL_EFUNC, "Unable to read injection file %s", ppt->value);
+  ppt = LALInferenceGetProcParamVal(commandLine, "--event");
+  if (ppt)
+    event = atoi(ppt->value);
+  for (injEvent = injTable; injEvent && event > 0; event--)
+    injEvent = injEvent->next;
+  if (injEvent == NULL) {
+    XLALDestroySimInspiralTable(injTable);
+    XLAL_ERROR(XLAL_EINVAL, "Injection event not found for relative binning fiducial");
+  }
+
+  memset(&injParams, 0, sizeof(injParams));
+  LALInferenceInjectionToVariables(injEvent, &injParams);
+  XLALDestroySimInspiralTable(injTable);
+  for (LALInferenceVariableItem *item = injParams.head; item; item = item->next) {
+    if (item->type != LALINFERENCE_REAL8_t || !LALInferenceCheckVariable(fiducial, item->name) ||
+        LALInferenceGetVariableType(fiducial, item->name) != LALINFERENCE_REAL8_t)
+      continue;
+    LALInferenceSetVariable(fiducial, item->name, item->value);
+    LALInferenceAddINT4Variable(given, item->name, 1, LALINFERENCE_PARAM_OUTPUT);
+  }
+  LALInferenceClearVariables(&injParams);
+  return XLAL_SUCCESS;
+}
+
+int LALInferenceSetupRelativeBinning(LALInferenceRunState *runState)
+{
+  ProcessParamsTable *ppt = NULL;
+  ProcessParamsTable *commandLine = runState->commandLine;
+  LALInferenceThreadState *thread = &(runState->threads[0]);
+  LALInferenceModel *model = thread->model;
+  LALInferenceIFOData *dataPtr = NULL;
+  LALInferenceVariables fiducial;
+  LALInferenceVariables given; /* names of parameters with a given fiducial value */
+  UINT4 *edge_idx = NULL;
+  REAL8Sequence *grid = NULL;
+  INT4 errnum = 0;
+
+  memset(&fiducial, 0, sizeof(fiducial));
+  memset(&given, 0, sizeof(given));
+
+  REAL8 epsilon = 0.5;
+  ppt = LALInferenceGetProcParamVal(commandLine, "--relative-binning-epsilon");
+  if (ppt)
+    epsilon = atof(ppt->value);
+  if (!(epsilon > 0.0))
+    XLAL_ERROR(XLAL_EINVAL, "--relative-binning-epsilon must be positive");
+
+  if (LALInferenceGetProcParamVal(commandLine, "--psdFit") || LALInferenceGetProcParamVal(commandLine, "--psd-fit") ||
+      LALInferenceGetProcParamVal(commandLine, "--glitchFit") || LALInferenceGetProcParamVal(commandLine, "--glitch-fit"))
+    XLAL_ERROR(XLAL_EINVAL, "Relative binning does not support PSD or glitch fitting");
+
+  /* Common frequency grid: the union of the detectors' analysis bands */
+  REAL8 deltaF = 1.0 / (((double)runState->data->timeData->data->length) * runState->data->timeData->deltaT);
+  UINT4 lower = UINT_MAX, upper = 0;
+  for (dataPtr = runState->data; dataPtr; dataPtr = dataPtr->next) {
+    REAL8 ifo_deltaF = 1.0 / (((double)dataPtr->timeData->data->length) * dataPtr->timeData->deltaT);
+    if (fabs(ifo_deltaF - deltaF) > 1e-9 * deltaF)
+      XLAL_ERROR(XLAL_EINVAL, "Relative binning requires the same frequency resolution in all detectors");
+    UINT4 ifo_lower = (UINT4)ceil(dataPtr->fLow / deltaF);
+    UINT4 ifo_upper = (UINT4)floor(dataPtr->fHigh / deltaF);
+    if (ifo_lower < lower) lower = ifo_lower;
+    if (ifo_upper > upper) upper = ifo_upper;
+  }
+  if (lower == 0 || upper <= lower)
+    XLAL_ERROR(XLAL_EINVAL, "Invalid frequency range [%g, %g] Hz for relative binning", lower*deltaF, upper*deltaF);
+
+  /* Fiducial parameters: the initial parameters of the first thread,  */
+  /* overridden with the injection and --relative-binning-fiducial.    */
+  /* Relative binning is only accurate near the fiducial point, so a   */
+  /* varying parameter must not keep a value drawn from the prior      */
+  LALInferenceCopyVariables(thread->currentParams, &fiducial);
+  XLAL_CHECK_FAIL(relbin_set_fiducial_injection(&fiducial, &given, commandLine) == XLAL_SUCCESS, XLAL_EFUNC);
+  ppt = LALInferenceGetProcParamVal(commandLine, "--relative-binning-fiducial");
+  if (ppt)
+    XLAL_CHECK_FAIL(relbin_set_fiducial(&fiducial, &given, ppt->value) == XLAL_SUCCESS, XLAL_EFUNC);
+  for (LALInferenceVariableItem *item = fiducial.head; item; item = item->next) {
+    char valopt[VARNAME_MAX + 3];
+    if (item->type != LALINFERENCE_REAL8_t || (item->vary != LALINFERENCE_PARAM_LINEAR && item->vary != LALINFERENCE_PARAM_CIRCULAR))
+      continue;
+    if (LALInferenceCheckVariable(&given, item->name))
+      continue;
+    snprintf(valopt, sizeof(valopt), "--%s", item->name);
+    if (!LALInferenceGetProcParamVal(commandLine, valopt))
+      XLAL_ERROR_FAIL(XLAL_EINVAL, "Relative binning needs a fiducial value of '%s': give an injection, --relative-binning-fiducial or %s", item->name, valopt);
+  }
+
+  /* Place the bin edges on the data frequencies, so that the phase bound */
+  /* changes by at most epsilon across each bin                           */
+  REAL8 fmin = lower * deltaF, fmax = upper * deltaF;
+  edge_idx = XLALMalloc((upper - lower + 1) * sizeof(*edge_idx));
+  XLAL_CHECK_FAIL(edge_idx != NULL, XLAL_ENOMEM);
+  UINT4 nedges = 0;
+  edge_idx[nedges++] = lower;
+  REAL8 psi_next = relbin_phase_bound(fmin, fmin, fmax) + epsilon;
+  for (UINT4 k = lower + 1; k < upper; k++) {
+    REAL8 psi = relbin_phase_bound(k * deltaF, fmin, fmax);
+    if (psi >= psi_next) {
+      edge_idx[nedges++] = k;
+      psi_next = psi + epsilon;
+    }
+  }
+  edge_idx[nedges++] = upper;
+
+  /* Generate the fiducial waveform on the full frequency grid */
+  grid = XLALCreateREAL8Sequence(upper - lower + 1);
+  XLAL_CHECK_FAIL(grid != NULL, XLAL_EFUNC);
+  for (UINT4 k = lower; k <= upper; k++)
+    grid->data[k - lower] = k * deltaF;
+
+  model->relbin->frequencyBinEdges = grid;
+  LALInferenceCopyVariables(&fiducial, model->params);
+  XLAL_TRY(model->templt(model), errnum);
+  model->relbin->frequencyBinEdges = NULL;
+  if (errnum != XLAL_SUCCESS || model->relbin->hptilde == NULL || model->relbin->hctilde == NULL)
+    XLAL_ERROR_FAIL(XLAL_EFUNC, "Failed to generate the fiducial waveform for relative binning");
+
+  /* Fiducial sky location, polarisation and arrival time */
+  REAL8 ra, dec, tc;
+  INT4 SKY_FRAME = 0;
+  if (LALInferenceCheckVariable(&fiducial, "SKY_FRAME"))
+    SKY_FRAME = *(INT4 *)LALInferenceGetVariable(&fiducial, "SKY_FRAME");
+  if (SKY_FRAME == 1) {
+    REAL8 t0 = LALInferenceGetREAL8Variable(&fiducial, "t0");
+    REAL8 alph = acos(LALInferenceGetREAL8Variable(&fiducial, "cosalpha"));
+    REAL8 theta = LALInferenceGetREAL8Variable(&fiducial, "azimuth");
+    LALInferenceDetFrameToEquatorial(runState->data->detector, runState->data->next->detector,
+                                     t0, alph, theta, &tc, &ra, &dec);
+  } else {
+    ra = LALInferenceGetREAL8Variable(&fiducial, "rightascension");
+    dec = LALInferenceGetREAL8Variable(&fiducial, "declination");
+    tc = LALInferenceGetREAL8Variable(&fiducial, "time");
+  }
+  REAL8 psi = LALInferenceGetREAL8Variable(&fiducial, "polarisation");
+  REAL8 model_time = LALInferenceGetREAL8Variable(model->params, "time");
+  LIGOTimeGPS GPSlal;
+  XLALGPSSetREAL8(&GPSlal, tc);
+  REAL8 gmst = XLALGreenwichMeanSiderealTime(&GPSlal);
+
+  /* Summary data for each detector */
+  for (dataPtr = runState->data; dataPtr; dataPtr = dataPtr->next) {
+    double Fplus, Fcross;
+    XLALComputeDetAMResponse(&Fplus, &Fcross, (const REAL4(*)[3])dataPtr->detector->response, ra, dec, psi, gmst);
+    REAL8 timeshift = (tc - model_time) + XLALTimeDelayFromEarthCenter(dataPtr->detector->location, ra, dec, &GPSlal);
+    UINT4 ifo_lower = (UINT4)ceil(dataPtr->fLow / deltaF);
+    UINT4 ifo_upper = (UINT4)floor(dataPtr->fHigh / deltaF);
+
+    LALInferenceRelBinData *summary = XLALCalloc(1, sizeof(*summary));
+    XLAL_CHECK_FAIL(summary != NULL, XLAL_ENOMEM);
+    dataPtr->relbin = summary;
+    summary->A0 = XLALCreateCOMPLEX16Sequence(nedges - 1);
+    summary->A1 = XLALCreateCOMPLEX16Sequence(nedges - 1);
+    summary->B0 = XLALCreateREAL8Sequence(nedges - 1);
+    summary->B1 = XLALCreateREAL8Sequence(nedges - 1);
+    summary->h0 = XLALCreateCOMPLEX16Sequence(nedges);
+    XLAL_CHECK_FAIL(summary->A0 && summary->A1 && summary->B0 && summary->B1 && summary->h0, XLAL_ENOMEM);
+
+    for (UINT4 e = 0; e < nedges; e++) {
+      UINT4 k = edge_idx[e];
+      summary->h0->data[e] = (Fplus*model->relbin->hptilde->data->data[k - lower] + Fcross*model->relbin->hctilde->data->data[k - lower])
+                             * cexp(-I*LAL_TWOPI*k*deltaF*timeshift);
+    }
+
+    for (UINT4 b = 0; b + 1 < nedges; b++) {
+      REAL8 fb = edge_idx[b] * deltaF;
+      /* The last bin also includes its upper edge */
+      UINT4 kstart = edge_idx[b] > ifo_lower ? edge_idx[b] : ifo_lower;
+      UINT4 kend = (b + 2 == nedges) ? edge_idx[b+1] : edge_idx[b+1] - 1;
+      if (kend > ifo_upper) kend = ifo_upper;
+      COMPLEX16 A0 = 0.0, A1 = 0.0;
+      REAL8 B0 = 0.0, B1 = 0.0;
+      for (UINT4 k = kstart; k <= kend; k++) {
+        REAL8 f = k * deltaF;
+        COMPLEX16 h0 = (Fplus*model->relbin->hptilde->data->data[k - lower] + Fcross*model->relbin->hctilde->data->data[k - lower])
+                       * cexp(-I*LAL_TWOPI*f*timeshift);
+        REAL8 weight = 4.0 * deltaF / dataPtr->oneSidedNoisePowerSpectrum->data->data[k];
+        COMPLEX16 dh0 = weight * dataPtr->freqData->data->data[k] * conj(h0);
+        REAL8 h0h0 = weight * creal(h0*conj(h0));
+        A0 += dh0;
+        A1 += dh0 * (f - fb);
+        B0 += h0h0;
+        B1 += h0h0 * (f - fb);
+      }
+      summary->A0->data[b] = A0;
+      summary->A1->data[b] = A1;
+      summary->B0->data[b] = B0;
+      summary->B1->data[b] = B1;
+    }
+  }
+
+  XLALDestroyCOMPLEX16FrequencySeries(model->relbin->hptilde);
+  XLALDestroyCOMPLEX16FrequencySeries(model->relbin->hctilde);
+  model->relbin->hptilde = model->relbin->hctilde = NULL;
+  XLALDestroyREAL8Sequence(grid);
+  grid = NULL;
+
+  /* Give each thread its own copy of the bin edges */
+  for (INT4 t = 0; t < runState->nthreads; t++) {
+    LALInferenceModel *tmodel = runState->threads[t].model;
+    tmodel->relbin->frequencyBinEdges = XLALCreateREAL8Sequence(nedges);
+    tmodel->relbin->calFactor = XLALCreateCOMPLEX16Sequence(nedges);
+    XLAL_CHECK_FAIL(tmodel->relbin->frequencyBinEdges && tmodel->relbin->calFactor, XLAL_ENOMEM);
+    for (UINT4 e = 0; e < nedges; e++)
+      tmodel->relbin->frequencyBinEdges->data[e] = edge_idx[e] * deltaF;
+  }
+
+  fprintf(stdout, "Relative binning: %u bins between %g and %g Hz (epsilon = %g)\n", nedges - 1, fmin, fmax, epsilon);
+
+  XLALFree(edge_idx);
+  LALInferenceClearVariables(&fiducial);
+  LALInferenceClearVariables(&given);
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  XLALDestroyCOMPLEX16FrequencySeries(model->relbin->hptilde);
+  XLALDestroyCOMPLEX16FrequencySeries(model->relbin->hctilde);
+  model->relbin->hptilde = model->relbin->hctilde = NULL;
+  XLALDestroyREAL8Sequence(grid);
+  XLALFree(edge_idx);
+  LALInferenceClearVariables(&fiducial);
+  LALInferenceClearVariables(&given);
+  LALInferenceDestroyRelativeBinning(runState);
+  return XLAL_FAILURE;
+}
+
+void LALInferenceDestroyRelativeBinning(LALInferenceRunState *runState)
+{
+  if (runState == NULL)
+    return;
+
+  for (LALInferenceIFOData *dataPtr = runState->data; dataPtr; dataPtr = dataPtr->next) {
+    LALInferenceRelBinData *summary = dataPtr->relbin;
+    if (summary == NULL)
+      continue;
+    XLALDestroyCOMPLEX16Sequence(summary->A0);
+    XLALDestroyCOMPLEX16Sequence(summary->A1);
+    XLALDestroyREAL8Sequence(summary->B0);
+    XLALDestroyREAL8Sequence(summary->B1);
+    XLALDestroyCOMPLEX16Sequence(summary->h0);
+    XLALFree(summary);
+    dataPtr->relbin = NULL;
+  }
+
+  for (INT4 t = 0; t < runState->nthreads; t++) {
+    LALInferenceModel *tmodel = runState->threads[t].model;
+    if (tmodel == NULL || tmodel->relbin == NULL)
+      continue;
+    XLALDestroyREAL8Sequence(tmodel->relbin->frequencyBinEdges);
+    XLALDestroyCOMPLEX16Sequence(tmodel->relbin->calFactor);
+    XLALDestroyCOMPLEX16FrequencySeries(tmodel->relbin->hptilde);
+    XLALDestroyCOMPLEX16FrequencySeries(tmodel->relbin->hctilde);
+    tmodel->relbin->frequencyBinEdges = NULL;
+    tmodel->relbin->calFactor = NULL;
+    tmodel->relbin->hptilde = tmodel->relbin->hctilde = NULL;
+  }
+}
@@ -125,6 +125,31 @@ COMPLEX16 LALInferenceComputeFrequencyDomainComplexOverlap(LALInferenceIFOData *
  */
 REAL8 LALInferenceNullLogLikelihood(LALInferenceIFOData *data);
 
+/**
+ * Set up the relative binning (heterodyned) likelihood (Zackay, Dai & Venumadhav,
+ * arXiv:1806.08792), enabled with --relative-binning.
+ *
+ * The fiducial waveform is generated on the full frequency grid at the current parameters
+ * of the first thread, overridden by the injection given with --inj and then by any values
+ * given as name=value pairs in --relative-binning-fiducial. Each varying parameter must
+ * get its fiducial value from one of these or from an initial value given on the command
+ * line, since a value drawn from the prior would bias the likelihood; otherwise
+ * XLAL_EINVAL is returned. Bin edges are placed on the data
+ * frequencies so that the maximum phase variation across a bin is at most
+ * --relative-binning-epsilon, and the per-detector summary data are stored in the relbin
+ * member of each LALInferenceIFOData. The likelihood then only needs the waveform at the
+ * bin edges.
+ *
+ * Returns XLAL_SUCCESS, or XLAL_FAILURE with nothing allocated on error.
+ */
+int LALInferenceSetupRelativeBinning(LALInferenceRunState *runState);
+
+/**
+ * Free the relative binning summary data of each detector and the bin edges of each
+ * thread, allocated by LALInferenceSetupRelativeBinning().
+ */
+void LALInferenceDestroyRelativeBinning(LALInferenceRunState *runState);
+
 /***********************************************************//**
  * Student-t (log-) likelihood function                        
  * as described in Roever/Meyer/Christensen (2011):            
@@ -231,15 +231,41 @@ static void q2masses(double mc, double q, double *m1, double *m2)
   return;
 }
 
+/* Generate h+ and hx at the frequencies nodes1 (and at nodes2, if not NULL) */
+/* for the parameters in model->params, using                               */
+/* XLALSimInspiralChooseFDWaveformSequence().                               */
+static void LALInferenceFDWaveformSequences(LALInferenceModel *model,
+                                            REAL8Sequence *nodes1, COMPLEX16FrequencySeries **hptilde1, COMPLEX16FrequencySeries **hctilde1,
+                                            REAL8Sequence *nodes2, COMPLEX16FrequencySeries **hptilde2, COMPLEX16FrequencySeries **hctilde2);
+
 void LALInferenceROQWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferenceModel *model){
 /*************************************************************************************************************************/
+  model->roq->hptildeLinear=NULL, model->roq->hctildeLinear=NULL;
+  model->roq->hptildeQuadratic=NULL, model->roq->hctildeQuadratic=NULL;
+
+  LALInferenceFDWaveformSequences(model,
+                                  model->roq->frequencyNodesLinear, &(model->roq->hptildeLinear), &(model->roq->hctildeLinear),
+                                  model->roq->frequencyNodesQuadratic, &(model->roq->hptildeQuadratic), &(model->roq->hctildeQuadratic));
+}
+
+void LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferenceModel *model){
+/*************************************************************************************************************************/
+  model->relbin->hptilde=NULL, model->relbin->hctilde=NULL;
+
+  LALInferenceFDWaveformSequences(model,
+                                  model->relbin->frequencyBinEdges, &(model->relbin->hptilde), &(model->relbin->hctilde),
+                                  NULL, NULL, NULL);
+}
+
+static void LALInferenceFDWaveformSequences(LALInferenceModel *model,
+                                            REAL8Sequence *nodes1, COMPLEX16FrequencySeries **hptilde1, COMPLEX16FrequencySeries **hctilde1,
+                                            REAL8Sequence *nodes2, COMPLEX16FrequencySeries **hptilde2, COMPLEX16FrequencySeries **hctilde2)
+{
   Approximant approximant = (Approximant) 0;
 
   int ret=0;
   INT4 errnum=0;
 
-  model->roq->hptildeLinear=NULL, model->roq->hctildeLinear=NULL;
-  model->roq->hptildeQuadratic=NULL, model->roq->hctildeQuadratic=NULL;
   REAL8 mc;
   REAL8 phi0, m1, m2, distance, inclination;
 
@@ -476,11 +502,12 @@ void LALInferenceROQWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferen
   /* ==== Call the waveform generator ==== */
     /* Correct distance to account for renormalisation of data due to window RMS */
     double corrected_distance = distance * sqrt(model->window->sumofsquares/model->window->data->length);
-    XLAL_TRY(ret=XLALSimInspiralChooseFDWaveformSequence (&(model->roq->hptildeLinear), &(model->roq->hctildeLinear), phi0, m1*LAL_MSUN_SI, m2*LAL_MSUN_SI,
-                spin1x, spin1y, spin1z, spin2x, spin2y, spin2z, f_ref, corrected_distance, inclination, model->LALpars, approximant, (model->roq->frequencyNodesLinear)), errnum);
+    XLAL_TRY(ret=XLALSimInspiralChooseFDWaveformSequence (hptilde1, hctilde1, phi0, m1*LAL_MSUN_SI, m2*LAL_MSUN_SI,
+                spin1x, spin1y, spin1z, spin2x, spin2y, spin2z, f_ref, corrected_distance, inclination, model->LALpars, approximant, nodes1), errnum);
 
-    XLAL_TRY(ret=XLALSimInspiralChooseFDWaveformSequence (&(model->roq->hptildeQuadratic), &(model->roq->hctildeQuadratic), phi0, m1*LAL_MSUN_SI, m2*LAL_MSUN_SI,
-							spin1x, spin1y, spin1z, spin2x, spin2y, spin2z, f_ref, corrected_distance, inclination, model->LALpars, approximant, (model->roq->frequencyNodesQuadratic)), errnum);
+    if (nodes2)
+      XLAL_TRY(ret=XLALSimInspiralChooseFDWaveformSequence (hptilde2, hctilde2, phi0, m1*LAL_MSUN_SI, m2*LAL_MSUN_SI,
+							spin1x, spin1y, spin1z, spin2x, spin2y, spin2z, f_ref, corrected_distance, inclination, model->LALpars, approximant, nodes2), errnum);
 
     REAL8 instant = model->freqhPlus->epoch.gpsSeconds + 1e-9*model->freqhPlus->epoch.gpsNanoSeconds;
     LALInferenceSetVariable(model->params, "time", &instant);
@@ -123,6 +123,14 @@ void LALInferenceTemplateNullTimedomain(LALInferenceModel *model);
 void LALInferenceTemplateSineGaussian(LALInferenceModel *model);
 
 void LALInferenceROQWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferenceModel *model);
+
+/**
+ * Generate the plus and cross polarisations at the relative binning bin edges
+ * model->relbin->frequencyBinEdges, using XLALSimInspiralChooseFDWaveformSequence().
+ * As for the ROQ wrapper, the "time" parameter is set to the epoch of the model buffers,
+ * so that the likelihood applies the full time shift to the generated waveform.
+ */
+void LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferenceModel *model);
 /**
  * Damped Sinusoid template.
  *
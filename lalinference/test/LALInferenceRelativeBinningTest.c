@@ -0,0 +1,101 @@
+/*
+ *  LALInferenceRelativeBinningTest.c:  Compare the relative binning and full likelihoods
+ *
+ *  Copyright (C) 2026 agent
+ *
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include <lal/LALInference.h>
+#include <lal/LALInferenceInit.h>
+#include <lal/LALInferenceReadData.h>
+#include <lal/LALInferenceTemplate.h>
+#include <lal/LALInferenceLikelihood.h>
+
+/* Tolerance on the log likelihood difference at and near the fiducial point */
+#define LTOL 0.1
+
+/* Relative changes of the chirp mass away from the fiducial point */
+static const REAL8 dmc[] = {0.0, 1e-5, -1e-5, 1e-4};
+
+int main(int argc, char *argv[])
+{
+  /* Simulated Advanced LIGO noise in two detectors, with a BBH as fiducial point */
+  char *default_argv[] = {
+    argv[0], "--psdlength", "1000", "--psdstart", "1", "--seglen", "8", "--srate", "1024", "--trigtime", "0",
+    "--ifo", "H1", "--H1-channel", "LALSimAdLIGO", "--H1-cache", "LALSimAdLIGO", "--H1-flow", "20",
+    "--ifo", "L1", "--L1-channel", "LALSimAdLIGO", "--L1-cache", "LALSimAdLIGO", "--L1-flow", "20",
+    "--dataseed", "1324", "--randomseed", "1324", "--approximant", "IMRPhenomD",
+    "--chirpmass", "10.0", "--q", "0.7", "--logdistance", "6.0", "--a_spin1", "0.2", "--a_spin2", "-0.1",
+    "--costheta_jn", "0.5", "--phase", "1.0", "--polarisation", "0.3", "--rightascension", "1.5",
+    "--declination", "0.4", "--time", "0.0", "--relative-binning"
+  };
+  if (argc == 1) {
+    argc = sizeof(default_argv) / sizeof(default_argv[0]);
+    argv = default_argv;
+  }
+
+  ProcessParamsTable *procParams = LALInferenceParseCommandLine(argc, argv);
+  LALInferenceRunState *runState = LALInferenceInitRunState(procParams);
+  XLAL_CHECK_MAIN(runState != NULL, XLAL_EFUNC, "Failed to set up the run state");
+
+  /* Set up the template and likelihood; this generates the fiducial waveform */
+  LALInferenceInitCBCThreads(runState, 1);
+  LALInferenceInitLikelihood(runState);
+
+  LALInferenceModel *model = runState->threads[0].model;
+  XLAL_CHECK_MAIN(model->relbin_flag && runState->data->relbin != NULL, XLAL_EFAILED, "Relative binning was not set up");
+  model->waveformCache = NULL;
+
+  LALInferenceTemplateFunction relbin_templt = model->templt;
+  LALInferenceVariables params;
+  memset(&params, 0, sizeof(params));
+
+  int failed = 0;
+  REAL8 mc0 = LALInferenceGetREAL8Variable(runState->threads[0].currentParams, "chirpmass");
+  for (UINT4 i = 0; i < sizeof(dmc) / sizeof(dmc[0]); i++) {
+    LALInferenceCopyVariables(runState->threads[0].currentParams, &params);
+    REAL8 mc = mc0 * (1.0 + dmc[i]);
+    LALInferenceSetVariable(&params, "chirpmass", &mc);
+
+    model->relbin_flag = 1;
+    model->templt = relbin_templt;
+    REAL8 logL_relbin = runState->likelihood(&params, runState->data, model);
+
+    model->relbin_flag = 0;
+    model->templt = &LALInferenceTemplateXLALSimInspiralChooseWaveform;
+    REAL8 logL_full = runState->likelihood(&params, runState->data, model);
+
+    int ok = isfinite(logL_relbin) && isfinite(logL_full) && fabs(logL_relbin - logL_full) < LTOL;
+    fprintf(stdout, "chirpmass = %.8f: logL relbin = %.6f, full = %.6f, difference = %.3e (tolerance %.1e): %s\n",
+            mc, logL_relbin, logL_full, logL_relbin - logL_full, LTOL, ok ? "passed" : "failed");
+    if (!ok)
+      failed = 1;
+  }
+  model->relbin_flag = 1;
+  model->templt = relbin_templt;
+
+  LALInferenceClearVariables(&params);
+  LALInferenceDestroyRelativeBinning(runState);
+  for (LALInferenceIFOData *dataPtr = runState->data; dataPtr; dataPtr = dataPtr->next)
+    XLAL_CHECK_MAIN(dataPtr->relbin == NULL, XLAL_EFAILED, "Relative binning summary data were not freed");
+
+  return failed;
+}
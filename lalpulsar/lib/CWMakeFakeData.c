@@ -498,9 +498,9 @@ XLALMakeSFTsFromREAL8TimeSeries( const REAL8TimeSeries *timeseries,     //!< inp
                    dt, Tsft, timestepsSFT0, eps );
 
   // prepare window function if requested
-  REAL8Window *window = NULL;
+  const REAL8Window *window = NULL;
   if ( windowType != NULL ) {
-    XLAL_CHECK_NULL( ( window = XLALCreateNamedREAL8Window( windowType, windowParam, timestepsSFT ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_NULL( ( window = XLALCreateCachedREAL8Window( windowType, windowParam, timestepsSFT ) ) != NULL, XLAL_EFUNC );
   }
 
   // ---------- Prepare FFT ----------
@@ -586,7 +586,7 @@ XLALMakeSFTsFromREAL8TimeSeries( const REAL8TimeSeries *timeseries,     //!< inp
   fftw_destroy_plan( fftplan );
   LAL_FFTW_WISDOM_UNLOCK;
   XLALDestroyREAL8Vector( timeStretchCopy );
-  XLALDestroyREAL8Window( window );
+  XLALDestroyCachedREAL8Window( window );
 
   return sftvect;
 
@@ -71,6 +71,8 @@ int XLALGetFstatTiming_ResampCUDA( const void *method_data, FstatTimingGeneric *
 #endif
 
 static int XLALSelectBestFstatMethod( FstatMethodType *method );
+static int FstatMethodIsDemod( FstatMethodType method );
+static int XLALPrepareFstatResults( FstatResults **Fstats, const FstatInput *input, const PulsarDopplerParams *doppler, const UINT4 numFreqBins, const FstatQuantities whatToCompute );
 static void XLALDestroyFstatInputTimeslice_common( FstatCommon *common );
 
 // ---------- Constant variable definitions ---------- //
@@ -85,6 +87,8 @@ static const char *const FstatMethodNames[FMETHOD_END] = {
   [FMETHOD_RESAMP_GENERIC]      = "ResampGeneric",
   [FMETHOD_RESAMP_CUDA]         = "ResampCUDA",
   [FMETHOD_RESAMP_BEST]         = "ResampBest",
+
+  [FMETHOD_DEMOD_AVX2]          = "DemodAVX2",
 };
 
 const FstatOptionalArgs FstatOptionalArgsDefaults = {
@@ -432,6 +436,12 @@ XLALCreateFstatInput( const SFTCatalog *SFTcatalog,              /**< [in] Catal
     setupFuncMethod = XLALSetupFstatDemod;
     break;
 
+  case FMETHOD_DEMOD_AVX2:              // Demod: AVX2 hotloop
+    XLAL_CHECK_NULL( optArgs.Dterms > 0 && optArgs.Dterms % 2 == 0, XLAL_EINVAL, "Selected Hotloop variant 'AVX2' only works for even Dterms, got %d\n", optArgs.Dterms );
+    extraBinsMethod = optArgs.Dterms;
+    setupFuncMethod = XLALSetupFstatDemod;
+    break;
+
   case FMETHOD_RESAMP_CUDA:             // Resamp: CUDA implementation
 #ifdef LALPULSAR_CUDA_ENABLED
     extraBinsMethod = 8;   // use 8 extra bins to give better agreement with Demod(w Dterms=8) near the boundaries
@@ -763,6 +773,95 @@ XLALComputeFstat( FstatResults **Fstats,               ///< [in/out] Address of
                   const UINT4 numFreqBins,             ///< [in] Number of frequencies at which the \f$ 2\mathcal{F} \f$ are to be computed. Must be 1 if XLALCreateFstatInput() was passed zero \c dFreq.
                   const FstatQuantities whatToCompute  ///< [in] Bit-field of which \f$ \mathcal{F} \f$ -statistic quantities to compute.
                 )
+{
+  // Check input, allocate and initialise results struct
+  XLAL_CHECK( Fstats != NULL, XLAL_EINVAL );
+  XLAL_CHECK( input != NULL, XLAL_EINVAL );
+  XLAL_CHECK( XLALPrepareFstatResults( Fstats, input, doppler, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Call the appropriate method function to compute the F-statistic
+  XLAL_CHECK( ( input->method_funcs.compute_func )( *Fstats, &input->common, input->method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  ( *Fstats )->doppler = ( *doppler );
+  // Record the internal reference time used, which is required to compute a correct global signal phase
+  ( *Fstats )->refTimePhase = input->common.midTime;
+
+  return XLAL_SUCCESS;
+
+} // XLALComputeFstat()
+
+///
+/// Compute the \f$ \mathcal{F} \f$ -statistic over a band of frequencies, for a batch of Doppler points.
+///
+/// All Doppler points in \p dopplers must share the same sky position, reference time and binary-orbital
+/// parameters, i.e. they may only differ in their frequency and spindown parameters. This allows \f$ \mathcal{F} \f$ -statistic
+/// methods which support batch computation (currently \a Resamp) to compute and check the sky- and binary-dependent
+/// buffered quantities (e.g.\ the barycentred timeseries) only once, and then to compute all spindown points in one pass.
+/// For all other methods, this function is equivalent to calling XLALComputeFstat() for each Doppler point in turn.
+///
+/// The results for the Doppler point <tt>dopplers[i]</tt> are returned in <tt>Fstats[i]</tt>; if <tt>Fstats[i]</tt>
+/// is \c NULL, it is allocated here.
+///
+int
+XLALComputeFstatBatch( FstatResults **Fstats,                  ///< [in/out] Array of \p numDopplers pointers to \c FstatResults results structures; any \c NULL elements are allocated here.
+                       FstatInput *input,                      ///< [in] Input data structure created by one of the setup functions.
+                       const PulsarDopplerParams *dopplers,    ///< [in] Array of \p numDopplers Doppler parameters, including starting frequency, at which to compute \f$ 2\mathcal{F} \f$
+                       const UINT4 numDopplers,                ///< [in] Number of Doppler points in the batch.
+                       const UINT4 numFreqBins,                ///< [in] Number of frequencies at which the \f$ 2\mathcal{F} \f$ are to be computed. Must be 1 if XLALCreateFstatInput() was passed zero \c dFreq.
+                       const FstatQuantities whatToCompute     ///< [in] Bit-field of which \f$ \mathcal{F} \f$ -statistic quantities to compute.
+                     )
+{
+  // Check input
+  XLAL_CHECK( Fstats != NULL, XLAL_EINVAL );
+  XLAL_CHECK( input != NULL, XLAL_EINVAL );
+  XLAL_CHECK( dopplers != NULL, XLAL_EINVAL );
+  XLAL_CHECK( numDopplers > 0, XLAL_EINVAL );
+
+  // Check that all Doppler points share the same sky position, reference time, and binary-orbital parameters
+  for ( UINT4 i = 1; i < numDopplers; ++i ) {
+    const PulsarDopplerParams *d0 = &dopplers[0];
+    const PulsarDopplerParams *di = &dopplers[i];
+    XLAL_CHECK( ( di->Alpha == d0->Alpha ) && ( di->Delta == d0->Delta ), XLAL_EINVAL, "Doppler point %u has a different sky position from Doppler point 0", i );
+    XLAL_CHECK( XLALGPSCmp( &di->refTime, &d0->refTime ) == 0, XLAL_EINVAL, "Doppler point %u has a different reference time from Doppler point 0", i );
+    XLAL_CHECK( ( di->asini == d0->asini ) && ( di->period == d0->period ) && ( di->ecc == d0->ecc ) && ( di->argp == d0->argp ) && ( XLALGPSCmp( &di->tp, &d0->tp ) == 0 ),
+                XLAL_EINVAL, "Doppler point %u has different binary-orbital parameters from Doppler point 0", i );
+  }
+
+  // Check input, allocate and initialise results structs
+  for ( UINT4 i = 0; i < numDopplers; ++i ) {
+    XLAL_CHECK( XLALPrepareFstatResults( &Fstats[i], input, &dopplers[i], numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  // Call the appropriate method function to compute the F-statistic, either
+  // for the whole batch if supported by the method, or else one Doppler point at a time
+  if ( input->method_funcs.compute_batch_func != NULL ) {
+    XLAL_CHECK( ( input->method_funcs.compute_batch_func )( Fstats, numDopplers, &input->common, input->method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
+  } else {
+    for ( UINT4 i = 0; i < numDopplers; ++i ) {
+      XLAL_CHECK( ( input->method_funcs.compute_func )( Fstats[i], &input->common, input->method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+  }
+
+  for ( UINT4 i = 0; i < numDopplers; ++i ) {
+    Fstats[i]->doppler = dopplers[i];
+    // Record the internal reference time used, which is required to compute a correct global signal phase
+    Fstats[i]->refTimePhase = input->common.midTime;
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALComputeFstatBatch()
+
+///
+/// Check input to XLALComputeFstat(), and allocate and initialise the \c FstatResults results structure.
+///
+static int
+XLALPrepareFstatResults( FstatResults **Fstats,
+                         const FstatInput *input,
+                         const PulsarDopplerParams *doppler,
+                         const UINT4 numFreqBins,
+                         const FstatQuantities whatToCompute
+                       )
 {
   // Check input
   XLAL_CHECK( Fstats != NULL, XLAL_EINVAL );
@@ -867,16 +966,9 @@ XLALComputeFstat( FstatResults **Fstats,               ///< [in/out] Address of
   }
   ( *Fstats )->whatWasComputed = whatToCompute;
 
-  // Call the appropriate method function to compute the F-statistic
-  XLAL_CHECK( ( input->method_funcs.compute_func )( *Fstats, common, input->method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-  ( *Fstats )->doppler = ( *doppler );
-  // Record the internal reference time used, which is required to compute a correct global signal phase
-  ( *Fstats )->refTimePhase = midDoppler.refTime;
-
   return XLAL_SUCCESS;
 
-} // XLALComputeFstat()
+} // XLALPrepareFstatResults()
 
 ///
 /// Free all memory associated with a \c FstatInput structure.
@@ -889,7 +981,7 @@ XLALDestroyFstatInput( FstatInput *input        ///< [in] \c FstatInput structur
     return;
   }
   if ( input->common.isTimeslice ) {
-    XLAL_CHECK_VOID( input->method < FMETHOD_RESAMP_GENERIC, XLAL_EINVAL,
+    XLAL_CHECK_VOID( FstatMethodIsDemod( input->method ), XLAL_EINVAL,
                      "Something is wrong: 'isTimeslice==TRUE' for non-LALDemod F-stat method '%s' is not supported!\n", XLALGetFstatInputMethodName( input ) );
     XLALDestroyFstatInputTimeslice_common( &input->common );
     XLALDestroyFstatInputTimeslice_Demod( input->method_data );
@@ -1061,7 +1153,13 @@ XLALSelectBestFstatMethod( FstatMethodType *method )
     //     FMETHOD_..._OPTIMISED,    (always avaiable)
     //     FMETHOD_..._SUPERFAST     (not always available; requires special hardware)
     //     FMETHOD_..._BEST          (must **always** avaiable)
+    //   Methods appended after FMETHOD_RESAMP_BEST (to keep the values of the others unchanged) are checked first.
     XLALPrintInfo( "%s: trying to find best available Fstat method for '%s'\n", __func__, FstatMethodNames[*method] );
+    if ( *method == FMETHOD_DEMOD_BEST && XLALFstatMethodIsAvailable( FMETHOD_DEMOD_AVX2 ) ) {
+      *method = FMETHOD_DEMOD_AVX2;
+      XLALPrintInfo( "%s: Fstat method '%s' is available; selected as best method\n", __func__, FstatMethodNames[*method] );
+      break;
+    }
     while ( !XLALFstatMethodIsAvailable( --( *method ) ) ) {
       XLAL_CHECK( FMETHOD_START < *method, XLAL_EFAILED );
       XLALPrintInfo( "%s: Fstat method '%s' is unavailable\n",  __func__, FstatMethodNames[*method] );
@@ -1078,6 +1176,15 @@ XLALSelectBestFstatMethod( FstatMethodType *method )
   return XLAL_SUCCESS;
 }
 
+///
+/// Return true if given \c FstatMethodType is one of the \a Demod methods
+///
+static int
+FstatMethodIsDemod( FstatMethodType method )
+{
+  return ( FMETHOD_START < method && method < FMETHOD_RESAMP_GENERIC ) || method == FMETHOD_DEMOD_AVX2;
+}
+
 ///
 /// Return true if given \c FstatMethodType corresponds to a valid and *available* Fstat method, false otherwise
 ///
@@ -1114,6 +1221,15 @@ XLALFstatMethodIsAvailable( FstatMethodType method )
     return 0;
 #endif
 
+  case FMETHOD_DEMOD_AVX2:
+    // This method is available only if compiled with AVX2 support,
+    // and AVX2 is available on the current execution machine
+#ifdef HAVE_AVX2_COMPILER
+    return LAL_HAVE_AVX2_RUNTIME();
+#else
+    return 0;
+#endif
+
   case FMETHOD_RESAMP_CUDA:
     // This medthod is available only if compiled with CUDA support
 #ifdef LALPULSAR_CUDA_ENABLED
@@ -1198,6 +1314,7 @@ XLALGetFstatTiming( const FstatInput *input, FstatTimingGeneric *timingGeneric,
   case FMETHOD_DEMOD_OPTC:
   case FMETHOD_DEMOD_ALTIVEC:
   case FMETHOD_DEMOD_SSE:
+  case FMETHOD_DEMOD_AVX2:
     XLAL_CHECK( XLALGetFstatTiming_Demod( input->method_data, timingGeneric, timingModel ) == XLAL_SUCCESS, XLAL_EFUNC );
     break;
 
@@ -1319,7 +1436,7 @@ XLALFstatInputTimeslice( FstatInput **slice,                 ///< [out] Address
               LAL_GPS_PRINT( *minStartGPS ), LAL_GPS_PRINT( *maxStartGPS ) );
 
   // only supported for 'LALDemod' Fstat methods
-  XLAL_CHECK( input->method < FMETHOD_RESAMP_GENERIC, XLAL_EINVAL, "This function is not avavible for the chosen FstatMethod '%s'!", XLALGetFstatInputMethodName( input ) );
+  XLAL_CHECK( FstatMethodIsDemod( input->method ), XLAL_EINVAL, "This function is not avavible for the chosen FstatMethod '%s'!", XLALGetFstatInputMethodName( input ) );
 
   const FstatCommon *common = &( input->common );
   UINT4 numIFOs = common->detectors.length;
@@ -123,6 +123,8 @@ typedef enum tagFstatMethodType {
   FMETHOD_RESAMP_CUDA,          ///< \a Resamp: CUDA resampling \cite DunnEtAl2022
   FMETHOD_RESAMP_BEST,          ///< \a Resamp: best guess of the fastest available implementation
 
+  FMETHOD_DEMOD_AVX2,           ///< \a Demod: AVX2 hotloop, works for any even number of Dirichlet kernel terms \f$ \text{Dterms} \f$
+
   /// \cond DONT_DOXYGEN
   FMETHOD_END
   /// \endcond
@@ -147,6 +149,7 @@ typedef struct tagFstatOptionalArgs {
   BOOLEAN resampFFTPowerOf2;            ///< \a Resamp: round up FFT lengths to next power of 2; see \c FstatMethodType.
   REAL8 allowedMismatchFromSFTLength;   ///< Optional override for XLALFstatCheckSFTLengthMismatch().
   REAL8 sourceDeltaT;                   ///< Optional source-frame sampling period for XLALCWMakeFakeData(); if zero, use the previous internal defaults.
+  UINT4 resampNumThreads;               ///< \a Resamp: number of threads sharing the resampled timeseries in XLALComputeFstatBatch(); 0 or 1: no threading.
 } FstatOptionalArgs;
 
 ///
@@ -366,6 +369,10 @@ SWIGLAL( INOUT_STRUCTS( FstatResults **, Fstats ) );
 #endif
 int XLALComputeFstat( FstatResults **Fstats, FstatInput *input, const PulsarDopplerParams *doppler,
                       const UINT4 numFreqBins, const FstatQuantities whatToCompute );
+#ifndef SWIG // exclude from SWIG interface
+int XLALComputeFstatBatch( FstatResults **Fstats, FstatInput *input, const PulsarDopplerParams *dopplers, const UINT4 numDopplers,
+                           const UINT4 numFreqBins, const FstatQuantities whatToCompute );
+#endif
 
 void XLALDestroyFstatInput( FstatInput *input );
 void XLALDestroyFstatResults( FstatResults *Fstats );
@@ -0,0 +1,69 @@
+//
+// Copyright (C) 2026 agent
+// Copyright (C) 2007--2010, 2012 Bernd Machenschalk, Reinhard Prix, Fekete Akos
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+/// [hotloop]
+/* AVX2 version: sums 4 complex SFT bins per 256-bit register */
+{
+  {
+    /* the Dirichlet-kernel sum is sum_l X_l / x_l with x_l = kappa_max - l, l = 0 ... 2*Dterms-1;
+     * each denominator is duplicated for the real and imaginary part of X_l
+     */
+    REAL4 kappa_max = kappa_star + 1.0f * Dterms - 1.0f;
+    const __m256 v_two  = _mm256_set1_ps( 2.0f );
+    const __m256 v_four = _mm256_set1_ps( 4.0f );
+    __m256 v_x  = _mm256_sub_ps( _mm256_set1_ps( kappa_max ), _mm256_setr_ps( 0.0f, 0.0f, 1.0f, 1.0f, 2.0f, 2.0f, 3.0f, 3.0f ) );
+    __m256 v_XP = _mm256_setzero_ps();
+    const REAL4 *Xa = ( const REAL4 * ) Xalpha_l;
+
+    /* Dterms is even, so 2*Dterms is a multiple of 4 complex bins */
+    for ( UINT4 l = 0; l < 2 * Dterms; l += 4 )
+      {
+        /* reciprocal estimate of x_l, refined by one Newton-Raphson step: r = r * (2 - x*r) */
+        __m256 v_r = _mm256_rcp_ps( v_x );
+        v_r = _mm256_mul_ps( v_r, _mm256_sub_ps( v_two, _mm256_mul_ps( v_x, v_r ) ) );
+
+        /* accumulate X_l / x_l */
+        v_XP = _mm256_add_ps( v_XP, _mm256_mul_ps( _mm256_loadu_ps( Xa + 2 * l ), v_r ) );
+
+        v_x = _mm256_sub_ps( v_x, v_four );
+      } /* for l < 2*Dterms */
+
+    /* horizontal sum over the 4 complex lanes */
+    __m128 v_XP2 = _mm_add_ps( _mm256_castps256_ps128( v_XP ), _mm256_extractf128_ps( v_XP, 1 ) );
+    v_XP2 = _mm_add_ps( v_XP2, _mm_movehl_ps( v_XP2, v_XP2 ) );
+    REAL4 U_alpha = _mm_cvtss_f32( v_XP2 );
+    REAL4 V_alpha = _mm_cvtss_f32( _mm_shuffle_ps( v_XP2, v_XP2, _MM_SHUFFLE( 1, 1, 1, 1 ) ) );
+
+    /* NOTE: sin[ 2pi (Dphi_alpha - k) ] = sin [ 2pi Dphi_alpha ] = sin [ 2pi kappa_star ],
+     * therefore the trig-functions need to be calculated only once!
+     * As kappa in [0, 1) we can skip the trimming step.
+     */
+    REAL4 s_alpha, c_alpha;   /* sin(2pi kappa_alpha) and (cos(2pi kappa_alpha)-1) */
+    XLALSinCos2PiLUTtrimmed ( &s_alpha, &c_alpha, kappa_star);
+    c_alpha -= 1.0f;
+
+    realXP = s_alpha * U_alpha - c_alpha * V_alpha;
+    imagXP = c_alpha * U_alpha + s_alpha * V_alpha;
+  }
+
+  /* real- and imaginary part of e^{i 2 pi lambda_alpha } */
+  XLALSinCos2PiLUT ( &imagQ, &realQ, lambda_alpha );
+}
+/// [hotloop]
@@ -24,6 +24,9 @@
 #include <math.h>
 #include <complex.h>
 #include <fftw3.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "ComputeFstat_internal.h"
 #include "ComputeFstat_Resamp_internal.h"
@@ -93,6 +96,10 @@ typedef struct {
   UINT4 decimateFFT;                                    // output every n-th frequency bin, with n>1 iff (dFreq > 1/Tspan), and was internally decreased by n
   fftwf_plan fftplan;                                   // FFT plan
 
+  // ----- threading -----
+  UINT4 numThreads;                                     // number of threads used by XLALComputeFstatResampGenericBatch()
+  ResampGenericWorkspace **threadWS;                    // per-thread workspaces; thread 0 uses the (possibly shared) common workspace
+
   // ----- timing -----
   BOOLEAN collectTiming;                                // flag whether or not to collect timing information
   FstatTimingGeneric timingGeneric;                     // measured (generic) F-statistic timing values
@@ -108,7 +115,9 @@ int XLALExtractResampledTimeseries_ResampGeneric( MultiCOMPLEX8TimeSeries **mult
 int XLALGetFstatTiming_ResampGeneric( const void *method_data, FstatTimingGeneric *timingGeneric, FstatTimingModel *timingModel );
 
 static int XLALComputeFstatResampGeneric( FstatResults *Fstats, const FstatCommon *common, void *method_data );
-static int XLALApplySpindownAndFreqShiftGeneric( COMPLEX8 *xOut, const COMPLEX8TimeSeries *xIn, const PulsarDopplerParams *doppler, REAL8 freqShift );
+static int XLALComputeFstatResampGenericBatch( FstatResults **Fstats, const UINT4 numPoints, const FstatCommon *common, void *method_data );
+static int XLALComputeFstatResampGenericFromBuffer( FstatResults *Fstats, const FstatCommon *common, ResampGenericMethodData *resamp, ResampGenericWorkspace *ws, REAL8 ticStart );
+static int XLALComputeSpindownAndFreqShiftGeneric( COMPLEX8 *em2piphase, const COMPLEX8TimeSeries *xIn, const PulsarDopplerParams *doppler, REAL8 freqShift );
 static int XLALBarycentricResampleMultiCOMPLEX8TimeSeriesGeneric( ResampGenericMethodData *resamp, const PulsarDopplerParams *thisPoint, const FstatCommon *common );
 static int XLALComputeFaFb_ResampGeneric( ResampGenericMethodData *resamp, ResampGenericWorkspace *ws, const PulsarDopplerParams thisPoint, REAL8 dFreq, UINT4 numFreqBins, const COMPLEX8TimeSeries *TimeSeries_SRC_a, const COMPLEX8TimeSeries *TimeSeries_SRC_b );
 static void XLALGetFFTPlanHints( int *planMode, double *planGenTimeoutSeconds );
@@ -156,6 +165,16 @@ static void XLALDestroyResampGenericMethodData( void *method_data )
   fftwf_destroy_plan( resamp->fftplan );
   LAL_FFTW_WISDOM_UNLOCK;
 
+  // ----- free per-thread workspaces; thread 0 uses the common workspace, which is not owned by us
+  if ( resamp->threadWS != NULL ) {
+    for ( UINT4 t = 1; t < resamp->numThreads; ++t ) {
+      if ( resamp->threadWS[t] != NULL ) {
+        XLALDestroyResampGenericWorkspace( resamp->threadWS[t] );
+      }
+    }
+    XLALFree( resamp->threadWS );
+  }
+
   XLALFree( resamp );
 
 } // XLALDestroyResampGenericMethodData()
@@ -183,6 +202,7 @@ XLALSetupFstatResampGeneric( void **method_data,
 
   // Set method function pointers
   funcs->compute_func = XLALComputeFstatResampGeneric;
+  funcs->compute_batch_func = XLALComputeFstatResampGenericBatch;
   funcs->method_data_destroy_func = XLALDestroyResampGenericMethodData;
   funcs->workspace_destroy_func = XLALDestroyResampGenericWorkspace;
 
@@ -335,6 +355,31 @@ XLALSetupFstatResampGeneric( void **method_data,
   XLAL_CHECK( ( resamp->fftplan = fftwf_plan_dft_1d( resamp->numSamplesFFT, ws->TS_FFT, ws->FabX_Raw, FFTW_FORWARD, fft_plan_flags ) ) != NULL, XLAL_EFAILED, "fftwf_plan_dft_1d() failed\n" );
   LAL_FFTW_WISDOM_UNLOCK;
 
+  // ----- allocate per-thread workspaces ----------
+  // threads only need the spindown scratch-space and the FFT buffers; all resampled timeseries are shared read-only.
+  // the FFT plan is also shared, since fftwf_execute_dft() is thread-safe and all buffers come from fftw_malloc()
+  resamp->numThreads = 1;
+#ifdef _OPENMP
+  if ( optArgs->resampNumThreads > 1 ) {
+    resamp->numThreads = optArgs->resampNumThreads;
+  }
+#else
+  if ( optArgs->resampNumThreads > 1 ) {
+    XLALPrintWarning( "WARNING: compiled without OpenMP support, ignoring resampNumThreads=%" LAL_UINT4_FORMAT "\n", optArgs->resampNumThreads );
+  }
+#endif
+  if ( resamp->numThreads > 1 ) {
+    XLAL_CHECK_FAIL( ( resamp->threadWS = XLALCalloc( resamp->numThreads, sizeof( resamp->threadWS[0] ) ) ) != NULL, XLAL_ENOMEM );
+    for ( UINT4 t = 1; t < resamp->numThreads; ++t ) {
+      ResampGenericWorkspace *wsT = NULL;
+      XLAL_CHECK_FAIL( ( wsT = resamp->threadWS[t] = XLALCalloc( 1, sizeof( *wsT ) ) ) != NULL, XLAL_ENOMEM );
+      XLAL_CHECK_FAIL( ( wsT->TStmp1_SRC = XLALCreateCOMPLEX8Vector( numSamplesMax_SRC ) ) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_FAIL( ( wsT->FabX_Raw = fftw_malloc( numSamplesFFT * sizeof( COMPLEX8 ) ) ) != NULL, XLAL_ENOMEM );
+      XLAL_CHECK_FAIL( ( wsT->TS_FFT   = fftw_malloc( numSamplesFFT * sizeof( COMPLEX8 ) ) ) != NULL, XLAL_ENOMEM );
+      wsT->numSamplesFFTAlloc = numSamplesFFT;
+    }
+  }
+
   // turn on timing collection if requested
   resamp->collectTiming = optArgs->collectTiming;
 
@@ -351,6 +396,19 @@ XLALSetupFstatResampGeneric( void **method_data,
 
   return XLAL_SUCCESS;
 
+XLAL_FAIL:
+  // ----- free any per-thread workspaces allocated before the failure
+  if ( resamp->threadWS != NULL ) {
+    for ( UINT4 t = 1; t < resamp->numThreads; ++t ) {
+      if ( resamp->threadWS[t] != NULL ) {
+        XLALDestroyResampGenericWorkspace( resamp->threadWS[t] );
+      }
+    }
+    XLALFree( resamp->threadWS );
+    resamp->threadWS = NULL;
+  }
+  return XLAL_FAILURE;
+
 } // XLALSetupFstatResampGeneric()
 
 
@@ -362,39 +420,118 @@ XLALComputeFstatResampGeneric( FstatResults *Fstats,
 {
   // Check input
   XLAL_CHECK( Fstats != NULL, XLAL_EFAULT );
+
+  XLAL_CHECK( XLALComputeFstatResampGenericBatch( &Fstats, 1, common, method_data ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+} // XLALComputeFstatResampGeneric()
+
+///
+/// Compute the F-statistic for a batch of Doppler points which share the same sky position, reference time and
+/// binary-orbital parameters [checked by XLALComputeFstatBatch()]. The barycentric resampling, antenna patterns and
+/// buffering checks are therefore performed only once for the whole batch, after which only the spindown/frequency-shift
+/// correction, FFTs and normalization are performed for each Doppler point.
+///
+/// If \c FstatOptionalArgs.resampNumThreads > 1, the Doppler points are distributed over that many OpenMP threads,
+/// each using its own workspace but sharing the read-only resampled timeseries. Threading is disabled while
+/// collecting timing information, since the timing model assumes serial F-statistic calls.
+///
+static int
+XLALComputeFstatResampGenericBatch( FstatResults **Fstats,
+                                    const UINT4 numPoints,
+                                    const FstatCommon *common,
+                                    void *method_data
+                                  )
+{
+  // Check input
+  XLAL_CHECK( Fstats != NULL, XLAL_EFAULT );
+  XLAL_CHECK( numPoints > 0, XLAL_EINVAL );
   XLAL_CHECK( common != NULL, XLAL_EFAULT );
   XLAL_CHECK( method_data != NULL, XLAL_EFAULT );
 
   ResampGenericMethodData *resamp = ( ResampGenericMethodData * ) method_data;
 
-  const FstatQuantities whatToCompute = Fstats->whatWasComputed;
-  XLAL_CHECK( !( whatToCompute & FSTATQ_ATOMS_PER_DET ), XLAL_EINVAL, "Resampling does not currently support atoms per detector" );
-
-  ResampGenericWorkspace *ws = ( ResampGenericWorkspace * ) common->workspace;
-
-  // ----- handy shortcuts ----------
-  PulsarDopplerParams thisPoint = Fstats->doppler;
-  const MultiCOMPLEX8TimeSeries *multiTimeSeries_DET = resamp->multiTimeSeries_DET;
-  UINT4 numDetectors = multiTimeSeries_DET->length;
+  for ( UINT4 i = 0; i < numPoints; i ++ ) {
+    XLAL_CHECK( Fstats[i] != NULL, XLAL_EFAULT );
+    XLAL_CHECK( !( Fstats[i]->whatWasComputed & FSTATQ_ATOMS_PER_DET ), XLAL_EINVAL, "Resampling does not currently support atoms per detector" );
+  }
 
   // collect internal timing info
   BOOLEAN collectTiming = resamp->collectTiming;
   Timings_t *Tau = &( resamp->timingResamp.Tau );
   XLAL_INIT_MEM( ( *Tau ) );    // these need to be initialized to 0 for each call
 
-  REAL8 ticStart = 0, tocEnd = 0;
-  REAL8 tic = 0, toc = 0;
+  REAL8 ticStart = 0;
   if ( collectTiming ) {
     XLAL_INIT_MEM( ( *Tau ) );  // re-set all timings to 0 at beginning of each Fstat-call
     ticStart = XLALGetCPUTime();
   }
-  // Note: all buffering is done within that function
-  XLAL_CHECK( XLALBarycentricResampleMultiCOMPLEX8TimeSeriesGeneric( resamp, &thisPoint, common ) == XLAL_SUCCESS, XLAL_EFUNC );
+  // Note: all buffering is done within that function; the first Doppler point stands in for the whole batch
+  PulsarDopplerParams firstPoint = Fstats[0]->doppler;
+  XLAL_CHECK( XLALBarycentricResampleMultiCOMPLEX8TimeSeriesGeneric( resamp, &firstPoint, common ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+#ifdef _OPENMP
+  if ( resamp->numThreads > 1 && numPoints > 1 && !collectTiming ) {
+    resamp->threadWS[0] = ( ResampGenericWorkspace * ) common->workspace;
+    int numFailed = 0;
+    #pragma omp parallel for num_threads(resamp->numThreads) schedule(dynamic) reduction(+:numFailed)
+    for ( INT4 i = 0; i < ( INT4 ) numPoints; i ++ ) {
+      ResampGenericWorkspace *wsT = resamp->threadWS[omp_get_thread_num()];
+      if ( XLALComputeFstatResampGenericFromBuffer( Fstats[i], common, resamp, wsT, 0 ) != XLAL_SUCCESS ) {
+        numFailed ++;
+      }
+    }
+    XLAL_CHECK( numFailed == 0, XLAL_EFUNC, "F-statistic computation failed for %d out of %d Doppler points\n", numFailed, numPoints );
+    return XLAL_SUCCESS;
+  }
+#endif
+
+  for ( UINT4 i = 0; i < numPoints; i ++ ) {
+    if ( i > 0 && collectTiming ) {
+      // subsequent Doppler points are timed as separate F-stat calls which re-use the buffer
+      XLAL_INIT_MEM( ( *Tau ) );
+      ticStart = XLALGetCPUTime();
+    }
+    XLAL_CHECK( XLALComputeFstatResampGenericFromBuffer( Fstats[i], common, resamp, ( ResampGenericWorkspace * ) common->workspace, ticStart ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
 
+  return XLAL_SUCCESS;
+
+} // XLALComputeFstatResampGenericBatch()
+
+///
+/// Compute the F-statistic for a single Doppler point from the buffered SRC-frame timeseries, which must already
+/// have been computed for the sky position and binary-orbital parameters of this point. Only the workspace \p ws
+/// is modified, so this function may be called concurrently with distinct workspaces if timing is not collected.
+///
+static int
+XLALComputeFstatResampGenericFromBuffer( FstatResults *Fstats,
+                                         const FstatCommon *common,
+                                         ResampGenericMethodData *resamp,
+                                         ResampGenericWorkspace *ws,
+                                         REAL8 ticStart
+                                       )
+{
+  XLAL_CHECK( ws != NULL, XLAL_EFAULT );
+
+  const FstatQuantities whatToCompute = Fstats->whatWasComputed;
   if ( whatToCompute == FSTATQ_NONE ) {
     return XLAL_SUCCESS;
   }
 
+  // ----- handy shortcuts ----------
+  PulsarDopplerParams thisPoint = Fstats->doppler;
+  const MultiCOMPLEX8TimeSeries *multiTimeSeries_DET = resamp->multiTimeSeries_DET;
+  UINT4 numDetectors = multiTimeSeries_DET->length;
+
+  // collect internal timing info
+  BOOLEAN collectTiming = resamp->collectTiming;
+  Timings_t *Tau = &( resamp->timingResamp.Tau );
+
+  REAL8 tocEnd = 0;
+  REAL8 tic = 0, toc = 0;
+
   MultiCOMPLEX8TimeSeries *multiTimeSeries_SRC_a = resamp->multiTimeSeries_SRC_a;
   MultiCOMPLEX8TimeSeries *multiTimeSeries_SRC_b = resamp->multiTimeSeries_SRC_b;
 
@@ -604,7 +741,7 @@ XLALComputeFstatResampGeneric( FstatResults *Fstats,
 
   return XLAL_SUCCESS;
 
-} // XLALComputeFstatResampGeneric()
+} // XLALComputeFstatResampGenericFromBuffer()
 
 
 static int
@@ -642,13 +779,24 @@ XLALComputeFaFb_ResampGeneric( ResampGenericMethodData *resamp,
   XLAL_CHECK( resamp->numSamplesFFT >= TimeSeries_SRC_a->data->length, XLAL_EFAILED, "[numSamplesFFT = %d] < [len(TimeSeries_SRC_a) = %d]\n", resamp->numSamplesFFT, TimeSeries_SRC_a->data->length );
   XLAL_CHECK( resamp->numSamplesFFT >= TimeSeries_SRC_b->data->length, XLAL_EFAILED, "[numSamplesFFT = %d] < [len(TimeSeries_SRC_b) = %d]\n", resamp->numSamplesFFT, TimeSeries_SRC_b->data->length );
 
+  UINT4 numSamples_SRC = TimeSeries_SRC_a->data->length;
+  XLAL_CHECK( numSamples_SRC == TimeSeries_SRC_b->data->length, XLAL_EINVAL );
+  XLAL_CHECK( numSamples_SRC <= ws->TStmp1_SRC->length, XLAL_EFAILED, "[len(TStmp1_SRC) = %d] < [len(TimeSeries_SRC_a) = %d]\n", ws->TStmp1_SRC->length, numSamples_SRC );
+
   if ( collectTiming ) {
     tic = XLALGetCPUTime();
   }
+  // compute spindown phase-factors once, and apply them to both the a(t) and b(t) timeseries;
+  // the barycentring scratch-space 'TStmp1_SRC' is not needed any more at this stage, so re-use it here
+  COMPLEX8 *em2piphase = ws->TStmp1_SRC->data;
+  XLAL_CHECK( XLALComputeSpindownAndFreqShiftGeneric( em2piphase, TimeSeries_SRC_a, &thisPoint, freqShift ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   memset( ws->TS_FFT, 0, resamp->numSamplesFFT * sizeof( ws->TS_FFT[0] ) );
   // ----- compute FaX_k
   // apply spindown phase-factors, store result in zero-padded timeseries for 'FFT'ing
-  XLAL_CHECK( XLALApplySpindownAndFreqShiftGeneric( ws->TS_FFT, TimeSeries_SRC_a, &thisPoint, freqShift ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( UINT4 j = 0; j < numSamples_SRC; j ++ ) {
+    ws->TS_FFT[j] = em2piphase[j] * TimeSeries_SRC_a->data->data[j];
+  }
 
   if ( collectTiming ) {
     toc = XLALGetCPUTime();
@@ -677,7 +825,10 @@ XLALComputeFaFb_ResampGeneric( ResampGenericMethodData *resamp,
 
   // ----- compute FbX_k
   // apply spindown phase-factors, store result in zero-padded timeseries for 'FFT'ing
-  XLAL_CHECK( XLALApplySpindownAndFreqShiftGeneric( ws->TS_FFT, TimeSeries_SRC_b, &thisPoint, freqShift ) == XLAL_SUCCESS, XLAL_EFUNC );
+  // [zero-padding beyond numSamples_SRC is unchanged from FaX_k]
+  for ( UINT4 j = 0; j < numSamples_SRC; j ++ ) {
+    ws->TS_FFT[j] = em2piphase[j] * TimeSeries_SRC_b->data->data[j];
+  }
 
   if ( collectTiming ) {
     toc = XLALGetCPUTime();
@@ -727,14 +878,14 @@ XLALComputeFaFb_ResampGeneric( ResampGenericMethodData *resamp,
 } // XLALComputeFaFb_ResampGeneric()
 
 static int
-XLALApplySpindownAndFreqShiftGeneric( COMPLEX8 *restrict xOut,                         ///< [out] the spindown-corrected SRC-frame timeseries
-                                      const COMPLEX8TimeSeries *restrict xIn,          ///< [in] the input SRC-frame timeseries
-                                      const PulsarDopplerParams *restrict doppler,     ///< [in] containing spindown parameters
-                                      REAL8 freqShift                                  ///< [in] frequency-shift to apply, sign is "new - old"
-                                    )
+XLALComputeSpindownAndFreqShiftGeneric( COMPLEX8 *restrict em2piphase,                 ///< [out] the spindown and frequency-shift phase-factors for each sample of xIn
+                                        const COMPLEX8TimeSeries *restrict xIn,        ///< [in] the input SRC-frame timeseries [only used for its epoch and sampling]
+                                        const PulsarDopplerParams *restrict doppler,   ///< [in] containing spindown parameters
+                                        REAL8 freqShift                                ///< [in] frequency-shift to apply, sign is "new - old"
+                                      )
 {
   // input sanity checks
-  XLAL_CHECK( xOut != NULL, XLAL_EINVAL );
+  XLAL_CHECK( em2piphase != NULL, XLAL_EINVAL );
   XLAL_CHECK( xIn != NULL, XLAL_EINVAL );
   XLAL_CHECK( doppler != NULL, XLAL_EINVAL );
 
@@ -765,16 +916,13 @@ XLALApplySpindownAndFreqShiftGeneric( COMPLEX8 *restrict xOut,
 
     REAL4 cosphase, sinphase;
     XLAL_CHECK( XLALSinCos2PiLUT( &sinphase, &cosphase, cycles ) == XLAL_SUCCESS, XLAL_EFUNC );
-    COMPLEX8 em2piphase = crectf( cosphase, sinphase );
-
-    // weight the complex timeseries by the antenna patterns
-    xOut[j] = em2piphase * xIn->data->data[j];
+    em2piphase[j] = crectf( cosphase, sinphase );
 
   } // for j < numSamplesIn
 
   return XLAL_SUCCESS;
 
-} // XLALApplySpindownAndFreqShiftGeneric()
+} // XLALComputeSpindownAndFreqShiftGeneric()
 
 ///
 /// Performs barycentric resampling on a multi-detector timeseries, updates resampling buffer with results
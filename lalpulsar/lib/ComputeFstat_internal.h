@@ -69,6 +69,9 @@ typedef struct {
   int ( *compute_func )(                                // F-statistic method computation function
     FstatResults *, const FstatCommon *, void *
   );
+  int ( *compute_batch_func )(                          // F-statistic method batch computation function [optional]
+    FstatResults **, const UINT4, const FstatCommon *, void *
+  );
   void ( *method_data_destroy_func )( void * );         // F-statistic method data destructor function
   void ( *workspace_destroy_func )( void * );           // Workspace destructor function
 } FstatMethodFuncs;
@@ -45,10 +45,19 @@
 */
 
 
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
+#include <lal/LALConfig.h>
 #include "HeapToplist.h"
 
+/* the threshold of a concurrent toplist is accessed with atomic operations
+   where the compiler provides them, or else under a lock */
+#if !defined(__ATOMIC_ACQUIRE) && defined(LAL_PTHREAD_LOCK)
+#include <pthread.h>
+static pthread_mutex_t threshold_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 /* this function gets a "partial heap", i.e. a heap where only the top
    element (potentially) violates the heap property. It "bubbles
    down" this element so that the heap property is restored */
@@ -252,3 +261,153 @@ void qsort_toplist_r( toplist_t *list, int ( *compare )( const void *, const voi
   _qsort_compare1 = compare;
   qsort( list->heap, list->elems, sizeof( char * ), _qsort_compare3 );
 }
+
+
+/* atomically reads the threshold of a concurrent toplist */
+static double get_threshold( concurrent_toplist_t *list )
+{
+  double t;
+#if defined(__ATOMIC_ACQUIRE)
+  __atomic_load( &list->threshold, &t, __ATOMIC_ACQUIRE );
+#elif defined(LAL_PTHREAD_LOCK)
+  pthread_mutex_lock( &threshold_mutex );
+  t = list->threshold;
+  pthread_mutex_unlock( &threshold_mutex );
+#else
+  t = list->threshold;
+#endif
+  return ( t );
+}
+
+
+/* atomically raises the threshold of a concurrent toplist to 't', if it is lower */
+static void raise_threshold( concurrent_toplist_t *list, double t )
+{
+#if defined(__ATOMIC_ACQUIRE)
+  double old = get_threshold( list );
+  while ( old < t && !__atomic_compare_exchange( &list->threshold, &old, &t, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) ) {
+    /* 'old' now holds the value set by another thread; try again */
+  }
+#else
+#if defined(LAL_PTHREAD_LOCK)
+  pthread_mutex_lock( &threshold_mutex );
+#endif
+  if ( list->threshold < t ) {
+    list->threshold = t;
+  }
+#if defined(LAL_PTHREAD_LOCK)
+  pthread_mutex_unlock( &threshold_mutex );
+#endif
+#endif
+}
+
+
+/* creates a concurrent toplist,
+   returns -1 on error (out of memory), else 0 */
+int create_concurrent_toplist( concurrent_toplist_t **list,
+                               size_t threads,
+                               size_t length,
+                               size_t size,
+                               int ( *smaller )( const void *, const void * ),
+                               double ( *rank )( const void * ) )
+{
+  concurrent_toplist_t *listp;
+  size_t i;
+
+  if ( threads == 0 ) {
+    return ( -1 );
+  }
+  if ( !( listp = malloc( sizeof( concurrent_toplist_t ) ) ) ) {
+    return ( -1 );
+  }
+  if ( !( listp->lists = calloc( threads, sizeof( toplist_t * ) ) ) ) {
+    free( listp );
+    return ( -1 );
+  }
+  listp->threads   = threads;
+  listp->rank      = rank;
+  listp->threshold = -HUGE_VAL;
+
+  for ( i = 0; i < threads; i++ ) {
+    if ( create_toplist( &( listp->lists[i] ), length, size, smaller ) != 0 ) {
+      free_concurrent_toplist( &listp );
+      return ( -1 );
+    }
+  }
+
+  *list = listp;
+  return ( 0 );
+}
+
+
+/* frees the space occupied by the concurrent toplist */
+void free_concurrent_toplist( concurrent_toplist_t **list )
+{
+  size_t i;
+  for ( i = 0; i < ( *list )->threads; i++ ) {
+    if ( ( *list )->lists[i] ) {
+      free_toplist( &( ( *list )->lists[i] ) );
+    }
+  }
+  free( ( *list )->lists );
+  free( *list );
+  *list = NULL;
+}
+
+
+/* Inserts an element into the toplist of a thread unless it is ranked
+   below the threshold. If the toplist of the thread is full afterwards,
+   the rank of its smallest element becomes the threshold, if that is higher:
+   no element ranked below it can enter the combined toplist.
+   Returns 1 if the element was actually inserted, 0 if not. */
+int insert_into_concurrent_toplist( concurrent_toplist_t *list, size_t thread, void *element )
+{
+  toplist_t *tl = list->lists[thread];
+
+  if ( ( list->rank )( element ) < get_threshold( list ) ) {
+    return ( 0 );
+  }
+  if ( !insert_into_toplist( tl, element ) ) {
+    return ( 0 );
+  }
+  if ( tl->elems == tl->length ) {
+    raise_threshold( list, ( list->rank )( tl->heap[0] ) );
+  }
+  return ( 1 );
+}
+
+
+/* return non-zero value iff the passed element would be inserted */
+int test_concurrent_toplist_inclusion( concurrent_toplist_t *list, size_t thread, const void *element )
+{
+  return ( ( ( list->rank )( element ) >= get_threshold( list ) ) &&
+           TEST_FSTAT_TOPLIST_INCLUSION( list->lists[thread], element ) );
+}
+
+
+/* moves all elements of the thread toplists into the toplist 'dest' */
+int merge_concurrent_toplist( concurrent_toplist_t *list, toplist_t *dest )
+{
+  size_t i, j;
+  toplist_t *tl;
+
+  for ( i = 0; i < list->threads; i++ ) {
+    tl = list->lists[i];
+    if ( ( tl->length != dest->length ) ||
+         ( tl->size != dest->size ) ||
+         ( tl->smaller != dest->smaller ) ) {
+      return ( -1 );
+    }
+  }
+  for ( i = 0; i < list->threads; i++ ) {
+    tl = list->lists[i];
+    for ( j = 0; j < tl->elems; j++ ) {
+      insert_into_toplist( dest, tl->heap[j] );
+    }
+    clear_toplist( tl );
+  }
+  if ( dest->length > 0 && dest->elems == dest->length ) {
+    raise_threshold( list, ( list->rank )( dest->heap[0] ) );
+  }
+  return ( 0 );
+}
@@ -102,6 +102,54 @@ extern void *toplist_elem( toplist_t *list, size_t idx );
    2 if they are uncomparable (different data types or "smaller" functions */
 extern int compare_toplists( toplist_t *list1, toplist_t *list2 );
 
+
+/* concurrent toplist: a toplist for each of a number of threads, which
+   share a threshold so that elements which cannot enter the combined
+   toplist are dropped early. Each thread only inserts into its own
+   toplist, so no locking is needed; the threshold is read and raised
+   atomically. */
+typedef struct {
+  size_t threads;      /* number of threads */
+  toplist_t **lists;   /* array of 'threads' toplists, one per thread */
+  double ( *rank )( const void * ); /* rank function, see create_concurrent_toplist() */
+  double threshold;    /* elements ranked below this are dropped; only accessed atomically */
+} concurrent_toplist_t;
+
+
+/* creates a concurrent toplist for 'threads' threads, each with a toplist
+   of 'length' elements of size 'size' ordered by 'smaller'. 'rank' must be
+   consistent with 'smaller': an element of larger rank must be "larger"
+   according to 'smaller'.
+   returns -1 on error (out of memory), else 0 */
+extern int create_concurrent_toplist( concurrent_toplist_t **list, size_t threads,
+                                      size_t length, size_t size,
+                                      int ( *smaller )( const void *, const void * ),
+                                      double ( *rank )( const void * ) );
+
+
+/* frees the space occupied by the concurrent toplist */
+extern void free_concurrent_toplist( concurrent_toplist_t **list );
+
+
+/* Inserts an element into the toplist of thread 'thread', as for insert_into_toplist(),
+   unless it is ranked below the threshold. May be called concurrently for different threads.
+   Returns 1 if the element was actually inserted, 0 if not. */
+extern int insert_into_concurrent_toplist( concurrent_toplist_t *list, size_t thread, void *element );
+
+
+/* return non-zero value iff the passed element would be inserted into the toplist of
+   thread 'thread' by calling insert_into_concurrent_toplist(), as for TEST_FSTAT_TOPLIST_INCLUSION() */
+extern int test_concurrent_toplist_inclusion( concurrent_toplist_t *list, size_t thread, const void *element );
+
+
+/* moves all elements of the thread toplists, in thread order, into the toplist 'dest',
+   which must have the same length, element size and comparison function, and may already
+   hold elements (e.g. from a checkpoint). If 'smaller' defines a total order, the result does
+   not depend on how elements were distributed between threads.
+   Must not be called concurrently with insert_into_concurrent_toplist().
+   returns -1 on error (incompatible toplists), else 0 */
+extern int merge_concurrent_toplist( concurrent_toplist_t *list, toplist_t *dest );
+
 #endif /* SWIG */
 
 #endif /* HEAPTOPLIST_H - double inclusion protection */
@@ -904,9 +904,9 @@ XLALSincInterpolateCOMPLEX8TimeSeries( COMPLEX8Vector *y_out,           ///< [ou
   REAL8 dt = ts_in->deltaT;
   REAL8 tmin = XLALGPSGetREAL8( &( ts_in->epoch ) );    // time of first bin in input timeseries
 
-  REAL8Window *win;
+  const REAL8Window *win;
   UINT4 winLen = 2 * Dterms + 1;
-  XLAL_CHECK( ( win = XLALCreateHammingREAL8Window( winLen ) ) != NULL, XLAL_EFUNC );
+  XLAL_CHECK( ( win = XLALCreateCachedREAL8Window( "hamming", 0, winLen ) ) != NULL, XLAL_EFUNC );
 
   const REAL8 oodt = 1.0 / dt;
 
@@ -952,7 +952,7 @@ XLALSincInterpolateCOMPLEX8TimeSeries( COMPLEX8Vector *y_out,           ///< [ou
 
   } // for l < numSamplesOut
 
-  XLALDestroyREAL8Window( win );
+  XLALDestroyCachedREAL8Window( win );
 
   return XLAL_SUCCESS;
 
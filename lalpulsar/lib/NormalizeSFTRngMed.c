@@ -20,6 +20,21 @@
 
 #include <lal/NormalizeSFTRngMed.h>
 
+/*---------- internal types ----------*/
+
+/* Workspace reused when computing running medians over many SFTs */
+typedef struct tagRngmedWorkspace {
+  REAL8Vector *periodo;                         /* periodogram buffer */
+  LALRunningMedianContext *rngmedCtx;           /* running-median workspace */
+} RngmedWorkspace;
+
+/*---------- internal prototypes ----------*/
+
+static int NormalizeSFT_ws( REAL8FrequencySeries *rngmed, SFTtype *sft, UINT4 blockSize, const REAL8 assumeSqrtS, RngmedWorkspace *ws );
+static int SFTtoRngmed_ws( REAL8FrequencySeries *rngmed, const SFTtype *sft, UINT4 blockSize, RngmedWorkspace *ws );
+static int PeriodoToRngmed_ctx( REAL8FrequencySeries *rngmed, const REAL8FrequencySeries *periodo, LALRunningMedianContext *rngmedCtx );
+static void ClearRngmedWorkspace( RngmedWorkspace *ws );
+
 /**
  * \addtogroup NormalizeSFTRngMed_h
  * \author Badri Krishnan and Alicia Sintes
@@ -70,6 +85,27 @@ XLALNormalizeSFT( REAL8FrequencySeries *rngmed,         /**< [out] rng-median sm
                   UINT4                blockSize,      /**< Running median block size for rngmed calculation */
                   const REAL8          assumeSqrtS     /**< If >0, instead assume sqrt(S) value *instead* of calculating PSD from running median */
                 )
+{
+  RngmedWorkspace XLAL_INIT_DECL( ws );
+  int retn = NormalizeSFT_ws( rngmed, sft, blockSize, assumeSqrtS, &ws );
+  ClearRngmedWorkspace( &ws );
+  XLAL_CHECK( retn == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+} /* XLALNormalizeSFT() */
+
+
+/**
+ * Normalize an sft based on RngMed estimated PSD, reusing the given workspace.
+ */
+static int
+NormalizeSFT_ws( REAL8FrequencySeries *rngmed,
+                     SFTtype              *sft,
+                     UINT4                blockSize,
+                     const REAL8          assumeSqrtS,
+                     RngmedWorkspace      *ws
+                   )
 {
   /* check input argments */
   XLAL_CHECK( sft && sft->data && sft->data->data && sft->data->length > 0, XLAL_EINVAL, "Invalid NULL or zero-length input in 'sft'" );
@@ -83,7 +119,7 @@ XLALNormalizeSFT( REAL8FrequencySeries *rngmed,         /**< [out] rng-median sm
 
   if ( assumeSqrtS == 0 ) {
     /* calculate the rngmed */
-    XLAL_CHECK( XLALSFTtoRngmed( rngmed, sft, blockSize ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALSFTtoRngmed() failed" );
+    XLAL_CHECK( SFTtoRngmed_ws( rngmed, sft, blockSize, ws ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALSFTtoRngmed() failed" );
   } else {
     // copy whole SFT header info to be on the safe side (deltaF definitely needed for Tsft=1/deltaF later)
     strcpy( rngmed->name, sft->name );
@@ -110,7 +146,7 @@ XLALNormalizeSFT( REAL8FrequencySeries *rngmed,         /**< [out] rng-median sm
 
   return XLAL_SUCCESS;
 
-} /* XLALNormalizeSFT() */
+} /* NormalizeSFT_ws() */
 
 
 /**
@@ -125,28 +161,37 @@ XLALNormalizeSFTVect( SFTVector  *sftVect,              /**< [in/out] pointer to
   /* check input argments */
   XLAL_CHECK( sftVect && sftVect->data && sftVect->length > 0, XLAL_EINVAL, "Invalid NULL or zero-length input in 'sftVect'" );
 
+  int retn = XLAL_FAILURE;
+
+  /* periodogram buffer and running-median workspace, shared by all SFTs */
+  RngmedWorkspace XLAL_INIT_DECL( ws );
+
   /* memory allocation of rngmed using length of first sft -- assume all sfts have the same length*/
   UINT4 lengthsft = sftVect->data->data->length;
 
   /* allocate memory for a single rngmed */
   REAL8FrequencySeries *rngmed;
   XLAL_CHECK( ( rngmed = XLALCalloc( 1, sizeof( *rngmed ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1,%zu)", sizeof( *rngmed ) );
-  XLAL_CHECK( ( rngmed->data = XLALCreateREAL8Vector( lengthsft ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector ( %d ) failed.", lengthsft );
+  XLAL_CHECK_FAIL( ( rngmed->data = XLALCreateREAL8Vector( lengthsft ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector ( %d ) failed.", lengthsft );
 
   /* loop over sfts and normalize them */
   for ( UINT4 j = 0; j < sftVect->length; j++ ) {
     SFTtype *sft = &sftVect->data[j];
 
     /* call sft normalization function */
-    XLAL_CHECK( XLALNormalizeSFT( rngmed, sft, blockSize, assumeSqrtS ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALNormalizeSFT() failed." );
+    XLAL_CHECK_FAIL( NormalizeSFT_ws( rngmed, sft, blockSize, assumeSqrtS, &ws ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALNormalizeSFT() failed." );
 
   } /* for j < sftVect->length */
 
+  retn = XLAL_SUCCESS;
+
+XLAL_FAIL:
   /* free memory for psd */
+  ClearRngmedWorkspace( &ws );
   XLALDestroyREAL8Vector( rngmed->data );
   XLALFree( rngmed );
 
-  return XLAL_SUCCESS;
+  return retn;
 
 } /* XLALNormalizeSFTVect() */
 
@@ -165,23 +210,27 @@ XLALNormalizeMultiSFTVect( MultiSFTVector *multsft,             /**< [in/out] mu
   XLAL_CHECK_NULL( multsft && multsft->data && multsft->length > 0, XLAL_EINVAL, "Invalid NULL or zero-length input 'multsft'" );
   XLAL_CHECK_NULL( assumeSqrtSX == NULL || assumeSqrtSX->length == multsft->length, XLAL_EINVAL );
 
+  /* periodogram buffer and running-median workspace, shared by all SFTs of all detectors */
+  RngmedWorkspace XLAL_INIT_DECL( ws );
+
   /* allocate multipsd structure */
   MultiPSDVector *multiPSD;
   XLAL_CHECK_NULL( ( multiPSD = XLALCalloc( 1, sizeof( *multiPSD ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1, sizeof(*multiPSD))" );
 
+  /* lengths are only set once the matching arrays exist, so that a partially-built multiPSD can be destroyed */
   UINT4 numifo = multsft->length;
+  XLAL_CHECK_FAIL( ( multiPSD->data = XLALCalloc( numifo, sizeof( *multiPSD->data ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc ( %d, %zu)", numifo, sizeof( *multiPSD->data ) );
   multiPSD->length = numifo;
-  XLAL_CHECK_NULL( ( multiPSD->data = XLALCalloc( numifo, sizeof( *multiPSD->data ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc ( %d, %zu)", numifo, sizeof( *multiPSD->data ) );
 
   /* loop over ifos */
   for ( UINT4 X = 0; X < numifo; X++ ) {
     UINT4 numsft = multsft->data[X]->length;
 
     /* allocation of psd vector over SFTs for this detector X */
-    XLAL_CHECK_NULL( ( multiPSD->data[X] = XLALCalloc( 1, sizeof( *multiPSD->data[X] ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1, %zu)", sizeof( *multiPSD->data[X] ) );
+    XLAL_CHECK_FAIL( ( multiPSD->data[X] = XLALCalloc( 1, sizeof( *multiPSD->data[X] ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1, %zu)", sizeof( *multiPSD->data[X] ) );
 
+    XLAL_CHECK_FAIL( ( multiPSD->data[X]->data = XLALCalloc( numsft, sizeof( *( multiPSD->data[X]->data ) ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc ( %d, %zu)", numsft, sizeof( *( multiPSD->data[X]->data ) ) );
     multiPSD->data[X]->length = numsft;
-    XLAL_CHECK_NULL( ( multiPSD->data[X]->data = XLALCalloc( numsft, sizeof( *( multiPSD->data[X]->data ) ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc ( %d, %zu)", numsft, sizeof( *( multiPSD->data[X]->data ) ) );
 
     /* loop over sfts for this IFO X */
     for ( UINT4 j = 0; j < numsft; j++ ) {
@@ -189,19 +238,27 @@ XLALNormalizeMultiSFTVect( MultiSFTVector *multsft,             /**< [in/out] mu
 
       /* memory allocation of psd vector for this SFT */
       UINT4 lengthsft = sft->data->length;
-      XLAL_CHECK_NULL( ( multiPSD->data[X]->data[j].data = XLALCreateREAL8Vector( lengthsft ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector(%d) failed.", lengthsft );
+      XLAL_CHECK_FAIL( ( multiPSD->data[X]->data[j].data = XLALCreateREAL8Vector( lengthsft ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector(%d) failed.", lengthsft );
 
       /* if assumeSqrtSX is not given, pass 0.0 to calculate PSD from running median */
       const REAL8 assumeSqrtS = ( assumeSqrtSX != NULL ) ? assumeSqrtSX->sqrtSn[X] : 0.0;
 
-      XLAL_CHECK_NULL( XLALNormalizeSFT( &multiPSD->data[X]->data[j], sft, blockSize, assumeSqrtS ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALNormalizeSFT() failed" );
+      XLAL_CHECK_FAIL( NormalizeSFT_ws( &multiPSD->data[X]->data[j], sft, blockSize, assumeSqrtS, &ws ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALNormalizeSFT() failed" );
 
     } /* for j < numsft */
 
   } /* for X < numifo */
 
+  ClearRngmedWorkspace( &ws );
+
   return multiPSD;
 
+XLAL_FAIL:
+  ClearRngmedWorkspace( &ws );
+  XLALDestroyMultiPSDVector( multiPSD );
+
+  return NULL;
+
 } /* XLALNormalizeMultiSFTVect() */
 
 
@@ -213,6 +270,28 @@ XLALSFTtoRngmed( REAL8FrequencySeries *rngmed,  /**< [out] running-median smooth
                  const SFTtype *sft,           /**< [in]  input SFT */
                  UINT4 blockSize               /**< Running median block size */
                )
+{
+  RngmedWorkspace XLAL_INIT_DECL( ws );
+  int retn = SFTtoRngmed_ws( rngmed, sft, blockSize, &ws );
+  ClearRngmedWorkspace( &ws );
+  XLAL_CHECK( retn == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+} /* XLALSFTtoRngmed() */
+
+
+/**
+ * Calculates a smoothed (running-median) periodogram for the given SFT, using
+ * (and if necessary, (re)allocating) the periodogram buffer and running-median
+ * workspace in 'ws'.
+ */
+static int
+SFTtoRngmed_ws( REAL8FrequencySeries *rngmed,
+                    const SFTtype *sft,
+                    UINT4 blockSize,
+                    RngmedWorkspace *ws
+                  )
 {
   /* check argments */
   XLAL_CHECK( sft != NULL, XLAL_EINVAL, "Invalid NULL pointer passed in 'sft'" );
@@ -227,15 +306,25 @@ XLALSFTtoRngmed( REAL8FrequencySeries *rngmed,  /**< [out] running-median smooth
 
   UINT4 length = sft->data->length;
 
-  REAL8FrequencySeries periodo;
-  XLAL_CHECK( ( periodo.data = XLALCreateREAL8Vector( length ) ) != NULL, XLAL_EFUNC, "Failed to allocate periodo.data of length %d", length );
+  /* (re)allocate periodogram buffer */
+  if ( ws->periodo == NULL || ws->periodo->length != length ) {
+    XLAL_CHECK( ( ws->periodo = XLALResizeREAL8Vector( ws->periodo, length ) ) != NULL, XLAL_EFUNC, "Failed to allocate periodo.data of length %d", length );
+  }
+  REAL8FrequencySeries XLAL_INIT_DECL( periodo );
+  periodo.data = ws->periodo;
 
   /* calculate the periodogram */
   XLAL_CHECK( XLALSFTtoPeriodogram( &periodo, sft ) == XLAL_SUCCESS, XLAL_EFUNC, "Call to XLALSFTtoPeriodogram() failed.\n" );
 
   /* calculate the rngmed */
   if ( blockSize > 0 ) {
-    XLAL_CHECK( XLALPeriodoToRngmed( rngmed, &periodo, blockSize ) == XLAL_SUCCESS, XLAL_EFUNC, "Call to XLALPeriodoToRngmed() failed." );
+    XLAL_CHECK( length >= blockSize, XLAL_EINVAL, "Need at least %d bins in SFT (have %d) to perform running median!\n", blockSize, length );
+    /* (re)create running-median workspace */
+    if ( ws->rngmedCtx == NULL || XLALRunningMedianContextBlocksize( ws->rngmedCtx ) != blockSize ) {
+      XLALDestroyRunningMedianContext( ws->rngmedCtx );
+      XLAL_CHECK( ( ws->rngmedCtx = XLALCreateRunningMedianContext( blockSize ) ) != NULL, XLAL_EFUNC );
+    }
+    XLAL_CHECK( PeriodoToRngmed_ctx( rngmed, &periodo, ws->rngmedCtx ) == XLAL_SUCCESS, XLAL_EFUNC, "Call to XLALPeriodoToRngmed() failed." );
   } else { // blockSize==0 means don't use any running-median, just *copy* the periodogram contents into the output
     strcpy( rngmed->name, periodo.name );
     rngmed->epoch     = periodo.epoch;
@@ -245,13 +334,9 @@ XLALSFTtoRngmed( REAL8FrequencySeries *rngmed,  /**< [out] running-median smooth
     memcpy( rngmed->data->data, periodo.data->data, periodo.data->length * sizeof( periodo.data->data[0] ) );
   }
 
-  /* free memory */
-  XLALFree( periodo.data->data );
-  XLALFree( periodo.data );
-
   return XLAL_SUCCESS;
 
-} /* XLALSFTtoRngmed() */
+} /* SFTtoRngmed_ws() */
 
 /**
  * Calculate the "periodogram" of an SFT, ie the modulus-squares of the SFT-data.
@@ -316,6 +401,30 @@ XLALPeriodoToRngmed( REAL8FrequencySeries  *rngmed,             /**< [out] resul
   XLAL_CHECK( blockSize > 0, XLAL_EINVAL, "'blockSize = %d' must be > 0", blockSize );
   XLAL_CHECK( length >= blockSize, XLAL_EINVAL, "Need at least %d bins in SFT (have %d) to perform running median!\n", blockSize, length );
 
+  LALRunningMedianContext *rngmedCtx = XLALCreateRunningMedianContext( blockSize );
+  XLAL_CHECK( rngmedCtx != NULL, XLAL_EFUNC );
+  int retn = PeriodoToRngmed_ctx( rngmed, periodo, rngmedCtx );
+  XLALDestroyRunningMedianContext( rngmedCtx );
+  XLAL_CHECK( retn == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+
+} /* XLALPeriodoToRngmed() */
+
+
+/**
+ * Calculates running median over a single periodogram, using the given
+ * running-median workspace; the block size is that of 'rngmedCtx'.
+ */
+static int
+PeriodoToRngmed_ctx( REAL8FrequencySeries  *rngmed,
+                         const REAL8FrequencySeries  *periodo,
+                         LALRunningMedianContext *rngmedCtx
+                       )
+{
+  UINT4 length = periodo->data->length;
+  UINT4 blockSize = XLALRunningMedianContextBlocksize( rngmedCtx );
+
   /* copy periodogram header */
   strcpy( rngmed->name, periodo->name );
   rngmed->epoch = periodo->epoch;
@@ -324,8 +433,6 @@ XLALPeriodoToRngmed( REAL8FrequencySeries  *rngmed,             /**< [out] resul
 
   UINT4 blocks2 = blockSize / 2; /* integer division, round down */
 
-  LALRunningMedianPar rngMedPar;
-  rngMedPar.blocksize = blockSize;
   REAL8Sequence mediansV, inputV;
   inputV.length = length;
   inputV.data = periodo->data->data;
@@ -333,9 +440,7 @@ XLALPeriodoToRngmed( REAL8FrequencySeries  *rngmed,             /**< [out] resul
   mediansV.length = medianVLength;
   mediansV.data = rngmed->data->data + blocks2;
 
-  LALStatus XLAL_INIT_DECL( status );
-  LALDRunningMedian2( &status, &mediansV, &inputV, rngMedPar );
-  XLAL_CHECK( status.statusCode == 0, XLAL_EFAILED, "LALDRunningMedian2() failed with statusCode = %d", status.statusCode );
+  XLAL_CHECK( XLALDRunningMedianWithContext( rngmedCtx, &mediansV, &inputV ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   /* copy values in the wings */
   for ( UINT4 j = 0; j < blocks2; j++ ) {
@@ -358,7 +463,20 @@ XLALPeriodoToRngmed( REAL8FrequencySeries  *rngmed,             /**< [out] resul
 
   return XLAL_SUCCESS;
 
-} /* XLALPeriodoToRngmed() */
+} /* PeriodoToRngmed_ctx() */
+
+
+/**
+ * Free the buffers held by a running-median workspace.
+ */
+static void
+ClearRngmedWorkspace( RngmedWorkspace *ws )
+{
+  XLALDestroyREAL8Vector( ws->periodo );
+  XLALDestroyRunningMedianContext( ws->rngmedCtx );
+  ws->periodo = NULL;
+  ws->rngmedCtx = NULL;
+} /* ClearRngmedWorkspace() */
 
 
 /**
@@ -24,18 +24,110 @@
 
 /*---------- includes ----------*/
 
+#include <config.h>
+
+#include <time.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include <lal/Units.h>
 #include <lal/Sequence.h>
+#include <lal/LALString.h>
 
 #include "SFTinternal.h"
 
+/*---------- constants ----------*/
+
+/** name of the SFT index file written to each directory of SFT files */
+#define SFT_INDEX_FILENAME ".SFTindex"
+
+/** magic string and format version identifying an SFT index file */
+#define SFT_INDEX_MAGIC "LALSFTIX"
+#define SFT_INDEX_FORMAT 2
+
+/** byte-order marker of an SFT index file; an index file written with a different byte order is ignored */
+#define SFT_INDEX_BYTE_ORDER 0x01020304
+
+/**
+ * SFT files modified less than this many seconds before they were scanned are always rescanned,
+ * since a later modification within the same timestamp granularity would not change their mtime
+ */
+#define SFT_INDEX_RACY_SECONDS 2
+
+/*---------- internal types ----------*/
+
+/** header information of one SFT block, as recorded in an SFT index file */
+typedef struct {
+  INT8 offset;                  /**< offset of the SFT block in the file */
+  REAL8 f0;                     /**< start frequency */
+  REAL8 deltaF;                 /**< frequency spacing */
+  UINT8 crc64;                  /**< crc64 checksum reported by the SFT block */
+  INT4 gpsSeconds;              /**< GPS epoch, seconds */
+  INT4 gpsNanoSeconds;          /**< GPS epoch, nanoseconds */
+  UINT4 version;                /**< SFT-specification version */
+  UINT4 numBins;                /**< number of frequency-bins */
+  UINT4 comment_length;         /**< length of comment including terminating NULL, or 0 for no comment */
+  UINT2 windowspec;             /**< SFT window specification */
+  CHAR detector[2];             /**< detector prefix */
+} SFTIndexBlock;
+
+/** header of an SFT index file, following its magic string */
+typedef struct {
+  UINT4 format;                 /**< format version */
+  UINT4 byteorder;              /**< byte-order marker */
+  UINT4 record_size;            /**< size of an SFTIndexRecord */
+  UINT4 block_size;             /**< size of an SFTIndexBlock */
+} SFTIndexHeader;
+
+/** record of one SFT file in an SFT index file, followed by its name and blocks */
+typedef struct {
+  INT8 size;                    /**< size of the file */
+  INT8 mtime;                   /**< modification time of the file */
+  INT8 scan_time;               /**< time at which the file was scanned */
+  UINT4 name_length;            /**< length of file name */
+  UINT4 numBlocks;              /**< number of SFT blocks in the file */
+} SFTIndexRecord;
+
+/** header information of all SFT blocks in one SFT file */
+typedef struct {
+  CHAR *name;                   /**< file name within its directory (only set for files read from an index) */
+  INT8 size;                    /**< size of the file */
+  INT8 mtime;                   /**< modification time of the file */
+  INT8 scan_time;               /**< time at which the file was scanned */
+  UINT4 numBlocks;              /**< number of SFT blocks in the file */
+  SFTIndexBlock *blocks;        /**< header information of each SFT block */
+  CHAR **comments;              /**< comment of each SFT block, or NULL */
+  BOOLEAN from_index;           /**< whether this information was read from an SFT index file */
+  int errnum;                   /**< XLAL error code if the file failed to scan */
+} SFTFileScan;
+
+/** contents of the SFT index file of one directory */
+typedef struct {
+  CHAR *dirname;                /**< directory name */
+  UINT4 numFiles;               /**< number of files in the index */
+  SFTFileScan *files;           /**< files in the index, sorted by name */
+  BOOLEAN modified;             /**< whether the index needs to be rewritten */
+} SFTIndex;
+
 /*---------- internal prototypes ----------*/
 
 static long get_file_len( FILE *fp );
 
+static int scan_sft_files( SFTFileScan *scans, const LALStringVector *fnames );
+static int scan_sft_file( const CHAR *fname, SFTFileScan *scan );
+static void free_sft_file_scan( SFTFileScan *scan );
+static void read_sft_index( SFTIndex *index );
+static void write_sft_index( const SFTIndex *index, UINT4 k, const SFTFileScan *scans, const LALStringVector *fnames, const UINT4 *fileIndex );
+static const CHAR *sft_file_basename( const CHAR *fname );
+static int compare_sft_file_scan_names( const void *ptr1, const void *ptr2 );
+static int compare_name_to_sft_file_scan( const void *ptr1, const void *ptr2 );
+
 static BOOLEAN consistent_mSFT_header( SFTtype header1, UINT4 version1, UINT4 nsamples1, UINT2 windowspec1, SFTtype header2, UINT4 version2, UINT4 nsamples2, UINT2 windowspec2 );
 static BOOLEAN timestamp_in_list( LIGOTimeGPS timestamp, LIGOTimeGPSVector *list );
 
@@ -66,6 +158,13 @@ static BOOLEAN timestamp_in_list( LIGOTimeGPS timestamp, LIGOTimeGPSVector *list
  *
  * The returned SFTs in the catalogue are sorted by increasing GPS-epochs !
  *
+ * Matched files are scanned in parallel (if compiled with OpenMP). If the environment variable
+ * \c LAL_SFT_INDEX is set to \c 1, the headers of all SFT-blocks in each directory of matched files are
+ * also recorded in a sidecar SFT index file '.SFTindex' in that directory. Files recorded in the index whose
+ * size and modification time are unchanged are then not opened again, and the index is updated with all
+ * other files. An index file written with a different format version or byte order is ignored, and failure
+ * to write an index file (e.g. in a read-only directory) is not an error.
+ *
  */
 SFTCatalog *
 XLALSFTdataFind( const CHAR *file_pattern,             /**< which SFT-files */
@@ -90,80 +189,39 @@ XLALSFTdataFind( const CHAR *file_pattern,             /**< which SFT-files */
   XLAL_CHECK_NULL( ( fnames = XLALFindFiles( file_pattern ) ) != NULL, XLAL_EFUNC, "Failed to find filelist matching pattern '%s'.\n\n", file_pattern );
   UINT4 numFiles = fnames->length;
 
+  /* scan the headers of all SFT-blocks in the matched files */
+  SFTFileScan *scans;
+  if ( ( scans = XLALCalloc( numFiles, sizeof( *scans ) ) ) == NULL ) {
+    XLALDestroyStringVector( fnames );
+    XLALDestroySFTCatalog( ret );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+  if ( scan_sft_files( scans, fnames ) != XLAL_SUCCESS ) {
+    for ( UINT4 i = 0; i < numFiles; i ++ ) {
+      free_sft_file_scan( &scans[i] );
+    }
+    XLALFree( scans );
+    XLALDestroyStringVector( fnames );
+    XLALDestroySFTCatalog( ret );
+    XLAL_ERROR_NULL( XLAL_EFUNC );
+  }
+
   UINT4 numSFTs = 0;
-  /* ----- main loop: parse all matching files */
+  /* ----- main loop: select SFT-blocks of all matching files */
   for ( UINT4 i = 0; i < numFiles; i ++ ) {
     const CHAR *fname = fnames->data[i];
+    SFTFileScan *scan = &scans[i];
 
-    /* merged SFTs need to satisfy stronger consistency-constraints (-> see spec) */
-    BOOLEAN mfirst_block = TRUE;
-    UINT4   mprev_version = 0;
-    SFTtype XLAL_INIT_DECL( mprev_header );
-    REAL8   mprev_nsamples = 0;
-    UINT2   mprev_windowspec = 0;
-
-    FILE *fp;
-    if ( ( fp = fopen( fname, "rb" ) ) == NULL ) {
-      XLALPrintError( "ERROR: Failed to open matched file '%s'\n\n", fname );
-      XLALDestroyStringVector( fnames );
-      XLALDestroySFTCatalog( ret );
-      XLAL_ERROR_NULL( XLAL_EIO );
-    }
-
-    long file_len;
-    if ( ( file_len = get_file_len( fp ) ) == 0 ) {
-      XLALPrintError( "ERROR: got file-len == 0 for '%s'\n\n", fname );
-      XLALDestroyStringVector( fnames );
-      XLALDestroySFTCatalog( ret );
-      fclose( fp );
-      XLAL_ERROR_NULL( XLAL_EIO );
-    }
-
-    /* go through SFT-blocks in fp */
-    while ( ftell( fp ) < file_len ) {
-      SFTtype this_header;
-      UINT4 this_version;
-      UINT4 this_nsamples;
-      UINT8 this_crc;
-      UINT2 this_windowspec;
-      CHAR *this_comment = NULL;
-      BOOLEAN endian;
+    for ( UINT4 b = 0; b < scan->numBlocks; b ++ ) {
+      const SFTIndexBlock *block = &( scan->blocks[b] );
       BOOLEAN want_this_block = FALSE;
 
-      long this_filepos;
-      if ( ( this_filepos = ftell( fp ) ) == -1 ) {
-        XLALPrintError( "ERROR: ftell() failed for '%s'\n\n", fname );
-        XLALDestroyStringVector( fnames );
-        XLALDestroySFTCatalog( ret );
-        fclose( fp );
-        XLAL_ERROR_NULL( XLAL_EIO );
-      }
-
-      if ( read_sft_header_from_fp( fp, &this_header, &this_version, &this_crc, &this_windowspec, &endian, &this_comment, &this_nsamples ) != 0 ) {
-        XLALPrintError( "ERROR: File-block '%s:%ld' is not a valid SFT!\n\n", fname, ftell( fp ) );
-        XLALDestroyStringVector( fnames );
-        XLALFree( this_comment );
-        XLALDestroySFTCatalog( ret );
-        fclose( fp );
-        XLAL_ERROR_NULL( XLAL_EDATA );
-      }
-
-      /* if merged-SFT: check consistency constraints */
-      if ( !mfirst_block ) {
-        if ( ! consistent_mSFT_header( mprev_header, mprev_version, mprev_nsamples, mprev_windowspec, this_header, this_version, this_nsamples, this_windowspec ) ) {
-          XLALPrintError( "ERROR: merged SFT-file '%s' contains inconsistent SFT-blocks!\n\n", fname );
-          XLALFree( this_comment );
-          XLALDestroyStringVector( fnames );
-          XLALDestroySFTCatalog( ret );
-          fclose( fp );
-          XLAL_ERROR_NULL( XLAL_EDATA );
-        }
-      } /* if !mfirst_block */
-
-      mprev_header = this_header;
-      mprev_version = this_version;
-      mprev_nsamples = this_nsamples;
-      mprev_windowspec = this_windowspec;
+      SFTtype XLAL_INIT_DECL( this_header );
+      memcpy( this_header.name, block->detector, sizeof( block->detector ) );
+      this_header.epoch.gpsSeconds = block->gpsSeconds;
+      this_header.epoch.gpsNanoSeconds = block->gpsNanoSeconds;
+      this_header.f0 = block->f0;
+      this_header.deltaF = block->deltaF;
 
       want_this_block = TRUE;       /* default */
       /* but does this SFT-block satisfy the user-constraints ? */
@@ -195,10 +253,12 @@ XLALSFTdataFind( const CHAR *file_pattern,             /**< which SFT-files */
           int len = ( ret->length + SFTFILEIO_REALLOC_BLOCKSIZE ) * sizeof( *( ret->data ) );
           if ( ( ret->data = LALRealloc( ret->data, len ) ) == NULL ) {
             XLALPrintError( "ERROR: SFT memory reallocation failed: nSFT:%d, len = %d\n", numSFTs, len );
+            for ( UINT4 j = 0; j < numFiles; j ++ ) {
+              free_sft_file_scan( &scans[j] );
+            }
+            XLALFree( scans );
             XLALDestroyStringVector( fnames );
             XLALDestroySFTCatalog( ret );
-            XLALFree( this_comment );
-            fclose( fp );
             XLAL_ERROR_NULL( XLAL_ENOMEM );
           }
 
@@ -218,50 +278,36 @@ XLALSFTdataFind( const CHAR *file_pattern,             /**< which SFT-files */
         }
         if ( ( desc->locator == NULL ) || ( desc->locator->fname == NULL ) ) {
           XLALPrintError( "ERROR: XLALCalloc() failed\n" );
+          for ( UINT4 j = 0; j < numFiles; j ++ ) {
+            free_sft_file_scan( &scans[j] );
+          }
+          XLALFree( scans );
           XLALDestroyStringVector( fnames );
           XLALDestroySFTCatalog( ret );
-          fclose( fp );
           XLAL_ERROR_NULL( XLAL_ENOMEM );
         }
         strcpy( desc->locator->fname, fname );
-        desc->locator->offset = this_filepos;
+        desc->locator->offset = block->offset;
 
-        XLAL_CHECK_NULL( parse_sft_windowspec( this_windowspec, &desc->window_type, &desc->window_param ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( parse_sft_windowspec( block->windowspec, &desc->window_type, &desc->window_param ) == XLAL_SUCCESS, XLAL_EFUNC );
 
         desc->header  = this_header;
-        desc->comment = this_comment;
-        desc->numBins = this_nsamples;
-        desc->version = this_version;
-        desc->crc64   = this_crc;
+        desc->comment = scan->comments[b];      /* take ownership of comment */
+        scan->comments[b] = NULL;
+        desc->numBins = block->numBins;
+        desc->version = block->version;
+        desc->crc64   = block->crc64;
 
       } /* if want_this_block */
-      else {
-        XLALFree( this_comment );
-      }
-
-      mfirst_block = FALSE;
-
-      /* skip seeking if we know we would reach the end */
-      if ( ftell( fp ) + ( long )this_nsamples * 8 >= file_len ) {
-        break;
-      }
-
-      /* seek to end of SFT data-entries in file  */
-      if ( fseek( fp, this_nsamples * 8, SEEK_CUR ) == -1 ) {
-        XLALPrintError( "ERROR: Failed to skip DATA field for SFT '%s': %s\n", fname, strerror( errno ) );
-        XLALFree( this_comment );
-        XLALDestroyStringVector( fnames );
-        XLALDestroySFTCatalog( ret );
-        fclose( fp );
-        XLAL_ERROR_NULL( XLAL_EIO );
-      }
 
-    } /* while !feof */
+    } /* for b < numBlocks */
 
-    fclose( fp );
+    free_sft_file_scan( scan );
 
   } /* for i < numFiles */
 
+  XLALFree( scans );
+
   /* free matched filenames */
   XLALDestroyStringVector( fnames );
 
@@ -808,6 +854,512 @@ static long get_file_len( FILE *fp )
 } /* get_file_len() */
 
 
+/*
+   Scan the headers of all SFT-blocks in the files 'fnames' into 'scans'.
+   Files recorded, unchanged, in the SFT index file of their directory are not opened;
+   all other files are scanned in parallel, and the SFT index files are then updated.
+*/
+static int
+scan_sft_files( SFTFileScan *scans, const LALStringVector *fnames )
+{
+  const UINT4 numFiles = fnames->length;
+
+  /* check whether SFT index files should be used; they are only read and written on request */
+  BOOLEAN use_index = FALSE;
+  {
+    const char *env = getenv( "LAL_SFT_INDEX" );
+    if ( env != NULL && strcmp( env, "1" ) == 0 ) {
+      use_index = TRUE;
+    }
+  }
+
+  int retn = XLAL_FAILURE;
+  UINT4 numIndexes = 0;
+  SFTIndex *indexes = NULL;
+  UINT4 *fileIndex = NULL;
+
+  /* look up matched files in the SFT index files of their directories */
+  if ( use_index ) {
+    XLAL_CHECK_FAIL( ( fileIndex = XLALCalloc( numFiles, sizeof( *fileIndex ) ) ) != NULL, XLAL_ENOMEM );
+    for ( UINT4 i = 0; i < numFiles; i ++ ) {
+      const CHAR *fname = fnames->data[i];
+      const CHAR *bname = sft_file_basename( fname );
+
+      /* find or read the SFT index of the directory of this file */
+      const size_t dirlen = ( bname > fname ) ? ( size_t )( bname - fname - 1 ) : 0;
+      UINT4 k;
+      for ( k = 0; k < numIndexes; k ++ ) {
+        const CHAR *dirname = indexes[k].dirname;
+        if ( ( dirlen == 0 ) ? ( strcmp( dirname, "." ) == 0 ) : ( strlen( dirname ) == dirlen && strncmp( dirname, fname, dirlen ) == 0 ) ) {
+          break;
+        }
+      }
+      if ( k == numIndexes ) {
+        SFTIndex *new_indexes = XLALRealloc( indexes, ( numIndexes + 1 ) * sizeof( *indexes ) );
+        XLAL_CHECK_FAIL( new_indexes != NULL, XLAL_ENOMEM );
+        indexes = new_indexes;
+        XLAL_INIT_MEM( indexes[k] );
+        if ( dirlen == 0 ) {
+          XLAL_CHECK_FAIL( ( indexes[k].dirname = XLALStringDuplicate( "." ) ) != NULL, XLAL_EFUNC );
+        } else {
+          XLAL_CHECK_FAIL( ( indexes[k].dirname = XLALStringAppendFmt( NULL, "%.*s", ( int ) dirlen, fname ) ) != NULL, XLAL_EFUNC );
+        }
+        ++numIndexes;
+        read_sft_index( &indexes[k] );
+      }
+      fileIndex[i] = k;
+
+      /* use the recorded SFT headers if the file is unchanged since it was scanned */
+      SFTFileScan *entry = bsearch( bname, indexes[k].files, indexes[k].numFiles, sizeof( indexes[k].files[0] ), compare_name_to_sft_file_scan );
+      struct stat st;
+      if ( entry != NULL && entry->blocks != NULL && stat( fname, &st ) == 0
+           && entry->size == ( INT8 ) st.st_size && entry->mtime == ( INT8 ) st.st_mtime
+           && entry->mtime + SFT_INDEX_RACY_SECONDS < entry->scan_time ) {
+        scans[i] = *entry;
+        scans[i].name = NULL;
+        scans[i].from_index = TRUE;
+        entry->numBlocks = 0;
+        entry->blocks = NULL;
+        entry->comments = NULL;
+      } else {
+        indexes[k].modified = TRUE;
+      }
+    }
+  }
+
+  /* scan all other files in parallel */
+  INT4 numFailed = 0;
+  #pragma omp parallel for schedule(dynamic) reduction(+:numFailed)
+  for ( INT4 i = 0; i < ( INT4 ) numFiles; i ++ ) {
+    if ( !scans[i].from_index ) {
+      scans[i].errnum = scan_sft_file( fnames->data[i], &scans[i] );
+      if ( scans[i].errnum != XLAL_SUCCESS ) {
+        ++numFailed;
+      }
+    }
+  }
+
+  /* update SFT index files */
+  for ( UINT4 k = 0; k < numIndexes; k ++ ) {
+    if ( indexes[k].modified ) {
+      write_sft_index( &indexes[k], k, scans, fnames, fileIndex );
+    }
+  }
+
+  /* report the first file which failed to scan */
+  if ( numFailed > 0 ) {
+    for ( UINT4 i = 0; i < numFiles; i ++ ) {
+      XLAL_CHECK_FAIL( scans[i].errnum == XLAL_SUCCESS, scans[i].errnum, "Failed to scan SFT file '%s'", fnames->data[i] );
+    }
+  }
+
+  retn = XLAL_SUCCESS;
+
+XLAL_FAIL:
+
+  /* free SFT index files */
+  for ( UINT4 k = 0; k < numIndexes; k ++ ) {
+    for ( UINT4 j = 0; j < indexes[k].numFiles; j ++ ) {
+      free_sft_file_scan( &indexes[k].files[j] );
+    }
+    XLALFree( indexes[k].files );
+    XLALFree( indexes[k].dirname );
+  }
+  XLALFree( indexes );
+  XLALFree( fileIndex );
+
+  return retn;
+
+} /* scan_sft_files() */
+
+
+/*
+   Scan the headers of all SFT-blocks in the file 'fname' into 'scan'.
+   Returns XLAL_SUCCESS, or an XLAL error code on failure.
+   This function is called from multiple threads, so must not raise XLAL errors.
+*/
+static int
+scan_sft_file( const CHAR *fname, SFTFileScan *scan )
+{
+  int errnum = XLAL_SUCCESS;
+
+  /* record file size and modification time */
+  scan->scan_time = time( NULL );
+  {
+    struct stat st;
+    if ( stat( fname, &st ) != 0 ) {
+      XLALPrintError( "ERROR: Failed to stat matched file '%s'\n\n", fname );
+      return XLAL_EIO;
+    }
+    scan->size = st.st_size;
+    scan->mtime = st.st_mtime;
+  }
+
+  FILE *fp;
+  if ( ( fp = fopen( fname, "rb" ) ) == NULL ) {
+    XLALPrintError( "ERROR: Failed to open matched file '%s'\n\n", fname );
+    return XLAL_EIO;
+  }
+
+  long file_len;
+  if ( ( file_len = get_file_len( fp ) ) == 0 ) {
+    XLALPrintError( "ERROR: got file-len == 0 for '%s'\n\n", fname );
+    errnum = XLAL_EIO;
+    goto failed;
+  }
+
+  /* merged SFTs need to satisfy stronger consistency-constraints (-> see spec) */
+  BOOLEAN mfirst_block = TRUE;
+  UINT4   mprev_version = 0;
+  SFTtype XLAL_INIT_DECL( mprev_header );
+  REAL8   mprev_nsamples = 0;
+  UINT2   mprev_windowspec = 0;
+
+  /* go through SFT-blocks in fp */
+  UINT4 maxBlocks = 0;
+  while ( ftell( fp ) < file_len ) {
+    SFTtype this_header;
+    UINT4 this_version;
+    UINT4 this_nsamples;
+    UINT8 this_crc;
+    UINT2 this_windowspec;
+    CHAR *this_comment = NULL;
+    BOOLEAN endian;
+
+    long this_filepos;
+    if ( ( this_filepos = ftell( fp ) ) == -1 ) {
+      XLALPrintError( "ERROR: ftell() failed for '%s'\n\n", fname );
+      errnum = XLAL_EIO;
+      goto failed;
+    }
+
+    if ( read_sft_header_from_fp( fp, &this_header, &this_version, &this_crc, &this_windowspec, &endian, &this_comment, &this_nsamples ) != 0 ) {
+      XLALPrintError( "ERROR: File-block '%s:%ld' is not a valid SFT!\n\n", fname, ftell( fp ) );
+      XLALFree( this_comment );
+      errnum = XLAL_EDATA;
+      goto failed;
+    }
+
+    /* if merged-SFT: check consistency constraints */
+    if ( !mfirst_block ) {
+      if ( ! consistent_mSFT_header( mprev_header, mprev_version, mprev_nsamples, mprev_windowspec, this_header, this_version, this_nsamples, this_windowspec ) ) {
+        XLALPrintError( "ERROR: merged SFT-file '%s' contains inconsistent SFT-blocks!\n\n", fname );
+        XLALFree( this_comment );
+        errnum = XLAL_EDATA;
+        goto failed;
+      }
+    } /* if !mfirst_block */
+
+    mprev_header = this_header;
+    mprev_version = this_version;
+    mprev_nsamples = this_nsamples;
+    mprev_windowspec = this_windowspec;
+
+    /* record this SFT-block */
+    if ( scan->numBlocks == maxBlocks ) {
+      maxBlocks = ( maxBlocks == 0 ) ? 1 : 2 * maxBlocks;
+      SFTIndexBlock *blocks = XLALRealloc( scan->blocks, maxBlocks * sizeof( *blocks ) );
+      if ( blocks != NULL ) {
+        scan->blocks = blocks;
+      }
+      CHAR **comments = XLALRealloc( scan->comments, maxBlocks * sizeof( *comments ) );
+      if ( comments != NULL ) {
+        scan->comments = comments;
+      }
+      if ( blocks == NULL || comments == NULL ) {
+        XLALPrintError( "ERROR: XLALRealloc() failed\n" );
+        XLALFree( this_comment );
+        errnum = XLAL_ENOMEM;
+        goto failed;
+      }
+    }
+    SFTIndexBlock *block = &( scan->blocks[scan->numBlocks] );
+    XLAL_INIT_MEM( *block );
+    block->offset = this_filepos;
+    block->f0 = this_header.f0;
+    block->deltaF = this_header.deltaF;
+    block->crc64 = this_crc;
+    block->gpsSeconds = this_header.epoch.gpsSeconds;
+    block->gpsNanoSeconds = this_header.epoch.gpsNanoSeconds;
+    block->version = this_version;
+    block->numBins = this_nsamples;
+    block->comment_length = ( this_comment != NULL ) ? strlen( this_comment ) + 1 : 0;
+    block->windowspec = this_windowspec;
+    memcpy( block->detector, this_header.name, sizeof( block->detector ) );
+    scan->comments[scan->numBlocks] = this_comment;
+    ++scan->numBlocks;
+
+    mfirst_block = FALSE;
+
+    /* skip seeking if we know we would reach the end */
+    if ( ftell( fp ) + ( long )this_nsamples * 8 >= file_len ) {
+      break;
+    }
+
+    /* seek to end of SFT data-entries in file  */
+    if ( fseek( fp, this_nsamples * 8, SEEK_CUR ) == -1 ) {
+      XLALPrintError( "ERROR: Failed to skip DATA field for SFT '%s': %s\n", fname, strerror( errno ) );
+      errnum = XLAL_EIO;
+      goto failed;
+    }
+
+  } /* while !feof */
+
+failed:
+  fclose( fp );
+  return errnum;
+
+} /* scan_sft_file() */
+
+
+/* free the contents of an SFTFileScan */
+static void
+free_sft_file_scan( SFTFileScan *scan )
+{
+  if ( scan->comments ) {
+    for ( UINT4 b = 0; b < scan->numBlocks; b ++ ) {
+      XLALFree( scan->comments[b] );
+    }
+  }
+  XLALFree( scan->comments );
+  XLALFree( scan->blocks );
+  XLALFree( scan->name );
+  XLAL_INIT_MEM( *scan );
+} /* free_sft_file_scan() */
+
+
+/*
+   Read the SFT index file of the directory 'index->dirname', if any.
+   An index file which is missing, unreadable, or of a different format or byte order is ignored.
+*/
+static void
+read_sft_index( SFTIndex *index )
+{
+  CHAR *fname = XLALStringAppendFmt( NULL, "%s/%s", index->dirname, SFT_INDEX_FILENAME );
+  if ( fname == NULL ) {
+    XLALClearErrno();
+    return;
+  }
+  FILE *fp = fopen( fname, "rb" );
+  if ( fp == NULL ) {
+    XLALFree( fname );
+    return;
+  }
+
+  /* check magic string, format version, byte order, and record layout */
+  CHAR magic[sizeof( SFT_INDEX_MAGIC ) - 1];
+  SFTIndexHeader header;
+  if ( fread( magic, sizeof( magic ), 1, fp ) != 1 || memcmp( magic, SFT_INDEX_MAGIC, sizeof( magic ) ) != 0
+       || fread( &header, sizeof( header ), 1, fp ) != 1 || header.format != SFT_INDEX_FORMAT
+       || header.byteorder != SFT_INDEX_BYTE_ORDER || header.record_size != sizeof( SFTIndexRecord )
+       || header.block_size != sizeof( SFTIndexBlock ) ) {
+    XLALPrintInfo( "%s: Ignoring SFT index file '%s' of unknown format or byte order\n", __func__, fname );
+    goto failed;
+  }
+
+  /* read records until end of file */
+  SFTIndexRecord record;
+  UINT4 maxFiles = 0;
+  while ( fread( &record, sizeof( record ), 1, fp ) == 1 ) {
+    if ( record.name_length == 0 || record.name_length > 4096 || record.numBlocks == 0 ) {
+      goto corrupt;
+    }
+    if ( index->numFiles == maxFiles ) {
+      maxFiles = ( maxFiles == 0 ) ? 64 : 2 * maxFiles;
+      SFTFileScan *files = XLALRealloc( index->files, maxFiles * sizeof( *files ) );
+      if ( files == NULL ) {
+        goto corrupt;
+      }
+      index->files = files;
+    }
+    SFTFileScan *file = &( index->files[index->numFiles] );
+    XLAL_INIT_MEM( *file );
+    file->size = record.size;
+    file->mtime = record.mtime;
+    file->scan_time = record.scan_time;
+    if ( ( file->name = XLALCalloc( 1, record.name_length + 1 ) ) == NULL
+         || fread( file->name, record.name_length, 1, fp ) != 1
+         || ( file->blocks = XLALCalloc( record.numBlocks, sizeof( file->blocks[0] ) ) ) == NULL
+         || ( file->comments = XLALCalloc( record.numBlocks, sizeof( file->comments[0] ) ) ) == NULL ) {
+      free_sft_file_scan( file );
+      goto corrupt;
+    }
+    file->numBlocks = record.numBlocks;
+    for ( UINT4 b = 0; b < file->numBlocks; b ++ ) {
+      SFTIndexBlock *block = &( file->blocks[b] );
+      if ( fread( block, sizeof( *block ), 1, fp ) != 1 || block->comment_length > ( 1U << 20 ) ) {
+        free_sft_file_scan( file );
+        goto corrupt;
+      }
+      if ( block->comment_length > 0 ) {
+        if ( ( file->comments[b] = XLALCalloc( 1, block->comment_length ) ) == NULL
+             || fread( file->comments[b], block->comment_length, 1, fp ) != 1
+             || file->comments[b][block->comment_length - 1] != 0 ) {
+          free_sft_file_scan( file );
+          goto corrupt;
+        }
+      }
+    }
+    ++index->numFiles;
+  }
+  if ( !feof( fp ) ) {
+    goto corrupt;
+  }
+
+  /* sort files by name for look-up */
+  qsort( index->files, index->numFiles, sizeof( index->files[0] ), compare_sft_file_scan_names );
+
+  fclose( fp );
+  XLALFree( fname );
+  return;
+
+corrupt:
+  XLALPrintInfo( "%s: Ignoring corrupt SFT index file '%s'\n", __func__, fname );
+  for ( UINT4 j = 0; j < index->numFiles; j ++ ) {
+    free_sft_file_scan( &index->files[j] );
+  }
+  XLALFree( index->files );
+  index->files = NULL;
+  index->numFiles = 0;
+  index->modified = TRUE;
+  XLALClearErrno();
+
+failed:
+  fclose( fp );
+  XLALFree( fname );
+
+} /* read_sft_index() */
+
+
+/*
+   Write the SFT index file of the directory 'index->dirname', containing all files in this
+   directory which were successfully scanned, plus all files from the previous index file
+   which were not rescanned. The index file is first written to a temporary file which then
+   replaces the index file, so that concurrent readers never see a partially-written index.
+   Failure to write the index file is not an error.
+*/
+static void
+write_sft_index( const SFTIndex *index, UINT4 k, const SFTFileScan *scans, const LALStringVector *fnames, const UINT4 *fileIndex )
+{
+
+  /* collect the files to record in the index */
+  UINT4 numFiles = 0;
+  SFTFileScan *files = XLALCalloc( fnames->length + index->numFiles, sizeof( *files ) );
+  if ( files == NULL ) {
+    XLALClearErrno();
+    return;
+  }
+  for ( UINT4 i = 0; i < fnames->length; i ++ ) {
+    if ( fileIndex[i] == k && scans[i].errnum == XLAL_SUCCESS && scans[i].numBlocks > 0 ) {
+      files[numFiles] = scans[i];
+      files[numFiles].name = ( CHAR * ) sft_file_basename( fnames->data[i] );
+      ++numFiles;
+    }
+  }
+  const UINT4 numScanned = numFiles;
+  qsort( files, numScanned, sizeof( files[0] ), compare_sft_file_scan_names );
+  for ( UINT4 j = 0; j < index->numFiles; j ++ ) {
+    if ( index->files[j].numBlocks > 0 ) {
+      /* drop files which were rescanned, whose recorded headers are stale */
+      if ( bsearch( index->files[j].name, files, numScanned, sizeof( files[0] ), compare_name_to_sft_file_scan ) != NULL ) {
+        continue;
+      }
+      /* drop files which no longer exist */
+      CHAR *path = XLALStringAppendFmt( NULL, "%s/%s", index->dirname, index->files[j].name );
+      struct stat st;
+      if ( path != NULL && stat( path, &st ) == 0 ) {
+        files[numFiles++] = index->files[j];
+      }
+      XLALFree( path );
+    }
+  }
+  qsort( files, numFiles, sizeof( files[0] ), compare_sft_file_scan_names );
+
+  /* write the index to a temporary file */
+  long pid = 0;
+#ifdef HAVE_UNISTD_H
+  pid = ( long ) getpid();
+#endif
+  CHAR *fname = XLALStringAppendFmt( NULL, "%s/%s", index->dirname, SFT_INDEX_FILENAME );
+  CHAR *tmpfname = XLALStringAppendFmt( NULL, "%s/%s.%ld", index->dirname, SFT_INDEX_FILENAME, pid );
+  FILE *fp = ( fname != NULL && tmpfname != NULL ) ? fopen( tmpfname, "wb" ) : NULL;
+  if ( fp == NULL ) {
+    XLALPrintInfo( "%s: Could not write SFT index file in directory '%s'\n", __func__, index->dirname );
+    XLALClearErrno();
+    XLALFree( files );
+    XLALFree( fname );
+    XLALFree( tmpfname );
+    return;
+  }
+  SFTIndexHeader XLAL_INIT_DECL( header );
+  header.format = SFT_INDEX_FORMAT;
+  header.byteorder = SFT_INDEX_BYTE_ORDER;
+  header.record_size = sizeof( SFTIndexRecord );
+  header.block_size = sizeof( SFTIndexBlock );
+  BOOLEAN ok = ( fwrite( SFT_INDEX_MAGIC, sizeof( SFT_INDEX_MAGIC ) - 1, 1, fp ) == 1 );
+  ok = ok && ( fwrite( &header, sizeof( header ), 1, fp ) == 1 );
+  for ( UINT4 j = 0; ok && j < numFiles; j ++ ) {
+    if ( j > 0 && strcmp( files[j - 1].name, files[j].name ) == 0 ) {
+      continue;   /* file was matched more than once */
+    }
+    SFTIndexRecord XLAL_INIT_DECL( record );
+    record.size = files[j].size;
+    record.mtime = files[j].mtime;
+    record.scan_time = files[j].scan_time;
+    record.name_length = strlen( files[j].name );
+    record.numBlocks = files[j].numBlocks;
+    ok = ok && ( fwrite( &record, sizeof( record ), 1, fp ) == 1 );
+    ok = ok && ( fwrite( files[j].name, record.name_length, 1, fp ) == 1 );
+    for ( UINT4 b = 0; ok && b < files[j].numBlocks; b ++ ) {
+      const SFTIndexBlock *block = &( files[j].blocks[b] );
+      ok = ok && ( fwrite( block, sizeof( *block ), 1, fp ) == 1 );
+      if ( block->comment_length > 0 ) {
+        ok = ok && ( fwrite( files[j].comments[b], block->comment_length, 1, fp ) == 1 );
+      }
+    }
+  }
+  ok = ( fclose( fp ) == 0 ) && ok;
+
+  /* replace the index file */
+  if ( ok && rename( tmpfname, fname ) == 0 ) {
+    XLALPrintInfo( "%s: Wrote SFT index file '%s' recording %u files\n", __func__, fname, numFiles );
+  } else {
+    XLALPrintInfo( "%s: Could not write SFT index file '%s'\n", __func__, fname );
+    remove( tmpfname );
+  }
+
+  XLALFree( files );
+  XLALFree( fname );
+  XLALFree( tmpfname );
+
+} /* write_sft_index() */
+
+
+/* return the part of the file name 'fname' after the last directory separator */
+static const CHAR *
+sft_file_basename( const CHAR *fname )
+{
+  const CHAR *bname = strrchr( fname, '/' );
+  return ( bname != NULL ) ? bname + 1 : fname;
+} /* sft_file_basename() */
+
+
+/* compare two SFTFileScan entries by name */
+static int
+compare_sft_file_scan_names( const void *ptr1, const void *ptr2 )
+{
+  return strcmp( ( ( const SFTFileScan * ) ptr1 )->name, ( ( const SFTFileScan * ) ptr2 )->name );
+} /* compare_sft_file_scan_names() */
+
+
+/* compare a file name to the name of an SFTFileScan entry, for bsearch() */
+static int
+compare_name_to_sft_file_scan( const void *ptr1, const void *ptr2 )
+{
+  return strcmp( ( const CHAR * ) ptr1, ( ( const SFTFileScan * ) ptr2 )->name );
+} /* compare_name_to_sft_file_scan() */
+
+
 /* check consistency constraints for SFT-blocks within a merged SFT-file, see \cite SFT-spec */
 static BOOLEAN
 consistent_mSFT_header( SFTtype header1, UINT4 version1, UINT4 nsamples1, UINT2 windowspec1, SFTtype header2, UINT4 version2, UINT4 nsamples2, UINT2 windowspec2 )
@@ -25,6 +25,16 @@
 
 /*---------- includes ----------*/
 
+#include <config.h>
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_UNISTD_H)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define HAVE_SFT_MMAP 1
+#endif
+
 #include "SFTinternal.h"
 #include "SFTReferenceLibrary.h"
 
@@ -56,8 +66,35 @@ typedef struct {
   struct tagSFTLocator *lastfrom;  /**< last bin read from this locator */
 } SFTReadSegment;
 
+/** a memory-mapped SFT file */
+typedef struct {
+  CHAR *fname;                     /**< name of the SFT file */
+  char *addr;                      /**< start of the mapping, or NULL if the file could not be mapped */
+  size_t length;                   /**< length of the mapping in bytes */
+} SFTMappedFile;
+
+/** an SFT block in a memory-mapped SFT file, whose CRC64 checksum is checked on demand */
+typedef struct {
+  UINT4 ifile;                     /**< index of the file containing this block */
+  long offset;                     /**< offset of this block in the file */
+  BOOLEAN crc_checked;             /**< whether the CRC64 checksum of this block has been verified */
+} SFTMappedBlock;
+
+/** SFTs whose data may point directly into memory-mapped SFT files */
+struct tagMappedSFTVector {
+  SFTVector *sfts;                 /**< the SFTs */
+  BOOLEAN *is_mapped;              /**< whether the data of each SFT points into a mapped file */
+  UINT4 numFiles;                  /**< number of mapped files */
+  SFTMappedFile *files;            /**< mapped files */
+  UINT4 numBlocks;                 /**< number of SFT blocks */
+  SFTMappedBlock *blocks;          /**< SFT blocks in the mapped files */
+};
+
 /*---------- internal prototypes ----------*/
 
+static int map_sft_file( MappedSFTVector *mappedSFTs, const CHAR *fname, UINT4 *ifile );
+static int read_header_from_map( const SFTMappedFile *file, long offset, _SFT_header_t *rawheader, BOOLEAN *swapEndian, char **data );
+static BOOLEAN has_valid_crc64_in_map( const SFTMappedFile *file, long offset );
 static int read_header_from_fp( FILE *fp, SFTtype *header, UINT4 *nsamples, UINT8 *header_crc64, UINT8 *ref_crc64, UINT2 *SFTwindowspec, CHAR **SFTcomment, BOOLEAN swapEndian );
 
 /*========== function definitions ==========*/
@@ -477,6 +514,248 @@ XLALLoadMultiSFTsFromView( const MultiSFTCatalogView *multiCatalogView, /**< The
 } // XLALLoadMultiSFTsFromView()
 
 
+/**
+ * Load the given frequency-band <tt>[fMin, fMax)</tt> (half-open) from the SFT-files listed in the
+ * SFT-'catalogue' ( returned by XLALSFTdataFind() ), memory-mapping the SFT-files instead of reading them.
+ *
+ * Each SFT-file is mapped once, read-only. Where the requested band of an SFT lies within a single
+ * SFT-block stored in native byte order, the data of the returned SFT point directly into the mapping, so
+ * no copy is made and only the pages containing the requested band are ever read from disk. If the block
+ * is stored in non-native byte order, the requested band is byte-swapped from the mapping into an
+ * allocated buffer. SFTs split over several SFT-blocks are loaded with XLALLoadSFTs(). The returned
+ * SFTs are otherwise identical to those returned by XLALLoadSFTs(), whose documentation applies.
+ *
+ * Note: CRC64 checksums are not verified here; use XLALCheckCRCMappedSFTs() to verify them on demand.
+ * The SFT data are read-only, since they may point into a read-only mapping; copy them, e.g. with
+ * XLALDuplicateSFTVector(), to modify them.
+ */
+MappedSFTVector *
+XLALLoadMappedSFTs( const SFTCatalog *catalog,   /**< The 'catalogue' of SFTs to load */
+                    REAL8 fMin,                  /**< minumum requested frequency (-1 = read from lowest) */
+                    REAL8 fMax                   /**< maximum requested frequency (-1 = read up to highest) */
+                  )
+{
+  XLAL_CHECK_NULL( catalog != NULL, XLAL_EINVAL );
+  XLAL_CHECK_NULL( catalog->length > 0, XLAL_EINVAL );
+
+  MappedSFTVector *mappedSFTs = NULL;
+
+  /* determine number of SFTs, i.e. number of different GPS timestamps,
+     and max and min bin of all SFTs in the catalog, as in XLALLoadSFTs() */
+  const REAL8 deltaF = catalog->data[0].header.deltaF; /* Hz/bin */
+  UINT4 nSFTs = 1;
+  UINT4 minbin = lround( catalog->data[0].header.f0 / deltaF );
+  UINT4 maxbin = minbin + catalog->data[0].numBins - 1;
+  for ( UINT4 catPos = 1; catPos < catalog->length; catPos++ ) {
+    const UINT4 firstSFTbin = lround( catalog->data[catPos].header.f0 / deltaF );
+    const UINT4 lastSFTbin = firstSFTbin + catalog->data[catPos].numBins - 1;
+    if ( firstSFTbin < minbin ) {
+      minbin = firstSFTbin;
+    }
+    if ( lastSFTbin > maxbin ) {
+      maxbin = lastSFTbin;
+    }
+    if ( !GPSEQUAL( catalog->data[catPos - 1].header.epoch, catalog->data[catPos].header.epoch ) ) {
+      nSFTs++;
+    }
+  }
+
+  /* calculate first and last frequency bin to read */
+  const UINT4 firstbin = ( fMin < 0 ) ? minbin : XLALRoundFrequencyDownToSFTBin( fMin, deltaF );
+  const UINT4 lastbin = ( fMax < 0 ) ? maxbin : XLALRoundFrequencyUpToSFTBin( fMax, deltaF ) - 1;
+  XLAL_CHECK_NULL( fMax < 0 || lastbin != 0 || fMax == 0, XLAL_EINVAL, "Last bin to read is 0 (fMax: %f, deltaF: %f)", fMax, deltaF );
+  XLAL_CHECK_NULL( firstbin <= lastbin, XLAL_EINVAL, "Empty frequency-interval requested [%u, %u] bins", firstbin, lastbin );
+  const UINT4 numBins = lastbin + 1 - firstbin;
+  XLALPrintInfo( "%s: Mapping from first bin: %u, last bin: %u\n", __func__, firstbin, lastbin );
+
+  /* allocate the mapped SFT vector; SFT data are allocated or mapped below */
+  XLAL_CHECK_FAIL( ( mappedSFTs = XLALCalloc( 1, sizeof( *mappedSFTs ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_FAIL( ( mappedSFTs->is_mapped = XLALCalloc( nSFTs, sizeof( mappedSFTs->is_mapped[0] ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_FAIL( ( mappedSFTs->blocks = XLALCalloc( catalog->length, sizeof( mappedSFTs->blocks[0] ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_FAIL( ( mappedSFTs->sfts = XLALCreateSFTVector( nSFTs, 0 ) ) != NULL, XLAL_EFUNC );
+
+  /* loop over SFTs, i.e. over ranges of catalog entries with the same GPS timestamp */
+  UINT4 isft = 0;
+  for ( UINT4 catStart = 0, catEnd = 0; catStart < catalog->length; catStart = catEnd, isft++ ) {
+    while ( catEnd < catalog->length && GPSEQUAL( catalog->data[catStart].header.epoch, catalog->data[catEnd].header.epoch ) ) {
+      catEnd++;
+    }
+    SFTtype *sft = &( mappedSFTs->sfts->data[isft] );
+
+    /* map the files containing the SFT blocks with this timestamp, and look for a single block containing the whole band */
+    const SFTDescriptor *cover = NULL;
+    const SFTMappedBlock *coverBlock = NULL;
+    for ( UINT4 catPos = catStart; catPos < catEnd; catPos++ ) {
+      const SFTDescriptor *desc = &( catalog->data[catPos] );
+      if ( desc->header.data != NULL || desc->locator == NULL ) {
+        continue;  /* SFT data is already held in the catalog */
+      }
+      SFTMappedBlock *block = &( mappedSFTs->blocks[mappedSFTs->numBlocks++] );
+      XLAL_CHECK_FAIL( map_sft_file( mappedSFTs, desc->locator->fname, &block->ifile ) == XLAL_SUCCESS, XLAL_EFUNC );
+      block->offset = desc->locator->offset;
+      const UINT4 firstSFTbin = lround( desc->header.f0 / deltaF );
+      if ( desc->header.deltaF == deltaF && firstSFTbin <= firstbin && lastbin < firstSFTbin + desc->numBins ) {
+        cover = desc;
+        coverBlock = block;
+      }
+    }
+
+    /* point SFT data directly into the mapped file if possible, otherwise copy them from it */
+    if ( cover != NULL ) {
+      const UINT4 firstSFTbin = lround( cover->header.f0 / deltaF );
+      _SFT_header_t rawheader;
+      BOOLEAN swapEndian;
+      char *data;
+      if ( read_header_from_map( &( mappedSFTs->files[coverBlock->ifile] ), coverBlock->offset, &rawheader, &swapEndian, &data ) == 0
+           && ( UINT4 ) rawheader.nsamples == cover->numBins ) {
+        data += ( firstbin - firstSFTbin ) * sizeof( COMPLEX8 );
+        if ( !swapEndian && ( ( uintptr_t ) data ) % sizeof( REAL4 ) == 0 ) {
+          XLAL_CHECK_FAIL( ( sft->data = XLALMalloc( sizeof( *sft->data ) ) ) != NULL, XLAL_ENOMEM );
+          sft->data->length = numBins;
+          sft->data->data = ( COMPLEX8 * ) data;
+          mappedSFTs->is_mapped[isft] = 1;
+        } else {
+          /* byte-swap (or realign) the frequency-bins into an allocated buffer */
+          XLAL_CHECK_FAIL( ( sft->data = XLALCreateCOMPLEX8Vector( numBins ) ) != NULL, XLAL_EFUNC );
+          memcpy( sft->data->data, data, numBins * sizeof( COMPLEX8 ) );
+          if ( swapEndian ) {
+            endian_swap( ( CHAR * ) sft->data->data, sizeof( REAL4 ), 2 * numBins );
+          }
+        }
+        memcpy( sft->name, cover->header.name, sizeof( sft->name ) );
+        sft->epoch = cover->header.epoch;
+        sft->f0 = 1.0 * firstbin * deltaF;
+        sft->deltaF = deltaF;
+        sft->sampleUnits = cover->header.sampleUnits;
+        XLALPrintInfo( "%s: Mapped data from %s:%lu: %u - %u\n", __func__, cover->locator->fname, cover->locator->offset, firstbin, lastbin );
+        continue;
+      }
+    }
+
+    /* otherwise load the SFT data with XLALLoadSFTs() */
+    {
+      SFTCatalog XLAL_INIT_DECL( slice );
+      slice.length = catEnd - catStart;
+      slice.data = &( catalog->data[catStart] );
+      SFTVector *loaded = XLALLoadSFTs( &slice, firstbin * deltaF, ( lastbin + 1 ) * deltaF );
+      XLAL_CHECK_FAIL( loaded != NULL, XLAL_EFUNC );
+      XLAL_CHECK_FAIL( loaded->length == 1 && loaded->data[0].data->length == numBins, XLAL_EFAILED, "Inconsistent SFT loaded for SFT#%u (GPS %lf)", isft, GPS2REAL8( catalog->data[catStart].header.epoch ) );
+      ( *sft ) = loaded->data[0];
+      loaded->data[0].data = NULL;
+      XLALDestroySFTVector( loaded );
+    }
+
+  } // for catStart < catalog->length
+  XLAL_CHECK_FAIL( isft == nSFTs, XLAL_EFAILED );
+
+  return mappedSFTs;
+
+XLAL_FAIL:
+  XLALDestroyMappedSFTVector( mappedSFTs );
+  return NULL;
+
+} // XLALLoadMappedSFTs()
+
+
+/**
+ * Return the SFTs of a MappedSFTVector. The returned SFTVector is owned by \a mappedSFTs,
+ * and must not be destroyed with XLALDestroySFTVector().
+ */
+const SFTVector *
+XLALMappedSFTVectorGetSFTs( const MappedSFTVector *mappedSFTs )
+{
+  XLAL_CHECK_NULL( mappedSFTs != NULL, XLAL_EFAULT );
+  return mappedSFTs->sfts;
+} // XLALMappedSFTVectorGetSFTs()
+
+
+/**
+ * Verify the CRC64 checksums of all SFT-blocks from which a MappedSFTVector was loaded.
+ * Each block is only verified once: subsequent calls skip blocks that have already passed.
+ * The result of the validation is returned in '*crc_check'.
+ */
+int
+XLALCheckCRCMappedSFTs( BOOLEAN *crc_check,            /**< set to true if checksum validation passes */
+                        MappedSFTVector *mappedSFTs    /**< SFTs loaded by XLALLoadMappedSFTs() */
+                      )
+{
+  XLAL_CHECK( crc_check != NULL, XLAL_EINVAL );
+  XLAL_CHECK( mappedSFTs != NULL, XLAL_EINVAL );
+
+  /* CRC checks are assumed to pass until one fails */
+  *crc_check = 1;
+
+  for ( UINT4 i = 0; i < mappedSFTs->numBlocks; i++ ) {
+    SFTMappedBlock *block = &( mappedSFTs->blocks[i] );
+    if ( block->crc_checked ) {
+      continue;
+    }
+    const SFTMappedFile *file = &( mappedSFTs->files[block->ifile] );
+    BOOLEAN valid;
+    if ( file->addr != NULL ) {
+      valid = has_valid_crc64_in_map( file, block->offset );
+    } else {
+      /* file could not be mapped, so read the SFT block from it */
+      FILE *fp = fopen( file->fname, "rb" );
+      XLAL_CHECK( fp != NULL, XLAL_EIO, "Failed to open SFT '%s' for reading: %s", file->fname, strerror( errno ) );
+      if ( fseek( fp, block->offset, SEEK_SET ) == -1 ) {
+        fclose( fp );
+        XLAL_ERROR( XLAL_EIO, "Failed to set fp-offset to '%ld': %s", block->offset, strerror( errno ) );
+      }
+      valid = ( has_valid_crc64( fp ) != 0 );
+      fclose( fp );
+    }
+    if ( valid ) {
+      block->crc_checked = 1;
+    } else {
+      XLALPrintError( "CRC64 checksum failure for SFT '%s' at offset %ld\n", file->fname, block->offset );
+      *crc_check = 0;
+    }
+  }
+
+  return XLAL_SUCCESS;
+
+} // XLALCheckCRCMappedSFTs()
+
+
+/**
+ * Destroy a MappedSFTVector, freeing any loaded SFT data and unmapping the SFT-files.
+ */
+void
+XLALDestroyMappedSFTVector( MappedSFTVector *mappedSFTs )
+{
+  if ( !mappedSFTs ) {
+    return;
+  }
+
+  if ( mappedSFTs->sfts ) {
+    /* mapped SFT data was not allocated, so only free its container */
+    for ( UINT4 i = 0; i < mappedSFTs->sfts->length; i++ ) {
+      if ( mappedSFTs->is_mapped[i] ) {
+        XLALFree( mappedSFTs->sfts->data[i].data );
+        mappedSFTs->sfts->data[i].data = NULL;
+      }
+    }
+    XLALDestroySFTVector( mappedSFTs->sfts );
+  }
+
+  for ( UINT4 i = 0; i < mappedSFTs->numFiles; i++ ) {
+#ifdef HAVE_SFT_MMAP
+    if ( mappedSFTs->files[i].addr ) {
+      munmap( mappedSFTs->files[i].addr, mappedSFTs->files[i].length );
+    }
+#endif
+    XLALFree( mappedSFTs->files[i].fname );
+  }
+
+  XLALFree( mappedSFTs->files );
+  XLALFree( mappedSFTs->blocks );
+  XLALFree( mappedSFTs->is_mapped );
+  XLALFree( mappedSFTs );
+
+} // XLALDestroyMappedSFTVector()
+
+
 /**
  * Write the given SFTtype to a FILE pointer.
  * Add the comment to SFT if SFTcomment != NULL.
@@ -1401,6 +1680,160 @@ read_sft_bins_from_fp( SFTtype *ret, UINT4 *firstBinRead, UINT4 firstBin2read, U
 } /* read_sft_bins_from_fp() */
 
 
+/*
+   Find the SFT-file 'fname' among the files of a MappedSFTVector, mapping it if necessary,
+   and return its index in 'ifile'. A file which cannot be mapped is recorded with a NULL
+   mapping, so that SFTs from it are loaded with XLALLoadSFTs() instead.
+*/
+static int
+map_sft_file( MappedSFTVector *mappedSFTs, const CHAR *fname, UINT4 *ifile )
+{
+
+  /* SFTs in a catalog are sorted by GPS time, so consecutive SFTs are usually found in the same file */
+  for ( UINT4 i = mappedSFTs->numFiles; i > 0; i-- ) {
+    if ( strcmp( mappedSFTs->files[i - 1].fname, fname ) == 0 ) {
+      *ifile = i - 1;
+      return XLAL_SUCCESS;
+    }
+  }
+
+  /* add a new file */
+  XLAL_CHECK( ( mappedSFTs->files = XLALRealloc( mappedSFTs->files, ( mappedSFTs->numFiles + 1 ) * sizeof( mappedSFTs->files[0] ) ) ) != NULL, XLAL_ENOMEM );
+  SFTMappedFile *file = &( mappedSFTs->files[mappedSFTs->numFiles] );
+  XLAL_INIT_MEM( *file );
+  XLAL_CHECK( ( file->fname = XLALStringDuplicate( fname ) ) != NULL, XLAL_EFUNC );
+  *ifile = mappedSFTs->numFiles++;
+
+#ifdef HAVE_SFT_MMAP
+  int fd = open( fname, O_RDONLY );
+  if ( fd == -1 ) {
+    XLALPrintInfo( "%s: Couldn't open file '%s': %s\n", __func__, fname, strerror( errno ) );
+    return XLAL_SUCCESS;
+  }
+  struct stat st;
+  if ( fstat( fd, &st ) == 0 && st.st_size > 0 ) {
+    /* map read-only; SFT data pointing into the mapping are returned as const */
+    void *addr = mmap( NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+    if ( addr != MAP_FAILED ) {
+      file->addr = addr;
+      file->length = st.st_size;
+      XLALPrintInfo( "%s: Mapped file '%s' (%zu bytes)\n", __func__, fname, file->length );
+    } else {
+      XLALPrintInfo( "%s: Couldn't map file '%s': %s\n", __func__, fname, strerror( errno ) );
+    }
+  }
+  close( fd );
+#endif
+
+  return XLAL_SUCCESS;
+
+} /* map_sft_file() */
+
+
+/*
+   Read an SFT-header from the block at 'offset' in a memory-mapped SFT-file.
+   Returns the (endian-swapped, if required) header in 'rawheader', and sets 'data' to point to
+   the frequency-bins of the block in the mapping. Checks that the whole block lies within the mapping.
+   RETURN: 0 = OK, -1 = ERROR
+*/
+static int
+read_header_from_map( const SFTMappedFile *file, long offset, _SFT_header_t *rawheader, BOOLEAN *swapEndian, char **data )
+{
+
+  if ( file->addr == NULL || offset < 0 || ( size_t ) offset + sizeof( *rawheader ) > file->length ) {
+    return -1;
+  }
+  memcpy( rawheader, file->addr + offset, sizeof( *rawheader ) );
+
+  /* figure out endian-ness from the version-number, as in read_SFTversion_from_fp() */
+  UINT4 version;
+  for ( version = MAX_SFT_VERSION; version >= MIN_SFT_VERSION; --version ) {
+    REAL8 vertest = version;
+    if ( ! memcmp( &rawheader->version, &vertest, sizeof( vertest ) ) ) {
+      *swapEndian = FALSE;
+      break;
+    }
+    endian_swap( ( char * )( &vertest ), sizeof( vertest ), 1 );
+    if ( ! memcmp( &rawheader->version, &vertest, sizeof( vertest ) ) ) {
+      *swapEndian = TRUE;
+      break;
+    }
+  }
+  if ( version < MIN_SFT_VERSION ) {
+    return -1;
+  }
+
+  if ( *swapEndian ) {
+    endian_swap( ( CHAR * )( &rawheader->version ),                  sizeof( rawheader->version ), 1 );
+    endian_swap( ( CHAR * )( &rawheader->gps_sec ),                  sizeof( rawheader->gps_sec ), 1 );
+    endian_swap( ( CHAR * )( &rawheader->gps_nsec ),                 sizeof( rawheader->gps_nsec ), 1 );
+    endian_swap( ( CHAR * )( &rawheader->tbase ),                    sizeof( rawheader->tbase ), 1 );
+    endian_swap( ( CHAR * )( &rawheader->first_frequency_index ),    sizeof( rawheader->first_frequency_index ), 1 );
+    endian_swap( ( CHAR * )( &rawheader->nsamples ),                 sizeof( rawheader->nsamples ), 1 );
+    endian_swap( ( CHAR * )( &rawheader->crc64 ),                    sizeof( rawheader->crc64 ), 1 );
+    endian_swap( ( CHAR * )( &rawheader->windowspec ),               sizeof( rawheader->windowspec ), 1 );
+    endian_swap( ( CHAR * )( &rawheader->comment_length ),           sizeof( rawheader->comment_length ), 1 );
+  }
+
+  if ( rawheader->nsamples <= 0 || rawheader->comment_length < 0 || rawheader->comment_length % 8 != 0 ) {
+    return -1;
+  }
+
+  /* check that comment and frequency-bins lie within the mapping */
+  const size_t data_offset = ( size_t ) offset + sizeof( *rawheader ) + ( size_t ) rawheader->comment_length;
+  if ( data_offset + ( size_t ) rawheader->nsamples * sizeof( COMPLEX8 ) > file->length ) {
+    return -1;
+  }
+  *data = file->addr + data_offset;
+
+  return 0;
+
+} /* read_header_from_map() */
+
+
+/*
+   Check the SFT-block at 'offset' in a memory-mapped SFT-file for valid crc64 checksum.
+   The checksum is computed on the same bytes as in has_valid_crc64().
+*/
+static BOOLEAN
+has_valid_crc64_in_map( const SFTMappedFile *file, long offset )
+{
+  _SFT_header_t rawheader;
+  BOOLEAN swapEndian;
+  char *data;
+
+  if ( read_header_from_map( file, offset, &rawheader, &swapEndian, &data ) != 0 ) {
+    return FALSE;
+  }
+
+  /* compute CRC for the header on the *bytes*, with the checksum set to zero */
+  _SFT_header_t header_bytes;
+  memcpy( &header_bytes, file->addr + offset, sizeof( header_bytes ) );
+  header_bytes.crc64 = 0;
+  UINT8 computed_crc = crc64( ( const unsigned char * )&header_bytes, sizeof( header_bytes ), ~( 0ULL ) );
+
+  /* include the comment and its padding, as in read_header_from_fp() */
+  if ( rawheader.comment_length ) {
+    const char *comm = file->addr + offset + sizeof( header_bytes );
+    if ( comm[ rawheader.comment_length - 1] != 0 ) {
+      return FALSE;
+    }
+    const CHAR pad[] = {0, 0, 0, 0, 0, 0, 0};
+    UINT4 comment_len = strlen( comm ) + 1;
+    UINT4 pad_len = ( 8 - ( comment_len % 8 ) ) % 8;
+    computed_crc = crc64( ( const unsigned char * )comm, comment_len, computed_crc );
+    computed_crc = crc64( ( const unsigned char * )pad, pad_len, computed_crc );
+  }
+
+  /* include the frequency-bins: don't endian-swap for that! */
+  computed_crc = crc64( ( const unsigned char * )data, rawheader.nsamples * sizeof( COMPLEX8 ), computed_crc );
+
+  /* check that checksum is consistent */
+  return ( computed_crc == rawheader.crc64 );
+
+} /* has_valid_crc64_in_map() */
+
+
 /**
  * Check the SFT-block starting at fp for valid crc64 checksum.
  * Restores filepointer before leaving.
@@ -159,6 +159,12 @@ extern "C" {
  * The function XLALLoadMultiSFTs() is similar to the above, except that it accepts an SFTCatalog with different detectors,
  * and returns corresponding multi-IFO vector of SFTVectors.
  *
+ * The function XLALLoadMappedSFTs() is an alternative to XLALLoadSFTs() for large SFT files: each SFT file is
+ * memory-mapped once, read-only, and where the requested band lies within a single native-endian SFT block the
+ * returned SFT data point directly into the mapping, so that only the pages containing the band are ever read.
+ * CRC64 checksums are not verified on loading, but on demand with XLALCheckCRCMappedSFTs(). The returned SFT
+ * data must not be modified.
+ *
  * <p><h2>Usage: Writing of SFT-files</h2>
  *
  * For <b>writing SFTs</b>:
@@ -284,6 +290,13 @@ typedef struct tagSFTFilenameSpec {
   UINT4 nbBinWidthRem;          /**< For narrow-band SFTs: remainder of division of SFT bandwidth by SFT time base */
 } SFTFilenameSpec;
 
+/**
+ * An SFTVector loaded by XLALLoadMappedSFTs(), whose frequency bins point directly into
+ * memory-mapped SFT files wherever possible. This type is opaque: use XLALMappedSFTVectorGetSFTs()
+ * to access the SFTs, and free it with XLALDestroyMappedSFTVector() (\em not XLALDestroySFTVector()).
+ */
+typedef struct tagMappedSFTVector MappedSFTVector;
+
 /*---------- exported prototypes [API] ----------*/
 
 /**
@@ -523,6 +536,14 @@ SFTVector *XLALLoadSFTs( const SFTCatalog *catalog, REAL8 fMin, REAL8 fMax );
 MultiSFTVector *XLALLoadMultiSFTs( const SFTCatalog *catalog, REAL8 fMin, REAL8 fMax );
 MultiSFTVector *XLALLoadMultiSFTsFromView( const MultiSFTCatalogView *multiCatalogView, REAL8 fMin, REAL8 fMax );
 
+MappedSFTVector *XLALLoadMappedSFTs( const SFTCatalog *catalog, REAL8 fMin, REAL8 fMax );
+#ifdef SWIG // SWIG interface directives
+SWIGLAL( RETURN_OWNED_BY_1ST_ARG( const SFTVector *, XLALMappedSFTVectorGetSFTs ) );
+#endif
+const SFTVector *XLALMappedSFTVectorGetSFTs( const MappedSFTVector *mappedSFTs );
+int XLALCheckCRCMappedSFTs( BOOLEAN *crc_check, MappedSFTVector *mappedSFTs );
+void XLALDestroyMappedSFTVector( MappedSFTVector *mappedSFTs );
+
 // These functions are defined in SFDBfileIO.c
 
 MultiSFTVector *XLALReadSFDB( REAL8 f_min, REAL8 f_max, const CHAR *file_pattern, const CHAR *timeStampsStarting, const CHAR *timeStampsFinishing );
@@ -210,7 +210,7 @@ main( int argc, char *argv[] )
             }
 
             // for resampling methods, check time series extraction and consistency
-            if ( iMethod >= FMETHOD_RESAMP_GENERIC ) {
+            if ( iMethod >= FMETHOD_RESAMP_GENERIC && iMethod <= FMETHOD_RESAMP_BEST ) {
               if ( first_SRC_a == NULL ) {
                 XLAL_CHECK( XLALExtractResampledTimeseries( &first_SRC_a, &first_SRC_b, input_seg2[iMethod] ) == XLAL_SUCCESS, XLAL_EFUNC );
                 XLAL_CHECK( first_SRC_a != NULL, XLAL_EFAULT );
@@ -270,6 +270,68 @@ main( int argc, char *argv[] )
 
   } // for iSky < numSkyPoints
 
+  // ----- test XLALComputeFstatBatch(): must agree with XLALComputeFstat() called for each Doppler point in turn
+  {
+    const UINT4 numBatch = 3;
+    PulsarDopplerParams batchDopplers[numBatch];
+    for ( UINT4 i = 0; i < numBatch; i ++ ) {
+      batchDopplers[i] = Doppler;
+      batchDopplers[i].fkdot[1] += i * df1dot;
+    }
+    for ( UINT4 iMethod = FMETHOD_START; iMethod < FMETHOD_END; iMethod ++ ) {
+      if ( !XLALFstatMethodIsAvailable( iMethod ) || ( iMethod == FMETHOD_DEMOD_BEST ) || ( iMethod == FMETHOD_RESAMP_BEST ) ) {
+        continue;
+      }
+      FstatResults *results_batch[numBatch];
+      for ( UINT4 i = 0; i < numBatch; i ++ ) {
+        results_batch[i] = NULL;
+      }
+      XLAL_CHECK( XLALComputeFstatBatch( results_batch, input_seg1[iMethod], batchDopplers, numBatch, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+      for ( UINT4 i = 0; i < numBatch; i ++ ) {
+        XLAL_CHECK( XLALComputeFstat( &results_seg1[iMethod], input_seg1[iMethod], &batchDopplers[i], numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLALPrintInfo( "Comparing batch and single-point results for method '%s', point %u\n", XLALGetFstatInputMethodName( input_seg1[iMethod] ), i );
+        if ( compareFstatResults( results_seg1[iMethod], results_batch[i] ) != XLAL_SUCCESS ) {
+          XLALPrintError( "Comparison between batch and single-point results for method '%s' failed at point %u\n", XLALGetFstatInputMethodName( input_seg1[iMethod] ), i );
+          XLAL_ERROR( XLAL_EFUNC );
+        }
+        XLALDestroyFstatResults( results_batch[i] );
+      }
+    }
+    // threaded Resamp batch must agree with serial single-point results
+    {
+      optionalArgs.FstatMethod = FMETHOD_RESAMP_GENERIC;
+      optionalArgs.prevInput = NULL;
+      optionalArgs.resampFFTPowerOf2 = ( 1 == 1 );
+      optionalArgs.resampNumThreads = 2;
+      FstatInput *input_threaded = NULL;
+      XLAL_CHECK( ( input_threaded = XLALCreateFstatInput( catalog, minCoverFreq, maxCoverFreq, dFreq, ephem, &optionalArgs ) ) != NULL, XLAL_EFUNC );
+      optionalArgs.resampNumThreads = 0;
+      FstatResults *results_batch[numBatch];
+      for ( UINT4 i = 0; i < numBatch; i ++ ) {
+        results_batch[i] = NULL;
+      }
+      XLAL_CHECK( XLALComputeFstatBatch( results_batch, input_threaded, batchDopplers, numBatch, numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+      for ( UINT4 i = 0; i < numBatch; i ++ ) {
+        XLAL_CHECK( XLALComputeFstat( &results_seg1[FMETHOD_RESAMP_GENERIC], input_seg1[FMETHOD_RESAMP_GENERIC], &batchDopplers[i], numFreqBins, whatToCompute ) == XLAL_SUCCESS, XLAL_EFUNC );
+        if ( compareFstatResults( results_seg1[FMETHOD_RESAMP_GENERIC], results_batch[i] ) != XLAL_SUCCESS ) {
+          XLALPrintError( "Comparison between threaded batch and single-point results for method 'ResampGeneric' failed at point %u\n", i );
+          XLAL_ERROR( XLAL_EFUNC );
+        }
+        XLALDestroyFstatResults( results_batch[i] );
+      }
+      XLALDestroyFstatInput( input_threaded );
+    }
+    // batch points with different sky positions must be rejected
+    batchDopplers[numBatch - 1].Alpha += dSky;
+    FstatResults *results_batch[numBatch];
+    for ( UINT4 i = 0; i < numBatch; i ++ ) {
+      results_batch[i] = NULL;
+    }
+    int errnum;
+    XLAL_TRY_SILENT( XLALComputeFstatBatch( results_batch, input_seg1[FMETHOD_DEMOD_BEST], batchDopplers, numBatch, numFreqBins, whatToCompute ), errnum );
+    XLAL_CHECK( errnum == XLAL_EINVAL, XLAL_EFAILED, "XLALComputeFstatBatch() did not reject Doppler points with different sky positions" );
+  }
+
   // ----- test XLALFstatInputTimeslice()
   // setup optional Fstat arguments
   optionalArgs.FstatMethod = FMETHOD_DEMOD_BEST; // only use demod best
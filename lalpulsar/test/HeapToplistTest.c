@@ -41,6 +41,11 @@ static int smaller( const void *a, const void *b )
   }
 }
 
+static double rank( const void *a )
+{
+  return *( ( const elem_t * )a );
+}
+
 static void print_elem( void *e )
 {
   printf( "%f ", *( ( elem_t * )e ) );
@@ -50,7 +55,8 @@ int main( int argc, char **argv )
 {
   elem_t elem;
   int i, n, m;
-  toplist_t *l;
+  toplist_t *l, *merged;
+  concurrent_toplist_t *cl;
 
   if ( argc < 2 ) {
     n = 20;
@@ -65,12 +71,27 @@ int main( int argc, char **argv )
   }
 
   create_toplist( &l, m, sizeof( elem_t ), smaller );
+  create_toplist( &merged, m, sizeof( elem_t ), smaller );
+  create_concurrent_toplist( &cl, 3, m, sizeof( elem_t ), smaller, rank );
   for ( i = 0; i < n; i++ ) {
     elem = rand() / ( double )RAND_MAX;
     insert_into_toplist( l, &elem );
+    insert_into_concurrent_toplist( cl, i % 3, &elem );
     go_through_toplist( l, print_elem );
     printf( "\n" );
   }
+
+  /* the merged concurrent toplist must hold the same elements */
+  merge_concurrent_toplist( cl, merged );
+  qsort_toplist( l, smaller );
+  qsort_toplist( merged, smaller );
+  if ( compare_toplists( l, merged ) != 0 ) {
+    fprintf( stderr, "merged concurrent toplist differs from toplist\n" );
+    return ( 1 );
+  }
+  free_toplist( &merged );
+  free_concurrent_toplist( &cl );
+
   qsort_toplist_r( l, smaller );
   go_through_toplist( l, print_elem );
   printf( "\n" );
@@ -78,4 +99,5 @@ int main( int argc, char **argv )
   go_through_toplist( l, print_elem );
   printf( "\n" );
   free_toplist( &l );
+  return ( 0 );
 }
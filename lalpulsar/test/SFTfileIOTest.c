@@ -21,6 +21,11 @@
 /*---------- INCLUDES ----------*/
 #include <config.h>
 
+#include <stdlib.h>
+#include <time.h>
+#include <utime.h>
+#include <unistd.h>
+
 #include <lal/LALStdio.h>
 #include <lal/SFTfileIO.h>
 #include <lal/Units.h>
@@ -378,10 +383,88 @@ int main( void )
 
   XLALDestroySFTVector( sft_vect2 );
   sft_vect2 = NULL;
+
+  /* ----- compare memory-mapped SFTs against SFTs read in, over the full band and a sub-band */
+  {
+    MappedSFTVector *mapped_vect = NULL;
+    XLAL_CHECK_MAIN( ( mapped_vect = XLALLoadMappedSFTs( catalog, -1, -1 ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( CompareSFTVectors( sft_vect, ( SFTVector * ) XLALMappedSFTVectorGetSFTs( mapped_vect ) ) == 0, XLAL_EFAILED );
+    XLAL_CHECK_MAIN( XLALCheckCRCMappedSFTs( &crc_check, mapped_vect ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( crc_check, XLAL_EFAILED, "XLALCheckCRCMappedSFTs() failed on correct SFTs 'outputsft_r*.sft'" );
+    XLALDestroyMappedSFTVector( mapped_vect );
+
+    const REAL8 dFreq = sft_vect->data[0].deltaF;
+    const REAL8 fMin = sft_vect->data[0].f0 + dFreq;
+    const REAL8 fMax = fMin + 2 * dFreq;
+    XLAL_CHECK_MAIN( ( sft_vect2 = XLALLoadSFTs( catalog, fMin, fMax ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( ( mapped_vect = XLALLoadMappedSFTs( catalog, fMin, fMax ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( CompareSFTVectors( sft_vect2, ( SFTVector * ) XLALMappedSFTVectorGetSFTs( mapped_vect ) ) == 0, XLAL_EFAILED );
+    XLALDestroyMappedSFTVector( mapped_vect );
+    XLALDestroySFTVector( sft_vect2 );
+    sft_vect2 = NULL;
+  }
   XLALDestroySFTVector( sft_vect );
   sft_vect = NULL;
   XLALDestroySFTCatalog( catalog );
 
+  /* ---------- test SFT index files by comparing catalogs found with and without an index ---------- */
+  {
+    /* backdate the SFT files, since recently-modified files are always rescanned */
+    struct utimbuf times;
+    times.actime = times.modtime = time( NULL ) - 3600;
+    XLAL_CHECK_MAIN( utime( "outputsft_r1.sft", &times ) == 0, XLAL_EIO );
+    XLAL_CHECK_MAIN( utime( "outputsft_r2.sft", &times ) == 0, XLAL_EIO );
+
+    /* SFT index files are only used on request */
+    SFTCatalog *catalog_noindex = NULL, *catalog_index = NULL, *catalog_badindex = NULL;
+    remove( ".SFTindex" );
+    XLAL_CHECK_MAIN( unsetenv( "LAL_SFT_INDEX" ) == 0, XLAL_ESYS );
+    XLAL_CHECK_MAIN( ( catalog_noindex = XLALSFTdataFind( "outputsft_r*.sft", NULL ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( access( ".SFTindex", F_OK ) != 0, XLAL_EFAILED, "SFT index file written without LAL_SFT_INDEX=1" );
+    XLAL_CHECK_MAIN( setenv( "LAL_SFT_INDEX", "1", 1 ) == 0, XLAL_ESYS );
+    XLAL_CHECK_MAIN( ( catalog = XLALSFTdataFind( "outputsft_r*.sft", NULL ) ) != NULL, XLAL_EFUNC );       /* writes index */
+    XLALDestroySFTCatalog( catalog );
+    XLAL_CHECK_MAIN( access( ".SFTindex", F_OK ) == 0, XLAL_EFAILED, "SFT index file not written with LAL_SFT_INDEX=1" );
+    XLAL_CHECK_MAIN( ( catalog_index = XLALSFTdataFind( "outputsft_r*.sft", NULL ) ) != NULL, XLAL_EFUNC ); /* reads index */
+
+    /* an index file with a different byte-order marker, which follows the magic string and format version, is ignored */
+    {
+      FILE *fp = fopen( ".SFTindex", "r+b" );
+      XLAL_CHECK_MAIN( fp != NULL, XLAL_EIO );
+      const UINT4 byteorder = 0x04030201;
+      XLAL_CHECK_MAIN( fseek( fp, 8 + sizeof( UINT4 ), SEEK_SET ) == 0 && fwrite( &byteorder, sizeof( byteorder ), 1, fp ) == 1, XLAL_EIO );
+      fclose( fp );
+    }
+    XLAL_CHECK_MAIN( ( catalog_badindex = XLALSFTdataFind( "outputsft_r*.sft", NULL ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( unsetenv( "LAL_SFT_INDEX" ) == 0, XLAL_ESYS );
+    remove( ".SFTindex" );
+
+    XLAL_CHECK_MAIN( catalog_index->length == catalog_noindex->length, XLAL_EFAILED );
+    XLAL_CHECK_MAIN( catalog_badindex->length == catalog_noindex->length, XLAL_EFAILED );
+    for ( UINT4 i = 0; i < catalog_index->length; i ++ ) {
+      const SFTDescriptor *desc1 = &catalog_noindex->data[i], *desc2 = &catalog_index->data[i];
+      char locator1[512];
+      XLAL_CHECK_MAIN( XLALStringPrint( locator1, sizeof( locator1 ), "%s", XLALshowSFTLocator( desc1->locator ) ) < ( int ) sizeof( locator1 ), XLAL_EFAILED );
+      XLAL_CHECK_MAIN( strcmp( locator1, XLALshowSFTLocator( desc2->locator ) ) == 0, XLAL_EFAILED );
+      XLAL_CHECK_MAIN( strcmp( desc1->header.name, desc2->header.name ) == 0, XLAL_EFAILED );
+      XLAL_CHECK_MAIN( XLALGPSCmp( &desc1->header.epoch, &desc2->header.epoch ) == 0, XLAL_EFAILED );
+      XLAL_CHECK_MAIN( desc1->header.f0 == desc2->header.f0 && desc1->header.deltaF == desc2->header.deltaF, XLAL_EFAILED );
+      XLAL_CHECK_MAIN( desc1->numBins == desc2->numBins && desc1->version == desc2->version && desc1->crc64 == desc2->crc64, XLAL_EFAILED );
+      XLAL_CHECK_MAIN( strcmp( desc1->window_type, desc2->window_type ) == 0 && desc1->window_param == desc2->window_param, XLAL_EFAILED );
+      XLAL_CHECK_MAIN( ( desc1->comment == NULL && desc2->comment == NULL ) || strcmp( desc1->comment, desc2->comment ) == 0, XLAL_EFAILED );
+    }
+
+    for ( UINT4 i = 0; i < catalog_badindex->length; i ++ ) {
+      XLAL_CHECK_MAIN( strcmp( catalog_noindex->data[i].header.name, catalog_badindex->data[i].header.name ) == 0, XLAL_EFAILED );
+      XLAL_CHECK_MAIN( XLALGPSCmp( &catalog_noindex->data[i].header.epoch, &catalog_badindex->data[i].header.epoch ) == 0, XLAL_EFAILED );
+      XLAL_CHECK_MAIN( catalog_noindex->data[i].crc64 == catalog_badindex->data[i].crc64, XLAL_EFAILED );
+    }
+
+    XLALDestroySFTCatalog( catalog_noindex );
+    XLALDestroySFTCatalog( catalog_index );
+    XLALDestroySFTCatalog( catalog_badindex );
+  }
+
   /* ---------- test timestamps-reading functions by comparing LAL- and XLAL-versions against each other ---------- */
   {
 #define TS_FNAME "testTimestamps.dat"
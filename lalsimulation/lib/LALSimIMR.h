@@ -653,6 +653,21 @@ int XLALSimIMRPhenomXHMFrequencySequenceOneMode(
     LALDict *lalParams                   /**< lal dictionary parameters */
 );
 
+int XLALSimIMRPhenomXHMFrequencySequenceOneModeBatch(
+    COMPLEX16VectorSequence **htildelm,  /**< [out] FD waveform: one row per parameter point */
+    const REAL8Sequence *freqs,          /**< frequency array to evaluate model (Hz) */
+    const REAL8Vector *m1_SI,            /**< Masses of companion 1 (kg) */
+    const REAL8Vector *m2_SI,            /**< Masses of companion 2 (kg) */
+    const REAL8Vector *chi1L,            /**< Dimensionless aligned spins of companion 1 */
+    const REAL8Vector *chi2L,            /**< Dimensionless aligned spins of companion 2 */
+    UINT4 ell,                           /**< l index of the mode */
+    INT4 emm,                            /**< m index of the mode */
+    REAL8 distance,                      /**< Luminosity distance (m) */
+    REAL8 phiRef,                        /**< Orbital phase at fRef (rad) */
+    REAL8 fRef_In,                       /**< Reference frequency (Hz) */
+    LALDict *lalParams                   /**< lal dictionary parameters */
+);
+
 int XLALSimIMRPhenomXHM(
    COMPLEX16FrequencySeries **hptilde, /**< [out] Frequency-domain waveform h+ */
    COMPLEX16FrequencySeries **hctilde, /**< [out] Frequency-domain waveform hx */
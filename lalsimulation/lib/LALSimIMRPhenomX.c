@@ -66,6 +66,36 @@
 /* Note: This is declared in LALSimIMRPhenomX_internals.c and avoids namespace clashes */
 IMRPhenomX_UsefulPowers powers_of_lalpi;
 
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_once_t powers_of_lalpi_is_initialized = PTHREAD_ONCE_INIT;
+#endif
+
+static void IMRPhenomX_Initialize_Powers_of_lalpi_once(void)
+{
+  IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+}
+
+/* Initialize powers_of_lalpi on the first call only, so that generators running in
+   different threads never write to it while others read it */
+int IMRPhenomX_Initialize_Powers_of_lalpi(void)
+{
+#ifdef LAL_PTHREAD_LOCK
+  (void) pthread_once(&powers_of_lalpi_is_initialized, IMRPhenomX_Initialize_Powers_of_lalpi_once);
+#else
+  static int initialized = 0;
+  #pragma omp critical (IMRPhenomX_Initialize_Powers_of_lalpi)
+  {
+    if (!initialized)
+    {
+      IMRPhenomX_Initialize_Powers_of_lalpi_once();
+      initialized = 1;
+    }
+  }
+#endif
+  return XLAL_SUCCESS;
+}
+
 #ifndef _OPENMP
 #define omp ignore
 #endif
@@ -244,7 +274,7 @@ int XLALSimIMRPhenomXASGenerateFD(
 
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -364,7 +394,7 @@ int XLALSimIMRPhenomXASGenerateFD(
    // If fRef is not provided, then set fRef to be the starting GW Frequency
    REAL8 fRef = (fRef_In == 0.0) ? freqs->data[0] : fRef_In;
 
-   UINT4 status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+   UINT4 status = IMRPhenomX_Initialize_Powers_of_lalpi();
    XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
    /*
@@ -423,7 +453,7 @@ int XLALSimIMRPhenomXASGenerateFD(
    int debug = PHENOMXDEBUG;
 
    /* Initialize useful powers of LAL_PI */
-   int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+   int status = IMRPhenomX_Initialize_Powers_of_lalpi();
    XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
    LALDict *lal_dict;
@@ -528,7 +558,7 @@ int IMRPhenomXASGenerateFD(
   LIGOTimeGPS ligotimegps_zero = LIGOTIMEGPSZERO; // = {0,0}
 
   /* Initialize useful powers of LAL_PI */
-  int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  int status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Inherit minimum and maximum frequencies to generate wavefom from input frequency grid */
@@ -1135,7 +1165,7 @@ int XLALSimIMRPhenomXPGenerateFD(
   #endif
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -1346,7 +1376,7 @@ int XLALSimIMRPhenomXPGenerateFD(
       Passing deltaF = 0 implies that freqs is a frequency grid with non-uniform spacing.
       The function waveform then start at lowest given frequency.
    */
-   status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+   status = IMRPhenomX_Initialize_Powers_of_lalpi();
    XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
    /* Initialize IMRPhenomX waveform struct and perform sanity check. */
@@ -1467,7 +1497,7 @@ int XLALSimIMRPhenomXPGenerateFD(
 
 
      /* Initialize the useful powers of LAL_PI */
-     status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+     status = IMRPhenomX_Initialize_Powers_of_lalpi();
      XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
      /* Initialize IMRPhenomX Waveform struct and check that it initialized correctly */
@@ -1891,7 +1921,7 @@ int IMRPhenomXPGenerateFD(
   LIGOTimeGPS ligotimegps_zero = LIGOTIMEGPSZERO; // = {0,0}
 
   /* Initialize useful powers of LAL_PI */
-  int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  int status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Inherit minimum and maximum frequencies to generate wavefom from input frequency grid */
@@ -2530,7 +2560,7 @@ REAL8 XLALSimPhenomPNRfRingEff(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, REAL8 ch
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -2609,7 +2639,7 @@ REAL8 XLALSimPhenomPNRfRINGEffShiftDividedByEmm(  REAL8 m1_SI, REAL8 m2_SI, REAL
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -2689,7 +2719,7 @@ REAL8 XLALSimPhenomPNRbetaRD(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, REAL8 chi1
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -2770,7 +2800,7 @@ REAL8 XLALSimPhenomPNRafinal_prec(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, REAL8
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -2851,7 +2881,7 @@ REAL8 XLALSimPhenomPNRafinal_nonprec(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, RE
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -2934,7 +2964,7 @@ REAL8 XLALSimPhenomPNRafinal(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, REAL8 chi1
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -3014,7 +3044,7 @@ REAL8 XLALSimPhenomPNRwindow(  REAL8 m1_SI, REAL8 m2_SI, REAL8 chi1x, REAL8 chi1
   const REAL8 phiRef = 0.0;
 
   /* Initialize useful powers of LAL_PI - this is used in the code called by IMRPhenomXPGenerateFD */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
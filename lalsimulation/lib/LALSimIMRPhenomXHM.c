@@ -23,6 +23,7 @@
 #include <lal/LALSimIMR.h>
 #include <lal/SphericalHarmonics.h>
 #include <lal/Sequence.h>
+#include <lal/SeqFactories.h>
 #include <lal/Date.h>
 #include <lal/Units.h>
 #include <lal/LALConstants.h>
@@ -67,6 +68,35 @@
 /* Note: This is declared in LALSimIMRPhenomX_internals.c and avoids namespace clash */
 IMRPhenomX_UsefulPowers powers_of_lalpiHM;
 
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_once_t powers_of_lalpiHM_is_initialized = PTHREAD_ONCE_INIT;
+#endif
+
+static void IMRPhenomXHM_Initialize_Powers_of_lalpiHM_once(void)
+{
+  IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+}
+
+/* Initialize powers_of_lalpiHM on the first call only, as IMRPhenomX_Initialize_Powers_of_lalpi() */
+int IMRPhenomXHM_Initialize_Powers_of_lalpiHM(void)
+{
+#ifdef LAL_PTHREAD_LOCK
+  (void) pthread_once(&powers_of_lalpiHM_is_initialized, IMRPhenomXHM_Initialize_Powers_of_lalpiHM_once);
+#else
+  static int initialized = 0;
+  #pragma omp critical (IMRPhenomXHM_Initialize_Powers_of_lalpiHM)
+  {
+    if (!initialized)
+    {
+      IMRPhenomXHM_Initialize_Powers_of_lalpiHM_once();
+      initialized = 1;
+    }
+  }
+#endif
+  return XLAL_SUCCESS;
+}
+
 
 //This is a wrapper function for adding higher modes to the ModeArray
 static LALDict *IMRPhenomXHM_setup_mode_array(LALDict *lalParams);
@@ -407,8 +437,8 @@ This is a wrapper function that uses XLALSimIMRPhenomXASGenerateFD for the 22 mo
      #endif
 
      /* Initialize the useful powers of LAL_PI */
-     status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
-     status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+     status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
+     status = IMRPhenomX_Initialize_Powers_of_lalpi();
      XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
 
@@ -846,9 +876,9 @@ int XLALSimIMRPhenomXHMFrequencySequenceOneMode(
 
 
     /* Initialize the useful powers of LAL_PI */
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+    status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_of_lalpi();
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
 
     /* Get minimum and maximum frequencies. */
@@ -899,6 +929,170 @@ int XLALSimIMRPhenomXHMFrequencySequenceOneMode(
 }
 
 
+/* Evaluate one mode at a single parameter point of a batch and store it in the row hlm. */
+static int IMRPhenomXHMFrequencySequenceOneModeBatchPoint(
+  COMPLEX16 *hlm,                      /**< [out] row of the output matrix */
+  const REAL8Sequence *freqs,          /**< frequency array to evaluate model (positives) (Hz) */
+  REAL8 m1_SI,                         /**< Mass of companion 1 (kg) */
+  REAL8 m2_SI,                         /**< Mass of companion 2 (kg) */
+  REAL8 chi1L,                         /**< Dimensionless aligned spin of companion 1 */
+  REAL8 chi2L,                         /**< Dimensionless aligned spin of companion 2 */
+  UINT4 ell,                           /**< l index of the mode */
+  INT4 emm,                            /**< m index of the mode */
+  REAL8 distance,                      /**< Luminosity distance (m) */
+  REAL8 phiRef,                        /**< Orbital phase at fRef (rad) */
+  REAL8 fRef,                          /**< Reference frequency (Hz) */
+  LALDict *lalParams                   /**< LAL dictionary with the mode array already set up */
+)
+{
+  if(m1_SI    <= 0.0) { XLAL_ERROR(XLAL_EDOM, "m1 must be positive.\n");                             }
+  if(m2_SI    <= 0.0) { XLAL_ERROR(XLAL_EDOM, "m2 must be positive.\n");                             }
+
+  REAL8 mass_ratio = (m1_SI > m2_SI) ? m1_SI / m2_SI : m2_SI / m1_SI;
+  if(mass_ratio > 20.0  ) { XLAL_PRINT_INFO("Warning: Extrapolating outside of Numerical Relativity calibration domain."); }
+  if(mass_ratio > 1000. && fabs(mass_ratio - 1000) > 1e-12) { XLAL_ERROR(XLAL_EDOM, "ERROR: Model not valid at mass ratios beyond 1000."); } // The 1e-12 is to avoid rounding errors
+  if(fabs(chi1L) > 0.99 || fabs(chi2L) > 0.99) { XLAL_PRINT_INFO("Warning: Extrapolating to extremal spins, model is not trusted."); }
+
+  IMRPhenomXWaveformStruct *pWF;
+  pWF = XLALMalloc(sizeof(IMRPhenomXWaveformStruct));
+  XLAL_CHECK(pWF != NULL, XLAL_ENOMEM);
+  INT4 status = IMRPhenomXSetWaveformVariables(pWF, m1_SI, m2_SI, chi1L, chi2L, 0.0, fRef, phiRef, freqs->data[0], freqs->data[freqs->length - 1], distance, 0.0, lalParams, PHENOMXDEBUG);
+  if(status != XLAL_SUCCESS)
+  {
+    LALFree(pWF);
+    XLAL_ERROR(XLAL_EFUNC, "Error: IMRPhenomXSetWaveformVariables failed.\n");
+  }
+
+  /* deltaF = 0, so the generators return exactly freqs->length points with no offset */
+  COMPLEX16FrequencySeries *htilde = NULL;
+  if(ell == 2 && abs(emm) == 2)
+  {
+    status = IMRPhenomXASGenerateFD(&htilde, freqs, pWF, lalParams);
+  }
+  else
+  {
+    status = IMRPhenomXHMGenerateFDOneMode(&htilde, freqs, pWF, ell, abs(emm), lalParams);
+  }
+  LALFree(pWF);
+  if(status != XLAL_SUCCESS)
+  {
+    XLALDestroyCOMPLEX16FrequencySeries(htilde);
+    XLAL_ERROR(XLAL_EFUNC, "Failed to generate IMRPhenomXHM mode (%i,%i).", ell, emm);
+  }
+
+  /* Transform to positive m mode if needed. Do (-1)^l*Conjugate[htildelm]. */
+  if(emm > 0)
+  {
+    REAL8 minus1l = (ell % 2 != 0) ? -1.0 : 1.0;
+    for(UINT4 idx = 0; idx < freqs->length; idx++)
+    {
+      hlm[idx] = minus1l * conj(htilde->data->data[idx]);
+    }
+  }
+  else
+  {
+    memcpy(hlm, htilde->data->data, freqs->length * sizeof(COMPLEX16));
+  }
+
+  XLALDestroyCOMPLEX16FrequencySeries(htilde);
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Evaluate one mode of IMRPhenomXHM at many aligned-spin parameter points on a common frequency grid.
+ *
+ * The output is a matrix with one row per parameter point and one column per entry of freqs,
+ * holding the same values that XLALSimIMRPhenomXHMFrequencySequenceOneMode() would return for
+ * that point. Only the setup that does not depend on the parameter point (the LAL dictionary and
+ * mode array setup, the frequency grid checks and the output allocation) is shared by the batch;
+ * the waveform coefficients depend on the masses and spins and are still computed point by point.
+ * Parameter points are distributed over OpenMP threads when available.
+ */
+int XLALSimIMRPhenomXHMFrequencySequenceOneModeBatch(
+  COMPLEX16VectorSequence **htildelm,  /**< [out] FD waveform: one row per parameter point */
+  const REAL8Sequence *freqs,          /**< frequency array to evaluate model (positives) (Hz) */
+  const REAL8Vector *m1_SI,            /**< Masses of companion 1 (kg) */
+  const REAL8Vector *m2_SI,            /**< Masses of companion 2 (kg) */
+  const REAL8Vector *chi1L,            /**< Dimensionless aligned spins of companion 1 */
+  const REAL8Vector *chi2L,            /**< Dimensionless aligned spins of companion 2 */
+  UINT4 ell,                           /**< l index of the mode */
+  INT4 emm,                            /**< m index of the mode */
+  REAL8 distance,                      /**< Luminosity distance (m) */
+  REAL8 phiRef,                        /**< Orbital phase at fRef (rad) */
+  REAL8 fRef_In,                       /**< Reference frequency (Hz) */
+  LALDict *lalParams                   /**< LAL dictionary parameters */
+)
+{
+  /* Sanity checks */
+  XLAL_CHECK(htildelm != NULL && *htildelm == NULL, XLAL_EFAULT);
+  XLAL_CHECK(freqs != NULL && freqs->length > 0, XLAL_EINVAL, "Frequency array must be non-empty.\n");
+  XLAL_CHECK(m1_SI != NULL && m2_SI != NULL && chi1L != NULL && chi2L != NULL, XLAL_EFAULT);
+  XLAL_CHECK(m2_SI->length == m1_SI->length && chi1L->length == m1_SI->length && chi2L->length == m1_SI->length, XLAL_EBADLEN, "Parameter vectors must all have the same length.\n");
+  XLAL_CHECK(m1_SI->length > 0, XLAL_EINVAL, "Number of parameter points must be positive.\n");
+  if(fRef_In  <  0.0) { XLAL_ERROR(XLAL_EDOM, "fRef_In must be positive or set to 0 to ignore.\n");  }
+  if(distance <  0.0) { XLAL_ERROR(XLAL_EDOM, "Distance must be positive and greater than 0.\n");    }
+
+  const UINT4 npoints = m1_SI->length;
+
+  /* Use an auxiliar laldict to not overwrite the input argument */
+  LALDict *lalParams_aux;
+  if (lalParams == NULL)
+  {
+      lalParams_aux = XLALCreateDict();
+  }
+  else{
+      lalParams_aux = XLALDictDuplicate(lalParams);
+  }
+  lalParams_aux = IMRPhenomXHM_setup_mode_array(lalParams_aux);
+  LALValue *ModeArray = XLALSimInspiralWaveformParamsLookupModeArray(lalParams_aux);
+  INT4 modeActive = XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, emm);
+  XLALDestroyValue(ModeArray);
+  if (!(ell == 2 && abs(emm) == 2) && modeActive != 1)
+  {
+    XLALDestroyDict(lalParams_aux);
+    XLALPrintError("XLAL Error - %i%i mode is not included\n", ell, emm);
+    XLAL_ERROR(XLAL_EDOM);
+  }
+
+  /* If fRef is not provided (i.e. set to 0), then take fRef to be the starting GW Frequency. */
+  REAL8 fRef = (fRef_In == 0.0) ? freqs->data[0] : fRef_In;
+
+  /* Initialize the useful powers of LAL_PI before entering the parallel region, so that the threads only read them */
+  INT4 status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
+  XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
+  XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
+
+  *htildelm = XLALCreateCOMPLEX16VectorSequence(npoints, freqs->length);
+  if (*htildelm == NULL)
+  {
+    XLALDestroyDict(lalParams_aux);
+    XLAL_ERROR(XLAL_ENOMEM, "Failed to allocate %u x %u output matrix.", npoints, freqs->length);
+  }
+
+  INT4 nfailed = 0;
+  #pragma omp parallel for schedule(dynamic) reduction(+:nfailed)
+  for(UINT4 i = 0; i < npoints; i++)
+  {
+    COMPLEX16 *row = (*htildelm)->data + ((size_t) i) * freqs->length;
+    if(IMRPhenomXHMFrequencySequenceOneModeBatchPoint(row, freqs, m1_SI->data[i], m2_SI->data[i], chi1L->data[i], chi2L->data[i], ell, emm, distance, phiRef, fRef, lalParams_aux) != XLAL_SUCCESS)
+    {
+      nfailed++;
+    }
+  }
+
+  XLALDestroyDict(lalParams_aux);
+  if(nfailed > 0)
+  {
+    XLALDestroyCOMPLEX16VectorSequence(*htildelm);
+    *htildelm = NULL;
+    XLAL_ERROR(XLAL_EFUNC, "Failed to generate IMRPhenomXHM mode (%i,%i) at %i of %u parameter points.", ell, emm, nfailed, npoints);
+  }
+
+  return XLAL_SUCCESS;
+}
+
+
 /** Function to obtain a SphHarmFrequencySeries with the individual modes h_lm.
     By default it returns all the modes available in the model, both positive and negatives.
     With the mode array option in the LAL dictionary, the user can specify a custom mode array.
@@ -1136,9 +1330,9 @@ int XLALSimIMRPhenomXHM_SpheroidalPhase(
 
 
     /* Initialize the useful powers of LAL_PI */
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+    status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_of_lalpi();
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
 
 
@@ -1293,9 +1487,9 @@ int XLALSimIMRPhenomXHM_SpheroidalAmplitude(
 
 
     /* Initialize the useful powers of LAL_PI */
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+    status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomX_Initialize_Powers_of_lalpi();
     XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
 
 
@@ -1557,7 +1751,7 @@ int XLALSimIMRPhenomXHM2(
   #endif
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -1708,7 +1902,7 @@ int XLALSimIMRPhenomXHM2(
    }
 
    /* Initialize the useful powers of LAL_PI */
-      status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+      status = IMRPhenomX_Initialize_Powers_of_lalpi();
       XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
    /* Initialize IMRPhenomX waveform struct and perform sanity check. */
@@ -1732,6 +1926,39 @@ int XLALSimIMRPhenomXHM2(
 * @} **/
 
 
+/* Generate the negative mode h_l-m for IMRPhenomXHM_MultiMode, with multibanding if resTest != 0.
+   htilde22 is the 22 mode that is recycled for the mixing of the 32 with multibanding. */
+static int IMRPhenomXHM_MultiModeOneMode(
+  COMPLEX16FrequencySeries **htildelm, /**< [out] FD waveform of the mode h_l-m */
+  COMPLEX16FrequencySeries *htilde22,  /**< 22 mode for the mixing of the 32 (multibanding only) */
+  REAL8 resTest,                       /**< Multibanding threshold, 0 means no multibanding */
+  UINT4 ell,                           /**< l index of the mode */
+  UINT4 emm,                           /**< positive m index of the mode */
+  REAL8 m1_SI,                         /**< primary mass [kg] */
+  REAL8 m2_SI,                         /**< secondary mass [kg] */
+  REAL8 chi1z,                         /**< aligned spin of primary */
+  REAL8 chi2z,                         /**< aligned spin of secondary */
+  REAL8 distance,                      /**< distance of source (m) */
+  REAL8 f_min,                         /**< Starting GW frequency (Hz) */
+  REAL8 f_max,                         /**< End frequency; 0 defaults to Mf = 0.3 */
+  REAL8 deltaF,                        /**< Sampling frequency (Hz) */
+  REAL8 phiRef,                        /**< reference orbital phase (rad) */
+  REAL8 fRef_In,                       /**< Reference frequency */
+  LALDict *lalParams                   /**< LALDict struct with the mode array set up */
+)
+{
+  if (resTest == 0){  // No multibanding
+    return XLALSimIMRPhenomXHMGenerateFDOneMode(htildelm, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams);
+  }
+  if(ell==3 && emm==2){  // mode with mixing
+    return XLALSimIMRPhenomXHMMultiBandOneModeMixing(htildelm, htilde22, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams);
+  }
+  // modes without mixing
+  return XLALSimIMRPhenomXHMMultiBandOneMode(htildelm, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams);
+}
+
+
+
 /* Core function of XLALSimIMRPhenomXHM, returns hptilde, hctilde corresponding to a sum of modes.
 The default modes are 22, 21, 33, 32 and 44. It returns also the contribution of the corresponding negatives modes. */
 static int IMRPhenomXHM_MultiMode(
@@ -1783,13 +2010,16 @@ static int IMRPhenomXHM_MultiMode(
   /* When calling only the 32 mode, we need to call also the 22 for the mixing, but not sum it for hp, hc */
   INT4 add22 = 1;
 
-
-  COMPLEX16FrequencySeries *htilde22 = NULL;
-  INT4 posMode, negMode;
   /* Take input/default value for the threshold of the Multibanding. If = 0 then do not use Multibanding. */
   REAL8 resTest  = XLALSimInspiralWaveformParamsLookupPhenomXHMThresholdMband(lalParams_aux);
-
-  /***** Loop over modes ******/
+  /* Generate the modes in parallel if requested (only effective with OpenMP) */
+  INT4 parallel = (XLALSimInspiralWaveformParamsLookupPhenomXHMParallel(lalParams_aux) & PHENOMXHM_PARALLEL_MODES) != 0;
+
+  /* List of the modes to generate, in the order in which they are added to hptilde, hctilde */
+  UINT4 modeL[L_MAX*L_MAX], modeM[L_MAX*L_MAX];
+  INT4 modePos[L_MAX*L_MAX], modeNeg[L_MAX*L_MAX];
+  COMPLEX16FrequencySeries *htildelms[L_MAX*L_MAX];
+  INT4 nModes = 0, i22 = -1;
   for (UINT4 ell = 2; ell <= L_MAX; ell++)
   {
     for (UINT4 emm = 1; emm <= ell; emm++)
@@ -1797,38 +2027,83 @@ static int IMRPhenomXHM_MultiMode(
       The single mode function returns the negative mode h_l-m, and the positive is added automatically in IMRPhenomXHMFDAddMode. */
       /* First check if (l,m) mode is 'activated' in the ModeArray */
       /* if activated then generate the mode, else skip this mode. */
-      posMode = XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, emm);
-      negMode = XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, -emm);
+      INT4 posMode = XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, emm);
+      INT4 negMode = XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, -emm);
       if ( posMode != 1 && negMode != 1)
       { /* skip mode */
         continue;
       } /* else: generate mode */
-      #if DEBUG == 1
-      printf("\n Mode %i%i\n",ell, emm);
-      #endif
+      if (ell == 2 && emm == 2) i22 = nModes;
+      modeL[nModes] = ell;
+      modeM[nModes] = emm;
+      modePos[nModes] = posMode;
+      modeNeg[nModes] = negMode;
+      htildelms[nModes] = NULL;
+      nModes++;
+    }
+  }
 
-      // Variable to store the strain of only one (negative) mode: h_l-m
-      COMPLEX16FrequencySeries *htildelm = NULL;
+  /* Initialize the useful powers of LAL_PI before entering the parallel region, so that the threads only read them */
+  status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
+  XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
+  XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
 
+  INT4 nfailed = 0;
+  if (parallel)
+  {
+    /* With multibanding the 22 mode is recycled for the mixing of the 32, so it is generated first. */
+    INT4 first = 0;
+    if (resTest != 0 && i22 >= 0)
+    {
+      IMRPhenomXHM_MultiModeOneMode(&htildelms[i22], NULL, resTest, 2, 2, m1_SI, m2_SI, chi1z, chi2z, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams_aux);
+      if (!(htildelms[i22])) nfailed++;
+      first = 1;
+    }
 
-      if (resTest == 0){  // No multibanding
-        XLALSimIMRPhenomXHMGenerateFDOneMode(&htildelm, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams_aux);
+    /* Each mode is generated into its own frequency series, so the modes can be generated by different threads. */
+    #pragma omp parallel for schedule(dynamic) reduction(+:nfailed)
+    for (INT4 i = 0; i < nModes; i++)
+    {
+      if (first && i == i22)
+      {
+        continue;
       }
-      else{               // With multibanding
-        if(ell==3 && emm==2){  // mode with mixing
-          XLALSimIMRPhenomXHMMultiBandOneModeMixing(&htildelm, htilde22, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams_aux);
-        }
-        else{                  // modes without mixing
-          XLALSimIMRPhenomXHMMultiBandOneMode(&htildelm, m1_SI, m2_SI, chi1z, chi2z, ell, -emm, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams_aux);
-        }
-        // If the 22 mode is active we will recycle for the mixing of the 32, we save it in another variable: htilde22.
-        if(ell==2 && emm==2 && htildelm){
-          htilde22 = XLALCreateCOMPLEX16FrequencySeries("hptilde: FD waveform", &(ligotimegps_zero), 0.0, deltaF, &lalStrainUnit, htildelm->data->length);
-          for(UINT4 idx = 0; idx < htildelm->data->length; idx++){
-            htilde22->data->data[idx] = htildelm->data->data[idx];
-          }
-        }
+      /* The 22 mode can only be shared once it is complete, i.e. if it was generated before this loop */
+      COMPLEX16FrequencySeries *htilde22 = first ? htildelms[i22] : NULL;
+      IMRPhenomXHM_MultiModeOneMode(&htildelms[i], htilde22, resTest, modeL[i], modeM[i], m1_SI, m2_SI, chi1z, chi2z, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams_aux);
+      if (!(htildelms[i]))
+      {
+        nfailed++;
+      }
+    }
+  }
+
+  /***** Loop over modes ******/
+  /* The modes are summed in a fixed order, so the result does not depend on the number of threads.
+     Without parallel generation each mode is generated here and freed once it has been added. */
+  for (INT4 i = 0; i < nModes && nfailed == 0; i++)
+  {
+    UINT4 ell = modeL[i];
+    UINT4 emm = modeM[i];
+    INT4 posMode = modePos[i];
+    INT4 negMode = modeNeg[i];
+
+    #if DEBUG == 1
+    printf("\n Mode %i%i\n",ell, emm);
+    #endif
+
+    if (!parallel)
+    {
+      COMPLEX16FrequencySeries *htilde22 = (i22 >= 0) ? htildelms[i22] : NULL;
+      IMRPhenomXHM_MultiModeOneMode(&htildelms[i], htilde22, resTest, ell, emm, m1_SI, m2_SI, chi1z, chi2z, distance, f_min, f_max, deltaF, phiRef, fRef_In, lalParams_aux);
+      if (!(htildelms[i]))
+      {
+        nfailed++;
+        break;
       }
+    }
+    COMPLEX16FrequencySeries *htildelm = htildelms[i];
 
       /**** For debugging ****/
       #if DEBUG == 1
@@ -1863,9 +2138,6 @@ static int IMRPhenomXHM_MultiMode(
       #endif
       /**** End debugging ****/
 
-
-      if (!(htildelm)){ XLAL_ERROR(XLAL_EFUNC); }
-
       /* We test for hypothetical m=0 modes */
       if (emm == 0)
       {
@@ -1907,16 +2179,26 @@ static int IMRPhenomXHM_MultiMode(
             status = IMRPhenomXHMFDAddMode(*hptilde, *hctilde, htildelm, inclination, LAL_PI_2 , ell, emm, sym);    // add both positive and negative modes
           }
     }
-    XLALDestroyCOMPLEX16FrequencySeries(htildelm);
-  }//Loop over emm
-}//Loop over ell
-XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHM_Multimode failed to generate IMRPhenomXHM waveform.");
+    /* The 22 mode is kept until the end, it may still be needed for the mixing of the 32 */
+    if (!parallel && i != i22)
+    {
+      XLALDestroyCOMPLEX16FrequencySeries(htildelms[i]);
+      htildelms[i] = NULL;
+    }
+    if (status != XLAL_SUCCESS) break;
+}//Loop over modes
 
 /* Free memory */
-XLALDestroyCOMPLEX16FrequencySeries(htilde22);
+for (INT4 i = 0; i < nModes; i++)
+{
+  XLALDestroyCOMPLEX16FrequencySeries(htildelms[i]);
+}
 XLALDestroyValue(ModeArray);
 XLALDestroyDict(lalParams_aux);
 
+if (nfailed > 0){ XLAL_ERROR(XLAL_EFUNC, "Failed to generate %i IMRPhenomXHM modes.", nfailed); }
+XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHM_Multimode failed to generate IMRPhenomXHM waveform.");
+
 #if DEBUG == 1
 printf("\n******Leaving IMRPhenomXHM_MultiMode*****\n");
 #endif
@@ -1944,7 +2226,7 @@ static int IMRPhenomXHM_MultiMode2(
   LIGOTimeGPS ligotimegps_zero = LIGOTIMEGPSZERO; // = {0,0}
 
   /* Initialize useful powers of LAL_PI */
-  int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  int status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Build the frequency array and initialize htildelm to the length of freqs. */
@@ -2468,8 +2750,8 @@ int XLALSimIMRPhenomXHMAmplitude(
     REAL8 fRef = (fRef_In == 0.0) ? freqs->data[0] : fRef_In;
     
     /* Initialize the useful powers of LAL_PI */
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
+    status = IMRPhenomX_Initialize_Powers_of_lalpi();
     XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
     
     /* Initialize IMRPhenomX Waveform struct and check that it generated successfully */
@@ -2666,8 +2948,8 @@ int XLALSimIMRPhenomXHMPhase(
     REAL8 fRef = (fRef_In == 0.0) ? freqs->data[0] : fRef_In;
     
     /* Initialize the useful powers of LAL_PI */
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
-    status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+    status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
+    status = IMRPhenomX_Initialize_Powers_of_lalpi();
     XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
     
     /* Initialize IMRPhenomX Waveform struct and check that it generated successfully */
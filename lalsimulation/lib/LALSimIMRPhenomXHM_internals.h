@@ -58,10 +58,16 @@ extern "C" {
 
   #define FALSE_ZERO 1.0e-15
 
+  /* Bits of the ParallelHM option: generate the modes in parallel threads,
+     and interpolate the multibanding fine grid in parallel frequency chunks */
+  #define PHENOMXHM_PARALLEL_MODES 1
+  #define PHENOMXHM_PARALLEL_MBAND 2
+
   //  You should not declare static functions here, since this file is included in other files apart form the source one.
 
   /*********** Useful Powers of pi **************/
   extern IMRPhenomX_UsefulPowers powers_of_lalpiHM;
+  int IMRPhenomXHM_Initialize_Powers_of_lalpiHM(void);
 
   /**************** QNMs and mixing coefficients ************** */
   void IMRPhenomXHM_Initialize_QNMs(QNMFits *qnmsFits);
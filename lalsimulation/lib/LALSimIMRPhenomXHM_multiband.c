@@ -515,9 +515,9 @@ int XLALSimIMRPhenomXHMMultiBandOneMode(
   int debug = DEBUG;
 
   // Define two powers of pi to avoid clashes between PhenomX and PhenomXHM files.
-  int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  int status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PIHM.");
 
   /* Initialize IMRPhenomX Waveform struct and check that it initialized correctly */
@@ -628,6 +628,8 @@ int IMRPhenomXHMMultiBandOneMode(
   REAL8 resTest  = XLALSimInspiralWaveformParamsLookupPhenomXHMThresholdMband(lalParams);
   XLAL_CHECK(resTest > 0, XLAL_EDOM, "Multibanding threshold must be > 0.");
   UINT4 ampinterpolorder = XLALSimInspiralWaveformParamsLookupPhenomXHMAmpInterpolMB(lalParams);
+  /* Interpolate in parallel frequency chunks if requested (only effective with OpenMP) */
+  INT4 parallel = (XLALSimInspiralWaveformParamsLookupPhenomXHMParallel(lalParams) & PHENOMXHM_PARALLEL_MBAND) != 0;
   #if DEBUG == 1
   printf("\n***** MBAND = %i, resTest = %.16f, ampIntorder = %i\n", MBAND, resTest, ampinterpolorder);
   #endif
@@ -1024,6 +1026,23 @@ int IMRPhenomXHMMultiBandOneMode(
 
   UINT4 count = 0; // Variable to track the point being filled in the fine frequency grid
 
+  /* Each coarse interval is filled independently, so the loop below only records where each one
+     starts in the fine grid and the interval loop after it does the filling. */
+  UINT4 nIntervals = 0;
+  UINT4 *intervalStart = (UINT4*)XLALMalloc(lenCoarseArray * sizeof(UINT4));
+  INT4 *intervalRatio = (INT4*)XLALMalloc(lenCoarseArray * sizeof(INT4));
+  REAL8 *intervalMf = (REAL8*)XLALMalloc(lenCoarseArray * sizeof(REAL8));
+  REAL8 *intervalPhi0 = (REAL8*)XLALMalloc(lenCoarseArray * sizeof(REAL8));
+  REAL8 *intervalOmega = (REAL8*)XLALMalloc(lenCoarseArray * sizeof(REAL8));
+  if (lenCoarseArray > 0 && (!intervalStart || !intervalRatio || !intervalMf || !intervalPhi0 || !intervalOmega)){
+    XLALFree(intervalStart);
+    XLALFree(intervalRatio);
+    XLALFree(intervalMf);
+    XLALFree(intervalPhi0);
+    XLALFree(intervalOmega);
+    XLAL_ERROR(XLAL_ENOMEM);
+  }
+
   /* Loop over allgrids */
   bool stop = false;
   for (UINT4 i = 0; i<actualnumberofGrids && !stop; i++){
@@ -1042,7 +1061,6 @@ int IMRPhenomXHMMultiBandOneMode(
     }
 
     REAL8 Omega, phi0, Mfhere = 0, Mfnext = 0;
-    COMPLEX16 h0, Q;
 
     /* Loop over the coarse points of a subgrid */
     for(UINT4 j = 0; j < lcoarseGrid && !stop ; j++){
@@ -1081,24 +1099,41 @@ int IMRPhenomXHMMultiBandOneMode(
       }
       phi0 = ILphaselm[jjdx];
 
-      h0   = cexp(I*phi0);
-      Q    = cexp(I*evaldMf*Omega);
-
-      finefreqs[count] = Mfhere;
-      expphi[count]    = h0;
-      count++;
-
-      /* This loop carry out the eq. 2.32 in arXiv:2001.10897 */
-      for(int kk = 1; kk < ratio; kk++){       // Compute finefreqs and fine expphi
-        finefreqs[count] = Mfhere + evaldMf*kk;
-        expphi[count]    = Q*expphi[count-1];
-        count++;
-      }
+      intervalStart[nIntervals] = count;
+      intervalRatio[nIntervals] = ratio;
+      intervalMf[nIntervals]    = Mfhere;
+      intervalPhi0[nIntervals]  = phi0;
+      intervalOmega[nIntervals] = Omega;
+      nIntervals++;
+      count += (ratio > 1) ? ratio : 1;
 
     }
     pointsPrecessedSoFar = pointsPrecessedSoFar + lcoarseGrid;
   }// End loop over ILgrids. count should be aprox = to lenWF
 
+  #pragma omp parallel for schedule(static) if(parallel)
+  for(UINT4 ii = 0; ii < nIntervals; ii++){
+    UINT4 start = intervalStart[ii];
+    REAL8 Mfhere = intervalMf[ii];
+    COMPLEX16 h0 = cexp(I*intervalPhi0[ii]);
+    COMPLEX16 Q  = cexp(I*evaldMf*intervalOmega[ii]);
+
+    finefreqs[start] = Mfhere;
+    expphi[start]    = h0;
+
+    /* This loop carry out the eq. 2.32 in arXiv:2001.10897 */
+    for(int kk = 1; kk < intervalRatio[ii]; kk++){       // Compute finefreqs and fine expphi
+      finefreqs[start + kk] = Mfhere + evaldMf*kk;
+      expphi[start + kk]    = Q*expphi[start + kk - 1];
+    }
+  }
+
+  XLALFree(intervalStart);
+  XLALFree(intervalRatio);
+  XLALFree(intervalMf);
+  XLALFree(intervalPhi0);
+  XLALFree(intervalOmega);
+
   #if DEBUG == 1
   printf("\ncount = %i\n", count);
   #endif
@@ -1109,7 +1144,7 @@ int IMRPhenomXHMMultiBandOneMode(
 
   /*** Interpolation and evaluation in fineFreqs of the amplitude ***/
   REAL8 *fineAmp = (REAL8*)XLALMalloc(count * sizeof(REAL8));
-  interpolateAmplitude(fineAmp, IntLawpoints, ILamplm, finefreqs, lenCoarseArray, count, ampinterpolorder);
+  interpolateAmplitude(fineAmp, IntLawpoints, ILamplm, finefreqs, lenCoarseArray, count, ampinterpolorder, parallel);
 
   /**** Build the waveform ****/
   // Due to round of erros, the last freq may be greater Mfmax. The difference should be less than the frequency step.
@@ -1145,6 +1180,7 @@ int IMRPhenomXHMMultiBandOneMode(
     minus1l = +1;
   }
     
+  #pragma omp parallel for schedule(static) if(parallel)
   for(UINT4 idx = 0; idx < count; idx++){
         /* Reconstruct waveform: h(f) = A(f) * Exp[I phi(f)] */
         ((*htildelm)->data->data)[idx + offset] = minus1l * fineAmp[idx] * expphi[idx];
@@ -1234,6 +1270,13 @@ int IMRPhenomXHMMultiBandOneMode(
 *         - 1: linear interpolation (DEFAULT)
 *         - 3: cubic interpolation
 *
+*   ParallelHM: Bit mask of the thread-parallel evaluation (only effective when compiled with OpenMP).
+*         - 0: serial evaluation (DEFAULT)
+*         - 1: generate the modes of IMRPhenomXHM/IMRPhenomXPHM in parallel
+*         - 2: fill the fine frequency grid of each mode in parallel frequency chunks
+*         - 3: both
+*   The result does not depend on this option.
+*
 */
 
 /** Returns htildelm the waveform of one mode that present mode-mixing.
@@ -1315,9 +1358,9 @@ int XLALSimIMRPhenomXHMMultiBandOneModeMixing(
   int debug = DEBUG;
 
   // Define two powers of pi to avoid clashes between PhenomX and PhenomXHM files.
-  int status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  int status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PIHM.");
 
   /* Initialize IMRPhenomX Waveform struct and check that it initialized correctly */
@@ -1418,6 +1461,8 @@ int IMRPhenomXHMMultiBandOneModeMixing(
   REAL8 resTest  = XLALSimInspiralWaveformParamsLookupPhenomXHMThresholdMband(lalParams);
   XLAL_CHECK(resTest > 0, XLAL_EDOM, "Multibanding threshold must be > 0.");
   UINT4 ampinterpolorder = XLALSimInspiralWaveformParamsLookupPhenomXHMAmpInterpolMB(lalParams);
+  /* Interpolate in parallel frequency chunks if requested (only effective with OpenMP) */
+  INT4 parallel = (XLALSimInspiralWaveformParamsLookupPhenomXHMParallel(lalParams) & PHENOMXHM_PARALLEL_MBAND) != 0;
   #if DEBUG == 1
   printf("\n***** MBAND = %i, resTest = %.16f, ampIntorder = %i\n", MBAND, resTest, ampinterpolorder);
   #endif
@@ -1944,7 +1989,7 @@ int IMRPhenomXHMMultiBandOneModeMixing(
   REAL8 *fineAmp = (REAL8*)XLALMalloc(count * sizeof(REAL8));
   REAL8 *fineAmpSS = (REAL8*)XLALMalloc(count * sizeof(REAL8));
 
-  interpolateAmplitudeMixing(fineAmp, fineAmpSS, IntLawpointsS, IntLawpointsSS, ILamplm, ILamplmSS, finefreqs, lencoarseS, lencoarseSS, count, RDcutMin, RDcutMax, ampinterpolorder);
+  interpolateAmplitudeMixing(fineAmp, fineAmpSS, IntLawpointsS, IntLawpointsSS, ILamplm, ILamplmSS, finefreqs, lencoarseS, lencoarseSS, count, RDcutMin, RDcutMax, ampinterpolorder, parallel);
 
 
   /**** Build the waveform ****/
@@ -2194,7 +2239,8 @@ static int interpolateAmplitude(
   double finefreqs[],   /**< uniform fine frequency grid**/
   int lengthCoarse,     /**< length of non-uniform freq array **/
   int lengthFine,       /**< length of uniform fine freq array **/
-  int ampinterpolorder     /**< order of the gsl interpolation **/
+  int ampinterpolorder,    /**< order of the gsl interpolation **/
+  int parallel          /**< evaluate in parallel frequency chunks **/
 ){
 
   #if DEBUG == 1
@@ -2202,7 +2248,6 @@ static int interpolateAmplitude(
   printf("Number of points to interpolate = %i\r\n", lengthCoarse);
   #endif
 
-  gsl_interp_accel *acc = gsl_interp_accel_alloc();
   gsl_spline *spline;
   switch(ampinterpolorder){
     case 1:{
@@ -2221,6 +2266,20 @@ static int interpolateAmplitude(
   printf("\n****Loop for fine freqs*****\n");
   #endif
 
+  /* The spline is only read here, so each thread only needs its own accelerator */
+  #pragma omp parallel if(parallel)
+  {
+    gsl_interp_accel *acc = gsl_interp_accel_alloc();
+    #pragma omp for schedule(static)
+    for(INT4 kk = 0; kk < lengthFine; kk++){
+      if(!(finefreqs[kk] < coarsefreqs[0] || finefreqs[kk] > coarsefreqs[lengthCoarse-1])){
+        fineAmp[kk] = gsl_spline_eval(spline, finefreqs[kk], acc);
+      }
+    }
+    gsl_interp_accel_free(acc);
+  }
+
+  /* Points out of the coarse range take the value of the previous point */
   for(INT4 kk = 0; kk < lengthFine; kk++){
     if(finefreqs[kk] < coarsefreqs[0] || finefreqs[kk] > coarsefreqs[lengthCoarse-1]){
       #if DEBUG == 1
@@ -2228,16 +2287,12 @@ static int interpolateAmplitude(
       #endif
       fineAmp[kk] = fineAmp[kk-1];
     }
-    else{
-      fineAmp[kk] = gsl_spline_eval(spline, finefreqs[kk], acc);
-    }
   }
   #if DEBUG == 1
   printf("\n****Free memory*****\n");
   #endif
   /* Free memory */
   gsl_spline_free(spline);
-  gsl_interp_accel_free(acc);
 
   return 0;
 
@@ -2257,7 +2312,8 @@ static int interpolateAmplitudeMixing(
   int lengthFine,             /**< length of uniform fine freq array **/
   int sphericalfinecount,     /**< length of spherical fine grid **/
   int sphericalfinecountMax,  /**< length of spherical fine grid **/
-  int ampinterpolorder           /**< order of interpolation **/
+  int ampinterpolorder,          /**< order of interpolation **/
+  int parallel                /**< evaluate in parallel frequency chunks **/
 )
 {
   int spheroidalfinecount = lengthFine - sphericalfinecount;
@@ -2272,8 +2328,8 @@ static int interpolateAmplitudeMixing(
     spheroidalfineFreqs[i] = finefreqs[i + sphericalfinecount];
   }
 
-  if(lengthCoarse > ampinterpolorder) interpolateAmplitude(fineAmp, coarsefreqs, coarseAmp, sphericalfineFreqs, lengthCoarse, sphericalfinecountMax, ampinterpolorder);
-  if(lengthCoarseSS > ampinterpolorder) interpolateAmplitude(fineAmpSS, coarsefreqsSS, coarseAmpSS, spheroidalfineFreqs,  lengthCoarseSS, spheroidalfinecount, ampinterpolorder);
+  if(lengthCoarse > ampinterpolorder) interpolateAmplitude(fineAmp, coarsefreqs, coarseAmp, sphericalfineFreqs, lengthCoarse, sphericalfinecountMax, ampinterpolorder, parallel);
+  if(lengthCoarseSS > ampinterpolorder) interpolateAmplitude(fineAmpSS, coarsefreqsSS, coarseAmpSS, spheroidalfineFreqs,  lengthCoarseSS, spheroidalfinecount, ampinterpolorder, parallel);
 
   #if DEBUG == 1
   //Save lm in file
@@ -153,7 +153,8 @@ static int interpolateAmplitude(
   double finefreqs[],   /**< uniform fine frequency grid**/
   int lengthCoarse,     /**< length of non-uniform freq array **/
   int lengthFine,       /**< length of uniform fine freq array **/
-  int ampinterpolorder     /**< order of the gsl interpolation **/
+  int ampinterpolorder,    /**< order of the gsl interpolation **/
+  int parallel          /**< evaluate in parallel frequency chunks **/
 );
 
 static int interpolateAmplitudeMixing(
@@ -169,7 +170,8 @@ static int interpolateAmplitudeMixing(
   int lengthFine,        /**< length of uniform fine freq array **/
   int sphericalfinecount,     /**< length of spherical fine grid **/
   int sphericalfinecountMax,     /**< length of spherical fine grid **/
-  int ampinterpolorder  /**< order of interpolation **/
+  int ampinterpolorder, /**< order of interpolation **/
+  int parallel          /**< evaluate in parallel frequency chunks **/
 );
 
 static double deltaF_mergerBin(REAL8 fdamp, REAL8 alpha4, REAL8 abserror);
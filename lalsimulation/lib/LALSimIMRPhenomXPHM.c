@@ -105,6 +105,18 @@ static int IMRPhenomXPHM_hplushcross_from_modes(
   LALDict *lalParams                   /**< LAL Dictionary Structure    */
 );
 
+static int IMRPhenomXPHM_NonPrecessingModesParallel(
+  COMPLEX16FrequencySeries *htildelms[L_MAX+1][L_MAX+1], /**< [out] Non-precessing modes h_l-m, indexed by l and m */
+  const REAL8Sequence *freqs,          /**< Frequency array to evaluate the model */
+  IMRPhenomXWaveformStruct *pWF,       /**< IMRPhenomX Waveform Struct  */
+  LALValue *ModeArray,                 /**< Active modes */
+  LALDict *lalParams                   /**< LAL Dictionary Structure    */
+);
+
+static void IMRPhenomXPHM_DestroyNonPrecessingModes(
+  COMPLEX16FrequencySeries *htildelms[L_MAX+1][L_MAX+1] /**< Non-precessing modes h_l-m, indexed by l and m */
+);
+
 static int IMRPhenomXPHM_OneMode(
   COMPLEX16FrequencySeries **hlmpos,    /**< [out] Frequency domain hlm GW strain inertial frame positive frequencies */
   COMPLEX16FrequencySeries **hlmneg,    /**< [out] Frequency domain hlm GW strain inertial frame negative frequencies */
@@ -268,7 +280,7 @@ int XLALSimIMRPhenomXPHM(
   #endif
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.\n");
 
   /* Initialize IMRPhenomX Waveform struct and check that it initialized correctly */
@@ -473,7 +485,7 @@ int XLALSimIMRPhenomXPHMFromModes(
   #endif
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
@@ -675,7 +687,7 @@ int XLALSimIMRPhenomXPHMFromModes(
     XLALSimInspiralWaveformParamsInsertPhenomXPHMThresholdMband(lalParams_aux, 0);
   }
 
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMRPhenomX waveform struct and perform sanity check. */
@@ -730,6 +742,116 @@ int XLALSimIMRPhenomXPHMFromModes(
  * @} **/
 
 
+/*
+  Generate the non-precessing modes h_l-m used by IMRPhenomXPHM_hplushcross, distributing the modes over OpenMP threads.
+  Every mode is generated with its own copy of the waveform struct, since the multibanding functions modify it.
+  With multibanding the 22 mode is generated first to be recycled for the mixing of the 32 mode.
+  Modes that are zero by symmetry are not generated.
+*/
+static int IMRPhenomXPHM_NonPrecessingModesParallel(
+  COMPLEX16FrequencySeries *htildelms[L_MAX+1][L_MAX+1], /**< [out] Non-precessing modes h_l-m, indexed by l and m */
+  const REAL8Sequence *freqs,          /**< Frequency array to evaluate the model */
+  IMRPhenomXWaveformStruct *pWF,       /**< IMRPhenomX Waveform Struct  */
+  LALValue *ModeArray,                 /**< Active modes */
+  LALDict *lalParams                   /**< LAL Dictionary Structure    */
+)
+{
+  REAL8 thresholdMB = XLALSimInspiralWaveformParamsLookupPhenomXHMThresholdMband(lalParams);
+
+  UINT4 modeL[L_MAX*L_MAX], modeM[L_MAX*L_MAX];
+  INT4 nModes = 0;
+  for (UINT4 ell = 2; ell <= L_MAX; ell++)
+  {
+    for (UINT4 emmprime = 1; emmprime <= ell; emmprime++)
+    {
+      htildelms[ell][emmprime] = NULL;
+      if (XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, emmprime) != 1)
+      {
+        continue;
+      }
+      if((pWF->q == 1) && (pWF->chi1L == pWF->chi2L) && (emmprime % 2 != 0))
+      {
+        continue;
+      }
+      modeL[nModes] = ell;
+      modeM[nModes] = emmprime;
+      nModes++;
+    }
+  }
+
+  INT4 nfailed = 0, recycle22 = 0;
+  COMPLEX16FrequencySeries *htilde22 = NULL;
+  if (thresholdMB != 0 && XLALSimInspiralModeArrayIsModeActive(ModeArray, 2, 2) == 1 && XLALSimInspiralModeArrayIsModeActive(ModeArray, 3, 2) == 1)
+  {
+    IMRPhenomXWaveformStruct pWFmode = *pWF;
+    if (IMRPhenomXHMMultiBandOneMode(&htildelms[2][2], &pWFmode, 2, 2, lalParams) != XLAL_SUCCESS || !(htildelms[2][2]))
+    {
+      nfailed++;
+    }
+    htilde22 = htildelms[2][2];
+    recycle22 = 1;
+  }
+
+  #pragma omp parallel for schedule(dynamic) reduction(+:nfailed)
+  for (INT4 i = 0; i < nModes; i++)
+  {
+    UINT4 ell = modeL[i];
+    UINT4 emmprime = modeM[i];
+    if (recycle22 && ell == 2 && emmprime == 2)
+    {
+      continue;
+    }
+
+    IMRPhenomXWaveformStruct pWFmode = *pWF;
+    INT4 status;
+    if (thresholdMB == 0){  // No multibanding
+      if(ell == 2 && emmprime == 2)
+      {
+        status = IMRPhenomXASGenerateFD(&htildelms[ell][emmprime], freqs, &pWFmode, lalParams);
+      }
+      else
+      {
+        status = IMRPhenomXHMGenerateFDOneMode(&htildelms[ell][emmprime], freqs, &pWFmode, ell, emmprime, lalParams);
+      }
+    }
+    else{               // With multibanding
+      if(ell==3 && emmprime==2){  // mode with mode-mixing
+        status = IMRPhenomXHMMultiBandOneModeMixing(&htildelms[ell][emmprime], htilde22, &pWFmode, ell, emmprime, lalParams);
+      }
+      else{                  // modes without mode-mixing including 22 mode
+        status = IMRPhenomXHMMultiBandOneMode(&htildelms[ell][emmprime], &pWFmode, ell, emmprime, lalParams);
+      }
+    }
+    if (status != XLAL_SUCCESS || !(htildelms[ell][emmprime]))
+    {
+      nfailed++;
+    }
+  }
+
+  if (nfailed > 0)
+  {
+    IMRPhenomXPHM_DestroyNonPrecessingModes(htildelms);
+    XLAL_ERROR(XLAL_EFUNC, "Failed to generate %i IMRPhenomXHM modes.", nfailed);
+  }
+
+  return XLAL_SUCCESS;
+}
+
+/* Free the non-precessing modes generated by IMRPhenomXPHM_NonPrecessingModesParallel that were not taken over yet */
+static void IMRPhenomXPHM_DestroyNonPrecessingModes(
+  COMPLEX16FrequencySeries *htildelms[L_MAX+1][L_MAX+1] /**< Non-precessing modes h_l-m, indexed by l and m */
+)
+{
+  for (UINT4 ell = 2; ell <= L_MAX; ell++)
+  {
+    for (UINT4 emmprime = 1; emmprime <= ell; emmprime++)
+    {
+      XLALDestroyCOMPLEX16FrequencySeries(htildelms[ell][emmprime]);
+      htildelms[ell][emmprime] = NULL;
+    }
+  }
+}
+
 /**
   Core function of XLALSimIMRPhenomXPHM and XLALSimIMRPhenomXPHMFrequencySequence.
   Returns hptilde, hctilde for positive frequencies.
@@ -797,7 +919,7 @@ static int IMRPhenomXPHM_hplushcross(
    
 
   /* Initialize the power of pi for the HM internal functions. */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
   XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Failed to initialize useful powers of LAL_PI.");
 
 
@@ -877,6 +999,21 @@ static int IMRPhenomXPHM_hplushcross(
 
 
 
+  /*
+    Optionally generate all the non-precessing modes in parallel threads first; they are then twisted up one by one below.
+    Not done when the modes come from PhenomHM or when the PNR phase alignment changes pWF for each mode.
+  */
+  COMPLEX16FrequencySeries *htildelmsNP[L_MAX+1][L_MAX+1] = {{NULL}};
+  INT4 parallelModes = (XLALSimInspiralWaveformParamsLookupPhenomXHMParallel(lalParams) & PHENOMXHM_PARALLEL_MODES)
+                       && XLALSimInspiralWaveformParamsLookupPhenomXPHMTwistPhenomHM(lalParams) != 1
+                       && !(pWF->APPLY_PNR_DEVIATIONS && pWF->IMRPhenomXPNRForceXHMAlignment)
+                       && pWF->IMRPhenomXReturnCoPrec != 1;
+  if (parallelModes)
+  {
+    status = IMRPhenomXPHM_NonPrecessingModesParallel(htildelmsNP, freqs, pWF, ModeArray, lalParams);
+    XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXPHM_NonPrecessingModesParallel failed to generate IMRPhenomXHM waveform.");
+  }
+
   /***** Loop over non-precessing modes ******/
   for (UINT4 ell = 2; ell <= L_MAX; ell++)
   {
@@ -945,7 +1082,7 @@ static int IMRPhenomXPHM_hplushcross(
         /* Initialize the htilde frequency series */
         htildelm = XLALCreateCOMPLEX16FrequencySeries("htildelm: FD waveform", &ligotimegps_zero, 0, pWF->deltaF, &lalStrainUnit, npts);
         /* Check that frequency series generated okay */
-        XLAL_CHECK(htildelm,XLAL_ENOMEM,"Failed to allocate COMPLEX16FrequencySeries of length %zu for f_max = %f, deltaF = %g.\n", npts, freqs_In->data[freqs_In->length - 1], pWF->deltaF);
+        XLAL_CHECK_FAIL(htildelm,XLAL_ENOMEM,"Failed to allocate COMPLEX16FrequencySeries of length %zu for f_max = %f, deltaF = %g.\n", npts, freqs_In->data[freqs_In->length - 1], pWF->deltaF);
         memset((htildelm)->data->data, 0, npts * sizeof(COMPLEX16));
         XLALUnitMultiply(&((htildelm)->sampleUnits), &((htildelm)->sampleUnits), &lalSecondUnit);
 
@@ -956,6 +1093,12 @@ static int IMRPhenomXPHM_hplushcross(
         }
         //XLALDestroyCOMPLEX16FrequencySeries(htildelmPhenomHM);
       }
+      else if (parallelModes)
+      {
+        /* Take over the mode generated above */
+        htildelm = htildelmsNP[ell][emmprime];
+        htildelmsNP[ell][emmprime] = NULL;
+      }
       else
       {
         /* Compute non-precessing mode */
@@ -963,22 +1106,22 @@ static int IMRPhenomXPHM_hplushcross(
           if(ell == 2 && emmprime == 2)
           {
             status = IMRPhenomXASGenerateFD(&htildelm, freqs, pWF, lalParams);
-            XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXASGenerateFD failed to generate IMRPhenomXHM waveform.");
+            XLAL_CHECK_FAIL(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXASGenerateFD failed to generate IMRPhenomXHM waveform.");
           }
           else
           {
             status = IMRPhenomXHMGenerateFDOneMode(&htildelm, freqs, pWF, ell, emmprime, lalParams);
-            XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMGenerateFDOneMode failed to generate IMRPhenomXHM waveform.");
+            XLAL_CHECK_FAIL(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMGenerateFDOneMode failed to generate IMRPhenomXHM waveform.");
           }
         }
         else{               // With multibanding
           if(ell==3 && emmprime==2){  // mode with mode-mixing
             status = IMRPhenomXHMMultiBandOneModeMixing(&htildelm, htilde22, pWF, ell, emmprime, lalParams);
-            XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMMultiBandOneModeMixing failed to generate IMRPhenomXHM waveform.");
+            XLAL_CHECK_FAIL(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMMultiBandOneModeMixing failed to generate IMRPhenomXHM waveform.");
           }
           else{                  // modes without mode-mixing including 22 mode
             status = IMRPhenomXHMMultiBandOneMode(&htildelm, pWF, ell, emmprime, lalParams);
-            XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMMultiBandOneMode failed to generate IMRPhenomXHM waveform.");
+            XLAL_CHECK_FAIL(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXHMMultiBandOneMode failed to generate IMRPhenomXHM waveform.");
           }
 
           /* IMRPhenomXHMMultiBandOneMode* functions set pWF->deltaF=0 internally, we put it back here. */
@@ -1003,7 +1146,7 @@ static int IMRPhenomXPHM_hplushcross(
         }
       }
 
-      if (!(htildelm)){ XLAL_ERROR(XLAL_EFUNC); }
+      if (!(htildelm)){ XLAL_ERROR_FAIL(XLAL_EFUNC); }
 
       /*
          For very special cases of deltaF, it can happen that building htildelm with 'freqs_In' or with 'freqs' gives different lengths.
@@ -1014,11 +1157,11 @@ static int IMRPhenomXPHM_hplushcross(
       if(htildelm->data->length != npts)
       {
         htildelm = XLALResizeCOMPLEX16FrequencySeries(htildelm, 0, npts);
-        XLAL_CHECK (htildelm, XLAL_ENOMEM, "Failed to resize hlm COMPLEX16FrequencySeries" );
+        XLAL_CHECK_FAIL (htildelm, XLAL_ENOMEM, "Failed to resize hlm COMPLEX16FrequencySeries" );
       }
 
       /* htildelm is recomputed every time in the loop. Check that it always comes out with the same length */
-      XLAL_CHECK (    ((*hptilde)->data->length==htildelm->data->length)
+      XLAL_CHECK_FAIL (    ((*hptilde)->data->length==htildelm->data->length)
                   && ((*hctilde)->data->length==htildelm->data->length),
                   XLAL_EBADLEN,
                   "Inconsistent lengths between frequency series htildelm (%d), hptilde (%d) and hctilde (%d).",
@@ -1073,7 +1216,7 @@ static int IMRPhenomXPHM_hplushcross(
             Mf_RD_lm = IMRPhenomXHM_GenerateRingdownFrequency(ell, emmprime, pWF);
 
             status = IMRPhenomX_PNR_LinearFrequencyMapTransitionFrequencies(&Mf_low, &Mf_high, emmprime, Mf_RD_22, Mf_RD_lm, pPrec);
-            XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Error: IMRPhenomX_PNR_LinearFrequencyMapTransitionFrequencies failed.\n");
+            XLAL_CHECK_FAIL(XLAL_SUCCESS == status, XLAL_EFUNC, "Error: IMRPhenomX_PNR_LinearFrequencyMapTransitionFrequencies failed.\n");
           }
         }
 
@@ -1119,7 +1262,7 @@ static int IMRPhenomXPHM_hplushcross(
 
               // Twist up symmetric strain
              status = IMRPhenomXPHMTwistUp(Mf, hlmcoprec, pWF, pPrec, ell, emmprime, &hplus, &hcross);
-              XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "Call to IMRPhenomXPHMTwistUp failed.");
+              XLAL_CHECK_FAIL(status == XLAL_SUCCESS, XLAL_EFUNC, "Call to IMRPhenomXPHMTwistUp failed.");
 
               if(ell == 2 && emmprime == 2 && AntisymmetricWaveform && IMRPhenomXPNRUseTunedAngles)
               {
@@ -1216,7 +1359,7 @@ static int IMRPhenomXPHM_hplushcross(
             Mf_RD_lm = IMRPhenomXHM_GenerateRingdownFrequency(ell, emmprime, pWF);
 
             status = IMRPhenomX_PNR_LinearFrequencyMapTransitionFrequencies(&Mf_low, &Mf_high, emmprime, Mf_RD_22, Mf_RD_lm, pPrec);
-            XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Error: IMRPhenomX_PNR_LinearFrequencyMapTransitionFrequencies failed.\n");
+            XLAL_CHECK_FAIL(XLAL_SUCCESS == status, XLAL_EFUNC, "Error: IMRPhenomX_PNR_LinearFrequencyMapTransitionFrequencies failed.\n");
           }
 
           UINT4 PNRtoggleInspiralScaling = pPrec->PNRInspiralScaling;
@@ -1319,7 +1462,7 @@ static int IMRPhenomXPHM_hplushcross(
                 cos_beta    = vangles.z;
 
                 status = IMRPhenomXWignerdCoefficients_cosbeta(&cBetah, &sBetah, cos_beta);
-                XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "Call to IMRPhenomXWignerdCoefficients_cosbeta failed.");
+                XLAL_CHECK_FAIL(status == XLAL_SUCCESS, XLAL_EFUNC, "Call to IMRPhenomXWignerdCoefficients_cosbeta failed.");
 
                 vbetah[j]   = acos(cBetah);
               }
@@ -1356,7 +1499,7 @@ static int IMRPhenomXPHM_hplushcross(
                         success = success + gsl_spline_eval_e(pPrec->cosbeta_spline, Mf, pPrec->cosbeta_acc,&cos_beta);
                         success = success + gsl_spline_eval_e(pPrec->gamma_spline,  Mf, pPrec->gamma_acc, &gamma);
                   
-                        XLAL_CHECK(success == XLAL_SUCCESS, XLAL_EFUNC, "%s: Failed to interpolate Euler angles at f=%.7f. \n",__func__,XLALSimIMRPhenomXUtilsMftoHz(Mf,pWF->Mtot));
+                        XLAL_CHECK_FAIL(success == XLAL_SUCCESS, XLAL_EFUNC, "%s: Failed to interpolate Euler angles at f=%.7f. \n",__func__,XLALSimIMRPhenomXUtilsMftoHz(Mf,pWF->Mtot));
                  }
                 
                else {
@@ -1406,7 +1549,7 @@ static int IMRPhenomXPHM_hplushcross(
  
                   
                 status = IMRPhenomXWignerdCoefficients_cosbeta(&cBetah, &sBetah, cos_beta);
-                XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "Call to IMRPhenomXWignerdCoefficients_cosbeta failed.");
+                XLAL_CHECK_FAIL(status == XLAL_SUCCESS, XLAL_EFUNC, "Call to IMRPhenomXWignerdCoefficients_cosbeta failed.");
                 vbetah[j]   = acos(cBetah);
                 
             }
@@ -1419,7 +1562,7 @@ static int IMRPhenomXPHM_hplushcross(
                  
            default:
             {
-              XLAL_ERROR(XLAL_EINVAL,"Error: IMRPhenomXPrecVersion not recognized. Recommended default is 223.\n");
+              XLAL_ERROR_FAIL(XLAL_EINVAL,"Error: IMRPhenomXPrecVersion not recognized. Recommended default is 223.\n");
               break;
             }
           }
@@ -1525,7 +1668,7 @@ static int IMRPhenomXPHM_hplushcross(
            if(pPrec->precessing_tag==3) pPrec->gamma_in = 0.;
 
           status = IMRPhenomXPHMTwistUp(Mf, hlmcoprec, pWF, pPrec, ell, emmprime, &hplus, &hcross);
-           XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "Call to IMRPhenomXPHMTwistUp failed.");
+           XLAL_CHECK_FAIL(status == XLAL_SUCCESS, XLAL_EFUNC, "Call to IMRPhenomXPHMTwistUp failed.");
 
           if(ell == 2 && emmprime == 2 && AntisymmetricWaveform && IMRPhenomXPNRUseTunedAngles)
           {
@@ -1633,6 +1776,11 @@ static int IMRPhenomXPHM_hplushcross(
   #endif
 
   return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  /* Free the non-precessing modes generated in parallel that were not twisted up before the failure */
+  IMRPhenomXPHM_DestroyNonPrecessingModes(htildelmsNP);
+  return XLAL_FAILURE;
 }
 
 
@@ -1687,7 +1835,7 @@ static int IMRPhenomXPHM_hplushcross_from_modes(
   XLALUnitMultiply(&((*hctilde)->sampleUnits), &((*hctilde)->sampleUnits), &lalSecondUnit);
 
   /* Initialize useful powers of pi for the higher modes internal code. */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
   
   if(pPrec->precessing_tag==3){
@@ -2385,7 +2533,7 @@ int XLALSimIMRPhenomXPHMOneMode(
   #endif
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly. */
@@ -2650,7 +2798,7 @@ int XLALSimIMRPhenomXPHMFrequencySequenceOneMode(
   #endif
 
   /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  status = IMRPhenomX_Initialize_Powers_of_lalpi();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly. */
@@ -2860,7 +3008,7 @@ static int IMRPhenomXPHM_OneMode(
   REAL8 thresholdMB  = XLALSimInspiralWaveformParamsLookupPhenomXHMThresholdMband(lalParams);
 
   /* Initialize the power of pi for the HM internal functions. */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpiHM, LAL_PI);
+  status = IMRPhenomXHM_Initialize_Powers_of_lalpiHM();
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
 
   UINT4 n_coprec_modes = 0;
@@ -283,8 +283,10 @@ typedef struct tagIMRPhenomX_UsefulPowers
 
 /*
  * useful powers of LAL_PI, calculated once and kept constant - to be initied with a call to
+ * IMRPhenomX_Initialize_Powers_of_lalpi(), which only writes to it on the first call
  */
 extern IMRPhenomX_UsefulPowers powers_of_lalpi;
+int IMRPhenomX_Initialize_Powers_of_lalpi(void);
 
 typedef struct tagIMRPhenomXPhaseCoefficients
 {
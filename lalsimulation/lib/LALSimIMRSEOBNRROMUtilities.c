@@ -35,6 +35,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdarg.h>
 #include <lal/XLALError.h>
 #include <stdbool.h>
@@ -42,6 +43,7 @@
 #include <gsl/gsl_multifit.h>
 #include <gsl/gsl_interp.h>
 #include <gsl/gsl_fit.h>
+#include <lal/LALSimReadData.h>
 #include <LALSimBlackHoleRingdown.h>
 
 #ifdef LAL_HDF5_ENABLED
@@ -63,6 +65,10 @@ UNUSED static UINT8 compute_i_at_f(gsl_vector * freq_array, REAL8 freq);
 UNUSED static UINT4 align_wfs_window(gsl_vector* f_array_1, gsl_vector* f_array_2, gsl_vector* phase_1, gsl_vector* phase_2, REAL8* Deltat, REAL8* Deltaphi, REAL8 f_align_start, REAL8 f_align_end);
 UNUSED static UINT4 align_wfs_window_from_22(gsl_vector* f_array_1, gsl_vector* f_array_2, gsl_vector* phase_1, gsl_vector* phase_2, REAL8 f_align_start, REAL8 f_align_end, REAL8 Deltat22, REAL8 Deltaphi22, INT4 modeM);
 
+UNUSED static int ReadROMDataRealVector(LALSimROMData *rom, const char *name, gsl_vector **data);
+UNUSED static int ReadROMDataRealMatrix(LALSimROMData *rom, const char *name, gsl_matrix **data);
+UNUSED static int ROMData_check_version_number(LALSimROMData *rom, INT4 version_major_in, INT4 version_minor_in, INT4 version_micro_in);
+
 #ifdef LAL_HDF5_ENABLED
 UNUSED static int CheckVectorFromHDF5(LALH5File *file, const char name[], const double *v, size_t n);
 UNUSED static int ReadHDF5RealVectorDataset(LALH5File *file, const char *name, gsl_vector **data);
@@ -96,6 +102,30 @@ UNUSED static REAL8 Interpolate_Coefficent_Matrix(
   gsl_bspline_workspace *bwy
 );
 
+// Nonzero cubic B-spline basis functions at one point of a 3D parameter space,
+// combined into the weights of the 4 x 4 x 4 block of tensor-product coefficients
+// they multiply, so that all SVD modes can be interpolated with one evaluation of the basis.
+typedef struct tagROMTPSplineWeights3D {
+  size_t ncy, ncz;        // number of coefficients in the second and third dimension
+  size_t isx, isy, isz;   // first nonzero basis function in each dimension
+  REAL8 w[4][4][4];       // products Bx_i * By_j * Bz_k of the nonzero basis functions
+} ROMTPSplineWeights3D;
+
+UNUSED static int ROM_cubic_bspline_nonzero(REAL8 B[4], size_t *is, REAL8 x, const double *breakpts, size_t nbreak);
+UNUSED static int ROM_TP_spline_weights_3d(
+  ROMTPSplineWeights3D *w,
+  REAL8 x,
+  REAL8 y,
+  REAL8 z,
+  const double *xvec,
+  const double *yvec,
+  const double *zvec,
+  int ncx,
+  int ncy,
+  int ncz
+);
+UNUSED static REAL8 ROM_TP_spline_eval_3d(const ROMTPSplineWeights3D *w, const double *c);
+
 UNUSED static gsl_vector *Fit_cubic(const gsl_vector *xi, const gsl_vector *yi);
 
 UNUSED static bool approximately_equal(REAL8 x, REAL8 y, REAL8 epsilon);
@@ -153,6 +183,76 @@ static int read_matrix(const char dir[], const char fname[], gsl_matrix *m) {
   return(XLAL_SUCCESS);
 }
 
+// Wrap a dataset of shared ROM data in a gsl_vector without copying it.
+// The vector does not own the data, which belong to the ROM data registry;
+// it must not be modified, and is released with gsl_vector_free().
+static int ReadROMDataRealVector(LALSimROMData *rom, const char *name, gsl_vector **data) {
+  const REAL8 *v;
+  size_t n;
+
+  if (rom == NULL || name == NULL || data == NULL)
+    XLAL_ERROR(XLAL_EFAULT);
+
+  v = XLALSimROMDataGetREAL8Vector(&n, rom, name);
+  if (v == NULL)
+    XLAL_ERROR(XLAL_EFUNC);
+
+  *data = malloc(sizeof(**data));
+  if (*data == NULL)
+    XLAL_ERROR(XLAL_ENOMEM);
+  (*data)->size = n;
+  (*data)->stride = 1;
+  (*data)->data = (double *) v;
+  (*data)->block = NULL;
+  (*data)->owner = 0;
+  return XLAL_SUCCESS;
+}
+
+// Wrap a dataset of shared ROM data in a gsl_matrix without copying it;
+// see ReadROMDataRealVector().
+static int ReadROMDataRealMatrix(LALSimROMData *rom, const char *name, gsl_matrix **data) {
+  const REAL8 *m;
+  size_t n1, n2;
+
+  if (rom == NULL || name == NULL || data == NULL)
+    XLAL_ERROR(XLAL_EFAULT);
+
+  m = XLALSimROMDataGetREAL8Matrix(&n1, &n2, rom, name);
+  if (m == NULL)
+    XLAL_ERROR(XLAL_EFUNC);
+
+  *data = malloc(sizeof(**data));
+  if (*data == NULL)
+    XLAL_ERROR(XLAL_ENOMEM);
+  (*data)->size1 = n1;
+  (*data)->size2 = n2;
+  (*data)->tda = n2;
+  (*data)->data = (double *) m;
+  (*data)->block = NULL;
+  (*data)->owner = 0;
+  return XLAL_SUCCESS;
+}
+
+static int ROMData_check_version_number(LALSimROMData *rom, INT4 version_major_in, INT4 version_minor_in, INT4 version_micro_in) {
+  REAL8 version_major;
+  REAL8 version_minor;
+  REAL8 version_micro;
+
+  if (XLALSimROMDataQueryAttribute(&version_major, rom, "version_major") < 0
+      || XLALSimROMDataQueryAttribute(&version_minor, rom, "version_minor") < 0
+      || XLALSimROMDataQueryAttribute(&version_micro, rom, "version_micro") < 0)
+    XLAL_ERROR(XLAL_EIO, "Could not read ROM data version.");
+
+  if ((version_major_in != version_major) || (version_minor_in != version_minor) || (version_micro_in != version_micro)) {
+    XLAL_ERROR(XLAL_EIO, "Expected ROM data version %d.%d.%d, but got version %d.%d.%d.",
+    version_major_in, version_minor_in, version_micro_in, (INT4) version_major, (INT4) version_minor, (INT4) version_micro);
+  }
+  else {
+    XLALPrintInfo("Reading ROM data version %d.%d.%d.\n", (INT4) version_major, (INT4) version_minor, (INT4) version_micro);
+    return XLAL_SUCCESS;
+  }
+}
+
 #ifdef LAL_HDF5_ENABLED
 static int CheckVectorFromHDF5(LALH5File *file, const char name[], const double *v, size_t n) {
   gsl_vector *temp = NULL;
@@ -520,6 +620,97 @@ static REAL8 Interpolate_Coefficent_Matrix(
   return sum;
 }
 
+// Evaluate the four cubic B-spline basis functions which are nonzero at x.
+// The knots are the nbreak breakpoints with the end points repeated, as set up by
+// gsl_bspline_knots() for a cubic (k = 4) gsl_bspline_workspace, so that the results
+// agree with gsl_bspline_eval_nonzero() without needing a workspace.
+// B[i] is the value of basis function *is + i.
+static int ROM_cubic_bspline_nonzero(REAL8 B[4], size_t *is, REAL8 x, const double *breakpts, size_t nbreak) {
+  if (nbreak < 2)
+    XLAL_ERROR(XLAL_EINVAL, "Need at least 2 breakpoints, got %zu", nbreak);
+  if (!(x >= breakpts[0] && x <= breakpts[nbreak-1]))
+    XLAL_ERROR(XLAL_EDOM, "x = %g is outside the spline domain [%g, %g]", x, breakpts[0], breakpts[nbreak-1]);
+
+  // Find the interval breakpts[j] <= x < breakpts[j+1]; the last interval is closed.
+  size_t lo = 0, hi = nbreak - 1;
+  while (hi - lo > 1) {
+    size_t mid = (lo + hi) / 2;
+    if (x < breakpts[mid])
+      hi = mid;
+    else
+      lo = mid;
+  }
+  const size_t j = lo;
+
+  // Cox-de Boor recursion over the knots t_{j+1}, ..., t_{j+6} around the interval,
+  // where t_i = breakpts[i-3] clamped to the end points.
+  REAL8 left[4], right[4];
+  B[0] = 1.0;
+  for (size_t r = 1; r < 4; r++) {
+    left[r] = x - breakpts[j + 1 > r ? j + 1 - r : 0];
+    right[r] = breakpts[j + r < nbreak - 1 ? j + r : nbreak - 1] - x;
+    REAL8 saved = 0.0;
+    for (size_t s = 0; s < r; s++) {
+      REAL8 tmp = B[s] / (right[s+1] + left[r-s]);
+      B[s] = saved + right[s+1] * tmp;
+      saved = left[r-s] * tmp;
+    }
+    B[r] = saved;
+  }
+
+  *is = j;
+  return XLAL_SUCCESS;
+}
+
+// Compute the tensor-product B-spline weights at position (x,y,z) for coefficient
+// tensors of size ncx x ncy x ncz, whose knots are given by the ncx-2, ncy-2 and ncz-2
+// breakpoints xvec, yvec and zvec.
+static int ROM_TP_spline_weights_3d(
+  ROMTPSplineWeights3D *w,
+  REAL8 x,
+  REAL8 y,
+  REAL8 z,
+  const double *xvec,
+  const double *yvec,
+  const double *zvec,
+  int ncx,
+  int ncy,
+  int ncz
+) {
+  REAL8 Bx[4], By[4], Bz[4];
+
+  if (ROM_cubic_bspline_nonzero(Bx, &w->isx, x, xvec, ncx - 2) != XLAL_SUCCESS
+      || ROM_cubic_bspline_nonzero(By, &w->isy, y, yvec, ncy - 2) != XLAL_SUCCESS
+      || ROM_cubic_bspline_nonzero(Bz, &w->isz, z, zvec, ncz - 2) != XLAL_SUCCESS)
+    XLAL_ERROR(XLAL_EFUNC);
+
+  w->ncy = ncy;
+  w->ncz = ncz;
+  for (int i=0; i<4; i++)
+    for (int j=0; j<4; j++) {
+      REAL8 BxBy = Bx[i] * By[j];
+      for (int k=0; k<4; k++)
+        w->w[i][j][k] = BxBy * Bz[k];
+    }
+
+  return XLAL_SUCCESS;
+}
+
+// Evaluate the tensor-product spline with the ncx x ncy x ncz coefficient tensor c
+// (last index fastest) at the position for which the weights w were computed.
+// The sum runs over 16 contiguous rows of 4 coefficients, accumulated in 4
+// independent lanes so that the compiler can vectorise it.
+static REAL8 ROM_TP_spline_eval_3d(const ROMTPSplineWeights3D *w, const double *c) {
+  REAL8 acc[4] = {0.0, 0.0, 0.0, 0.0};
+  for (size_t i=0; i<4; i++)
+    for (size_t j=0; j<4; j++) {
+      const double *row = c + ((w->isx + i) * w->ncy + w->isy + j) * w->ncz + w->isz;
+      for (size_t k=0; k<4; k++)
+        acc[k] += w->w[i][j][k] * row[k];
+    }
+  return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
 // Returns fitting coefficients for cubic y = c[0] + c[1]*x + c[2]*x**2 + c[3]*x**3
 static gsl_vector *Fit_cubic(const gsl_vector *xi, const gsl_vector *yi) {
   const int n = xi->size; // how many data points are we fitting
@@ -168,13 +168,6 @@ static SEOBNRROMdataDS __lalsim_SEOBNRv4HMROMDS_data[NMODES];
 
 typedef int (*load_dataPtr)(const char*, gsl_vector *, gsl_vector *, gsl_matrix *, gsl_matrix *, gsl_vector *);
 
-typedef struct tagSplineData
-{
-  gsl_bspline_workspace *bwx;
-  gsl_bspline_workspace *bwy;
-  gsl_bspline_workspace *bwz;
-} SplineData;
-
 typedef struct tagAmpPhaseSplineData
 {
   gsl_spline *spline_amp;
@@ -199,16 +192,6 @@ UNUSED static int SEOBNRROMdataDS_Init_submodel(
   UINT4 index_mode
 );
 UNUSED static void SEOBNRROMdataDS_Cleanup_submodel(SEOBNRROMdataDS_submodel *submodel);
-UNUSED static void SplineData_Destroy(SplineData *splinedata);
-UNUSED static void SplineData_Init(
-  SplineData **splinedata,
-  int ncx,                // Number of points in q  + 2
-  int ncy,                // Number of points in chi1 + 2
-  int ncz,                // Number of points in chi2 + 2
-  const double *qvec,     // B-spline knots in q
-  const double *chi1vec,  // B-spline knots in chi1
-  const double *chi2vec   // B-spline knots in chi2
-);
 UNUSED static void AmpPhaseSplineData_Init(
   AmpPhaseSplineData ***data,
   const int num_modes
@@ -471,66 +454,6 @@ static bool SEOBNRv4HMROM_IsSetup(UINT4 index_mode) {
   }
 }
 
-// Setup B-spline basis functions for given points
-static void SplineData_Init(
-  SplineData **splinedata,
-  int ncx,                // Number of points in q  + 2
-  int ncy,                // Number of points in chi1 + 2
-  int ncz,                // Number of points in chi2 + 2
-  const double *qvec,   // B-spline knots in q
-  const double *chi1vec,  // B-spline knots in chi1
-  const double *chi2vec   // B-spline knots in chi2
-)
-{
-  if(!splinedata) exit(1);
-  if(*splinedata) SplineData_Destroy(*splinedata);
-
-  (*splinedata)=XLALCalloc(1,sizeof(SplineData));
-
-  // Set up B-spline basis for desired knots
-  const size_t nbreak_x = ncx-2;  // must have nbreak = n-2 for cubic splines
-  const size_t nbreak_y = ncy-2;  // must have nbreak = n-2 for cubic splines
-  const size_t nbreak_z = ncz-2;  // must have nbreak = n-2 for cubic splines
-
-  // Allocate a cubic bspline workspace (k = 4)
-  gsl_bspline_workspace *bwx = gsl_bspline_alloc(4, nbreak_x);
-  gsl_bspline_workspace *bwy = gsl_bspline_alloc(4, nbreak_y);
-  gsl_bspline_workspace *bwz = gsl_bspline_alloc(4, nbreak_z);
-
-  // Set breakpoints (and thus knots by hand)
-  gsl_vector *breakpts_x = gsl_vector_alloc(nbreak_x);
-  gsl_vector *breakpts_y = gsl_vector_alloc(nbreak_y);
-  gsl_vector *breakpts_z = gsl_vector_alloc(nbreak_z);
-  for (UINT4 i=0; i<nbreak_x; i++)
-    gsl_vector_set(breakpts_x, i, qvec[i]);
-  for (UINT4 j=0; j<nbreak_y; j++)
-    gsl_vector_set(breakpts_y, j, chi1vec[j]);
-  for (UINT4 k=0; k<nbreak_z; k++)
-    gsl_vector_set(breakpts_z, k, chi2vec[k]);
-
-  gsl_bspline_knots(breakpts_x, bwx);
-  gsl_bspline_knots(breakpts_y, bwy);
-  gsl_bspline_knots(breakpts_z, bwz);
-
-  gsl_vector_free(breakpts_x);
-  gsl_vector_free(breakpts_y);
-  gsl_vector_free(breakpts_z);
-
-  (*splinedata)->bwx=bwx;
-  (*splinedata)->bwy=bwy;
-  (*splinedata)->bwz=bwz;
-}
-
-/* Destroy B-spline basis functions for given points */
-static void SplineData_Destroy(SplineData *splinedata)
-{
-  if(!splinedata) return;
-  if(splinedata->bwx) gsl_bspline_free(splinedata->bwx);
-  if(splinedata->bwy) gsl_bspline_free(splinedata->bwy);
-  if(splinedata->bwz) gsl_bspline_free(splinedata->bwz);
-  XLALFree(splinedata);
-}
-
 // Allocate memory for an array of AmpPhaseSplineData structs to store all modes
 static void AmpPhaseSplineData_Init(
   AmpPhaseSplineData ***data_array,
@@ -594,21 +517,17 @@ static int TP_Spline_interpolation_3d(
     }
   }
 
-  SplineData *splinedata=NULL;
-  SplineData_Init(&splinedata, ncx, ncy, ncz, qvec, chi1vec, chi2vec);
-
-  gsl_bspline_workspace *bwx=splinedata->bwx;
-  gsl_bspline_workspace *bwy=splinedata->bwy;
-  gsl_bspline_workspace *bwz=splinedata->bwz;
+  // The B-spline basis depends only on (q,chi1,chi2), so evaluate it once for all SVD modes
+  ROMTPSplineWeights3D w;
+  if (ROM_TP_spline_weights_3d(&w, q, chi1, chi2, qvec, chi1vec, chi2vec, ncx, ncy, ncz) != XLAL_SUCCESS)
+    XLAL_ERROR(XLAL_EFUNC);
 
   int N = ncx*ncy*ncz;  // Size of the data matrix for one SVD-mode
   // Evaluate the TP spline for all SVD modes - amplitude
   for (int k=0; k<nk; k++) { // For each SVD mode
-    gsl_vector v = gsl_vector_subvector(cvec, k*N, N).vector; // Pick out the coefficient matrix corresponding to the k-th SVD mode.
-    REAL8 csum = Interpolate_Coefficent_Tensor(&v, q, chi1, chi2, ncy, ncz, bwx, bwy, bwz);
+    REAL8 csum = ROM_TP_spline_eval_3d(&w, gsl_vector_const_ptr(cvec, k*N)); // Coefficient matrix corresponding to the k-th SVD mode.
     gsl_vector_set(c_out, k, csum);
   }
-  SplineData_Destroy(splinedata);
 
   return(0);
 }
@@ -117,13 +117,6 @@ static SEOBNRROMdataDS __lalsim_SEOBNRv4ROMDS_data;
 
 typedef int (*load_dataPtr)(const char*, gsl_vector *, gsl_vector *, gsl_matrix *, gsl_matrix *, gsl_vector *);
 
-typedef struct tagSplineData
-{
-  gsl_bspline_workspace *bwx;
-  gsl_bspline_workspace *bwy;
-  gsl_bspline_workspace *bwz;
-} SplineData;
-
 /**************** Internal functions **********************/
 
 UNUSED static void SEOBNRv4ROM_Init_LALDATA(void);
@@ -193,16 +186,6 @@ UNUSED static void SEOBNRROMdataDS_coeff_Init(SEOBNRROMdataDS_coeff **romdatacoe
 UNUSED static void SEOBNRROMdataDS_coeff_Cleanup(SEOBNRROMdataDS_coeff *romdatacoeff);
 
 static size_t NextPow2(const size_t n);
-UNUSED static void SplineData_Destroy(SplineData *splinedata);
-UNUSED static void SplineData_Init(
-  SplineData **splinedata,
-  int ncx,                // Number of points in eta  + 2
-  int ncy,                // Number of points in chi1 + 2
-  int ncz,                // Number of points in chi2 + 2
-  const double *etavec,   // B-spline knots in eta
-  const double *chi1vec,  // B-spline knots in chi1
-  const double *chi2vec   // B-spline knots in chi2
-);
 
 UNUSED static int SEOBNRv4ROMTimeFrequencySetup(
   gsl_spline **spline_phi,                      // phase spline
@@ -282,65 +265,6 @@ static bool SEOBNRv4ROM_IsSetup(void) {
     return false;
 }
 
-// Setup B-spline basis functions for given points
-static void SplineData_Init(
-  SplineData **splinedata,
-  int ncx,                // Number of points in eta  + 2
-  int ncy,                // Number of points in chi1 + 2
-  int ncz,                // Number of points in chi2 + 2
-  const double *etavec,   // B-spline knots in eta
-  const double *chi1vec,  // B-spline knots in chi1
-  const double *chi2vec   // B-spline knots in chi2
-)
-{
-  if(!splinedata) exit(1);
-  if(*splinedata) SplineData_Destroy(*splinedata);
-
-  (*splinedata)=XLALCalloc(1,sizeof(SplineData));
-
-  // Set up B-spline basis for desired knots
-  const size_t nbreak_x = ncx-2;  // must have nbreak = n-2 for cubic splines
-  const size_t nbreak_y = ncy-2;  // must have nbreak = n-2 for cubic splines
-  const size_t nbreak_z = ncz-2;  // must have nbreak = n-2 for cubic splines
-
-  // Allocate a cubic bspline workspace (k = 4)
-  gsl_bspline_workspace *bwx = gsl_bspline_alloc(4, nbreak_x);
-  gsl_bspline_workspace *bwy = gsl_bspline_alloc(4, nbreak_y);
-  gsl_bspline_workspace *bwz = gsl_bspline_alloc(4, nbreak_z);
-
-  // Set breakpoints (and thus knots by hand)
-  gsl_vector *breakpts_x = gsl_vector_alloc(nbreak_x);
-  gsl_vector *breakpts_y = gsl_vector_alloc(nbreak_y);
-  gsl_vector *breakpts_z = gsl_vector_alloc(nbreak_z);
-  for (UINT4 i=0; i<nbreak_x; i++)
-    gsl_vector_set(breakpts_x, i, etavec[i]);
-  for (UINT4 j=0; j<nbreak_y; j++)
-    gsl_vector_set(breakpts_y, j, chi1vec[j]);
-  for (UINT4 k=0; k<nbreak_z; k++)
-    gsl_vector_set(breakpts_z, k, chi2vec[k]);
-
-  gsl_bspline_knots(breakpts_x, bwx);
-  gsl_bspline_knots(breakpts_y, bwy);
-  gsl_bspline_knots(breakpts_z, bwz);
-
-  gsl_vector_free(breakpts_x);
-  gsl_vector_free(breakpts_y);
-  gsl_vector_free(breakpts_z);
-
-  (*splinedata)->bwx=bwx;
-  (*splinedata)->bwy=bwy;
-  (*splinedata)->bwz=bwz;
-}
-
-static void SplineData_Destroy(SplineData *splinedata)
-{
-  if(!splinedata) return;
-  if(splinedata->bwx) gsl_bspline_free(splinedata->bwx);
-  if(splinedata->bwy) gsl_bspline_free(splinedata->bwy);
-  if(splinedata->bwz) gsl_bspline_free(splinedata->bwz);
-  XLALFree(splinedata);
-}
-
 // Interpolate projection coefficients for amplitude and phase over the parameter space (q, chi).
 // The multi-dimensional interpolation is carried out via a tensor product decomposition.
 static int TP_Spline_interpolation_3d(
@@ -370,30 +294,24 @@ static int TP_Spline_interpolation_3d(
     }
   }
 
-  SplineData *splinedata=NULL;
-  SplineData_Init(&splinedata, ncx, ncy, ncz, etavec, chi1vec, chi2vec);
-
-  gsl_bspline_workspace *bwx=splinedata->bwx;
-  gsl_bspline_workspace *bwy=splinedata->bwy;
-  gsl_bspline_workspace *bwz=splinedata->bwz;
+  // The B-spline basis depends only on (eta,chi1,chi2), so evaluate it once for all SVD modes
+  ROMTPSplineWeights3D w;
+  if (ROM_TP_spline_weights_3d(&w, eta, chi1, chi2, etavec, chi1vec, chi2vec, ncx, ncy, ncz) != XLAL_SUCCESS)
+    XLAL_ERROR(XLAL_EFUNC);
 
   int N = ncx*ncy*ncz;  // Size of the data matrix for one SVD-mode
   // Evaluate the TP spline for all SVD modes - amplitude
   for (int k=0; k<nk_amp; k++) { // For each SVD mode
-    gsl_vector v = gsl_vector_subvector(cvec_amp, k*N, N).vector; // Pick out the coefficient matrix corresponding to the k-th SVD mode.
-    REAL8 csum = Interpolate_Coefficent_Tensor(&v, eta, chi1, chi2, ncy, ncz, bwx, bwy, bwz);
+    REAL8 csum = ROM_TP_spline_eval_3d(&w, gsl_vector_const_ptr(cvec_amp, k*N)); // Coefficient matrix corresponding to the k-th SVD mode.
     gsl_vector_set(c_amp, k, csum);
   }
 
   // Evaluate the TP spline for all SVD modes - phase
   for (int k=0; k<nk_phi; k++) {  // For each SVD mode
-    gsl_vector v = gsl_vector_subvector(cvec_phi, k*N, N).vector; // Pick out the coefficient matrix corresponding to the k-th SVD mode.
-    REAL8 csum = Interpolate_Coefficent_Tensor(&v, eta, chi1, chi2, ncy, ncz, bwx, bwy, bwz);
+    REAL8 csum = ROM_TP_spline_eval_3d(&w, gsl_vector_const_ptr(cvec_phi, k*N)); // Coefficient matrix corresponding to the k-th SVD mode.
     gsl_vector_set(c_phi, k, csum);
   }
 
-  SplineData_Destroy(splinedata);
-
   return(0);
 }
 
@@ -417,25 +335,41 @@ UNUSED static int SEOBNRROMdataDS_Init_submodel(
   char *path = XLALMalloc(size);
   snprintf(path, size, "%s/%s", dir, ROMDataHDF5);
 
-  LALH5File *file = XLALH5FileOpen(path, "r");
-  LALH5File *sub = XLALH5GroupOpen(file, grp_name);
+  // The ROM data are shared by all submodels and kept open by the registry
+  LALSimROMData *rom = XLALSimROMDataOpen(path);
+  XLALFree(path);
+  XLAL_CHECK(rom != NULL, XLAL_EFUNC);
+  size = strlen(grp_name) + 32;
+  char *name = XLALMalloc(size);
+
+#define READ_SUBMODEL_DATA(reader, dset, field) \
+  do { \
+    snprintf(name, size, "%s/%s", grp_name, dset); \
+    if (reader(rom, name, & (*submodel)->field) != XLAL_SUCCESS) { \
+      XLALFree(name); \
+      XLAL_ERROR(XLAL_EFUNC); \
+    } \
+  } while (0)
 
   // Read ROM coefficients
-  ReadHDF5RealVectorDataset(sub, "Amp_ciall", & (*submodel)->cvec_amp);
-  ReadHDF5RealVectorDataset(sub, "Phase_ciall", & (*submodel)->cvec_phi);
+  READ_SUBMODEL_DATA(ReadROMDataRealVector, "Amp_ciall", cvec_amp);
+  READ_SUBMODEL_DATA(ReadROMDataRealVector, "Phase_ciall", cvec_phi);
 
   // Read ROM basis functions
-  ReadHDF5RealMatrixDataset(sub, "Bamp", & (*submodel)->Bamp);
-  ReadHDF5RealMatrixDataset(sub, "Bphase", & (*submodel)->Bphi);
+  READ_SUBMODEL_DATA(ReadROMDataRealMatrix, "Bamp", Bamp);
+  READ_SUBMODEL_DATA(ReadROMDataRealMatrix, "Bphase", Bphi);
 
   // Read sparse frequency points
-  ReadHDF5RealVectorDataset(sub, "Mf_grid_Amp", & (*submodel)->gA);
-  ReadHDF5RealVectorDataset(sub, "Mf_grid_Phi", & (*submodel)->gPhi);
+  READ_SUBMODEL_DATA(ReadROMDataRealVector, "Mf_grid_Amp", gA);
+  READ_SUBMODEL_DATA(ReadROMDataRealVector, "Mf_grid_Phi", gPhi);
 
   // Read parameter space nodes
-  ReadHDF5RealVectorDataset(sub, "etavec", & (*submodel)->etavec);
-  ReadHDF5RealVectorDataset(sub, "chi1vec", & (*submodel)->chi1vec);
-  ReadHDF5RealVectorDataset(sub, "chi2vec", & (*submodel)->chi2vec);
+  READ_SUBMODEL_DATA(ReadROMDataRealVector, "etavec", etavec);
+  READ_SUBMODEL_DATA(ReadROMDataRealVector, "chi1vec", chi1vec);
+  READ_SUBMODEL_DATA(ReadROMDataRealVector, "chi2vec", chi2vec);
+
+#undef READ_SUBMODEL_DATA
+  XLALFree(name);
 
   // Initialize other members
   (*submodel)->nk_amp = (*submodel)->gA->size;
@@ -452,8 +386,6 @@ UNUSED static int SEOBNRROMdataDS_Init_submodel(
   (*submodel)->chi2_bounds[0] = gsl_vector_get((*submodel)->chi2vec, 0);
   (*submodel)->chi2_bounds[1] = gsl_vector_get((*submodel)->chi2vec, (*submodel)->chi2vec->size - 1);
 
-  XLALFree(path);
-  XLALH5FileClose(file);
   ret = XLAL_SUCCESS;
 #else
   XLAL_ERROR(XLAL_EFAILED, "HDF5 support not enabled");
@@ -493,17 +425,25 @@ int SEOBNRROMdataDS_Init(
   size_t size = strlen(dir) + strlen(ROMDataHDF5) + 2;
   char *path = XLALMalloc(size);
   snprintf(path, size, "%s/%s", dir, ROMDataHDF5);
-  LALH5File *file = XLALH5FileOpen(path, "r");
+  LALSimROMData *rom = XLALSimROMDataOpen(path);
+  if (rom == NULL) {
+    XLALFree(path);
+    XLAL_ERROR(XLAL_EFUNC);
+  }
 
-  XLALPrintInfo("ROM metadata\n============\n");
-  PrintInfoStringAttribute(file, "Email");
-  PrintInfoStringAttribute(file, "Description");
-  ret = ROM_check_version_number(file, ROMDataHDF5_VERSION_MAJOR,
-                                 ROMDataHDF5_VERSION_MINOR,
-                                 ROMDataHDF5_VERSION_MICRO);
+  // String attributes are only available from the HDF5 file
+  if (!XLALSimROMDataIsMapped(rom)) {
+    LALH5File *file = XLALH5FileOpen(path, "r");
+    XLALPrintInfo("ROM metadata\n============\n");
+    PrintInfoStringAttribute(file, "Email");
+    PrintInfoStringAttribute(file, "Description");
+    XLALH5FileClose(file);
+  }
+  ret = ROMData_check_version_number(rom, ROMDataHDF5_VERSION_MAJOR,
+                                     ROMDataHDF5_VERSION_MINOR,
+                                     ROMDataHDF5_VERSION_MICRO);
 
   XLALFree(path);
-  XLALH5FileClose(file);
 
   ret |= SEOBNRROMdataDS_Init_submodel(&(romdata)->sub1, dir, "sub1");
   if (ret==XLAL_SUCCESS) XLALPrintInfo("%s : submodel 1 loaded successfully.\n", __func__);
@@ -1116,6 +1056,9 @@ static int SEOBNRv4ROMCore(
  * The binary data HDF5 file (SEOBNRv4ROM_DS_HI_v1.0.hdf5)
  * will be available at on LIGO clusters in /home/cbc/.
  * Make sure the files are in your LAL_DATA_PATH.
+ * If a copy of the data written by XLALSimROMDataConvert(), with the
+ * extension <tt>.hdf5</tt> replaced by <tt>.lalrom</tt>, is installed next
+ * to the HDF5 file, it is memory-mapped instead; see XLALSimROMDataOpen().
  *
  * @note Note that due to its construction the iFFT of the ROM has a small (~ 20 M) offset
  * in the peak time that scales with total mass as compared to the time-domain SEOBNRv4 model.
@@ -33,6 +33,7 @@
 #include <lal/LALConstants.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALString.h>
+#include <lal/LALInstrument.h>
 #include <lal/Sequence.h>
 #include <lal/TimeSeries.h>
 #include <lal/FrequencySeries.h>
@@ -52,6 +53,10 @@
 
 #include "LALSimInspiralGenerator_private.h"
 
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+#endif
+
 #ifdef __GNUC__
 #define UNUSED __attribute__ ((unused))
 #else
@@ -372,6 +377,26 @@ const LALSimInspiralGenerator *lalSimInspiralGeneratorTemplates[NumApproximants]
     [ExternalPython] = &lalPythonGeneratorTemplate,
 };
 
+/*
+ * Give a generator instance a new identifier.  Called whenever an instance
+ * is created or its methods are changed, so that waveforms cached for it
+ * are not confused with those of an earlier instance at the same address.
+ */
+void XLALSimInspiralGeneratorNewId(LALSimInspiralGenerator *generator)
+{
+    static UINT8 lastId = 0;
+#if defined(__ATOMIC_RELAXED)
+    generator->id = __atomic_add_fetch(&lastId, 1, __ATOMIC_RELAXED);
+#elif defined(LAL_PTHREAD_LOCK)
+    static pthread_mutex_t idMutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_lock(&idMutex);
+    generator->id = ++lastId;
+    pthread_mutex_unlock(&idMutex);
+#else
+    generator->id = ++lastId;
+#endif
+}
+
 /**
  * @addtogroup LALSimInspiral_c
  * @brief General routines for generating binary inspiral waveforms.
@@ -421,6 +446,7 @@ LALSimInspiralGenerator *XLALCreateSimInspiralGenerator(const LALSimInspiralGene
         new = XLALMalloc(sizeof(*new));
         XLAL_CHECK_NULL(new, XLAL_ENOMEM, "could not allocate memory for new generator");
         memcpy(new, generator, sizeof(*new));
+        XLALSimInspiralGeneratorNewId(new);
         /* invoke initializer if present */
         if (new->initialize)
             if (new->initialize(new, params) < 0) {
@@ -477,8 +503,13 @@ int XLALSimInspiralGenerateTDWaveform(
     XLAL_CHECK(hplus && hcross && generator, XLAL_EFAULT);
     XLAL_CHECK(*hplus == NULL && *hcross == NULL, XLAL_EINVAL, "hplus and hcross must be pointers to NULL");
 
-    if (generator->generate_td_waveform)
-        return generator->generate_td_waveform(hplus, hcross, params, generator);
+    if (generator->generate_td_waveform) {
+        int ret;
+        XLAL_INSTRUMENT_START(__func__);
+        ret = generator->generate_td_waveform(hplus, hcross, params, generator);
+        XLAL_INSTRUMENT_STOP(__func__);
+        return ret;
+    }
 
     XLAL_ERROR(XLAL_EINVAL, "generator does not provide a method to generate time-domain waveforms");
 }
@@ -499,8 +530,13 @@ int XLALSimInspiralGenerateTDModes(
     XLAL_CHECK(hlm && generator, XLAL_EFAULT);
     XLAL_CHECK(*hlm == NULL, XLAL_EINVAL, "hlm must be a pointer to NULL");
 
-    if (generator->generate_td_modes)
-        return generator->generate_td_modes(hlm, params, generator);
+    if (generator->generate_td_modes) {
+        int ret;
+        XLAL_INSTRUMENT_START(__func__);
+        ret = generator->generate_td_modes(hlm, params, generator);
+        XLAL_INSTRUMENT_STOP(__func__);
+        return ret;
+    }
 
     XLAL_ERROR(XLAL_EINVAL, "generator does not provide a method to generate time-domain modes");
 }
@@ -521,8 +557,13 @@ int XLALSimInspiralGenerateFDWaveform(
 {
     XLAL_CHECK(hplus && hcross && generator, XLAL_EFAULT);
     XLAL_CHECK(*hplus == NULL && *hcross == NULL, XLAL_EINVAL, "hplus and hcross must be pointers to NULL");
-    if (generator->generate_fd_waveform)
-        return generator->generate_fd_waveform(hplus, hcross, params, generator);
+    if (generator->generate_fd_waveform) {
+        int ret;
+        XLAL_INSTRUMENT_START(__func__);
+        ret = generator->generate_fd_waveform(hplus, hcross, params, generator);
+        XLAL_INSTRUMENT_STOP(__func__);
+        return ret;
+    }
 
     XLAL_ERROR(XLAL_EINVAL, "generator does not provide a method to generate frequency-domain waveforms");
 }
@@ -543,8 +584,13 @@ int XLALSimInspiralGenerateFDModes(
     XLAL_CHECK(hlm && generator, XLAL_EFAULT);
     XLAL_CHECK(*hlm == NULL, XLAL_EINVAL, "hlm must be a pointer to NULL");
 
-    if (generator->generate_fd_modes)
-        return generator->generate_fd_modes(hlm, params, generator);
+    if (generator->generate_fd_modes) {
+        int ret;
+        XLAL_INSTRUMENT_START(__func__);
+        ret = generator->generate_fd_modes(hlm, params, generator);
+        XLAL_INSTRUMENT_STOP(__func__);
+        return ret;
+    }
 
     XLAL_ERROR(XLAL_EINVAL, "generator does not provide a method to generate frequency-domain modes");
 }
@@ -603,6 +603,7 @@ int XLALSimInspiralGeneratorAddConditioningForApproximant(LALSimInspiralGenerato
 
     generator->internal_data = internal_data;
     generator->finalize = finalize;
+    XLALSimInspiralGeneratorNewId(generator);
 
     if (internal_data->generator->generate_td_waveform) {
         if (internal_data->approx == -1) {
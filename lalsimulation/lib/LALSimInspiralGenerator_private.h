@@ -42,6 +42,11 @@ struct tagLALSimInspiralGenerator {
 
     /* ... */
     void *internal_data;
+
+    /* identifies the instance and its methods; 0 for immutable templates */
+    UINT8 id;
 };
 
+void XLALSimInspiralGeneratorNewId(LALSimInspiralGenerator *generator);
+
 #endif
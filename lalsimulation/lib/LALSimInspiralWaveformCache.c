@@ -18,6 +18,7 @@
  */
 
 #include <math.h>
+#include <string.h>
 #include <LALSimInspiralWaveformCache.h>
 #include <lal/LALSimInspiral.h>
 #include <lal/LALSimIMR.h>
@@ -25,8 +26,12 @@
 #include <lal/Sequence.h>
 #include <lal/LALConstants.h>
 #include <lal/LALSimInspiralEOS.h>
+#include <lal/LALHashTbl.h>
+#include <lal/LALHashFunc.h>
+#include <lal/LALSimSphHarmSeries.h>
 
 #include "check_waveform_macros.h"
+#include "LALSimInspiralGenerator_private.h"
 #include "LALSimInspiralPNCoefficients.c"
 
 /**
@@ -42,8 +47,61 @@ typedef enum {
     INCLINATION = 8
 } CacheVariableDiffersBitmask;
 
-static CacheVariableDiffersBitmask CacheArgsDifferenceBitmask(
+/** Kinds of waveform stored in a cache entry */
+typedef enum {
+    CACHE_TD_POLARIZATIONS,
+    CACHE_FD_POLARIZATIONS,
+    CACHE_TD_MODES,
+    CACHE_FD_MODES
+} CacheEntryKind;
+
+/** Default limits of a waveform cache */
+#define DEFAULT_MAX_ENTRIES 16
+#define DEFAULT_MAX_BYTES (256 * 1024 * 1024)
+
+/**
+ * A stored waveform, with the parameters it was generated with.  Entries
+ * are kept in a hash table keyed on the intrinsic parameters, and in a
+ * doubly-linked list in order of use.
+ */
+struct tagLALSimInspiralWaveformCacheEntry {
+    LALSimInspiralWaveformCacheEntry *prev;     /* more recently used */
+    LALSimInspiralWaveformCacheEntry *next;     /* less recently used */
+    UINT8 hash;                                 /* hash of the intrinsic parameters */
+    size_t bytes;                               /* memory used by the entry */
+    CacheEntryKind kind;                        /* kind of waveform stored */
+    const LALSimInspiralGenerator *generator;   /* generator, or NULL for the Choose*Waveform() interfaces */
+    UINT8 generatorId;                          /* identifier of the generator instance and its methods */
+    REAL8TimeSeries *hplus;
+    REAL8TimeSeries *hcross;
+    COMPLEX16FrequencySeries *hptilde;
+    COMPLEX16FrequencySeries *hctilde;
+    SphHarmTimeSeries *hlms;
+    SphHarmFrequencySeries *hlmstilde;
+    REAL8 phiRef;
+    REAL8 deltaTF;
+    REAL8 m1;
+    REAL8 m2;
+    REAL8 S1x;
+    REAL8 S1y;
+    REAL8 S1z;
+    REAL8 S2x;
+    REAL8 S2y;
+    REAL8 S2z;
+    REAL8 f_min;
+    REAL8 f_ref;
+    REAL8 f_max;
+    REAL8 r;
+    REAL8 i;
+    LALDict *LALpars;
+    Approximant approximant;
+    REAL8Sequence *frequencies;
+};
+
+static LALSimInspiralWaveformCacheEntry *CacheLookup(
         LALSimInspiralWaveformCache *cache,
+        CacheVariableDiffersBitmask *difference,
+        CacheEntryKind kind,
         REAL8 phiRef,
         REAL8 deltaTF,
         REAL8 m1,
@@ -57,11 +115,32 @@ static CacheVariableDiffersBitmask CacheArgsDifferenceBitmask(
         Approximant approximant,
         REAL8Sequence *frequencies);
 
+static UINT8 CacheEntryHash(const void *x);
+
+static int CacheEntryCmp(const void *x, const void *y);
+
+static void CacheEntryDestroy(LALSimInspiralWaveformCacheEntry *entry);
+
+static void CacheUnlink(LALSimInspiralWaveformCache *cache,
+        LALSimInspiralWaveformCacheEntry *entry);
+
+static int CacheInsert(LALSimInspiralWaveformCache *cache,
+        LALSimInspiralWaveformCacheEntry *entry);
+
+static void CacheEvict(LALSimInspiralWaveformCache *cache);
+
+static LALSimInspiralWaveformCacheEntry *CacheFind(
+        LALSimInspiralWaveformCache *cache,
+        LALSimInspiralWaveformCacheEntry *key);
+
+static int DictsAreEqual(LALDict *dict1, LALDict *dict2, const char *ignore);
+
 static int FrequenciesAreDifferent(
         REAL8Sequence *newFrequencies,
         REAL8Sequence *cachedFrequencies);
 
 static int StoreTDHCache(LALSimInspiralWaveformCache *cache,
+        LALSimInspiralWaveformCacheEntry *entry,
         REAL8TimeSeries *hplus,
         REAL8TimeSeries *hcross,
         REAL8 phiRef,
@@ -76,6 +155,7 @@ static int StoreTDHCache(LALSimInspiralWaveformCache *cache,
         Approximant approximant);
 
 static int StoreFDHCache(LALSimInspiralWaveformCache *cache,
+        LALSimInspiralWaveformCacheEntry *entry,
         COMPLEX16FrequencySeries *hptilde,
         COMPLEX16FrequencySeries *hctilde,
         REAL8 phiRef,
@@ -90,6 +170,23 @@ static int StoreFDHCache(LALSimInspiralWaveformCache *cache,
         Approximant approximant,
         REAL8Sequence *frequencies);
 
+static LALSimInspiralWaveformCacheEntry *CacheGetGeneratorEntry(
+        LALSimInspiralWaveformCache *cache,
+        CacheEntryKind kind,
+        LALDict *params,
+        LALSimInspiralGenerator *generator);
+
+static int CacheUseModes(LALDict *params,
+        const LALSimInspiralGenerator *generator);
+
+static LALDict *ModesParams(LALDict *params);
+
+static SphHarmTimeSeries *CopySphHarmTimeSeries(
+        const SphHarmTimeSeries *hlms, REAL8 scale);
+
+static SphHarmFrequencySeries *CopySphHarmFrequencySeries(
+        const SphHarmFrequencySeries *hlms, REAL8 scale);
+
 
 /**
  * @addtogroup LALSimInspiralWaveformCache_h
@@ -101,9 +198,10 @@ static int StoreFDHCache(LALSimInspiralWaveformCache *cache,
  * Returns the waveform in the time domain.
  * The parameters passed must be in SI units.
  *
- * This version allows caching of waveforms. The most recently generated
- * waveform and its parameters are stored. If the next call requests a waveform
- * that can be obtained by a simple transformation, then it is done.
+ * This version allows caching of waveforms. Generated waveforms and their
+ * parameters are stored in the cache. If a later call requests a waveform
+ * with the same intrinsic parameters as a stored one, and it can be obtained
+ * from it by a simple transformation, then it is done.
  * This bypasses the waveform generation and speeds up the code.
  */
 int XLALSimInspiralChooseTDWaveformFromCache(
@@ -133,6 +231,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
     REAL8 phasediff, dist_ratio, incl_ratio_plus, incl_ratio_cross;
     REAL8 cosrot, sinrot;
     CacheVariableDiffersBitmask changedParams;
+    LALSimInspiralWaveformCacheEntry *entry;
 
     // If nonGRparams are not NULL, don't even try to cache.
     if ( !XLALSimInspiralWaveformParamsNonGRAreDefault(LALpars) || (!cache) ||
@@ -153,23 +252,24 @@ int XLALSimInspiralChooseTDWaveformFromCache(
 					     approximant);
 
     // Check which parameters have changed
-    changedParams = CacheArgsDifferenceBitmask(cache, phiRef, deltaT,
+    entry = CacheLookup(cache, &changedParams, CACHE_TD_POLARIZATIONS, phiRef, deltaT,
             m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, 0., r, i,
             LALpars, approximant, NULL);
 
     // No parameters have changed! Copy the cached polarizations
     if( changedParams == NO_DIFFERENCE ) {
-        *hplus = XLALCutREAL8TimeSeries(cache->hplus, 0,
-                cache->hplus->data->length);
+        *hplus = XLALCutREAL8TimeSeries(entry->hplus, 0,
+                entry->hplus->data->length);
         if (*hplus == NULL) return XLAL_ENOMEM;
-        *hcross = XLALCutREAL8TimeSeries(cache->hcross, 0,
-                cache->hcross->data->length);
+        *hcross = XLALCutREAL8TimeSeries(entry->hcross, 0,
+                entry->hcross->data->length);
         if (*hcross == NULL) {
             XLALDestroyREAL8TimeSeries(*hplus);
             *hplus = NULL;
             return XLAL_ENOMEM;
         }
 
+        cache->hits++;
         return XLAL_SUCCESS;
     }
 
@@ -182,7 +282,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
         if (status == XLAL_FAILURE) return status;
 
         // FIXME: Need to add hlms, dynamic variables, etc. in cache
-        return StoreTDHCache(cache, *hplus, *hcross, phiRef, deltaT, m1, m2,
+        return StoreTDHCache(cache, entry, *hplus, *hcross, phiRef, deltaT, m1, m2,
 			     S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, r, i, LALpars, approximant);
     }
 
@@ -191,7 +291,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
     if( approximant == SpinTaylorT4 || approximant == SpinTaylorT5 ) {
         // If polarizations are not cached we must generate a fresh waveform
         // FIXME: Will need to check hlms and/or dynamical variables as well
-        if( cache->hplus == NULL || cache->hcross == NULL) {
+        if( entry->hplus == NULL || entry->hcross == NULL) {
             status = XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 						     S1x, S1y, S1z, S2x, S2y, S2z, r, i,
 						     phiRef, 0., 0., 0., deltaT, f_min, f_ref, LALpars,
@@ -199,7 +299,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
             if (status == XLAL_FAILURE) return status;
 
             // FIXME: Need to add hlms, dynamic variables, etc. in cache
-            return StoreTDHCache(cache, *hplus, *hcross, phiRef, deltaT, m1, m2,
+            return StoreTDHCache(cache, entry, *hplus, *hcross, phiRef, deltaT, m1, m2,
                     S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, r, i,
 		    LALpars, approximant);
         }
@@ -214,7 +314,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
             if (status == XLAL_FAILURE) return status;
 
             // FIXME: Need to add hlms, dynamic variables, etc. in cache
-            return StoreTDHCache(cache, *hplus, *hcross, phiRef, deltaT, m1, m2,
+            return StoreTDHCache(cache, entry, *hplus, *hcross, phiRef, deltaT, m1, m2,
                     S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, r, i,
                     LALpars, approximant);
         }
@@ -228,37 +328,38 @@ int XLALSimInspiralChooseTDWaveformFromCache(
             if (status == XLAL_FAILURE) return status;
 
             // FIXME: Need to add hlms, dynamic variables, etc. in cache
-            return StoreTDHCache(cache, *hplus, *hcross, phiRef, deltaT, m1, m2,
+            return StoreTDHCache(cache, entry, *hplus, *hcross, phiRef, deltaT, m1, m2,
                     S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, r, i,
 		    LALpars, approximant);
         }
         if( (changedParams & DISTANCE) != 0 ) {
             // Return rescaled copy of cached polarizations
-            dist_ratio = cache->r / r;
-            *hplus = XLALCreateREAL8TimeSeries(cache->hplus->name,
-                    &(cache->hplus->epoch), cache->hplus->f0,
-                    cache->hplus->deltaT, &(cache->hplus->sampleUnits),
-                    cache->hplus->data->length);
+            dist_ratio = entry->r / r;
+            *hplus = XLALCreateREAL8TimeSeries(entry->hplus->name,
+                    &(entry->hplus->epoch), entry->hplus->f0,
+                    entry->hplus->deltaT, &(entry->hplus->sampleUnits),
+                    entry->hplus->data->length);
             if (*hplus == NULL) return XLAL_ENOMEM;
 
-            *hcross = XLALCreateREAL8TimeSeries(cache->hcross->name,
-                    &(cache->hcross->epoch), cache->hcross->f0,
-                    cache->hcross->deltaT, &(cache->hcross->sampleUnits),
-                    cache->hcross->data->length);
+            *hcross = XLALCreateREAL8TimeSeries(entry->hcross->name,
+                    &(entry->hcross->epoch), entry->hcross->f0,
+                    entry->hcross->deltaT, &(entry->hcross->sampleUnits),
+                    entry->hcross->data->length);
             if (*hcross == NULL) {
                 XLALDestroyREAL8TimeSeries(*hplus);
                 *hplus = NULL;
                 return XLAL_ENOMEM;
             }
 
-            for (j = 0; j < cache->hplus->data->length; j++) {
-                (*hplus)->data->data[j] = cache->hplus->data->data[j]
+            for (j = 0; j < entry->hplus->data->length; j++) {
+                (*hplus)->data->data[j] = entry->hplus->data->data[j]
                         * dist_ratio;
-                (*hcross)->data->data[j] = cache->hcross->data->data[j]
+                (*hcross)->data->data[j] = entry->hcross->data->data[j]
                         * dist_ratio;
             }
         }
 
+        cache->hits++;
         return XLAL_SUCCESS;
     }
 
@@ -267,14 +368,14 @@ int XLALSimInspiralChooseTDWaveformFromCache(
                 || approximant==TaylorT3 || approximant==TaylorT4
                 || approximant==EOBNRv2 || approximant==SEOBNRv1) ) {
         // If polarizations are not cached we must generate a fresh waveform
-        if( cache->hplus == NULL || cache->hcross == NULL) {
+        if( entry->hplus == NULL || entry->hcross == NULL) {
             status = XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 						     S1x, S1y, S1z, S2x, S2y, S2z, r, i,
 						     phiRef, 0., 0., 0., deltaT, f_min, f_ref, LALpars, approximant);
             if (status == XLAL_FAILURE) return status;
 
             // FIXME: Need to add hlms, dynamic variables, etc. in cache
-            return StoreTDHCache(cache, *hplus, *hcross, phiRef, deltaT, m1, m2,
+            return StoreTDHCache(cache, entry, *hplus, *hcross, phiRef, deltaT, m1, m2,
                     S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, r, i,
                     LALpars, approximant);
         }
@@ -286,31 +387,31 @@ int XLALSimInspiralChooseTDWaveformFromCache(
 
         if( changedParams & PHI_REF ) {
             // Only 2nd harmonic present, so {h+,hx} rotates by 2*deltaphiRef
-            phasediff = 2.*(phiRef - cache->phiRef);
+            phasediff = 2.*(phiRef - entry->phiRef);
             cosrot = cos(phasediff);
             sinrot = sin(phasediff);
         }
         if( changedParams & INCLINATION) {
             // Rescale h+, hx by ratio of new/old inclination dependence
             incl_ratio_plus = (1.0 + cos(i)*cos(i))
-                    / (1.0 + cos(cache->i)*cos(cache->i));
-            incl_ratio_cross = cos(i) / cos(cache->i);
+                    / (1.0 + cos(entry->i)*cos(entry->i));
+            incl_ratio_cross = cos(i) / cos(entry->i);
         }
         if( changedParams & DISTANCE ) {
             // Rescale h+, hx by ratio of (1/new_dist)/(1/old_dist) = old/new
-            dist_ratio = cache->r / r;
+            dist_ratio = entry->r / r;
         }
 
         // Create the output polarizations
-        *hplus = XLALCreateREAL8TimeSeries(cache->hplus->name,
-                &(cache->hplus->epoch), cache->hplus->f0,
-                cache->hplus->deltaT, &(cache->hplus->sampleUnits),
-                cache->hplus->data->length);
+        *hplus = XLALCreateREAL8TimeSeries(entry->hplus->name,
+                &(entry->hplus->epoch), entry->hplus->f0,
+                entry->hplus->deltaT, &(entry->hplus->sampleUnits),
+                entry->hplus->data->length);
         if (*hplus == NULL) return XLAL_ENOMEM;
-        *hcross = XLALCreateREAL8TimeSeries(cache->hcross->name,
-                &(cache->hcross->epoch), cache->hcross->f0,
-                cache->hcross->deltaT, &(cache->hcross->sampleUnits),
-                cache->hcross->data->length);
+        *hcross = XLALCreateREAL8TimeSeries(entry->hcross->name,
+                &(entry->hcross->epoch), entry->hcross->f0,
+                entry->hcross->deltaT, &(entry->hcross->sampleUnits),
+                entry->hcross->data->length);
         if (*hcross == NULL) {
             XLALDestroyREAL8TimeSeries(*hplus);
             *hplus = NULL;
@@ -321,15 +422,16 @@ int XLALSimInspiralChooseTDWaveformFromCache(
         incl_ratio_plus *= dist_ratio;
         incl_ratio_cross *= dist_ratio;
         // FIXME: Do changing phiRef and inclination commute?!?!
-        for (j = 0; j < cache->hplus->data->length; j++) {
+        for (j = 0; j < entry->hplus->data->length; j++) {
             (*hplus)->data->data[j] = incl_ratio_plus
-                    * (cosrot*cache->hplus->data->data[j]
-                    - sinrot*cache->hcross->data->data[j]);
+                    * (cosrot*entry->hplus->data->data[j]
+                    - sinrot*entry->hcross->data->data[j]);
             (*hcross)->data->data[j] = incl_ratio_cross
-                    * (sinrot*cache->hplus->data->data[j]
-                    + cosrot*cache->hcross->data->data[j]);
+                    * (sinrot*entry->hplus->data->data[j]
+                    + cosrot*entry->hcross->data->data[j]);
         }
 
+        cache->hits++;
         return XLAL_SUCCESS;
     }
     // case 3: Non-precessing, ampO > 0
@@ -341,7 +443,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
                 || approximant==TEOBResumS) ) {
         // If polarizations are not cached we must generate a fresh waveform
         // FIXME: Add in check that hlms non-NULL
-        if( cache->hplus == NULL || cache->hcross == NULL) {
+        if( entry->hplus == NULL || entry->hcross == NULL) {
             // FIXME: This will change to a code-path: inputs->hlms->{h+,hx}
             status = XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 						     S1x, S1y, S1z, S2x, S2y, S2z, r, i,
@@ -349,7 +451,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
             if (status == XLAL_FAILURE) return status;
 
             // FIXME: Need to add hlms, dynamic variables, etc. in cache
-            return StoreTDHCache(cache, *hplus, *hcross, phiRef, deltaT, m1, m2,
+            return StoreTDHCache(cache, entry, *hplus, *hcross, phiRef, deltaT, m1, m2,
                     S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, r, i,
                     LALpars, approximant);
         }
@@ -363,7 +465,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
             if (status == XLAL_FAILURE) return status;
 
             // FIXME: Need to add hlms, dynamic variables, etc. in cache
-            return StoreTDHCache(cache, *hplus, *hcross, phiRef, deltaT, m1, m2,
+            return StoreTDHCache(cache, entry, *hplus, *hcross, phiRef, deltaT, m1, m2,
                     S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, r, i,
                     LALpars, approximant);
 
@@ -378,38 +480,39 @@ int XLALSimInspiralChooseTDWaveformFromCache(
             if (status == XLAL_FAILURE) return status;
 
             // FIXME: Need to add hlms, dynamic variables, etc. in cache
-            return StoreTDHCache(cache, *hplus, *hcross, phiRef, deltaT, m1, m2,
+            return StoreTDHCache(cache, entry, *hplus, *hcross, phiRef, deltaT, m1, m2,
                     S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, r, i,
                     LALpars, approximant);
 
         }
         if( changedParams & DISTANCE ) {
             // Return rescaled copy of cached polarizations
-            dist_ratio = cache->r / r;
-            *hplus = XLALCreateREAL8TimeSeries(cache->hplus->name,
-                    &(cache->hplus->epoch), cache->hplus->f0,
-                    cache->hplus->deltaT, &(cache->hplus->sampleUnits),
-                    cache->hplus->data->length);
+            dist_ratio = entry->r / r;
+            *hplus = XLALCreateREAL8TimeSeries(entry->hplus->name,
+                    &(entry->hplus->epoch), entry->hplus->f0,
+                    entry->hplus->deltaT, &(entry->hplus->sampleUnits),
+                    entry->hplus->data->length);
             if (*hplus == NULL) return XLAL_ENOMEM;
 
-            *hcross = XLALCreateREAL8TimeSeries(cache->hcross->name,
-                    &(cache->hcross->epoch), cache->hcross->f0,
-                    cache->hcross->deltaT, &(cache->hcross->sampleUnits),
-                    cache->hcross->data->length);
+            *hcross = XLALCreateREAL8TimeSeries(entry->hcross->name,
+                    &(entry->hcross->epoch), entry->hcross->f0,
+                    entry->hcross->deltaT, &(entry->hcross->sampleUnits),
+                    entry->hcross->data->length);
             if (*hcross == NULL) {
                 XLALDestroyREAL8TimeSeries(*hplus);
                 *hplus = NULL;
                 return XLAL_ENOMEM;
             }
 
-            for (j = 0; j < cache->hplus->data->length; j++) {
-                (*hplus)->data->data[j] = cache->hplus->data->data[j]
+            for (j = 0; j < entry->hplus->data->length; j++) {
+                (*hplus)->data->data[j] = entry->hplus->data->data[j]
                         * dist_ratio;
-                (*hcross)->data->data[j] = cache->hcross->data->data[j]
+                (*hcross)->data->data[j] = entry->hcross->data->data[j]
                         * dist_ratio;
             }
         }
 
+        cache->hits++;
         return XLAL_SUCCESS;
     }
 
@@ -417,6 +520,7 @@ int XLALSimInspiralChooseTDWaveformFromCache(
     // Basically, you requested a waveform type which is not setup for caching
     // b/c of lack of interest or it's unclear what/how to cache for that model
     else {
+        cache->misses++;
         return XLALSimInspiralChooseTDWaveform(hplus, hcross, m1, m2,
 					       S1x, S1y, S1z, S2x, S2y, S2z, r, i,
 					       phiRef, 0., 0., 0., deltaT, f_min, f_ref, LALpars, approximant);
@@ -428,9 +532,10 @@ int XLALSimInspiralChooseTDWaveformFromCache(
  * Returns the waveform in the frequency domain.
  * The parameters passed must be in SI units.
  *
- * This version allows caching of waveforms. The most recently generated
- * waveform and its parameters are stored. If the next call requests a waveform
- * that can be obtained by a simple transformation, then it is done.
+ * This version allows caching of waveforms. Generated waveforms and their
+ * parameters are stored in the cache. If a later call requests a waveform
+ * with the same intrinsic parameters as a stored one, and it can be obtained
+ * from it by a simple transformation, then it is done.
  * This bypasses the waveform generation and speeds up the code.
  */
 int XLALSimInspiralChooseFDWaveformFromCache(
@@ -462,6 +567,7 @@ int XLALSimInspiralChooseFDWaveformFromCache(
     REAL8 dist_ratio, incl_ratio_plus, incl_ratio_cross, phase_diff;
     COMPLEX16 exp_dphi;
     CacheVariableDiffersBitmask changedParams;
+    LALSimInspiralWaveformCacheEntry *entry;
 
 
     // If nonGRparams are not NULL, don't even try to cache.
@@ -480,23 +586,24 @@ int XLALSimInspiralChooseFDWaveformFromCache(
     }
 
     // Check which parameters have changed
-    changedParams = CacheArgsDifferenceBitmask(cache, phiRef, deltaF,
+    entry = CacheLookup(cache, &changedParams, CACHE_FD_POLARIZATIONS, phiRef, deltaF,
             m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, f_max, r, i,
 	    LALpars, approximant, frequencies);
 
     // No parameters have changed! Copy the cached polarizations
     if( changedParams == NO_DIFFERENCE ) {
-        *hptilde = XLALCutCOMPLEX16FrequencySeries(cache->hptilde, 0,
-                cache->hptilde->data->length);
+        *hptilde = XLALCutCOMPLEX16FrequencySeries(entry->hptilde, 0,
+                entry->hptilde->data->length);
         if (*hptilde == NULL) return XLAL_ENOMEM;
-        *hctilde = XLALCutCOMPLEX16FrequencySeries(cache->hctilde, 0,
-                cache->hctilde->data->length);
+        *hctilde = XLALCutCOMPLEX16FrequencySeries(entry->hctilde, 0,
+                entry->hctilde->data->length);
         if (*hctilde == NULL) {
             XLALDestroyCOMPLEX16FrequencySeries(*hptilde);
             *hptilde = NULL;
             return XLAL_ENOMEM;
         }
 
+        cache->hits++;
         return XLAL_SUCCESS;
     }
 
@@ -516,7 +623,7 @@ int XLALSimInspiralChooseFDWaveformFromCache(
         }
         if (status == XLAL_FAILURE) return status;
 
-        return StoreFDHCache(cache, *hptilde, *hctilde, phiRef, deltaF, m1, m2,
+        return StoreFDHCache(cache, entry, *hptilde, *hctilde, phiRef, deltaF, m1, m2,
 			     S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, f_max, r, i, LALpars, approximant, frequencies);
     }
 
@@ -527,7 +634,7 @@ int XLALSimInspiralChooseFDWaveformFromCache(
                 || approximant == IMRPhenomC ) {
         // If polarizations are not cached we must generate a fresh waveform
         // FIXME: Will need to check hlms and/or dynamical variables as well
-        if( cache->hptilde == NULL || cache->hctilde == NULL) {
+        if( entry->hptilde == NULL || entry->hctilde == NULL) {
             if ( frequencies != NULL ){
                 status =  XLALSimInspiralChooseFDWaveformSequence(hptilde, hctilde, phiRef,
                     m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_ref,
@@ -541,7 +648,7 @@ int XLALSimInspiralChooseFDWaveformFromCache(
             }
             if (status == XLAL_FAILURE) return status;
 
-            return StoreFDHCache(cache, *hptilde, *hctilde, phiRef, deltaF,
+            return StoreFDHCache(cache, entry, *hptilde, *hctilde, phiRef, deltaF,
                     m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_min, f_ref, f_max, r, i,
                     LALpars, approximant, frequencies);
         }
@@ -554,31 +661,31 @@ int XLALSimInspiralChooseFDWaveformFromCache(
 
         if( changedParams & PHI_REF ) {
             // Only 2nd harmonic present, so {h+,hx} \propto e^(2 i phiRef)
-            phase_diff = 2.*(phiRef - cache->phiRef);
+            phase_diff = 2.*(phiRef - entry->phiRef);
             exp_dphi = cpolar(1., phase_diff);
         }
         if( changedParams & INCLINATION) {
             // Rescale h+, hx by ratio of new/old inclination dependence
             incl_ratio_plus = (1.0 + cos(i)*cos(i))
-                    / (1.0 + cos(cache->i)*cos(cache->i));
-            incl_ratio_cross = cos(i) / cos(cache->i);
+                    / (1.0 + cos(entry->i)*cos(entry->i));
+            incl_ratio_cross = cos(i) / cos(entry->i);
         }
         if( changedParams & DISTANCE ) {
             // Rescale h+, hx by ratio of (1/new_dist)/(1/old_dist) = old/new
-            dist_ratio = cache->r / r;
+            dist_ratio = entry->r / r;
         }
 
         // Create the output polarizations
-        *hptilde = XLALCreateCOMPLEX16FrequencySeries(cache->hptilde->name,
-                &(cache->hptilde->epoch), cache->hptilde->f0,
-                cache->hptilde->deltaF, &(cache->hptilde->sampleUnits),
-                cache->hptilde->data->length);
+        *hptilde = XLALCreateCOMPLEX16FrequencySeries(entry->hptilde->name,
+                &(entry->hptilde->epoch), entry->hptilde->f0,
+                entry->hptilde->deltaF, &(entry->hptilde->sampleUnits),
+                entry->hptilde->data->length);
         if (*hptilde == NULL) return XLAL_ENOMEM;
 
-        *hctilde = XLALCreateCOMPLEX16FrequencySeries(cache->hctilde->name,
-                &(cache->hctilde->epoch), cache->hctilde->f0,
-                cache->hctilde->deltaF, &(cache->hctilde->sampleUnits),
-                cache->hctilde->data->length);
+        *hctilde = XLALCreateCOMPLEX16FrequencySeries(entry->hctilde->name,
+                &(entry->hctilde->epoch), entry->hctilde->f0,
+                entry->hctilde->deltaF, &(entry->hctilde->sampleUnits),
+                entry->hctilde->data->length);
         if (*hctilde == NULL) {
             XLALDestroyCOMPLEX16FrequencySeries(*hptilde);
             *hptilde = NULL;
@@ -588,13 +695,14 @@ int XLALSimInspiralChooseFDWaveformFromCache(
         // Get new polarizations by transforming the old
         incl_ratio_plus *= dist_ratio;
         incl_ratio_cross *= dist_ratio;
-        for (j = 0; j < cache->hptilde->data->length; j++) {
+        for (j = 0; j < entry->hptilde->data->length; j++) {
             (*hptilde)->data->data[j] = exp_dphi * incl_ratio_plus
-                    * cache->hptilde->data->data[j];
+                    * entry->hptilde->data->data[j];
             (*hctilde)->data->data[j] = exp_dphi * incl_ratio_cross
-                    * cache->hctilde->data->data[j];
+                    * entry->hctilde->data->data[j];
         }
 
+        cache->hits++;
         return XLAL_SUCCESS;
     }
 
@@ -607,6 +715,7 @@ int XLALSimInspiralChooseFDWaveformFromCache(
     // Basically, you requested a waveform type which is not setup for caching
     // b/c of lack of interest or it's unclear what/how to cache for that model
     else {
+        cache->misses++;
         if ( frequencies != NULL ){
             return XLALSimInspiralChooseFDWaveformSequence(hptilde, hctilde, phiRef,
                     m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_ref,
@@ -624,29 +733,298 @@ int XLALSimInspiralChooseFDWaveformFromCache(
 }
 
 /**
- * Construct and initialize a waveform cache.  Caches are used to
- * avoid re-computation of waveforms that differ only by simple
- * scaling relations in extrinsic parameters.
+ * Returns the time-domain modes of a waveform generator, reusing a
+ * previous result stored in the cache if the parameters differ from it
+ * at most in distance.  Equivalent to XLALSimInspiralGenerateTDModes().
+ *
+ * Entries are keyed on the generator instance, so entries of a destroyed
+ * generator are never returned for another one created in its place.
+ * If \a cache is NULL the modes are generated directly.
+ */
+int XLALSimInspiralGenerateTDModesFromCache(
+        SphHarmTimeSeries **hlm,                /**< spherical-harmonic modes [returned] */
+        LALDict *params,                        /**< waveform parameters (SI units) */
+        LALSimInspiralGenerator *generator,     /**< waveform generator */
+        LALSimInspiralWaveformCache *cache      /**< waveform cache structure; can be NULL */
+        )
+{
+    LALSimInspiralWaveformCacheEntry *entry;
+    REAL8 r;
+
+    XLAL_CHECK(hlm != NULL, XLAL_EFAULT);
+    XLAL_CHECK(*hlm == NULL, XLAL_EINVAL);
+    XLAL_CHECK(generator != NULL, XLAL_EFAULT);
+    XLAL_CHECK(generator->generate_td_modes != NULL, XLAL_EINVAL, "generator does not provide a method to generate time-domain modes");
+
+    if (cache == NULL)
+        return XLALSimInspiralGenerateTDModes(hlm, params, generator);
+
+    entry = CacheGetGeneratorEntry(cache, CACHE_TD_MODES, params, generator);
+    XLAL_CHECK(entry != NULL, XLAL_EFUNC);
+    r = XLALSimInspiralWaveformParamsLookupDistance(params);
+    *hlm = CopySphHarmTimeSeries(entry->hlms, r == entry->r ? 1. : entry->r / r);
+    XLAL_CHECK(*hlm != NULL, XLAL_EFUNC);
+
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Returns the Fourier-domain modes of a waveform generator, reusing a
+ * previous result stored in the cache if the parameters differ from it
+ * at most in distance.  Equivalent to XLALSimInspiralGenerateFDModes().
+ *
+ * Entries are keyed on the generator instance, so entries of a destroyed
+ * generator are never returned for another one created in its place.
+ * If \a cache is NULL the modes are generated directly.
+ */
+int XLALSimInspiralGenerateFDModesFromCache(
+        SphHarmFrequencySeries **hlm,           /**< spherical-harmonic modes [returned] */
+        LALDict *params,                        /**< waveform parameters (SI units) */
+        LALSimInspiralGenerator *generator,     /**< waveform generator */
+        LALSimInspiralWaveformCache *cache      /**< waveform cache structure; can be NULL */
+        )
+{
+    LALSimInspiralWaveformCacheEntry *entry;
+    REAL8 r;
+
+    XLAL_CHECK(hlm != NULL, XLAL_EFAULT);
+    XLAL_CHECK(*hlm == NULL, XLAL_EINVAL);
+    XLAL_CHECK(generator != NULL, XLAL_EFAULT);
+    XLAL_CHECK(generator->generate_fd_modes != NULL, XLAL_EINVAL, "generator does not provide a method to generate Fourier-domain modes");
+
+    if (cache == NULL)
+        return XLALSimInspiralGenerateFDModes(hlm, params, generator);
+
+    entry = CacheGetGeneratorEntry(cache, CACHE_FD_MODES, params, generator);
+    XLAL_CHECK(entry != NULL, XLAL_EFUNC);
+    r = XLALSimInspiralWaveformParamsLookupDistance(params);
+    *hlm = CopySphHarmFrequencySeries(entry->hlmstilde, r == entry->r ? 1. : entry->r / r);
+    XLAL_CHECK(*hlm != NULL, XLAL_EFUNC);
+
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Returns the time-domain polarizations of a waveform generator, using
+ * the cache to avoid regenerating the waveform where possible.
+ * Equivalent to XLALSimInspiralGenerateTDWaveform().
+ *
+ * The polarizations are cached, and are reused only if the parameters
+ * differ at most in distance.  Time-domain modes are not recombined: the
+ * time-domain approximants differ from their polarizations in amplitude
+ * order and mode content, or depend on the reference phase through their
+ * modes.
+ *
+ * Entries are keyed on the generator instance, so entries of a destroyed
+ * generator are never returned for another one created in its place.
+ * If \a cache is NULL the waveform is generated directly.
+ */
+int XLALSimInspiralGenerateTDWaveformFromCache(
+        REAL8TimeSeries **hplus,                /**< +-polarization waveform [returned] */
+        REAL8TimeSeries **hcross,               /**< x-polarization waveform [returned] */
+        LALDict *params,                        /**< waveform parameters (SI units) */
+        LALSimInspiralGenerator *generator,     /**< waveform generator */
+        LALSimInspiralWaveformCache *cache      /**< waveform cache structure; can be NULL */
+        )
+{
+    LALSimInspiralWaveformCacheEntry *entry;
+    REAL8 r, scale;
+    size_t j;
+
+    XLAL_CHECK(hplus != NULL && hcross != NULL, XLAL_EFAULT);
+    XLAL_CHECK(*hplus == NULL && *hcross == NULL, XLAL_EINVAL);
+    XLAL_CHECK(generator != NULL, XLAL_EFAULT);
+
+    if (cache == NULL)
+        return XLALSimInspiralGenerateTDWaveform(hplus, hcross, params, generator);
+
+    r = XLALSimInspiralWaveformParamsLookupDistance(params);
+
+    entry = CacheGetGeneratorEntry(cache, CACHE_TD_POLARIZATIONS, params, generator);
+    XLAL_CHECK(entry != NULL, XLAL_EFUNC);
+    *hplus = XLALCutREAL8TimeSeries(entry->hplus, 0, entry->hplus->data->length);
+    *hcross = XLALCutREAL8TimeSeries(entry->hcross, 0, entry->hcross->data->length);
+    if (*hplus == NULL || *hcross == NULL) {
+        XLALDestroyREAL8TimeSeries(*hplus);
+        XLALDestroyREAL8TimeSeries(*hcross);
+        *hplus = *hcross = NULL;
+        XLAL_ERROR(XLAL_EFUNC);
+    }
+
+    if (r != entry->r) {
+        scale = entry->r / r;
+        for (j = 0; j < (*hplus)->data->length; j++)
+            (*hplus)->data->data[j] *= scale;
+        for (j = 0; j < (*hcross)->data->length; j++)
+            (*hcross)->data->data[j] *= scale;
+    }
+
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Returns the Fourier-domain polarizations of a waveform generator, using
+ * the cache to avoid regenerating the waveform where possible.
+ * Equivalent to XLALSimInspiralGenerateFDWaveform().
+ *
+ * For the reduced-order models SEOBNRv4HM_ROM, SEOBNRv5_ROM and
+ * SEOBNRv5HM_ROM with aligned spins and no conditioning, the modes are
+ * generated and cached with zero inclination and reference phase, and the
+ * polarizations are obtained with
+ * XLALSimInspiralPolarizationsFromSphHarmFrequencySeries() at
+ * \f$(\iota, \pi/2 - \phi_\mathrm{ref})\f$, as in
+ * XLALSimInspiralPolarizationsFromChooseFDModes().  A change of distance,
+ * inclination or reference phase then costs only this sum.  Other models
+ * do not use the modes: IMRPhenomHM and IMRPhenomXHM include the
+ * reference phase in the modes themselves, and IMRPhenomXPHM returns its
+ * modes in the J-frame.
+ *
+ * Otherwise the polarizations themselves are cached, and are reused only
+ * if the parameters differ at most in distance.
+ *
+ * Entries are keyed on the generator instance, so entries of a destroyed
+ * generator are never returned for another one created in its place.
+ * If \a cache is NULL the waveform is generated directly.
+ */
+int XLALSimInspiralGenerateFDWaveformFromCache(
+        COMPLEX16FrequencySeries **hptilde,     /**< +-polarization waveform [returned] */
+        COMPLEX16FrequencySeries **hctilde,     /**< x-polarization waveform [returned] */
+        LALDict *params,                        /**< waveform parameters (SI units) */
+        LALSimInspiralGenerator *generator,     /**< waveform generator */
+        LALSimInspiralWaveformCache *cache      /**< waveform cache structure; can be NULL */
+        )
+{
+    LALSimInspiralWaveformCacheEntry *entry;
+    REAL8 r, scale;
+    size_t j;
+
+    XLAL_CHECK(hptilde != NULL && hctilde != NULL, XLAL_EFAULT);
+    XLAL_CHECK(*hptilde == NULL && *hctilde == NULL, XLAL_EINVAL);
+    XLAL_CHECK(generator != NULL, XLAL_EFAULT);
+
+    if (cache == NULL)
+        return XLALSimInspiralGenerateFDWaveform(hptilde, hctilde, params, generator);
+
+    r = XLALSimInspiralWaveformParamsLookupDistance(params);
+
+    if (CacheUseModes(params, generator)) {
+        LALDict *modesParams = ModesParams(params);
+        XLAL_CHECK(modesParams != NULL, XLAL_EFUNC);
+        entry = CacheGetGeneratorEntry(cache, CACHE_FD_MODES, modesParams, generator);
+        XLALDestroyDict(modesParams);
+        XLAL_CHECK(entry != NULL, XLAL_EFUNC);
+        if (XLALSimInspiralPolarizationsFromSphHarmFrequencySeries(hptilde, hctilde, entry->hlmstilde,
+                    XLALSimInspiralWaveformParamsLookupInclination(params),
+                    LAL_PI_2 - XLALSimInspiralWaveformParamsLookupRefPhase(params)) != XLAL_SUCCESS) {
+            XLALDestroyCOMPLEX16FrequencySeries(*hptilde);
+            XLALDestroyCOMPLEX16FrequencySeries(*hctilde);
+            *hptilde = *hctilde = NULL;
+            XLAL_ERROR(XLAL_EFUNC);
+        }
+    } else {
+        entry = CacheGetGeneratorEntry(cache, CACHE_FD_POLARIZATIONS, params, generator);
+        XLAL_CHECK(entry != NULL, XLAL_EFUNC);
+        *hptilde = XLALCutCOMPLEX16FrequencySeries(entry->hptilde, 0, entry->hptilde->data->length);
+        *hctilde = XLALCutCOMPLEX16FrequencySeries(entry->hctilde, 0, entry->hctilde->data->length);
+        if (*hptilde == NULL || *hctilde == NULL) {
+            XLALDestroyCOMPLEX16FrequencySeries(*hptilde);
+            XLALDestroyCOMPLEX16FrequencySeries(*hctilde);
+            *hptilde = *hctilde = NULL;
+            XLAL_ERROR(XLAL_EFUNC);
+        }
+    }
+
+    if (r != entry->r) {
+        scale = entry->r / r;
+        for (j = 0; j < (*hptilde)->data->length; j++)
+            (*hptilde)->data->data[j] *= scale;
+        for (j = 0; j < (*hctilde)->data->length; j++)
+            (*hctilde)->data->data[j] *= scale;
+    }
+
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Construct and initialize a waveform cache with the default limits of
+ * 16 waveforms and 256 MiB.  Caches are used to avoid re-computation of
+ * waveforms that differ only by simple scaling relations in extrinsic
+ * parameters.
  */
 LALSimInspiralWaveformCache *XLALCreateSimInspiralWaveformCache(void)
+{
+    LALSimInspiralWaveformCache *cache;
+    cache = XLALCreateSimInspiralWaveformCacheWithLimits(DEFAULT_MAX_ENTRIES, DEFAULT_MAX_BYTES);
+    XLAL_CHECK_NULL(cache != NULL, XLAL_EFUNC);
+    return cache;
+}
+
+/**
+ * Construct and initialize a waveform cache which stores at most
+ * \a maxEntries waveforms using at most \a maxBytes of memory.
+ * A limit of zero means no limit.
+ */
+LALSimInspiralWaveformCache *XLALCreateSimInspiralWaveformCacheWithLimits(
+        size_t maxEntries,      /**< maximum number of stored waveforms */
+        size_t maxBytes         /**< maximum memory used by stored waveforms */
+        )
 {
     LALSimInspiralWaveformCache *cache = XLALCalloc(1,
             sizeof(LALSimInspiralWaveformCache));
+    XLAL_CHECK_NULL(cache != NULL, XLAL_ENOMEM);
+
+    cache->table = XLALHashTblCreate(NULL, CacheEntryHash, CacheEntryCmp);
+    if (cache->table == NULL) {
+        XLALFree(cache);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    }
+    cache->maxEntries = maxEntries;
+    cache->maxBytes = maxBytes;
 
     return cache;
 }
 
+/**
+ * Change the limits of a waveform cache, discarding the least recently
+ * used waveforms if the cache now exceeds them.
+ * A limit of zero means no limit.
+ */
+int XLALSetSimInspiralWaveformCacheLimits(
+        LALSimInspiralWaveformCache *cache,     /**< waveform cache structure */
+        size_t maxEntries,                      /**< maximum number of stored waveforms */
+        size_t maxBytes                         /**< maximum memory used by stored waveforms */
+        )
+{
+    XLAL_CHECK(cache != NULL, XLAL_EFAULT);
+    cache->maxEntries = maxEntries;
+    cache->maxBytes = maxBytes;
+    CacheEvict(cache);
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Discard all waveforms stored in a waveform cache.
+ * The hit, miss and eviction counts are not reset.
+ */
+void XLALClearSimInspiralWaveformCache(LALSimInspiralWaveformCache *cache)
+{
+    if (cache != NULL) {
+        while (cache->head != NULL) {
+            LALSimInspiralWaveformCacheEntry *entry = cache->head;
+            CacheUnlink(cache, entry);
+            CacheEntryDestroy(entry);
+        }
+    }
+}
+
 /**
  * Destroy a waveform cache.
  */
 void XLALDestroySimInspiralWaveformCache(LALSimInspiralWaveformCache *cache)
 {
     if (cache != NULL) {
-        XLALDestroyREAL8TimeSeries(cache->hplus);
-        XLALDestroyREAL8TimeSeries(cache->hcross);
-        XLALDestroyCOMPLEX16FrequencySeries(cache->hptilde);
-        XLALDestroyCOMPLEX16FrequencySeries(cache->hctilde);
-        if(cache->LALpars) XLALDestroyDict(cache->LALpars);
+        XLALClearSimInspiralWaveformCache(cache);
+        XLALHashTblDestroy(cache->table);
         XLALFree(cache);
     }
 }
@@ -654,11 +1032,171 @@ void XLALDestroySimInspiralWaveformCache(LALSimInspiralWaveformCache *cache)
 /** @} */
 
 /**
- * Function to compare the requested arguments to those stored in the cache,
- * returns a bitmask which determines if a cached waveform can be recycled.
+ * Hash the intrinsic parameters of a cache entry.  Parameters which
+ * compare equal in CacheEntryCmp() must hash equally, so LALDict entries
+ * are combined in an order-independent way, and zeros are normalized.
+ * The distance is not part of the key of entries stored for a generator.
  */
-static CacheVariableDiffersBitmask CacheArgsDifferenceBitmask(
+static UINT8 CacheKeyHash(const LALSimInspiralWaveformCacheEntry *entry)
+{
+    /* adding zero maps -0.0 to +0.0, which compares equal to it */
+    const REAL8 params[] = {
+        entry->deltaTF + 0., entry->m1 + 0., entry->m2 + 0.,
+        entry->S1x + 0., entry->S1y + 0., entry->S1z + 0.,
+        entry->S2x + 0., entry->S2y + 0., entry->S2z + 0.,
+        entry->f_min + 0., entry->f_ref + 0., entry->f_max + 0.
+    };
+    const char *ignore = entry->generator ? "distance" : NULL;
+    UINT8 hash = XLALCityHash64WithSeed((const char *) params, sizeof(params),
+            4 * (UINT8) entry->approximant + (UINT8) entry->kind);
+
+    if (entry->generator != NULL) {
+        hash = XLALCityHash64WithSeed((const char *) &entry->generator, sizeof(entry->generator), hash);
+        hash = XLALCityHash64WithSeed((const char *) &entry->generatorId, sizeof(entry->generatorId), hash);
+    }
+
+    if (entry->frequencies != NULL)
+        hash = XLALCityHash64WithSeed((const char *) entry->frequencies->data,
+                entry->frequencies->length * sizeof(*entry->frequencies->data), hash);
+
+    /* a NULL LALDict hashes like an empty one, to which it compares equal */
+    UINT8 dicthash = 0;
+    if (entry->LALpars != NULL) {
+        LALDictIter iter;
+        LALDictEntry *item;
+        XLALDictIterInit(&iter, entry->LALpars);
+        while ((item = XLALDictIterNext(&iter)) != NULL) {
+            const char *key = XLALDictEntryGetKey(item);
+            const LALValue *value = XLALDictEntryGetValue(item);
+            if (ignore && strcmp(key, ignore) == 0)
+                continue;
+            dicthash += XLALCityHash64WithSeed((const char *) XLALValueGetDataPtr(value),
+                    XLALValueGetSize(value), XLALCityHash64(key, strlen(key)));
+        }
+    }
+    hash = XLALCityHash64WithSeed((const char *) &dicthash, sizeof(dicthash), hash);
+
+    return hash;
+}
+
+/** Hash table hash function: return the stored hash of a cache entry. */
+static UINT8 CacheEntryHash(const void *x)
+{
+    const LALSimInspiralWaveformCacheEntry *entry = x;
+    return entry->hash;
+}
+
+/**
+ * Hash table comparison function: returns 0 if two cache entries have
+ * the same intrinsic parameters, i.e. one may be transformed into the other.
+ */
+static int CacheEntryCmp(const void *x, const void *y)
+{
+    const LALSimInspiralWaveformCacheEntry *a = x;
+    const LALSimInspiralWaveformCacheEntry *b = y;
+
+    if ( a->hash != b->hash ) return 1;
+    if ( a->kind != b->kind ) return 1;
+    if ( a->generator != b->generator ) return 1;
+    if ( a->generatorId != b->generatorId ) return 1;
+    if ( a->approximant != b->approximant ) return 1;
+    if ( a->deltaTF != b->deltaTF ) return 1;
+    if ( a->m1 != b->m1 ) return 1;
+    if ( a->m2 != b->m2 ) return 1;
+    if ( a->S1x != b->S1x ) return 1;
+    if ( a->S1y != b->S1y ) return 1;
+    if ( a->S1z != b->S1z ) return 1;
+    if ( a->S2x != b->S2x ) return 1;
+    if ( a->S2y != b->S2y ) return 1;
+    if ( a->S2z != b->S2z ) return 1;
+    if ( a->f_min != b->f_min ) return 1;
+    if ( a->f_ref != b->f_ref ) return 1;
+    if ( a->f_max != b->f_max ) return 1;
+    if ( FrequenciesAreDifferent(a->frequencies, b->frequencies) ) return 1;
+    if ( !DictsAreEqual(a->LALpars, b->LALpars, a->generator ? "distance" : NULL) ) return 1;
+
+    return 0;
+}
+
+/** Number of entries in a LALDict, not counting the key \a ignore. */
+static size_t DictSizeIgnoring(LALDict *dict, const char *ignore)
+{
+    size_t size;
+    if (dict == NULL) return 0;
+    size = XLALDictSize(dict);
+    if (ignore && XLALDictContains(dict, ignore) == 1) size--;
+    return size;
+}
+
+/**
+ * Function to compare two LALDicts, ignoring the key \a ignore if it is
+ * not NULL.  Returns 1 if they contain the same keys with equal values,
+ * 0 otherwise.  A NULL LALDict is equal to an empty one.
+ */
+static int DictsAreEqual(LALDict *dict1, LALDict *dict2, const char *ignore)
+{
+    LALDictIter iter;
+    LALDictEntry *item;
+    size_t size1 = DictSizeIgnoring(dict1, ignore);
+    size_t size2 = DictSizeIgnoring(dict2, ignore);
+
+    if ( size1 != size2 ) return 0;
+    if ( size1 == 0 ) return 1;
+
+    XLALDictIterInit(&iter, dict1);
+    while ((item = XLALDictIterNext(&iter)) != NULL) {
+        LALDictEntry *other;
+        if ( ignore && strcmp(XLALDictEntryGetKey(item), ignore) == 0 ) continue;
+        other = XLALDictLookup(dict2, XLALDictEntryGetKey(item));
+        if ( other == NULL ) return 0;
+        if ( !XLALValueEqual(XLALDictEntryGetValue(item), XLALDictEntryGetValue(other)) ) return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * Find the stored waveform matching the key fields of \a key, and mark it
+ * as most recently used.  Returns NULL if there is none.
+ */
+static LALSimInspiralWaveformCacheEntry *CacheFind(
         LALSimInspiralWaveformCache *cache,
+        LALSimInspiralWaveformCacheEntry *key)
+{
+    LALSimInspiralWaveformCacheEntry *entry;
+    const void *found = NULL;
+
+    key->hash = CacheKeyHash(key);
+    if (XLALHashTblFind(cache->table, key, &found) != XLAL_SUCCESS || found == NULL)
+        return NULL;
+    entry = (LALSimInspiralWaveformCacheEntry *) found;
+
+    /* Move the entry to the front of the list */
+    if (entry != cache->head) {
+        entry->prev->next = entry->next;
+        if (entry->next != NULL)
+            entry->next->prev = entry->prev;
+        else
+            cache->tail = entry->prev;
+        entry->prev = NULL;
+        entry->next = cache->head;
+        cache->head->prev = entry;
+        cache->head = entry;
+    }
+
+    return entry;
+}
+
+/**
+ * Function to find a stored waveform with the requested intrinsic
+ * parameters.  If found, it is marked as most recently used, and the
+ * returned bitmask determines how it must be transformed; otherwise
+ * NULL is returned and the bitmask is INTRINSIC.
+ */
+static LALSimInspiralWaveformCacheEntry *CacheLookup(
+        LALSimInspiralWaveformCache *cache,
+        CacheVariableDiffersBitmask *difference,
+        CacheEntryKind kind,
         REAL8 phiRef,
         REAL8 deltaTF,
         REAL8 m1,
@@ -673,45 +1211,124 @@ static CacheVariableDiffersBitmask CacheArgsDifferenceBitmask(
         REAL8Sequence *frequencies
         )
 {
-    CacheVariableDiffersBitmask difference = NO_DIFFERENCE;
-    if (cache == NULL) return INTRINSIC;
-
-    if ( !XLALSimInspiralWaveformFlagsEqual(LALpars, cache->LALpars) )
-        return INTRINSIC;
-
-    if ( deltaTF != cache->deltaTF) return INTRINSIC;
-    if ( m1 != cache->m1) return INTRINSIC;
-    if ( m2 != cache->m2) return INTRINSIC;
-    if ( S1x != cache->S1x) return INTRINSIC;
-    if ( S1y != cache->S1y) return INTRINSIC;
-    if ( S1z != cache->S1z) return INTRINSIC;
-    if ( S2x != cache->S2x) return INTRINSIC;
-    if ( S2y != cache->S2y) return INTRINSIC;
-    if ( S2z != cache->S2z) return INTRINSIC;
-    if ( f_min != cache->f_min) return INTRINSIC;
-    if ( f_ref != cache->f_ref) return INTRINSIC;
-    if ( f_max != cache->f_max) return INTRINSIC;
-    if ( XLALSimInspiralWaveformParamsLookupTidalLambda1(LALpars) != XLALSimInspiralWaveformParamsLookupTidalLambda1(cache->LALpars)) return INTRINSIC;
-    if ( XLALSimInspiralWaveformParamsLookupTidalLambda2(LALpars) != XLALSimInspiralWaveformParamsLookupTidalLambda2(cache->LALpars)) return INTRINSIC;
-    if ( XLALSimInspiralWaveformParamsLookupTidalOctupolarLambda1(LALpars) != XLALSimInspiralWaveformParamsLookupTidalOctupolarLambda1(cache->LALpars)) return INTRINSIC;
-    if ( XLALSimInspiralWaveformParamsLookupTidalOctupolarLambda2(LALpars) != XLALSimInspiralWaveformParamsLookupTidalOctupolarLambda2(cache->LALpars)) return INTRINSIC;
-    if ( XLALSimInspiralWaveformParamsLookupTidalHexadecapolarLambda1(LALpars) != XLALSimInspiralWaveformParamsLookupTidalHexadecapolarLambda1(cache->LALpars)) return INTRINSIC;
-    if ( XLALSimInspiralWaveformParamsLookupTidalHexadecapolarLambda2(LALpars) != XLALSimInspiralWaveformParamsLookupTidalHexadecapolarLambda1(cache->LALpars)) return INTRINSIC;
-    if ( XLALSimInspiralWaveformParamsLookupdQuadMon1(LALpars) != XLALSimInspiralWaveformParamsLookupdQuadMon1(cache->LALpars)) return INTRINSIC;
-    if ( XLALSimInspiralWaveformParamsLookupdQuadMon2(LALpars) != XLALSimInspiralWaveformParamsLookupdQuadMon2(cache->LALpars)) return INTRINSIC;
-
-    if ( XLALSimInspiralWaveformParamsLookupPNAmplitudeOrder(LALpars) != XLALSimInspiralWaveformParamsLookupPNAmplitudeOrder(cache->LALpars)) return INTRINSIC;
-    if ( XLALSimInspiralWaveformParamsLookupPNAmplitudeOrder(LALpars) != XLALSimInspiralWaveformParamsLookupPNAmplitudeOrder(cache->LALpars)) return INTRINSIC;
-
-    if ( approximant != cache->approximant) return INTRINSIC;
-
-    if (r != cache->r) difference = difference | DISTANCE;
-    if (phiRef != cache->phiRef) difference = difference | PHI_REF;
-    if (i != cache->i) difference = difference | INCLINATION;
-
-    if (FrequenciesAreDifferent(frequencies,cache->frequencies)) return INTRINSIC;
-
-    return difference;
+    LALSimInspiralWaveformCacheEntry key;
+    LALSimInspiralWaveformCacheEntry *entry;
+
+    *difference = INTRINSIC;
+    if (cache == NULL || cache->table == NULL) return NULL;
+
+    memset(&key, 0, sizeof(key));
+    key.kind = kind;
+    key.deltaTF = deltaTF;
+    key.m1 = m1;
+    key.m2 = m2;
+    key.S1x = S1x;
+    key.S1y = S1y;
+    key.S1z = S1z;
+    key.S2x = S2x;
+    key.S2y = S2y;
+    key.S2z = S2z;
+    key.f_min = f_min;
+    key.f_ref = f_ref;
+    key.f_max = f_max;
+    key.LALpars = LALpars;
+    key.approximant = approximant;
+    key.frequencies = frequencies;
+    entry = CacheFind(cache, &key);
+    if (entry == NULL) return NULL;
+
+    *difference = NO_DIFFERENCE;
+    if (r != entry->r) *difference = *difference | DISTANCE;
+    if (phiRef != entry->phiRef) *difference = *difference | PHI_REF;
+    if (i != entry->i) *difference = *difference | INCLINATION;
+
+    return entry;
+}
+
+/** Free a cache entry which is not in a cache. */
+static void CacheEntryDestroy(LALSimInspiralWaveformCacheEntry *entry)
+{
+    if (entry != NULL) {
+        XLALDestroyREAL8TimeSeries(entry->hplus);
+        XLALDestroyREAL8TimeSeries(entry->hcross);
+        XLALDestroyCOMPLEX16FrequencySeries(entry->hptilde);
+        XLALDestroyCOMPLEX16FrequencySeries(entry->hctilde);
+        XLALDestroySphHarmTimeSeries(entry->hlms);
+        XLALDestroySphHarmFrequencySeries(entry->hlmstilde);
+        XLALDestroyREAL8Sequence(entry->frequencies);
+        if(entry->LALpars) XLALDestroyDict(entry->LALpars);
+        XLALFree(entry);
+    }
+}
+
+/** Remove an entry from a cache, without freeing it. */
+static void CacheUnlink(LALSimInspiralWaveformCache *cache,
+        LALSimInspiralWaveformCacheEntry *entry)
+{
+    void *removed = NULL;
+    XLALHashTblExtract(cache->table, entry, &removed);
+    if (entry->prev != NULL)
+        entry->prev->next = entry->next;
+    else
+        cache->head = entry->next;
+    if (entry->next != NULL)
+        entry->next->prev = entry->prev;
+    else
+        cache->tail = entry->prev;
+    entry->prev = entry->next = NULL;
+    cache->numEntries--;
+    cache->numBytes -= entry->bytes;
+}
+
+/**
+ * Add a filled-in entry to the front of a cache, replacing any entry
+ * with the same intrinsic parameters, then enforce the cache limits.
+ * On failure the entry is freed.
+ */
+static int CacheInsert(LALSimInspiralWaveformCache *cache,
+        LALSimInspiralWaveformCacheEntry *entry)
+{
+    const void *found = NULL;
+
+    entry->hash = CacheKeyHash(entry);
+    if (XLALHashTblFind(cache->table, entry, &found) == XLAL_SUCCESS && found != NULL) {
+        LALSimInspiralWaveformCacheEntry *old = (LALSimInspiralWaveformCacheEntry *) found;
+        CacheUnlink(cache, old);
+        CacheEntryDestroy(old);
+    }
+    if (XLALHashTblAdd(cache->table, entry) != XLAL_SUCCESS) {
+        CacheEntryDestroy(entry);
+        XLAL_ERROR(XLAL_EFUNC);
+    }
+
+    entry->prev = NULL;
+    entry->next = cache->head;
+    if (cache->head != NULL)
+        cache->head->prev = entry;
+    else
+        cache->tail = entry;
+    cache->head = entry;
+    cache->numEntries++;
+    cache->numBytes += entry->bytes;
+
+    CacheEvict(cache);
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Discard least recently used entries until the cache respects its
+ * limits.  The most recently used entry is never discarded.
+ */
+static void CacheEvict(LALSimInspiralWaveformCache *cache)
+{
+    while (cache->tail != cache->head
+            && ((cache->maxEntries > 0 && cache->numEntries > cache->maxEntries)
+                || (cache->maxBytes > 0 && cache->numBytes > cache->maxBytes))) {
+        LALSimInspiralWaveformCacheEntry *entry = cache->tail;
+        CacheUnlink(cache, entry);
+        CacheEntryDestroy(entry);
+        cache->evictions++;
+    }
 }
 
 /**
@@ -734,8 +1351,12 @@ static int FrequenciesAreDifferent(
     return 0;
 }
 
-/** Store the output TD hplus and hcross in the cache. */
+/**
+ * Store the output TD hplus and hcross in the cache, in the given entry
+ * if it is not NULL, or else in a new entry.
+ */
 static int StoreTDHCache(LALSimInspiralWaveformCache *cache,
+        LALSimInspiralWaveformCacheEntry *entry,
         REAL8TimeSeries *hplus,
         REAL8TimeSeries *hcross,
         REAL8 phiRef,
@@ -750,61 +1371,82 @@ static int StoreTDHCache(LALSimInspiralWaveformCache *cache,
         Approximant approximant
         )
 {
+    cache->misses++;
+
+    if (hplus == NULL || hcross == NULL || hplus->data == NULL || hcross->data == NULL){
+        XLALPrintError("We have null pointers for h+, hx in StoreTDHCache \n");
+        XLALPrintError("Houston-S, we've got a problem SOS, SOS, SOS, the waveform generator returns NULL!!!... m1 = %.18e, m2 = %.18e, fMin = %.18e, spin1 = {%.18e, %.18e, %.18e},   spin2 = {%.18e, %.18e, %.18e} \n",
+                   m1, m2, (double)f_min, S1x, S1y, S1z, S2x, S2y, S2z);
+        return XLAL_ENOMEM;
+    }
+
+    /* Take the entry out of the cache while it is updated */
+    if (entry != NULL) {
+        CacheUnlink(cache, entry);
+    } else {
+        entry = XLALCalloc(1, sizeof(*entry));
+        if (entry == NULL) return XLAL_ENOMEM;
+    }
+
     /* Clear any frequency-domain data. */
-    if (cache->hptilde != NULL) {
-        XLALDestroyCOMPLEX16FrequencySeries(cache->hptilde);
-        cache->hptilde = NULL;
+    if (entry->hptilde != NULL) {
+        XLALDestroyCOMPLEX16FrequencySeries(entry->hptilde);
+        entry->hptilde = NULL;
     }
 
-    if (cache->hctilde != NULL) {
-        XLALDestroyCOMPLEX16FrequencySeries(cache->hctilde);
-        cache->hctilde = NULL;
+    if (entry->hctilde != NULL) {
+        XLALDestroyCOMPLEX16FrequencySeries(entry->hctilde);
+        entry->hctilde = NULL;
     }
 
+    XLALDestroyREAL8Sequence(entry->frequencies);
+    entry->frequencies = NULL;
+
     /* Store params in cache */
-    cache->phiRef = phiRef;
-    cache->deltaTF = deltaT;
-    cache->m1 = m1;
-    cache->m2 = m2;
-    cache->S1x = S1x;
-    cache->S1y = S1y;
-    cache->S1z = S1z;
-    cache->S2x = S2x;
-    cache->S2y = S2y;
-    cache->S2z = S2z;
-    cache->f_min = f_min;
-    cache->f_ref = f_ref;
-    cache->r = r;
-    cache->i = i;
-    if(cache->LALpars) XLALDestroyDict(cache->LALpars);
-    cache->LALpars = XLALDictDuplicate(LALpars);
-    cache->approximant = approximant;
-    cache->frequencies = NULL;
+    entry->kind = CACHE_TD_POLARIZATIONS;
+    entry->phiRef = phiRef;
+    entry->deltaTF = deltaT;
+    entry->m1 = m1;
+    entry->m2 = m2;
+    entry->S1x = S1x;
+    entry->S1y = S1y;
+    entry->S1z = S1z;
+    entry->S2x = S2x;
+    entry->S2y = S2y;
+    entry->S2z = S2z;
+    entry->f_min = f_min;
+    entry->f_ref = f_ref;
+    entry->f_max = 0.;
+    entry->r = r;
+    entry->i = i;
+    if(entry->LALpars) XLALDestroyDict(entry->LALpars);
+    entry->LALpars = XLALDictDuplicate(LALpars);
+    entry->approximant = approximant;
 
     // Copy over the waveforms
     // NB: XLALCut... creates a new Series object and copies data and metadata
-    XLALDestroyREAL8TimeSeries(cache->hplus);
-    XLALDestroyREAL8TimeSeries(cache->hcross);
-    if (hplus == NULL || hcross == NULL || hplus->data == NULL || hcross->data == NULL){
-        XLALPrintError("We have null pointers for h+, hx in StoreTDHCache \n");
-        XLALPrintError("Houston-S, we've got a problem SOS, SOS, SOS, the waveform generator returns NULL!!!... m1 = %.18e, m2 = %.18e, fMin = %.18e, spin1 = {%.18e, %.18e, %.18e},   spin2 = {%.18e, %.18e, %.18e} \n",
-                   m1, m2, (double)f_min, S1x, S1y, S1z, S2x, S2y, S2z);
-        return XLAL_ENOMEM;
-    }
-    cache->hplus = XLALCutREAL8TimeSeries(hplus, 0, hplus->data->length);
-    if (cache->hplus == NULL) return XLAL_ENOMEM;
-    cache->hcross = XLALCutREAL8TimeSeries(hcross, 0, hcross->data->length);
-    if (cache->hcross == NULL) {
-        XLALDestroyREAL8TimeSeries(cache->hplus);
-        cache->hplus = NULL;
+    XLALDestroyREAL8TimeSeries(entry->hplus);
+    XLALDestroyREAL8TimeSeries(entry->hcross);
+    entry->hcross = NULL;
+    entry->hplus = XLALCutREAL8TimeSeries(hplus, 0, hplus->data->length);
+    if (entry->hplus != NULL)
+        entry->hcross = XLALCutREAL8TimeSeries(hcross, 0, hcross->data->length);
+    if (entry->hplus == NULL || entry->hcross == NULL) {
+        CacheEntryDestroy(entry);
         return XLAL_ENOMEM;
     }
+    entry->bytes = sizeof(*entry)
+        + (hplus->data->length + hcross->data->length) * sizeof(REAL8);
 
-    return XLAL_SUCCESS;
+    return CacheInsert(cache, entry);
 }
 
-/** Store the output FD hptilde and hctilde in cache. */
+/**
+ * Store the output FD hptilde and hctilde in cache, in the given entry
+ * if it is not NULL, or else in a new entry.
+ */
 static int StoreFDHCache(LALSimInspiralWaveformCache *cache,
+        LALSimInspiralWaveformCacheEntry *entry,
         COMPLEX16FrequencySeries *hptilde,
         COMPLEX16FrequencySeries *hctilde,
         REAL8 phiRef,
@@ -820,59 +1462,281 @@ static int StoreFDHCache(LALSimInspiralWaveformCache *cache,
         REAL8Sequence *frequencies
         )
 {
+    cache->misses++;
+
+    /* Take the entry out of the cache while it is updated */
+    if (entry != NULL) {
+        CacheUnlink(cache, entry);
+    } else {
+        entry = XLALCalloc(1, sizeof(*entry));
+        if (entry == NULL) return XLAL_ENOMEM;
+    }
+
     /* Clear any time-domain data. */
-    if (cache->hplus != NULL) {
-        XLALDestroyREAL8TimeSeries(cache->hplus);
-        cache->hplus = NULL;
+    if (entry->hplus != NULL) {
+        XLALDestroyREAL8TimeSeries(entry->hplus);
+        entry->hplus = NULL;
     }
 
-    if (cache->hcross != NULL) {
-        XLALDestroyREAL8TimeSeries(cache->hcross);
-        cache->hcross = NULL;
+    if (entry->hcross != NULL) {
+        XLALDestroyREAL8TimeSeries(entry->hcross);
+        entry->hcross = NULL;
     }
 
     /* Store params in cache */
-    cache->phiRef = phiRef;
-    cache->deltaTF = deltaT;
-    cache->m1 = m1;
-    cache->m2 = m2;
-    cache->S1x = S1x;
-    cache->S1y = S1y;
-    cache->S1z = S1z;
-    cache->S2x = S2x;
-    cache->S2y = S2y;
-    cache->S2z = S2z;
-    cache->f_min = f_min;
-    cache->f_ref = f_ref;
-    cache->f_max = f_max;
-    cache->r = r;
-    cache->i = i;
-    if(cache->LALpars) XLALDestroyDict(cache->LALpars);
-    cache->LALpars = XLALDictDuplicate(LALpars);
-    cache->approximant = approximant;
-
-    XLALDestroyREAL8Sequence(cache->frequencies);
-    cache->frequencies = NULL;
+    entry->kind = CACHE_FD_POLARIZATIONS;
+    entry->phiRef = phiRef;
+    entry->deltaTF = deltaT;
+    entry->m1 = m1;
+    entry->m2 = m2;
+    entry->S1x = S1x;
+    entry->S1y = S1y;
+    entry->S1z = S1z;
+    entry->S2x = S2x;
+    entry->S2y = S2y;
+    entry->S2z = S2z;
+    entry->f_min = f_min;
+    entry->f_ref = f_ref;
+    entry->f_max = f_max;
+    entry->r = r;
+    entry->i = i;
+    if(entry->LALpars) XLALDestroyDict(entry->LALpars);
+    entry->LALpars = XLALDictDuplicate(LALpars);
+    entry->approximant = approximant;
+
+    XLALDestroyREAL8Sequence(entry->frequencies);
+    entry->frequencies = NULL;
     if (frequencies != NULL){
-        cache->frequencies = XLALCopyREAL8Sequence(frequencies);
+        entry->frequencies = XLALCopyREAL8Sequence(frequencies);
     }
 
     // Copy over the waveforms
     // NB: XLALCut... creates a new Series object and copies data and metadata
-    XLALDestroyCOMPLEX16FrequencySeries(cache->hptilde);
-    XLALDestroyCOMPLEX16FrequencySeries(cache->hctilde);
-    cache->hptilde = XLALCutCOMPLEX16FrequencySeries(hptilde, 0,
+    XLALDestroyCOMPLEX16FrequencySeries(entry->hptilde);
+    XLALDestroyCOMPLEX16FrequencySeries(entry->hctilde);
+    entry->hctilde = NULL;
+    entry->hptilde = XLALCutCOMPLEX16FrequencySeries(hptilde, 0,
             hptilde->data->length);
-    if (cache->hptilde == NULL) return XLAL_ENOMEM;
-    cache->hctilde = XLALCutCOMPLEX16FrequencySeries(hctilde, 0,
-            hctilde->data->length);
-    if (cache->hctilde == NULL) {
-        XLALDestroyCOMPLEX16FrequencySeries(cache->hptilde);
-        cache->hptilde = NULL;
+    if (entry->hptilde != NULL)
+        entry->hctilde = XLALCutCOMPLEX16FrequencySeries(hctilde, 0,
+                hctilde->data->length);
+    if (entry->hptilde == NULL || entry->hctilde == NULL
+            || (frequencies != NULL && entry->frequencies == NULL)) {
+        CacheEntryDestroy(entry);
         return XLAL_ENOMEM;
     }
+    entry->bytes = sizeof(*entry)
+        + (hptilde->data->length + hctilde->data->length) * sizeof(COMPLEX16);
+    if (frequencies != NULL)
+        entry->bytes += frequencies->length * sizeof(REAL8);
 
-    return XLAL_SUCCESS;
+    return CacheInsert(cache, entry);
+}
+
+/**
+ * Find or generate the cache entry of kind \a kind for a waveform generator.
+ * An entry generated at a different, nonzero distance is reused; the caller
+ * rescales it.  The entry is the most recently used one on return.
+ */
+static LALSimInspiralWaveformCacheEntry *CacheGetGeneratorEntry(
+        LALSimInspiralWaveformCache *cache,
+        CacheEntryKind kind,
+        LALDict *params,
+        LALSimInspiralGenerator *generator)
+{
+    LALSimInspiralWaveformCacheEntry key;
+    LALSimInspiralWaveformCacheEntry *entry;
+    REAL8 r = XLALSimInspiralWaveformParamsLookupDistance(params);
+    int status = XLAL_FAILURE;
+
+    memset(&key, 0, sizeof(key));
+    key.kind = kind;
+    key.generator = generator;
+    key.generatorId = generator->id;
+    key.LALpars = params;
+    entry = CacheFind(cache, &key);
+    if (entry != NULL && (entry->r == r || (entry->r != 0 && r != 0))) {
+        cache->hits++;
+        return entry;
+    }
+
+    cache->misses++;
+    entry = XLALCalloc(1, sizeof(*entry));
+    XLAL_CHECK_NULL(entry != NULL, XLAL_ENOMEM);
+    entry->kind = kind;
+    entry->generator = generator;
+    entry->generatorId = generator->id;
+    entry->r = r;
+    entry->bytes = sizeof(*entry);
+
+    switch (kind) {
+    case CACHE_TD_POLARIZATIONS:
+        status = XLALSimInspiralGenerateTDWaveform(&entry->hplus, &entry->hcross, params, generator);
+        if (status == XLAL_SUCCESS)
+            entry->bytes += (entry->hplus->data->length + entry->hcross->data->length) * sizeof(REAL8);
+        break;
+    case CACHE_FD_POLARIZATIONS:
+        status = XLALSimInspiralGenerateFDWaveform(&entry->hptilde, &entry->hctilde, params, generator);
+        if (status == XLAL_SUCCESS)
+            entry->bytes += (entry->hptilde->data->length + entry->hctilde->data->length) * sizeof(COMPLEX16);
+        break;
+    case CACHE_TD_MODES:
+        status = XLALSimInspiralGenerateTDModes(&entry->hlms, params, generator);
+        if (status == XLAL_SUCCESS && entry->hlms == NULL)
+            status = XLAL_FAILURE;
+        if (status == XLAL_SUCCESS) {
+            const SphHarmTimeSeries *hlm;
+            for (hlm = entry->hlms; hlm != NULL; hlm = hlm->next)
+                entry->bytes += sizeof(*hlm) + hlm->mode->data->length * sizeof(COMPLEX16);
+        }
+        break;
+    case CACHE_FD_MODES:
+        status = XLALSimInspiralGenerateFDModes(&entry->hlmstilde, params, generator);
+        if (status == XLAL_SUCCESS && entry->hlmstilde == NULL)
+            status = XLAL_FAILURE;
+        if (status == XLAL_SUCCESS) {
+            const SphHarmFrequencySeries *hlm;
+            for (hlm = entry->hlmstilde; hlm != NULL; hlm = hlm->next)
+                entry->bytes += sizeof(*hlm) + hlm->mode->data->length * sizeof(COMPLEX16);
+        }
+        break;
+    }
+    if (status != XLAL_SUCCESS) {
+        CacheEntryDestroy(entry);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    }
+
+    if (params != NULL) {
+        entry->LALpars = XLALDictDuplicate(params);
+        if (entry->LALpars == NULL) {
+            CacheEntryDestroy(entry);
+            XLAL_ERROR_NULL(XLAL_EFUNC);
+        }
+    }
+
+    XLAL_CHECK_NULL(CacheInsert(cache, entry) == XLAL_SUCCESS, XLAL_EFUNC);
+    return entry;
+}
+
+/**
+ * Returns 1 if Fourier-domain polarizations may be obtained by summing
+ * cached modes of \a generator, 0 otherwise.  This is only the case for
+ * the approximants listed in CacheModesApproximants[], whose modes do not
+ * depend on \f$\phi_\mathrm{ref}\f$ and which
+ * XLALSimInspiralPolarizationsFromChooseFDModes() sums at
+ * \f$(\iota, \pi/2 - \phi_\mathrm{ref})\f$, when they produce their
+ * polarizations directly (not through conditioning) and the spins are
+ * aligned.
+ */
+static int CacheUseModes(LALDict *params,
+        const LALSimInspiralGenerator *generator)
+{
+    static const char *const CacheModesApproximants[] = {
+        "SEOBNRv4HM_ROM",
+        "SEOBNRv5_ROM",
+        "SEOBNRv5HM_ROM",
+    };
+    size_t i;
+
+    if (generator->finalize != NULL) return 0;
+    if (generator->generate_fd_modes == NULL) return 0;
+    if (generator->name == NULL) return 0;
+    for (i = 0; i < XLAL_NUM_ELEM(CacheModesApproximants); i++)
+        if (strcmp(generator->name, CacheModesApproximants[i]) == 0) break;
+    if (i == XLAL_NUM_ELEM(CacheModesApproximants)) return 0;
+    if (XLALSimInspiralWaveformParamsLookupSpin1x(params) != 0) return 0;
+    if (XLALSimInspiralWaveformParamsLookupSpin1y(params) != 0) return 0;
+    if (XLALSimInspiralWaveformParamsLookupSpin2x(params) != 0) return 0;
+    if (XLALSimInspiralWaveformParamsLookupSpin2y(params) != 0) return 0;
+    return 1;
+}
+
+/**
+ * Copy of the waveform parameters with zero inclination and reference
+ * phase, which are the parameters with which modes are cached.
+ */
+static LALDict *ModesParams(LALDict *params)
+{
+    LALDict *modesParams = params ? XLALDictDuplicate(params) : XLALCreateDict();
+    XLAL_CHECK_NULL(modesParams != NULL, XLAL_EFUNC);
+    if (XLALSimInspiralWaveformParamsInsertInclination(modesParams, 0.) != XLAL_SUCCESS
+            || XLALSimInspiralWaveformParamsInsertRefPhase(modesParams, 0.) != XLAL_SUCCESS) {
+        XLALDestroyDict(modesParams);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    }
+    return modesParams;
+}
+
+/** Copy a list of time-domain modes in order, multiplying them by \a scale. */
+static SphHarmTimeSeries *CopySphHarmTimeSeries(
+        const SphHarmTimeSeries *hlms, REAL8 scale)
+{
+    SphHarmTimeSeries *copy = NULL;
+    SphHarmTimeSeries **tail = &copy;
+    const SphHarmTimeSeries *hlm;
+    size_t j;
+
+    for (hlm = hlms; hlm != NULL; hlm = hlm->next) {
+        SphHarmTimeSeries *node = XLALCalloc(1, sizeof(*node));
+        if (node == NULL) goto fail;
+        *tail = node;
+        tail = &node->next;
+        node->l = hlm->l;
+        node->m = hlm->m;
+        node->mode = XLALCutCOMPLEX16TimeSeries(hlm->mode, 0, hlm->mode->data->length);
+        if (node->mode == NULL) goto fail;
+        if (scale != 1.)
+            for (j = 0; j < node->mode->data->length; j++)
+                node->mode->data->data[j] *= scale;
+    }
+
+    if (copy != NULL && hlms->tdata != NULL) {
+        REAL8Sequence *tdata = XLALCutREAL8Sequence(hlms->tdata, 0, hlms->tdata->length);
+        if (tdata == NULL) goto fail;
+        XLALSphHarmTimeSeriesSetTData(copy, tdata);
+    }
+
+    return copy;
+
+fail:
+    XLALDestroySphHarmTimeSeries(copy);
+    XLAL_ERROR_NULL(XLAL_EFUNC);
+}
+
+/** Copy a list of Fourier-domain modes in order, multiplying them by \a scale. */
+static SphHarmFrequencySeries *CopySphHarmFrequencySeries(
+        const SphHarmFrequencySeries *hlms, REAL8 scale)
+{
+    SphHarmFrequencySeries *copy = NULL;
+    SphHarmFrequencySeries **tail = &copy;
+    const SphHarmFrequencySeries *hlm;
+    size_t j;
+
+    for (hlm = hlms; hlm != NULL; hlm = hlm->next) {
+        SphHarmFrequencySeries *node = XLALCalloc(1, sizeof(*node));
+        if (node == NULL) goto fail;
+        *tail = node;
+        tail = &node->next;
+        node->l = hlm->l;
+        node->m = hlm->m;
+        node->mode = XLALCutCOMPLEX16FrequencySeries(hlm->mode, 0, hlm->mode->data->length);
+        if (node->mode == NULL) goto fail;
+        if (scale != 1.)
+            for (j = 0; j < node->mode->data->length; j++)
+                node->mode->data->data[j] *= scale;
+    }
+
+    if (copy != NULL && hlms->fdata != NULL) {
+        REAL8Sequence *fdata = XLALCutREAL8Sequence(hlms->fdata, 0, hlms->fdata->length);
+        if (fdata == NULL) goto fail;
+        XLALSphHarmFrequencySeriesSetFData(copy, fdata);
+    }
+
+    return copy;
+
+fail:
+    XLALDestroySphHarmFrequencySeries(copy);
+    XLAL_ERROR_NULL(XLAL_EFUNC);
 }
 
 /**
@@ -73,42 +73,56 @@ tagLALSimInspiralWaveformCacheOld {
     REAL8Sequence *frequencies;
 } LALSimInspiralWaveformCacheOld;
 
+/** Opaque type of a waveform stored in a LALSimInspiralWaveformCache */
+typedef struct tagLALSimInspiralWaveformCacheEntry LALSimInspiralWaveformCacheEntry;
+
+/**
+ * Stores previously-computed waveforms, keyed on their intrinsic parameters
+ * (masses, spins, frequencies, sampling, approximant, and the contents of the
+ * LALDict of non-mandatory parameters).  A request whose intrinsic parameters
+ * match a stored waveform reuses it, transforming it for a new distance,
+ * inclination or reference phase where the approximant allows.  When the
+ * cache exceeds either of its limits the least recently used waveforms are
+ * discarded; the most recently used waveform is always kept.
+ */
 typedef struct
 tagLALSimInspiralWaveformCache {
-    REAL8TimeSeries *hplus;
-    REAL8TimeSeries *hcross;
-    COMPLEX16FrequencySeries *hptilde;
-    COMPLEX16FrequencySeries *hctilde;
-    REAL8 phiRef;
-    REAL8 deltaTF;
-    REAL8 m1;
-    REAL8 m2;
-    REAL8 S1x;
-    REAL8 S1y;
-    REAL8 S1z;
-    REAL8 S2x;
-    REAL8 S2y;
-    REAL8 S2z;
-    REAL8 f_min;
-    REAL8 f_ref;
-    REAL8 f_max;
-    REAL8 r;
-    REAL8 i;
-    LALDict *LALpars;
-    Approximant approximant;
-    REAL8Sequence *frequencies;
+    size_t maxEntries;  /**< maximum number of stored waveforms; 0 for no limit */
+    size_t maxBytes;    /**< maximum memory used by stored waveforms; 0 for no limit */
+    size_t numEntries;  /**< number of stored waveforms */
+    size_t numBytes;    /**< memory used by stored waveforms */
+    UINT8 hits;         /**< requests served from a stored waveform */
+    UINT8 misses;       /**< requests for which a waveform was generated */
+    UINT8 evictions;    /**< stored waveforms discarded to respect the limits */
+    struct tagLALHashTbl *table;                /**< stored waveforms, by intrinsic parameters */
+    LALSimInspiralWaveformCacheEntry *head;     /**< most recently used waveform */
+    LALSimInspiralWaveformCacheEntry *tail;     /**< least recently used waveform */
 } LALSimInspiralWaveformCache;
 
 /** @} */
 
 LALSimInspiralWaveformCache *XLALCreateSimInspiralWaveformCache(void);
 
+LALSimInspiralWaveformCache *XLALCreateSimInspiralWaveformCacheWithLimits(size_t maxEntries, size_t maxBytes);
+
+int XLALSetSimInspiralWaveformCacheLimits(LALSimInspiralWaveformCache *cache, size_t maxEntries, size_t maxBytes);
+
+void XLALClearSimInspiralWaveformCache(LALSimInspiralWaveformCache *cache);
+
 void XLALDestroySimInspiralWaveformCache(LALSimInspiralWaveformCache *cache);
 
 int XLALSimInspiralChooseTDWaveformFromCache(REAL8TimeSeries **hplus, REAL8TimeSeries **hcross, REAL8 phiRef, REAL8 deltaT, REAL8 m1, REAL8 m2, REAL8 s1x, REAL8 s1y, REAL8 s1z, REAL8 s2x, REAL8 s2y, REAL8 s2z, REAL8 f_min, REAL8 f_ref, REAL8 r, REAL8 i, LALDict *LALpars, Approximant approximant, LALSimInspiralWaveformCache *cache);
 
 int XLALSimInspiralChooseFDWaveformFromCache(COMPLEX16FrequencySeries **hptilde, COMPLEX16FrequencySeries **hctilde, REAL8 phiRef, REAL8 deltaF, REAL8 m1, REAL8 m2, REAL8 S1x, REAL8 S1y, REAL8 S1z, REAL8 S2x, REAL8 S2y, REAL8 S2z, REAL8 f_min, REAL8 f_max, REAL8 f_ref, REAL8 r, REAL8 i, LALDict *LALpars, Approximant approximant, LALSimInspiralWaveformCache *cache, REAL8Sequence *frequencies);
 
+int XLALSimInspiralGenerateTDWaveformFromCache(REAL8TimeSeries **hplus, REAL8TimeSeries **hcross, LALDict *params, LALSimInspiralGenerator *generator, LALSimInspiralWaveformCache *cache);
+
+int XLALSimInspiralGenerateTDModesFromCache(SphHarmTimeSeries **hlm, LALDict *params, LALSimInspiralGenerator *generator, LALSimInspiralWaveformCache *cache);
+
+int XLALSimInspiralGenerateFDWaveformFromCache(COMPLEX16FrequencySeries **hptilde, COMPLEX16FrequencySeries **hctilde, LALDict *params, LALSimInspiralGenerator *generator, LALSimInspiralWaveformCache *cache);
+
+int XLALSimInspiralGenerateFDModesFromCache(SphHarmFrequencySeries **hlm, LALDict *params, LALSimInspiralGenerator *generator, LALSimInspiralWaveformCache *cache);
+
 int XLALSimInspiralChooseFDWaveformSequence(COMPLEX16FrequencySeries **hptilde, COMPLEX16FrequencySeries **hctilde, REAL8 phiRef, REAL8 m1, REAL8 m2, REAL8 S1x, REAL8 S1y, REAL8 S1z, REAL8 S2x, REAL8 S2y, REAL8 S2z, REAL8 f_ref, REAL8 r, REAL8 i, LALDict *LALpars, Approximant approximant, REAL8Sequence *frequencies);
 
 #if 0
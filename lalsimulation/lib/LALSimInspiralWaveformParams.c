@@ -31,8 +31,9 @@
 	TYPE XLALSimInspiralWaveformParamsLookup ## NAME(LALDict *params) \
 	{ \
 		TYPE value = DEFAULT; \
-		if (params && XLALDictContains(params, KEY)) \
-			value = XLALDictLookup ## TYPE ## Value(params, KEY); \
+		LALDictEntry *entry; \
+		if (params && (entry = XLALDictLookup(params, KEY)) != NULL) \
+			value = XLALValueGet ## TYPE(XLALDictEntryGetValue(entry)); \
 		return value; \
 	}
 
@@ -366,6 +367,7 @@ DEFINE_INSERT_FUNC(PhenomXHMRingdownAmpFreqsVersion, INT4, "RDAmpFreqsVersion",
 DEFINE_INSERT_FUNC(PhenomXHMPhaseRef21, REAL8, "PhaseRef21", 0.)
 DEFINE_INSERT_FUNC(PhenomXHMThresholdMband, REAL8, "ThresholdMband", 0.001)
 DEFINE_INSERT_FUNC(PhenomXHMAmpInterpolMB, INT4, "AmpInterpol", 1)
+DEFINE_INSERT_FUNC(PhenomXHMParallel, INT4, "ParallelHM", 0)
 
 /* IMRPhenomXPHM Parameters */
 DEFINE_INSERT_FUNC(PhenomXPHMMBandVersion, INT4, "MBandPrecVersion", 0)
@@ -1448,6 +1450,7 @@ DEFINE_LOOKUP_FUNC(PhenomXHMRingdownAmpFreqsVersion, INT4, "RDAmpFreqsVersion",
 DEFINE_LOOKUP_FUNC(PhenomXHMPhaseRef21, REAL8, "PhaseRef21", 0.)
 DEFINE_LOOKUP_FUNC(PhenomXHMThresholdMband, REAL8, "ThresholdMband", 0.001)
 DEFINE_LOOKUP_FUNC(PhenomXHMAmpInterpolMB, INT4, "AmpInterpol", 1)
+DEFINE_LOOKUP_FUNC(PhenomXHMParallel, INT4, "ParallelHM", 0)
 DEFINE_LOOKUP_FUNC(DOmega220, REAL8, "domega220", 0)
 DEFINE_LOOKUP_FUNC(DTau220, REAL8, "dtau220", 0)
 DEFINE_LOOKUP_FUNC(DOmega210, REAL8, "domega210", 0)
@@ -1674,6 +1677,7 @@ DEFINE_ISDEFAULT_FUNC(PhenomXHMRingdownAmpFreqsVersion, INT4, "RDAmpFreqsVersion
 DEFINE_ISDEFAULT_FUNC(PhenomXHMPhaseRef21, REAL8, "PhaseRef21", 0.)
 DEFINE_ISDEFAULT_FUNC(PhenomXHMThresholdMband, REAL8, "ThresholdMband", 0.001)
 DEFINE_ISDEFAULT_FUNC(PhenomXHMAmpInterpolMB, INT4, "AmpInterpol", 1)
+DEFINE_ISDEFAULT_FUNC(PhenomXHMParallel, INT4, "ParallelHM", 0)
 DEFINE_ISDEFAULT_FUNC(DOmega220, REAL8, "domega220", 0)
 DEFINE_ISDEFAULT_FUNC(DTau220, REAL8, "dtau220", 0)
 DEFINE_ISDEFAULT_FUNC(DOmega210, REAL8, "domega210", 0)
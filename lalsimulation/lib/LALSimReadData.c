@@ -26,11 +26,28 @@
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_UNISTD_H)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#define HAVE_ROM_MMAP 1
+#endif
 #include <lal/FileIO.h>
 #include <lal/LALStdlib.h>
 #include <lal/LALString.h>
+#include <lal/H5FileIO.h>
 #include <lal/LALSimReadData.h>
 
+#ifdef LAL_PTHREAD_LOCK
+#include <pthread.h>
+static pthread_mutex_t lalSimROMDataMutex = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK() pthread_mutex_lock(&lalSimROMDataMutex)
+#define UNLOCK() pthread_mutex_unlock(&lalSimROMDataMutex)
+#else
+#define LOCK()
+#define UNLOCK()
+#endif
+
 #ifndef PAGESIZE
 #ifdef _SC_PAGE_SIZE
 #define PAGESIZE _SC_PAGE_SIZE
@@ -196,3 +213,649 @@ size_t XLALSimReadDataFileNCol(double **data, size_t *ncol, LALFILE *fp)
 
     return nrow;
 }
+
+
+/*
+ * ROM data registry.
+ *
+ * Note: malloc and free are used for the registry rather than XLALMalloc
+ * and XLALFree, since ROM data are kept for the lifetime of the process
+ * and should not show up as memory leaks.
+ */
+
+#define ROM_MAP_MAGIC "LALROMD1"
+#define ROM_MAP_BYTE_ORDER 0x01020304
+#define ROM_MAP_ALIGN 64
+#define ROM_MAP_NAME_MAX 96
+#define ROM_MAP_ATTRIBUTE_NAME_MAX 56
+#define ROM_MAP_MAX_DIMS 4
+
+/* header of a mapped ROM data file; followed by the dataset entries,
+ * sorted by name, and the attributes */
+typedef struct {
+    char magic[8];
+    UINT4 byteorder;
+    UINT4 nentries;
+    UINT4 nattributes;
+    UINT4 reserved;
+} ROMMapHeader;
+
+/* a dataset in a mapped ROM data file */
+typedef struct {
+    char name[ROM_MAP_NAME_MAX];        /* path of the dataset in the HDF5 file, without leading '/' */
+    INT4 type;                          /* LALTYPECODE of the elements */
+    UINT4 ndim;
+    UINT8 dims[ROM_MAP_MAX_DIMS];
+    UINT8 offset;                       /* offset of the data from the start of the file */
+    UINT8 nbytes;
+} ROMMapEntry;
+
+/* a numerical attribute of the root group of a mapped ROM data file */
+typedef struct {
+    char name[ROM_MAP_ATTRIBUTE_NAME_MAX];
+    REAL8 value;
+} ROMMapAttribute;
+
+/* a REAL8 dataset read from an HDF5 file */
+typedef struct tagROMDataArray {
+    struct tagROMDataArray *next;
+    char *name;
+    UINT4 ndim;
+    size_t dims[2];
+    REAL8 *data;
+} ROMDataArray;
+
+struct tagLALSimROMData {
+    struct tagLALSimROMData *next;
+    char *fname;                        /* name with which the data were opened */
+    char *addr;                         /* mapping of the mapped file, or NULL */
+    size_t length;                      /* length of the mapping */
+    const ROMMapEntry *entries;
+    UINT4 nentries;
+    const ROMMapAttribute *attributes;
+    UINT4 nattributes;
+    char *path;                         /* HDF5 file, if the data are not mapped; opened only while reading */
+    ROMDataArray *arrays;               /* datasets read from the HDF5 file so far */
+};
+
+/* all opened ROM data, newest first */
+static LALSimROMData *lalSimROMDataRegistry = NULL;
+
+static size_t ROMDataTypeSize(LALTYPECODE type)
+{
+    return 1U << (type & LAL_TYPE_SIZE_MASK);
+}
+
+/* name of the mapped file corresponding to a HDF5 file: the extension
+ * .hdf5 or .h5, if any, is replaced by .lalrom */
+static char *ROMDataMapFileName(const char *fname)
+{
+    size_t n = strlen(fname);
+    char *mapname;
+    if (n > 5 && strcmp(fname + n - 5, ".hdf5") == 0)
+        n -= 5;
+    else if (n > 3 && strcmp(fname + n - 3, ".h5") == 0)
+        n -= 3;
+    mapname = XLALMalloc(n + sizeof(".lalrom"));
+    XLAL_CHECK_NULL(mapname, XLAL_ENOMEM);
+    memcpy(mapname, fname, n);
+    strcpy(mapname + n, ".lalrom");
+    return mapname;
+}
+
+static int ROMDataEntryCompare(const void *key, const void *entry)
+{
+    return strcmp((const char *)key, ((const ROMMapEntry *)entry)->name);
+}
+
+#ifdef HAVE_ROM_MMAP
+
+/* map a ROM data file read-only and check its layout, including that the
+ * entries are sorted by name for bsearch(); returns 0 if the file cannot
+ * be used, e.g. because it was written on a different platform */
+static int ROMDataMap(LALSimROMData *rom, const char *path)
+{
+    const ROMMapHeader *header;
+    struct stat st;
+    size_t tables;
+    UINT4 i;
+    void *addr;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return 0;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(ROMMapHeader)) {
+        close(fd);
+        return 0;
+    }
+    addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+        return 0;
+
+    header = addr;
+    tables = sizeof(*header) + header->nentries * sizeof(ROMMapEntry) + header->nattributes * sizeof(ROMMapAttribute);
+    if (memcmp(header->magic, ROM_MAP_MAGIC, sizeof(header->magic)) != 0
+        || header->byteorder != ROM_MAP_BYTE_ORDER || tables > (size_t)st.st_size) {
+        XLALPrintWarning("%s: ignoring ROM data file %s with an unknown layout\n", __func__, path);
+        munmap(addr, st.st_size);
+        return 0;
+    }
+    rom->addr = addr;
+    rom->length = st.st_size;
+    rom->entries = (const ROMMapEntry *)(rom->addr + sizeof(*header));
+    rom->nentries = header->nentries;
+    rom->attributes = (const ROMMapAttribute *)(rom->entries + rom->nentries);
+    rom->nattributes = header->nattributes;
+
+    for (i = 0; i < rom->nentries; ++i) {
+        const ROMMapEntry *entry = rom->entries + i;
+        UINT8 npoints = 1;
+        UINT4 j;
+        for (j = 0; j < entry->ndim && j < ROM_MAP_MAX_DIMS; ++j)
+            npoints *= entry->dims[j];
+        if (entry->name[ROM_MAP_NAME_MAX - 1] != '\0' || entry->ndim > ROM_MAP_MAX_DIMS
+            || entry->offset % ROM_MAP_ALIGN != 0 || entry->offset > rom->length
+            || entry->nbytes > rom->length - entry->offset
+            || entry->nbytes != npoints * ROMDataTypeSize(entry->type)
+            || (i > 0 && strcmp(entry[-1].name, entry->name) >= 0)) {
+            XLALPrintWarning("%s: ignoring corrupt ROM data file %s\n", __func__, path);
+            munmap(addr, st.st_size);
+            rom->addr = NULL;
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+#endif /* HAVE_ROM_MMAP */
+
+/* open ROM data which are not yet in the registry */
+static LALSimROMData *ROMDataCreate(const char *fname)
+{
+    LALSimROMData *rom;
+    char *mapname;
+    char *path;
+
+    rom = calloc(1, sizeof(*rom));
+    if (!rom || !(rom->fname = strdup(fname))) {
+        free(rom);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+
+    /* prefer a mapped file */
+    mapname = ROMDataMapFileName(fname);
+    if (!mapname) {
+        free(rom->fname);
+        free(rom);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    }
+    path = XLAL_FILE_RESOLVE_PATH(mapname);
+    XLALFree(mapname);
+#ifdef HAVE_ROM_MMAP
+    if (path && ROMDataMap(rom, path)) {
+        XLALPrintInfo("%s: mapped ROM data file %s\n", __func__, path);
+        XLALFree(path);
+        return rom;
+    }
+#endif
+    XLALFree(path);
+
+    /* otherwise read datasets from the HDF5 file as they are requested */
+    path = XLAL_FILE_RESOLVE_PATH(fname);
+    if (!path) {
+        free(rom->fname);
+        free(rom);
+        XLAL_ERROR_NULL(XLAL_EIO, "Could not find ROM data file %s\n", fname);
+    }
+#ifdef LAL_HDF5_ENABLED
+    {
+        LALH5File *file = XLALH5FileOpen(path, "r");
+        if (file) {
+            XLALH5FileClose(file);
+            rom->path = strdup(path);
+        }
+    }
+#endif
+    if (!rom->path) {
+        free(rom->fname);
+        free(rom);
+        XLALFree(path);
+        XLAL_ERROR_NULL(XLAL_EIO, "Could not open ROM data file %s\n", fname);
+    }
+    XLALPrintInfo("%s: opened ROM data file %s\n", __func__, path);
+    XLALFree(path);
+    return rom;
+}
+
+/**
+ * @brief Opens reduced-order-model data, sharing them within the process.
+ * @details The data are looked for in the same places as by
+ * XLALSimReadDataFileOpen().  If a file with the extension <tt>.hdf5</tt>
+ * or <tt>.h5</tt> of @p fname replaced by <tt>.lalrom</tt> exists, written
+ * by XLALSimROMDataConvert() on a platform with the same byte order, it is
+ * memory-mapped: opening costs no reading, datasets point directly into
+ * the mapping, only the pages of datasets which are actually used are read,
+ * and processes on the same machine share these pages.  Otherwise each
+ * dataset is read from the HDF5 file @p fname when it is first requested.
+ *
+ * The data of each file name are opened once and kept until the process
+ * exits; later calls return the same object.  This function is thread-safe.
+ *
+ * Currently only SEOBNRv4ROM reads its data through this function; the
+ * other reduced-order models still read their HDF5 files directly, and
+ * do not use a <tt>.lalrom</tt> file installed next to them.
+ * @param[in] fname The name of the HDF5 ROM data file.
+ * @return A pointer to the ROM data, or NULL on failure.
+ */
+LALSimROMData *XLALSimROMDataOpen(const char *fname)
+{
+    LALSimROMData *rom;
+    XLAL_CHECK_NULL(fname, XLAL_EFAULT);
+    LOCK();
+    for (rom = lalSimROMDataRegistry; rom; rom = rom->next)
+        if (strcmp(rom->fname, fname) == 0)
+            break;
+    if (!rom && (rom = ROMDataCreate(fname))) {
+        rom->next = lalSimROMDataRegistry;
+        lalSimROMDataRegistry = rom;
+    }
+    UNLOCK();
+    XLAL_CHECK_NULL(rom, XLAL_EFUNC);
+    return rom;
+}
+
+/**
+ * @brief Returns whether reduced-order-model data are memory-mapped.
+ * @param[in] rom The ROM data.
+ * @return 1 if the data are memory-mapped, 0 if they are read from HDF5.
+ */
+int XLALSimROMDataIsMapped(const LALSimROMData *rom)
+{
+    return rom && rom->addr;
+}
+
+/* look up a REAL8 dataset; if it has one dimension, dims[1] is set to 1 */
+static const REAL8 *ROMDataGetREAL8Array(LALSimROMData *rom, const char *name, UINT4 ndim, size_t dims[2])
+{
+    ROMDataArray *array;
+
+    XLAL_CHECK_NULL(rom && name && dims, XLAL_EFAULT);
+    while (*name == '/')
+        ++name;
+
+    if (rom->addr) {
+        const ROMMapEntry *entry = bsearch(name, rom->entries, rom->nentries, sizeof(*entry), ROMDataEntryCompare);
+        XLAL_CHECK_NULL(entry, XLAL_ENAME, "No dataset `%s' in ROM data %s", name, rom->fname);
+        XLAL_CHECK_NULL(entry->type == LAL_D_TYPE_CODE, XLAL_ETYPE, "Dataset `%s' is wrong type", name);
+        XLAL_CHECK_NULL(entry->ndim == ndim, XLAL_EDIMS, "Dataset `%s' must be %u-dimensional", name, ndim);
+        dims[0] = entry->dims[0];
+        dims[1] = ndim == 2 ? entry->dims[1] : 1;
+        return (const REAL8 *)(rom->addr + entry->offset);
+    }
+
+    LOCK();
+    for (array = rom->arrays; array; array = array->next)
+        if (strcmp(array->name, name) == 0)
+            break;
+#ifdef LAL_HDF5_ENABLED
+    if (!array) {
+        LALH5File *file = XLALH5FileOpen(rom->path, "r");
+        LALH5Dataset *dset = file ? XLALH5DatasetRead(file, name) : NULL;
+        UINT4Vector *dimLength = NULL;
+        if (!dset) {
+            XLALH5FileClose(file);
+            UNLOCK();
+            XLAL_ERROR_NULL(XLAL_EFUNC);
+        }
+        if (XLALH5DatasetQueryType(dset) != LAL_D_TYPE_CODE) {
+            XLALH5DatasetFree(dset);
+            XLALH5FileClose(file);
+            UNLOCK();
+            XLAL_ERROR_NULL(XLAL_ETYPE, "Dataset `%s' is wrong type", name);
+        }
+        dimLength = XLALH5DatasetQueryDims(dset);
+        if (!dimLength || dimLength->length != ndim) {
+            XLALDestroyUINT4Vector(dimLength);
+            XLALH5DatasetFree(dset);
+            XLALH5FileClose(file);
+            UNLOCK();
+            XLAL_ERROR_NULL(XLAL_EDIMS, "Dataset `%s' must be %u-dimensional", name, ndim);
+        }
+        if ((array = calloc(1, sizeof(*array)))) {
+            array->ndim = ndim;
+            array->dims[0] = dimLength->data[0];
+            array->dims[1] = ndim == 2 ? dimLength->data[1] : 1;
+            array->name = strdup(name);
+            array->data = malloc(XLALH5DatasetQueryNBytes(dset));
+        }
+        XLALDestroyUINT4Vector(dimLength);
+        if (!array || !array->name || !array->data || XLALH5DatasetQueryData(array->data, dset) < 0) {
+            if (array) {
+                free(array->name);
+                free(array->data);
+            }
+            free(array);
+            XLALH5DatasetFree(dset);
+            XLALH5FileClose(file);
+            UNLOCK();
+            XLAL_ERROR_NULL(XLAL_EFUNC, "Could not read dataset `%s'", name);
+        }
+        XLALH5DatasetFree(dset);
+        XLALH5FileClose(file);
+        array->next = rom->arrays;
+        rom->arrays = array;
+    }
+#endif
+    UNLOCK();
+
+    XLAL_CHECK_NULL(array, XLAL_ENAME, "No dataset `%s' in ROM data %s", name, rom->fname);
+    XLAL_CHECK_NULL(array->ndim == ndim, XLAL_EDIMS, "Dataset `%s' must be %u-dimensional", name, ndim);
+    dims[0] = array->dims[0];
+    dims[1] = array->dims[1];
+    return array->data;
+}
+
+/**
+ * @brief Returns a one-dimensional REAL8 dataset of reduced-order-model data.
+ * @details The data belong to @p rom and must not be modified or freed.
+ * @param[out] length The number of elements of the dataset.
+ * @param[in] rom The ROM data.
+ * @param[in] name The path of the dataset in the HDF5 file, e.g. "sub1/Amp_ciall".
+ * @return A pointer to the data, or NULL on failure.
+ */
+const REAL8 *XLALSimROMDataGetREAL8Vector(size_t *length, LALSimROMData *rom, const char *name)
+{
+    size_t dims[2];
+    const REAL8 *data;
+    XLAL_CHECK_NULL(length, XLAL_EFAULT);
+    data = ROMDataGetREAL8Array(rom, name, 1, dims);
+    XLAL_CHECK_NULL(data, XLAL_EFUNC);
+    *length = dims[0];
+    return data;
+}
+
+/**
+ * @brief Returns a two-dimensional REAL8 dataset of reduced-order-model data.
+ * @details The data are in row-major order, and belong to @p rom and must
+ * not be modified or freed.
+ * @param[out] rows The number of rows of the dataset.
+ * @param[out] cols The number of columns of the dataset.
+ * @param[in] rom The ROM data.
+ * @param[in] name The path of the dataset in the HDF5 file, e.g. "sub1/Bamp".
+ * @return A pointer to the data, or NULL on failure.
+ */
+const REAL8 *XLALSimROMDataGetREAL8Matrix(size_t *rows, size_t *cols, LALSimROMData *rom, const char *name)
+{
+    size_t dims[2];
+    const REAL8 *data;
+    XLAL_CHECK_NULL(rows && cols, XLAL_EFAULT);
+    data = ROMDataGetREAL8Array(rom, name, 2, dims);
+    XLAL_CHECK_NULL(data, XLAL_EFUNC);
+    *rows = dims[0];
+    *cols = dims[1];
+    return data;
+}
+
+#ifdef LAL_HDF5_ENABLED
+/* read a numerical scalar attribute of an HDF5 object as a REAL8 */
+static int ROMDataQueryH5Attribute(REAL8 *value, LALH5Generic object, const char *key)
+{
+    union { INT2 i2; INT4 i4; INT8 i8; UINT2 u2; UINT4 u4; UINT8 u8; REAL4 s; REAL8 d; } v;
+    LALTYPECODE type;
+    int errnum;
+    XLAL_TRY(type = XLALH5AttributeQueryScalarType(object, key), errnum);
+    if (errnum || (int)type < 0)
+        return XLAL_FAILURE;
+    switch (type) {
+    case LAL_I2_TYPE_CODE:
+    case LAL_I4_TYPE_CODE:
+    case LAL_I8_TYPE_CODE:
+    case LAL_U2_TYPE_CODE:
+    case LAL_U4_TYPE_CODE:
+    case LAL_U8_TYPE_CODE:
+    case LAL_S_TYPE_CODE:
+    case LAL_D_TYPE_CODE:
+        break;
+    default:
+        return XLAL_FAILURE;
+    }
+    if (XLALH5AttributeQueryScalarValue(&v, object, key) < 0)
+        XLAL_ERROR(XLAL_EFUNC);
+    switch (type) {
+    case LAL_I2_TYPE_CODE: *value = v.i2; break;
+    case LAL_I4_TYPE_CODE: *value = v.i4; break;
+    case LAL_I8_TYPE_CODE: *value = v.i8; break;
+    case LAL_U2_TYPE_CODE: *value = v.u2; break;
+    case LAL_U4_TYPE_CODE: *value = v.u4; break;
+    case LAL_U8_TYPE_CODE: *value = v.u8; break;
+    case LAL_S_TYPE_CODE: *value = v.s; break;
+    default: *value = v.d; break;
+    }
+    return XLAL_SUCCESS;
+}
+#endif
+
+/**
+ * @brief Returns a numerical attribute of reduced-order-model data.
+ * @details Only attributes of the root group of the HDF5 file, such as
+ * version numbers, are available.  Integer attributes are converted to REAL8.
+ * @param[out] value The value of the attribute.
+ * @param[in] rom The ROM data.
+ * @param[in] key The name of the attribute.
+ * @return 0 on success, or <0 if there is no such numerical attribute.
+ */
+int XLALSimROMDataQueryAttribute(REAL8 *value, LALSimROMData *rom, const char *key)
+{
+    XLAL_CHECK(value && rom && key, XLAL_EFAULT);
+    if (rom->addr) {
+        UINT4 i;
+        for (i = 0; i < rom->nattributes; ++i)
+            if (strncmp(rom->attributes[i].name, key, ROM_MAP_ATTRIBUTE_NAME_MAX) == 0) {
+                *value = rom->attributes[i].value;
+                return XLAL_SUCCESS;
+            }
+    }
+#ifdef LAL_HDF5_ENABLED
+    else {
+        LALH5Generic gfile;
+        int status = XLAL_FAILURE;
+        LOCK();
+        if ((gfile.file = XLALH5FileOpen(rom->path, "r"))) {
+            status = ROMDataQueryH5Attribute(value, gfile, key);
+            XLALH5FileClose(gfile.file);
+        }
+        UNLOCK();
+        if (status == XLAL_SUCCESS)
+            return XLAL_SUCCESS;
+    }
+#endif
+    XLAL_ERROR(XLAL_ENAME, "No numerical attribute `%s' in ROM data %s", key, rom->fname);
+}
+
+#ifdef LAL_HDF5_ENABLED
+
+/* a dataset to be written to a mapped ROM data file */
+typedef struct {
+    ROMMapEntry entry;
+    void *data;
+} ROMConvertItem;
+
+static int ROMConvertItemCompare(const void *a, const void *b)
+{
+    return strcmp(((const ROMConvertItem *)a)->entry.name, ((const ROMConvertItem *)b)->entry.name);
+}
+
+/* read all numerical datasets of a group and its subgroups */
+static int ROMConvertReadGroup(ROMConvertItem **items, size_t *nitems, LALH5File *root, LALH5File *group)
+{
+    size_t ndsets = XLALH5FileQueryNDatasets(group);
+    size_t ngroups = XLALH5FileQueryNGroups(group);
+    size_t i;
+
+    for (i = 0; i < ndsets; ++i) {
+        char name[ROM_MAP_NAME_MAX + 1];
+        const char *relname = name;
+        LALH5Dataset *dset;
+        UINT4Vector *dimLength;
+        ROMConvertItem *newItems;
+        ROMConvertItem *item;
+        int n = XLALH5FileQueryDatasetName(name, sizeof(name), group, i);
+        XLAL_CHECK(n >= 0, XLAL_EFUNC);
+        while (*relname == '/')
+            ++relname;
+        XLAL_CHECK(strlen(relname) < ROM_MAP_NAME_MAX && (size_t)n < sizeof(name), XLAL_ESIZE, "Dataset name `%s' too long", name);
+        XLAL_CHECK((dset = XLALH5DatasetRead(root, relname)), XLAL_EFUNC);
+        dimLength = XLALH5DatasetQueryDims(dset);
+        if (!dimLength || dimLength->length > ROM_MAP_MAX_DIMS || XLALH5DatasetCheckStringData(dset)) {
+            XLALPrintInfo("%s: skipping dataset `%s'\n", __func__, relname);
+            XLALDestroyUINT4Vector(dimLength);
+            XLALH5DatasetFree(dset);
+            continue;
+        }
+        newItems = XLALRealloc(*items, (*nitems + 1) * sizeof(**items));
+        if (!newItems) {
+            XLALDestroyUINT4Vector(dimLength);
+            XLALH5DatasetFree(dset);
+            XLAL_ERROR(XLAL_ENOMEM);
+        }
+        *items = newItems;
+        item = *items + (*nitems)++;
+        memset(item, 0, sizeof(*item));
+        strcpy(item->entry.name, relname);
+        item->entry.type = XLALH5DatasetQueryType(dset);
+        item->entry.ndim = dimLength->length;
+        for (UINT4 j = 0; j < dimLength->length; ++j)
+            item->entry.dims[j] = dimLength->data[j];
+        item->entry.nbytes = XLALH5DatasetQueryNBytes(dset);
+        XLALDestroyUINT4Vector(dimLength);
+        item->data = XLALMalloc(item->entry.nbytes ? item->entry.nbytes : 1);
+        if (!item->data || XLALH5DatasetQueryData(item->data, dset) < 0) {
+            XLALH5DatasetFree(dset);
+            XLAL_ERROR(XLAL_EFUNC, "Could not read dataset `%s'", relname);
+        }
+        XLALH5DatasetFree(dset);
+    }
+
+    for (i = 0; i < ngroups; ++i) {
+        char name[ROM_MAP_NAME_MAX + 1];
+        LALH5File *subgroup;
+        int status;
+        int n = XLALH5FileQueryGroupName(name, sizeof(name), group, i);
+        XLAL_CHECK(n >= 0 && (size_t)n < sizeof(name), XLAL_EFUNC);
+        XLAL_CHECK((subgroup = XLALH5GroupOpen(root, name)), XLAL_EFUNC);
+        status = ROMConvertReadGroup(items, nitems, root, subgroup);
+        XLALH5FileClose(subgroup);
+        XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC);
+    }
+
+    return XLAL_SUCCESS;
+}
+
+#endif /* LAL_HDF5_ENABLED */
+
+/**
+ * @brief Converts reduced-order-model data from HDF5 into a file which can
+ * be memory-mapped by XLALSimROMDataOpen().
+ * @details All numerical datasets of up to four dimensions, and the
+ * numerical attributes of the root group, are copied into a contiguous
+ * file with each dataset aligned to 64 bytes.  The file is only usable on
+ * platforms with the byte order of the platform which wrote it.  To be
+ * found by XLALSimROMDataOpen(), @p outfname should be the name of the
+ * HDF5 file with the extension <tt>.hdf5</tt> replaced by <tt>.lalrom</tt>,
+ * in a directory searched for the HDF5 file.  Only the models which read
+ * their data through XLALSimROMDataOpen(), currently just SEOBNRv4ROM,
+ * make use of the converted file.
+ * @param[in] outfname The name of the file to write.
+ * @param[in] infname The name of the HDF5 file to read.
+ * @return 0 on success, or <0 if an error occurs.
+ */
+int XLALSimROMDataConvert(const char *outfname, const char *infname)
+{
+#ifndef LAL_HDF5_ENABLED
+    XLAL_CHECK(outfname && infname, XLAL_EFAULT);
+    XLAL_ERROR(XLAL_EFAILED, "HDF5 support not enabled");
+#else
+    static const char zeros[ROM_MAP_ALIGN];
+    ROMConvertItem *items = NULL;
+    ROMMapAttribute *attributes = NULL;
+    ROMMapHeader header;
+    size_t nitems = 0, nattributes = 0, nattrs, i;
+    LALH5File *file = NULL;
+    LALFILE *fp = NULL;
+    LALH5Generic gfile;
+    UINT8 offset;
+    int retn = XLAL_FAILURE;
+
+    XLAL_CHECK(outfname && infname, XLAL_EFAULT);
+    XLAL_CHECK((file = XLALH5FileOpen(infname, "r")), XLAL_EIO, "Could not open ROM data file %s", infname);
+
+    if (ROMConvertReadGroup(&items, &nitems, file, file) != XLAL_SUCCESS)
+        XLAL_ERROR_FAIL(XLAL_EFUNC);
+    qsort(items, nitems, sizeof(*items), ROMConvertItemCompare);
+
+    gfile.file = file;
+    nattrs = XLALH5AttributeQueryN(gfile);
+    for (i = 0; i < nattrs; ++i) {
+        char name[ROM_MAP_ATTRIBUTE_NAME_MAX];
+        REAL8 value;
+        ROMMapAttribute *newAttributes;
+        int n = XLALH5AttributeQueryName(name, sizeof(name), gfile, i);
+        if (n < 0 || (size_t)n >= sizeof(name) || ROMDataQueryH5Attribute(&value, gfile, name) != XLAL_SUCCESS)
+            continue;
+        newAttributes = XLALRealloc(attributes, (nattributes + 1) * sizeof(*attributes));
+        if (!newAttributes)
+            XLAL_ERROR_FAIL(XLAL_ENOMEM);
+        attributes = newAttributes;
+        memset(attributes + nattributes, 0, sizeof(*attributes));
+        strcpy(attributes[nattributes].name, name);
+        attributes[nattributes++].value = value;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ROM_MAP_MAGIC, sizeof(header.magic));
+    header.byteorder = ROM_MAP_BYTE_ORDER;
+    header.nentries = nitems;
+    header.nattributes = nattributes;
+    offset = sizeof(header) + nitems * sizeof(ROMMapEntry) + nattributes * sizeof(ROMMapAttribute);
+    for (i = 0; i < nitems; ++i) {
+        offset = (offset + ROM_MAP_ALIGN - 1) / ROM_MAP_ALIGN * ROM_MAP_ALIGN;
+        items[i].entry.offset = offset;
+        offset += items[i].entry.nbytes;
+    }
+
+    if (!(fp = XLALFileOpenWrite(outfname, 0)))
+        XLAL_ERROR_FAIL(XLAL_EIO, "Could not open %s for writing", outfname);
+    offset = 0;
+    if (XLALFileWrite(&header, sizeof(header), 1, fp) != 1)
+        XLAL_ERROR_FAIL(XLAL_EIO);
+    offset += sizeof(header);
+    for (i = 0; i < nitems; ++i) {
+        if (XLALFileWrite(&items[i].entry, sizeof(items[i].entry), 1, fp) != 1)
+            XLAL_ERROR_FAIL(XLAL_EIO);
+        offset += sizeof(items[i].entry);
+    }
+    if (nattributes && XLALFileWrite(attributes, sizeof(*attributes), nattributes, fp) != nattributes)
+        XLAL_ERROR_FAIL(XLAL_EIO);
+    offset += nattributes * sizeof(*attributes);
+    for (i = 0; i < nitems; ++i) {
+        size_t pad = items[i].entry.offset - offset;
+        if ((pad && XLALFileWrite(zeros, 1, pad, fp) != pad)
+            || (items[i].entry.nbytes && XLALFileWrite(items[i].data, items[i].entry.nbytes, 1, fp) != 1))
+            XLAL_ERROR_FAIL(XLAL_EIO);
+        offset = items[i].entry.offset + items[i].entry.nbytes;
+    }
+    retn = XLAL_SUCCESS;
+
+XLAL_FAIL:
+    if (fp)
+        XLALFileClose(fp);
+    for (i = 0; i < nitems; ++i)
+        XLALFree(items[i].data);
+    XLALFree(items);
+    XLALFree(attributes);
+    XLALH5FileClose(file);
+    return retn;
+#endif
+}
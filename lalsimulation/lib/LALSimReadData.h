@@ -21,6 +21,7 @@
 #define _LALSIMREADDATA_H
 
 #include <stddef.h>
+#include <lal/LALAtomicDatatypes.h>
 #include <lal/FileIO.h>
 
 #if defined(__cplusplus)
@@ -33,6 +34,25 @@ LALFILE *XLALSimReadDataFileOpen(const char *fname);
 size_t XLALSimReadDataFile2Col(double **xdat, double **ydat, LALFILE * fp);
 size_t XLALSimReadDataFileNCol(double **data, size_t *ncol, LALFILE * fp);
 
+/**
+ * @brief Reduced-order-model data shared within a process.
+ * @details Opened with XLALSimROMDataOpen() and kept until the process
+ * exits.  The data are memory-mapped from a file written by
+ * XLALSimROMDataConvert() if one is installed alongside the HDF5 file, and
+ * otherwise read from the HDF5 file one dataset at a time as requested.
+ * Currently only SEOBNRv4ROM reads its data in this way.
+ */
+typedef struct tagLALSimROMData LALSimROMData;
+
+#ifndef SWIG    /* exclude from SWIG interface */
+LALSimROMData *XLALSimROMDataOpen(const char *fname);
+int XLALSimROMDataIsMapped(const LALSimROMData *rom);
+const REAL8 *XLALSimROMDataGetREAL8Vector(size_t *length, LALSimROMData *rom, const char *name);
+const REAL8 *XLALSimROMDataGetREAL8Matrix(size_t *rows, size_t *cols, LALSimROMData *rom, const char *name);
+int XLALSimROMDataQueryAttribute(REAL8 *value, LALSimROMData *rom, const char *key);
+#endif /* SWIG */
+int XLALSimROMDataConvert(const char *outfname, const char *infname);
+
 #if 0
 {       /* so that editors will match succeeding brace */
 #elif defined(__cplusplus)
@@ -0,0 +1,241 @@
+/*
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check that memory-mapped ROM data written by XLALSimROMDataConvert()
+ * agree with the HDF5 file they were converted from, and that corrupt
+ * mapped files are rejected
+ */
+
+#include <config.h>
+#include <lal/LALConfig.h>
+
+#if !defined(LAL_HDF5_ENABLED) || !defined(HAVE_SYS_MMAN_H) || !defined(HAVE_UNISTD_H)
+int main(void) { return 77; /* don't do any testing */ }
+#else
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/H5FileIO.h>
+#include <lal/LALSimReadData.h>
+
+/* HDF5 file, which is read directly since there is no ROMDataTest.lalrom */
+#define H5NAME "./ROMDataTest.hdf5"
+/* mapped file converted from it, opened as ./ROMDataTestMapped.hdf5 */
+#define MAPNAME "./ROMDataTestMapped.lalrom"
+
+/* layout of the header and dataset entries of a mapped file, as written
+ * by XLALSimROMDataConvert() */
+#define MAP_BYTEORDER_OFFSET 8
+#define MAP_HEADER_SIZE 24
+#define MAP_ENTRY_SIZE 152
+
+static const char *vectors[] = { "grid", "sub1/Amp_ciall", "sub2/chi1vec" };
+static const char *matrices[] = { "sub1/Bamp", "sub2/Bamp" };
+static const char *attributes[] = { "version_major", "version_minor", "eta_min", "Email", "missing" };
+
+static REAL8Vector *create_vector(size_t length, REAL8 offset)
+{
+    REAL8Vector *v = XLALCreateREAL8Vector(length);
+    for (size_t i = 0; i < length; ++i)
+        v->data[i] = offset + 0.25 * i * i;
+    return v;
+}
+
+static REAL8Array *create_matrix(UINT4 rows, UINT4 cols, REAL8 offset)
+{
+    REAL8Array *a = XLALCreateREAL8ArrayL(2, rows, cols);
+    for (UINT4 i = 0; i < rows * cols; ++i)
+        a->data[i] = offset - 1.5 * i;
+    return a;
+}
+
+/* write a small HDF5 file laid out like the ROM data files */
+static int write_hdf5(void)
+{
+    LALH5File *file = XLALH5FileOpen(H5NAME, "w");
+    LALH5File *group;
+    REAL8Vector *v;
+    REAL8Array *a;
+    INT4 major = 2, minor = 1;
+    REAL8 eta_min = 0.01;
+    XLAL_CHECK(file != NULL, XLAL_EFUNC);
+
+    XLAL_CHECK(XLALH5FileAddScalarAttribute(file, "version_major", &major, LAL_I4_TYPE_CODE) == 0, XLAL_EFUNC);
+    XLAL_CHECK(XLALH5FileAddScalarAttribute(file, "version_minor", &minor, LAL_I4_TYPE_CODE) == 0, XLAL_EFUNC);
+    XLAL_CHECK(XLALH5FileAddScalarAttribute(file, "eta_min", &eta_min, LAL_D_TYPE_CODE) == 0, XLAL_EFUNC);
+    XLAL_CHECK(XLALH5FileAddStringAttribute(file, "Email", "nobody@example.org") == 0, XLAL_EFUNC);
+    v = create_vector(7, 0.5);
+    XLAL_CHECK(XLALH5FileWriteREAL8Vector(file, "grid", v) == 0, XLAL_EFUNC);
+    XLALDestroyREAL8Vector(v);
+
+    XLAL_CHECK((group = XLALH5GroupOpen(file, "sub1")) != NULL, XLAL_EFUNC);
+    v = create_vector(4, -3.0);
+    a = create_matrix(3, 5, 10.0);
+    XLAL_CHECK(XLALH5FileWriteREAL8Vector(group, "Amp_ciall", v) == 0, XLAL_EFUNC);
+    XLAL_CHECK(XLALH5FileWriteREAL8Array(group, "Bamp", a) == 0, XLAL_EFUNC);
+    XLALDestroyREAL8Vector(v);
+    XLALDestroyREAL8Array(a);
+    XLALH5FileClose(group);
+
+    XLAL_CHECK((group = XLALH5GroupOpen(file, "sub2")) != NULL, XLAL_EFUNC);
+    v = create_vector(3, 1.0);
+    a = create_matrix(2, 2, -7.0);
+    XLAL_CHECK(XLALH5FileWriteREAL8Vector(group, "chi1vec", v) == 0, XLAL_EFUNC);
+    XLAL_CHECK(XLALH5FileWriteREAL8Array(group, "Bamp", a) == 0, XLAL_EFUNC);
+    XLALDestroyREAL8Vector(v);
+    XLALDestroyREAL8Array(a);
+    XLALH5FileClose(group);
+
+    XLALH5FileClose(file);
+    return XLAL_SUCCESS;
+}
+
+/* write a corrupted copy of the mapped file; bytes [start, start + n) of
+ * the copy are replaced by those of 'patch', and the copy is truncated to
+ * 'length' bytes if it is not zero */
+static int write_corrupt(const char *fname, const char *buf, size_t size, size_t length, size_t start, const void *patch, size_t n)
+{
+    char *copy = malloc(size);
+    FILE *fp;
+    XLAL_CHECK(copy != NULL, XLAL_ENOMEM);
+    memcpy(copy, buf, size);
+    if (n > 0)
+        memcpy(copy + start, patch, n);
+    if (length > 0)
+        size = length;
+    fp = fopen(fname, "wb");
+    if (fp == NULL || fwrite(copy, 1, size, fp) != size) {
+        free(copy);
+        if (fp)
+            fclose(fp);
+        XLAL_ERROR(XLAL_EIO, "Could not write %s", fname);
+    }
+    fclose(fp);
+    free(copy);
+    return XLAL_SUCCESS;
+}
+
+/* check that ROM data opened under 'fname' are not used */
+static int check_rejected(const char *fname)
+{
+    LALSimROMData *rom;
+    int errnum;
+    XLAL_TRY_SILENT(rom = XLALSimROMDataOpen(fname), errnum);
+    XLAL_CHECK(rom == NULL || !XLALSimROMDataIsMapped(rom), XLAL_EFAILED, "Corrupt mapped ROM data %s were accepted", fname);
+    return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+    LALSimROMData *h5, *map;
+    char *buf;
+    size_t size;
+    FILE *fp;
+    int errnum;
+
+    /* convert a small HDF5 file */
+    XLAL_CHECK_MAIN(write_hdf5() == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(XLALSimROMDataConvert(MAPNAME, H5NAME) == XLAL_SUCCESS, XLAL_EFUNC);
+
+    h5 = XLALSimROMDataOpen(H5NAME);
+    XLAL_CHECK_MAIN(h5 != NULL, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(!XLALSimROMDataIsMapped(h5), XLAL_EFAILED, "%s should be read from HDF5", H5NAME);
+    map = XLALSimROMDataOpen("./ROMDataTestMapped.hdf5");
+    XLAL_CHECK_MAIN(map != NULL, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(XLALSimROMDataIsMapped(map), XLAL_EFAILED, "%s should be mapped", MAPNAME);
+    XLAL_CHECK_MAIN(XLALSimROMDataOpen(H5NAME) == h5, XLAL_EFAILED, "ROM data were not shared");
+
+    /* compare datasets */
+    for (size_t i = 0; i < XLAL_NUM_ELEM(vectors); ++i) {
+        size_t n_h5, n_map;
+        const REAL8 *v_h5 = XLALSimROMDataGetREAL8Vector(&n_h5, h5, vectors[i]);
+        const REAL8 *v_map = XLALSimROMDataGetREAL8Vector(&n_map, map, vectors[i]);
+        XLAL_CHECK_MAIN(v_h5 != NULL && v_map != NULL, XLAL_EFUNC);
+        XLAL_CHECK_MAIN(((uintptr_t)v_map) % 64 == 0, XLAL_EFAILED, "Mapped dataset `%s' is not aligned", vectors[i]);
+        XLAL_CHECK_MAIN(n_h5 == n_map && memcmp(v_h5, v_map, n_h5 * sizeof(*v_h5)) == 0, XLAL_EFAILED, "Dataset `%s' differs", vectors[i]);
+    }
+    for (size_t i = 0; i < XLAL_NUM_ELEM(matrices); ++i) {
+        size_t rows_h5, cols_h5, rows_map, cols_map;
+        const REAL8 *m_h5 = XLALSimROMDataGetREAL8Matrix(&rows_h5, &cols_h5, h5, matrices[i]);
+        const REAL8 *m_map = XLALSimROMDataGetREAL8Matrix(&rows_map, &cols_map, map, matrices[i]);
+        XLAL_CHECK_MAIN(m_h5 != NULL && m_map != NULL, XLAL_EFUNC);
+        XLAL_CHECK_MAIN(((uintptr_t)m_map) % 64 == 0, XLAL_EFAILED, "Mapped dataset `%s' is not aligned", matrices[i]);
+        XLAL_CHECK_MAIN(rows_h5 == rows_map && cols_h5 == cols_map
+                        && memcmp(m_h5, m_map, rows_h5 * cols_h5 * sizeof(*m_h5)) == 0, XLAL_EFAILED, "Dataset `%s' differs", matrices[i]);
+    }
+    {
+        size_t n;
+        const REAL8 *v;
+        XLAL_TRY_SILENT(v = XLALSimROMDataGetREAL8Vector(&n, h5, "sub1/missing"), errnum);
+        XLAL_CHECK_MAIN(v == NULL && errnum != 0, XLAL_EFAILED, "Missing dataset found in HDF5");
+        XLAL_TRY_SILENT(v = XLALSimROMDataGetREAL8Vector(&n, map, "sub1/missing"), errnum);
+        XLAL_CHECK_MAIN(v == NULL && errnum != 0, XLAL_EFAILED, "Missing dataset found in mapped file");
+    }
+
+    /* compare attributes; only numerical ones are available */
+    for (size_t i = 0; i < XLAL_NUM_ELEM(attributes); ++i) {
+        REAL8 value_h5 = 0, value_map = 0;
+        int status_h5, status_map;
+        XLAL_TRY_SILENT(status_h5 = XLALSimROMDataQueryAttribute(&value_h5, h5, attributes[i]), errnum);
+        XLAL_TRY_SILENT(status_map = XLALSimROMDataQueryAttribute(&value_map, map, attributes[i]), errnum);
+        XLAL_CHECK_MAIN(status_h5 == status_map && value_h5 == value_map, XLAL_EFAILED, "Attribute `%s' differs", attributes[i]);
+        XLAL_CHECK_MAIN((status_h5 == XLAL_SUCCESS) == (i < 3), XLAL_EFAILED, "Attribute `%s' wrongly %s", attributes[i], i < 3 ? "missing" : "found");
+    }
+
+    /* read the mapped file */
+    fp = fopen(MAPNAME, "rb");
+    XLAL_CHECK_MAIN(fp != NULL, XLAL_EIO);
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    rewind(fp);
+    buf = malloc(size);
+    XLAL_CHECK_MAIN(buf != NULL && fread(buf, 1, size, fp) == size, XLAL_EIO);
+    fclose(fp);
+    XLAL_CHECK_MAIN(size > MAP_HEADER_SIZE + 2 * MAP_ENTRY_SIZE, XLAL_EFAILED, "Mapped file too short");
+
+    /* corrupt files must not be mapped; there are no HDF5 files to fall back on */
+    {
+        const UINT4 byteorder = 0x04030201;
+        char entries[2 * MAP_ENTRY_SIZE];
+        memcpy(entries, buf + MAP_HEADER_SIZE + MAP_ENTRY_SIZE, MAP_ENTRY_SIZE);
+        memcpy(entries + MAP_ENTRY_SIZE, buf + MAP_HEADER_SIZE, MAP_ENTRY_SIZE);
+        XLAL_CHECK_MAIN(write_corrupt("./ROMDataTestMagic.lalrom", buf, size, 0, 0, "LALROMD0", 8) == XLAL_SUCCESS, XLAL_EFUNC);
+        XLAL_CHECK_MAIN(write_corrupt("./ROMDataTestByteOrder.lalrom", buf, size, 0, MAP_BYTEORDER_OFFSET, &byteorder, sizeof(byteorder)) == XLAL_SUCCESS, XLAL_EFUNC);
+        XLAL_CHECK_MAIN(write_corrupt("./ROMDataTestTruncated.lalrom", buf, size, size - 8, 0, NULL, 0) == XLAL_SUCCESS, XLAL_EFUNC);
+        XLAL_CHECK_MAIN(write_corrupt("./ROMDataTestUnsorted.lalrom", buf, size, 0, MAP_HEADER_SIZE, entries, sizeof(entries)) == XLAL_SUCCESS, XLAL_EFUNC);
+    }
+    free(buf);
+    XLAL_CHECK_MAIN(check_rejected("./ROMDataTestMagic.hdf5") == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(check_rejected("./ROMDataTestByteOrder.hdf5") == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(check_rejected("./ROMDataTestTruncated.hdf5") == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(check_rejected("./ROMDataTestUnsorted.hdf5") == XLAL_SUCCESS, XLAL_EFUNC);
+
+    LALCheckMemoryLeaks();
+    fprintf(stdout, "PASSED: mapped ROM data agree with HDF5, and corrupt files are rejected\n");
+    return 0;
+}
+
+#endif
@@ -0,0 +1,166 @@
+/*
+ *  Copyright (C) 2026 agent
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check the workspace-free cubic B-spline evaluation of the SEOBNR
+ * ROMs, ROM_cubic_bspline_nonzero() and ROM_TP_spline_eval_3d(), against
+ * gsl_bspline_eval_nonzero() and Interpolate_Coefficent_Tensor()
+ */
+
+#ifdef __GNUC__
+#define UNUSED __attribute__ ((unused))
+#else
+#define UNUSED
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <stdbool.h>
+
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_bspline.h>
+#include <gsl/gsl_vector.h>
+#include <lal/LALStdlib.h>
+#include <lal/XLALError.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimIMR.h>
+
+#include "../lib/LALSimIMRSEOBNRROMUtilities.c"
+
+/* Absolute tolerance on basis functions, and relative to the largest coefficient on interpolated values */
+#define TOL 1e-12
+
+/* Nonuniform breakpoints, including the minimal case of a single interval */
+static const double xbreak[] = { 0.1, 0.15, 0.2, 0.22, 0.24, 0.25 };
+static const double ybreak[] = { -1.0, -0.3, 0.5, 0.99 };
+static const double zbreak[] = { -1.0, 1.0 };
+
+#define NXBREAK XLAL_NUM_ELEM(xbreak)
+#define NYBREAK XLAL_NUM_ELEM(ybreak)
+#define NZBREAK XLAL_NUM_ELEM(zbreak)
+
+/* Test points: every breakpoint, including both domain ends, and two points inside each interval */
+static size_t test_points(double *x, const double *breakpts, size_t nbreak)
+{
+  size_t n = 0;
+  for (size_t i = 0; i + 1 < nbreak; i++) {
+    const double h = breakpts[i + 1] - breakpts[i];
+    x[n++] = breakpts[i];
+    x[n++] = breakpts[i] + h / 3.0;
+    x[n++] = breakpts[i] + 0.5 * h;
+  }
+  x[n++] = breakpts[nbreak - 1];
+  return n;
+}
+
+static gsl_bspline_workspace *create_bspline(const double *breakpts, size_t nbreak)
+{
+  gsl_bspline_workspace *bw = gsl_bspline_alloc(4, nbreak);
+  gsl_vector_const_view bv = gsl_vector_const_view_array(breakpts, nbreak);
+  gsl_bspline_knots(&bv.vector, bw);
+  return bw;
+}
+
+static int check_nonzero(const char *name, const double *breakpts, size_t nbreak)
+{
+  gsl_bspline_workspace *bw = create_bspline(breakpts, nbreak);
+  gsl_vector *B4 = gsl_vector_alloc(4);
+  double x[3 * nbreak];
+  const size_t nx = test_points(x, breakpts, nbreak);
+
+  for (size_t n = 0; n < nx; n++) {
+    size_t is, ie, is_gsl;
+    REAL8 B[4];
+    gsl_bspline_eval_nonzero(x[n], B4, &is_gsl, &ie, bw);
+    XLAL_CHECK(ROM_cubic_bspline_nonzero(B, &is, x[n], breakpts, nbreak) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK(is == is_gsl, XLAL_EFAILED, "%s = %g: first nonzero basis function %zu, GSL has %zu", name, x[n], is, is_gsl);
+    for (size_t i = 0; i < 4; i++)
+      XLAL_CHECK(fabs(B[i] - gsl_vector_get(B4, i)) < TOL, XLAL_EFAILED, "%s = %g: basis function %zu is %.16g, GSL has %.16g", name, x[n], is + i, B[i], gsl_vector_get(B4, i));
+  }
+
+  /* Points just outside the domain must be rejected */
+  const double h = breakpts[nbreak - 1] - breakpts[0];
+  const double outside[] = { breakpts[0] - 1e-9 * h, breakpts[nbreak - 1] + 1e-9 * h };
+  for (size_t n = 0; n < XLAL_NUM_ELEM(outside); n++) {
+    size_t is;
+    REAL8 B[4];
+    int errnum;
+    XLAL_TRY_SILENT(ROM_cubic_bspline_nonzero(B, &is, outside[n], breakpts, nbreak), errnum);
+    XLAL_CHECK(errnum == XLAL_EDOM, XLAL_EFAILED, "%s = %g outside the domain was not rejected", name, outside[n]);
+  }
+
+  gsl_vector_free(B4);
+  gsl_bspline_free(bw);
+
+  fprintf(stdout, "%s: %zu basis function evaluations agree with GSL\n", name, nx);
+  return XLAL_SUCCESS;
+}
+
+static int check_tensor(void)
+{
+  const int ncx = NXBREAK + 2, ncy = NYBREAK + 2, ncz = NZBREAK + 2;
+  gsl_bspline_workspace *bwx = create_bspline(xbreak, NXBREAK);
+  gsl_bspline_workspace *bwy = create_bspline(ybreak, NYBREAK);
+  gsl_bspline_workspace *bwz = create_bspline(zbreak, NZBREAK);
+
+  gsl_vector *c = gsl_vector_alloc(ncx * ncy * ncz);
+  double cmax = 0;
+  for (size_t i = 0; i < c->size; i++) {
+    gsl_vector_set(c, i, sin(1.3 * i) + 0.1 * i);
+    cmax = fmax(cmax, fabs(gsl_vector_get(c, i)));
+  }
+
+  double x[3 * NXBREAK], y[3 * NYBREAK], z[3 * NZBREAK];
+  const size_t nx = test_points(x, xbreak, NXBREAK);
+  const size_t ny = test_points(y, ybreak, NYBREAK);
+  const size_t nz = test_points(z, zbreak, NZBREAK);
+
+  for (size_t i = 0; i < nx; i++)
+    for (size_t j = 0; j < ny; j++)
+      for (size_t k = 0; k < nz; k++) {
+        ROMTPSplineWeights3D w;
+        XLAL_CHECK(ROM_TP_spline_weights_3d(&w, x[i], y[j], z[k], xbreak, ybreak, zbreak, ncx, ncy, ncz) == XLAL_SUCCESS, XLAL_EFUNC);
+        const REAL8 value = ROM_TP_spline_eval_3d(&w, c->data);
+        const REAL8 value_gsl = Interpolate_Coefficent_Tensor(c, x[i], y[j], z[k], ncy, ncz, bwx, bwy, bwz);
+        XLAL_CHECK(fabs(value - value_gsl) < TOL * cmax, XLAL_EFAILED, "(%g, %g, %g): interpolated value %.16g, GSL has %.16g", x[i], y[j], z[k], value, value_gsl);
+      }
+
+  gsl_vector_free(c);
+  gsl_bspline_free(bwx);
+  gsl_bspline_free(bwy);
+  gsl_bspline_free(bwz);
+
+  fprintf(stdout, "tensor: %zu interpolated values agree with GSL\n", nx * ny * nz);
+  return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+  XLAL_CHECK_MAIN(check_nonzero("x", xbreak, NXBREAK) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(check_nonzero("y", ybreak, NYBREAK) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(check_nonzero("z", zbreak, NZBREAK) == XLAL_SUCCESS, XLAL_EFUNC);
+  XLAL_CHECK_MAIN(check_tensor() == XLAL_SUCCESS, XLAL_EFUNC);
+
+  LALCheckMemoryLeaks();
+
+  return 0;
+}
@@ -30,12 +30,20 @@
 #include <lal/FrequencySeries.h>
 #include <time.h>
 #include <lal/LALConstants.h>
+#include <lal/LALStdio.h>
+#include <lal/FileIO.h>
+
+/* Tolerance on the largest difference between cached and generated
+ * waveforms, relative to the peak amplitude */
+#define RTOL 1e-10
 
 int main(void) {
     clock_t s1, e1, s2, e2;
     double diff1, diff2;
-    unsigned int i;
-    REAL8 plusdiff, crossdiff, temp;
+    unsigned int i, i2;
+    size_t j;
+    UINT8 hits, misses;
+    REAL8 plusdiff, crossdiff, peak, temp;
     REAL8TimeSeries *hplus = NULL;
     REAL8TimeSeries *hcross = NULL;
     REAL8TimeSeries *hplusC = NULL;
@@ -44,17 +52,19 @@ int main(void) {
     COMPLEX16FrequencySeries *hctilde = NULL;
     COMPLEX16FrequencySeries *hptildeC = NULL;
     COMPLEX16FrequencySeries *hctildeC = NULL;
-    REAL8 m1 = 10. * LAL_MSUN_SI, m2 = 10 * LAL_MSUN_SI;
+    REAL8 m1 = 10. * LAL_MSUN_SI, m2 = 10 * LAL_MSUN_SI, m1b = 12. * LAL_MSUN_SI;
     REAL8 s1x = 0., s1y = 0., s1z = 0., s2x = 0., s2y = 0., s2z = 0.;
     REAL8 f_min = 40., f_ref = 0., lambda1 = 0., lambda2 = 0.i, f_max = 0.;
     REAL8 dt = 1./16384., df = 1./16.;
     int ret, phaseO = 7, ampO = 0;
     Approximant approx = SEOBNRv1;
     Approximant approxFD = TaylorF2;
+    const Approximant approxGen[] = {IMRPhenomXHM, SEOBNRv4HM_ROM};
     REAL8 phiref1 = 0., phiref2 = 0.3;
     REAL8 inc1 = 0.2, inc2 = 1.3;
     REAL8 dist1 = 1.e6 * LAL_PC_SI, dist2 = 2.e6 * LAL_PC_SI;
     LALSimInspiralWaveformCache *cache = XLALCreateSimInspiralWaveformCache();
+    LALSimInspiralGenerator *generator = NULL;
     LALDict *LALpars=XLALCreateDict();
     XLALSimInspiralWaveformParamsInsertTidalLambda1(LALpars,lambda1);
     XLALSimInspiralWaveformParamsInsertTidalLambda1(LALpars,lambda2);
@@ -88,9 +98,10 @@ int main(void) {
         XLAL_ERROR(XLAL_EFUNC);
 
     // Find level of agreement
-    plusdiff = crossdiff = 0.;
+    plusdiff = crossdiff = peak = 0.;
     for(i=0; i < hplus->data->length; i++)
     {
+        if(fabs(hplus->data->data[i]) > peak) peak = fabs(hplus->data->data[i]);
         temp = fabs(hplus->data->data[i] - hplusC->data->data[i]);
         if(temp > plusdiff) plusdiff = temp;
         temp = fabs(hcross->data->data[i] - hcrossC->data->data[i]);
@@ -102,6 +113,8 @@ int main(void) {
     printf("ChooseTDWaveformFromCache took %f seconds\n", diff2);
     printf("Largest difference in plus polarization is: %.16g\n", plusdiff);
     printf("Largest difference in cross polarization is: %.16g\n\n", crossdiff);
+    if( !(plusdiff <= RTOL * peak) || !(crossdiff <= RTOL * peak) )
+        XLAL_ERROR(XLAL_EFAILED, "Cached polarizations differ from generated ones");
 
     XLALDestroyREAL8TimeSeries(hplus);
     XLALDestroyREAL8TimeSeries(hcross);
@@ -133,9 +146,10 @@ int main(void) {
         XLAL_ERROR(XLAL_EFUNC);
 
     // Find level of agreement
-    plusdiff = crossdiff = 0.;
+    plusdiff = crossdiff = peak = 0.;
     for(i=0; i < hplus->data->length; i++)
     {
+        if(fabs(hplus->data->data[i]) > peak) peak = fabs(hplus->data->data[i]);
         temp = fabs(hplus->data->data[i] - hplusC->data->data[i]);
         if(temp > plusdiff) plusdiff = temp;
         temp = fabs(hcross->data->data[i] - hcrossC->data->data[i]);
@@ -147,6 +161,8 @@ int main(void) {
     printf("ChooseTDWaveformFromCache took %f seconds\n", diff2);
     printf("Largest difference in plus polarization is: %.16g\n", plusdiff);
     printf("Largest difference in cross polarization is: %.16g\n\n", crossdiff);
+    if( !(plusdiff <= RTOL * peak) || !(crossdiff <= RTOL * peak) )
+        XLAL_ERROR(XLAL_EFAILED, "Cached polarizations differ from generated ones");
 
     XLALDestroyREAL8TimeSeries(hplus);
     XLALDestroyREAL8TimeSeries(hcross);
@@ -182,9 +198,10 @@ int main(void) {
         XLAL_ERROR(XLAL_EFUNC);
 
     // Find level of agreement
-    plusdiff = crossdiff = 0.;
+    plusdiff = crossdiff = peak = 0.;
     for(i=0; i < hptilde->data->length; i++)
     {
+        if(cabs(hptilde->data->data[i]) > peak) peak = cabs(hptilde->data->data[i]);
         temp = cabs(hptilde->data->data[i] - hptildeC->data->data[i]);
         if(temp > plusdiff) plusdiff = temp;
         temp = cabs(hctilde->data->data[i] - hctildeC->data->data[i]);
@@ -196,6 +213,8 @@ int main(void) {
     printf("ChooseFDWaveformFromCache took %f seconds\n", diff2);
     printf("Largest difference in plus polarization is: %.16g\n", plusdiff);
     printf("Largest difference in cross polarization is: %.16g\n\n", crossdiff);
+    if( !(plusdiff <= RTOL * peak) || !(crossdiff <= RTOL * peak) )
+        XLAL_ERROR(XLAL_EFAILED, "Cached polarizations differ from generated ones");
 
     XLALDestroyCOMPLEX16FrequencySeries(hptilde);
     XLALDestroyCOMPLEX16FrequencySeries(hctilde);
@@ -221,16 +240,16 @@ int main(void) {
     ret = XLALSimInspiralChooseFDWaveformFromCache(&hptildeC, &hctildeC,
             phiref2, df, m1, m2, s1x, s1y, s1z, s2x, s2y, s2z, f_min, f_max,
             f_ref, dist2, inc2, LALpars, approxFD, cache, NULL);
-    XLALDestroyDict(LALpars);
     e2 = clock();
     diff2 = (double) (e2 - s2) / CLOCKS_PER_SEC;
     if( ret == XLAL_FAILURE )
         XLAL_ERROR(XLAL_EFUNC);
 
     // Find level of agreement
-    plusdiff = crossdiff = 0.;
+    plusdiff = crossdiff = peak = 0.;
     for(i=0; i < hptilde->data->length; i++)
     {
+        if(cabs(hptilde->data->data[i]) > peak) peak = cabs(hptilde->data->data[i]);
         temp = cabs(hptilde->data->data[i] - hptildeC->data->data[i]);
         if(temp > plusdiff) plusdiff = temp;
         temp = cabs(hctilde->data->data[i] - hctildeC->data->data[i]);
@@ -242,6 +261,8 @@ int main(void) {
     printf("ChooseFDWaveformFromCache took %f seconds\n", diff2);
     printf("Largest difference in plus polarization is: %.16g\n", plusdiff);
     printf("Largest difference in cross polarization is: %.16g\n\n", crossdiff);
+    if( !(plusdiff <= RTOL * peak) || !(crossdiff <= RTOL * peak) )
+        XLAL_ERROR(XLAL_EFAILED, "Cached polarizations differ from generated ones");
 
     XLALDestroyCOMPLEX16FrequencySeries(hptilde);
     XLALDestroyCOMPLEX16FrequencySeries(hctilde);
@@ -249,6 +270,193 @@ int main(void) {
     XLALDestroyCOMPLEX16FrequencySeries(hctildeC);
     hptilde = hctilde = hptildeC = hctildeC = NULL;
 
+    //
+    // Test that interleaved requests are served from the cache
+    //
+
+    // Alternate between two sets of intrinsic parameters, changing the
+    // distance each time; only the first request for the new masses
+    // should generate a waveform
+    hits = cache->hits;
+    misses = cache->misses;
+    for(i=0; i < 4; i++)
+    {
+        ret = XLALSimInspiralChooseFDWaveformFromCache(&hptildeC, &hctildeC,
+                phiref1, df, (i % 2 ? m1b : m1), m2, s1x, s1y, s1z, s2x, s2y, s2z,
+                f_min, f_max, f_ref, (i + 1) * dist1, inc1, LALpars, approxFD,
+                cache, NULL);
+        if( ret == XLAL_FAILURE )
+            XLAL_ERROR(XLAL_EFUNC);
+        XLALDestroyCOMPLEX16FrequencySeries(hptildeC);
+        XLALDestroyCOMPLEX16FrequencySeries(hctildeC);
+        hptildeC = hctildeC = NULL;
+    }
+    printf("Interleaving requests for two sets of intrinsic parameters...\n");
+    printf("Cache hits: %" LAL_UINT8_FORMAT ", misses: %" LAL_UINT8_FORMAT ", stored waveforms: %zu\n\n",
+            cache->hits - hits, cache->misses - misses, cache->numEntries);
+    if( cache->hits - hits != 3 || cache->misses - misses != 1 )
+        XLAL_ERROR(XLAL_EFAILED, "Interleaved requests were not served from the cache");
+
+    // A NULL LALDict and an empty one give the same waveform, so the
+    // second request should be served from the cache
+    LALDict *emptyPars = XLALCreateDict();
+    hits = cache->hits;
+    misses = cache->misses;
+    for(i=0; i < 2; i++)
+    {
+        ret = XLALSimInspiralChooseFDWaveformFromCache(&hptildeC, &hctildeC,
+                phiref1, df, m1, m2, s1x, s1y, s1z, s2x, s2y, s2z,
+                f_min, f_max, f_ref, dist1, inc1, (i ? emptyPars : NULL), approxFD,
+                cache, NULL);
+        if( ret == XLAL_FAILURE )
+            XLAL_ERROR(XLAL_EFUNC);
+        XLALDestroyCOMPLEX16FrequencySeries(hptildeC);
+        XLALDestroyCOMPLEX16FrequencySeries(hctildeC);
+        hptildeC = hctildeC = NULL;
+    }
+    XLALDestroyDict(emptyPars);
+    if( cache->hits - hits != 1 || cache->misses - misses != 1 )
+        XLAL_ERROR(XLAL_EFAILED, "Requests with a NULL and an empty LALDict were not served from the same cache entry");
+
+    // A cache limited to one waveform must regenerate every time
+    if( XLALSetSimInspiralWaveformCacheLimits(cache, 1, 0) != XLAL_SUCCESS )
+        XLAL_ERROR(XLAL_EFUNC);
+    if( cache->numEntries != 1 )
+        XLAL_ERROR(XLAL_EFAILED, "Cache not reduced to its limit");
+    misses = cache->misses;
+    for(i=0; i < 4; i++)
+    {
+        ret = XLALSimInspiralChooseFDWaveformFromCache(&hptildeC, &hctildeC,
+                phiref1, df, (i % 2 ? m1 : m1b), m2, s1x, s1y, s1z, s2x, s2y, s2z,
+                f_min, f_max, f_ref, dist1, inc1, LALpars, approxFD,
+                cache, NULL);
+        if( ret == XLAL_FAILURE )
+            XLAL_ERROR(XLAL_EFUNC);
+        XLALDestroyCOMPLEX16FrequencySeries(hptildeC);
+        XLALDestroyCOMPLEX16FrequencySeries(hctildeC);
+        hptildeC = hctildeC = NULL;
+    }
+    if( cache->misses - misses != 4 )
+        XLAL_ERROR(XLAL_EFAILED, "Cache exceeded its limit");
+
+    //
+    // Test generator path with IMRPhenomXHM, whose modes depend on the
+    // reference phase so that its polarizations are cached, and with
+    // SEOBNRv4HM_ROM, whose modes are cached and recombined for each
+    // inclination and reference phase if its data file is available
+    //
+
+    if( XLALSetSimInspiralWaveformCacheLimits(cache, 16, 0) != XLAL_SUCCESS )
+        XLAL_ERROR(XLAL_EFUNC);
+    for(j=0; j < XLAL_NUM_ELEM(approxGen); j++)
+    {
+        int recombine = approxGen[j] != IMRPhenomXHM;
+        if( recombine ) {
+            char *path = XLALFileResolvePath("SEOBNRv4HMROM.hdf5");
+            if( path == NULL ) {
+                printf("SEOBNRv4HMROM.hdf5 not found in $LAL_DATA_PATH; skipping recombination of cached modes\n\n");
+                continue;
+            }
+            XLALFree(path);
+        }
+        generator = XLALSimInspiralChooseGenerator(approxGen[j], NULL);
+        if( generator == NULL )
+            XLAL_ERROR(XLAL_EFUNC);
+        hits = cache->hits;
+        misses = cache->misses;
+        for(i=0; i < 2; i++)
+        {
+            LALDict *params = XLALCreateDict();
+            XLALSimInspiralWaveformParamsInsertMass1(params, m1);
+            XLALSimInspiralWaveformParamsInsertMass2(params, m2);
+            XLALSimInspiralWaveformParamsInsertDistance(params, i ? dist2 : dist1);
+            XLALSimInspiralWaveformParamsInsertInclination(params, i ? inc2 : inc1);
+            XLALSimInspiralWaveformParamsInsertRefPhase(params, i ? phiref2 : phiref1);
+            XLALSimInspiralWaveformParamsInsertDeltaF(params, df);
+            XLALSimInspiralWaveformParamsInsertF22Start(params, f_min);
+            XLALSimInspiralWaveformParamsInsertF22Ref(params, f_min);
+
+            s1 = clock();
+            ret = XLALSimInspiralGenerateFDWaveform(&hptilde, &hctilde, params, generator);
+            e1 = clock();
+            diff1 = (double) (e1 - s1) / CLOCKS_PER_SEC;
+            if( ret == XLAL_FAILURE )
+                XLAL_ERROR(XLAL_EFUNC);
+
+            s2 = clock();
+            ret = XLALSimInspiralGenerateFDWaveformFromCache(&hptildeC, &hctildeC, params, generator, cache);
+            e2 = clock();
+            diff2 = (double) (e2 - s2) / CLOCKS_PER_SEC;
+            if( ret == XLAL_FAILURE )
+                XLAL_ERROR(XLAL_EFUNC);
+
+            // Find level of agreement, relative to the peak amplitude
+            plusdiff = crossdiff = temp = 0.;
+            for(i2=0; i2 < hptilde->data->length && i2 < hptildeC->data->length; i2++)
+            {
+                if(cabs(hptilde->data->data[i2]) > temp) temp = cabs(hptilde->data->data[i2]);
+                if(cabs(hptilde->data->data[i2] - hptildeC->data->data[i2]) > plusdiff)
+                    plusdiff = cabs(hptilde->data->data[i2] - hptildeC->data->data[i2]);
+                if(cabs(hctilde->data->data[i2] - hctildeC->data->data[i2]) > crossdiff)
+                    crossdiff = cabs(hctilde->data->data[i2] - hctildeC->data->data[i2]);
+            }
+            printf("Comparing %s waveforms from GenerateFDWaveform and GenerateFDWaveformFromCache\n",
+                    XLALSimInspiralGeneratorName(generator));
+            printf(i == 0 ? "when both must be generated from scratch...\n"
+                    : recombine ? "when the latter is recombined from cached modes...\n"
+                    : "when the inclination and phase change...\n");
+            printf("GenerateFDWaveform took %f seconds\n", diff1);
+            printf("GenerateFDWaveformFromCache took %f seconds\n", diff2);
+            printf("Largest relative difference in plus polarization is: %.16g\n", plusdiff / temp);
+            printf("Largest relative difference in cross polarization is: %.16g\n\n", crossdiff / temp);
+            if( hptilde->data->length != hptildeC->data->length || !(plusdiff <= RTOL * temp) || !(crossdiff <= RTOL * temp) )
+                XLAL_ERROR(XLAL_EFAILED, "Cached %s polarizations differ from generated ones at inclination %g, phase %g",
+                        XLALSimInspiralGeneratorName(generator), i ? inc2 : inc1, i ? phiref2 : phiref1);
+
+            XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+            XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+            XLALDestroyCOMPLEX16FrequencySeries(hptildeC);
+            XLALDestroyCOMPLEX16FrequencySeries(hctildeC);
+            hptilde = hctilde = hptildeC = hctildeC = NULL;
+            XLALDestroyDict(params);
+        }
+        if( recombine && (cache->hits - hits != 1 || cache->misses - misses != 1) )
+            XLAL_ERROR(XLAL_EFAILED, "Change of inclination and phase was not served from cached modes");
+        if( !recombine && (cache->hits - hits != 0 || cache->misses - misses != 2) )
+            XLAL_ERROR(XLAL_EFAILED, "Change of inclination and phase was served from cached modes");
+
+        // Entries are keyed on the generator instance, so a new generator,
+        // possibly at the address of the destroyed one, does not reuse them
+        XLALDestroySimInspiralGenerator(generator);
+        generator = XLALSimInspiralChooseGenerator(approxGen[j], NULL);
+        if( generator == NULL )
+            XLAL_ERROR(XLAL_EFUNC);
+        {
+            LALDict *params = XLALCreateDict();
+            XLALSimInspiralWaveformParamsInsertMass1(params, m1);
+            XLALSimInspiralWaveformParamsInsertMass2(params, m2);
+            XLALSimInspiralWaveformParamsInsertDistance(params, dist2);
+            XLALSimInspiralWaveformParamsInsertInclination(params, inc2);
+            XLALSimInspiralWaveformParamsInsertRefPhase(params, phiref2);
+            XLALSimInspiralWaveformParamsInsertDeltaF(params, df);
+            XLALSimInspiralWaveformParamsInsertF22Start(params, f_min);
+            XLALSimInspiralWaveformParamsInsertF22Ref(params, f_min);
+            misses = cache->misses;
+            ret = XLALSimInspiralGenerateFDWaveformFromCache(&hptildeC, &hctildeC, params, generator, cache);
+            if( ret == XLAL_FAILURE )
+                XLAL_ERROR(XLAL_EFUNC);
+            if( cache->misses - misses != 1 )
+                XLAL_ERROR(XLAL_EFAILED, "Entries of a destroyed generator were reused for a new one");
+            XLALDestroyCOMPLEX16FrequencySeries(hptildeC);
+            XLALDestroyCOMPLEX16FrequencySeries(hctildeC);
+            hptildeC = hctildeC = NULL;
+            XLALDestroyDict(params);
+        }
+        XLALDestroySimInspiralGenerator(generator);
+        generator = NULL;
+    }
+
+    XLALDestroyDict(LALpars);
     XLALDestroySimInspiralWaveformCache(cache);
     LALCheckMemoryLeaks();
 
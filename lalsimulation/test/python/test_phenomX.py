@@ -477,6 +477,52 @@ def test_IMRPhenomXP_NRTidalv2_SpinTaylor():
 
     np.testing.assert_allclose(new_result, expected_result, rtol=1e-6, err_msg="IMRPhenomXP_NRTidalv2 test failed")
 
+def test_IMRPhenomXHM_batch():
+    """
+    This test checks that evaluating IMRPhenomXHM modes for a batch of parameter
+    points agrees with evaluating each point separately.
+    """
+
+    freqs = lal.CreateREAL8Sequence(64)
+    freqs.data = np.linspace(20., 512., freqs.length)
+
+    npoints = 3
+    m1 = lal.CreateREAL8Vector(npoints)
+    m2 = lal.CreateREAL8Vector(npoints)
+    chi1 = lal.CreateREAL8Vector(npoints)
+    chi2 = lal.CreateREAL8Vector(npoints)
+    m1.data = np.array([50., 40., 25.]) * lal.MSUN_SI
+    m2.data = np.array([30., 10., 20.]) * lal.MSUN_SI
+    chi1.data = np.array([0.1, -0.4, 0.7])
+    chi2.data = np.array([-0.2, 0.3, 0.0])
+
+    for ell, emm in [[2, 2], [2, -2], [3, -3], [2, 1]]:
+        batch = lalsimulation.SimIMRPhenomXHMFrequencySequenceOneModeBatch(freqs, m1, m2, chi1, chi2, ell, emm, 1e6*lal.PC_SI, 0., 20., None)
+        for i in range(npoints):
+            single = lalsimulation.SimIMRPhenomXHMFrequencySequenceOneMode(freqs, m1.data[i], m2.data[i], chi1.data[i], chi2.data[i], ell, emm, 1e6*lal.PC_SI, 0., 20., None)
+            np.testing.assert_allclose(batch.data[i], single.data.data, rtol=1e-12, err_msg="IMRPhenomXHM batch test failed for mode ({},{})".format(ell, emm))
+
+def test_IMRPhenomXHM_parallel_modes():
+    """
+    This test checks that generating the modes of IMRPhenomXHM and IMRPhenomXPHM in
+    parallel (ParallelHM=3) gives bit-identical polarizations to the serial
+    generation (ParallelHM=0), with and without multibanding.
+    """
+
+    for approximant, spin1x in [[lalsimulation.IMRPhenomXHM, 0.], [lalsimulation.IMRPhenomXPHM, 0.4]]:
+        for thresholdMband in [0., 1e-3]:
+            hphc = []
+            for parallel in [0, 3]:
+                lalparams = lal.CreateDict()
+                lalsimulation.SimInspiralWaveformParamsInsertPhenomXHMThresholdMband(lalparams, thresholdMband)
+                lalsimulation.SimInspiralWaveformParamsInsertPhenomXHMParallel(lalparams, parallel)
+                hphc.append(lalsimulation.SimInspiralChooseFDWaveform(50*lal.MSUN_SI, 30*lal.MSUN_SI, spin1x, 0., 0.3, 0., 0., -0.2,
+                                                                      1e6*lal.PC_SI, np.pi/3., 0.4, 0., 0., 0., 1./4., 20., 512., 20.,
+                                                                      lalparams, approximant))
+            for i in range(2):
+                np.testing.assert_array_equal(hphc[0][i].data.data, hphc[1][i].data.data,
+                    err_msg="{} parallel modes test failed for ThresholdMband = {}".format(lalsimulation.GetStringFromApproximant(approximant), thresholdMband))
+
 # -- run the tests ------------------------------
 
 if __name__ == '__main__':